@@ -0,0 +1,135 @@
+#include "Analysis.h"
+
+#include <algorithm>
+#include <chrono>
+
+Analyzer::Analyzer(const AnalyzerOptions& options) : options{ options }, cachedDepth{ 0 }, running{ true }, exited{ false }, generation{ 0 }, searchGeneration{ 0 }, stopsSent{ 0 } {
+	engine.setIterationCallback([this](const Position& position, const SearchResult& result) {
+		// a request that arrived right before the search started had its stop reset by it
+		if (int(generation.load() - searchGeneration) > 0) {
+			engine.stop();
+			return;
+		}
+		if (result.depth <= cachedDepth) return;
+		// a resumed search starts over from depth 1
+		cachedDepth = result.depth;
+
+		// every position of the line was searched that deep minus its distance from the root
+		Position line = position;
+		int score = result.score;
+		for (int i = 0; i < int(result.pv.size()) && result.depth - i > 0; ++i, score = -score) {
+			// mate scores count plies from the position they are stored with
+			int lineScore = !isMateScore(score) ? score : score > 0 ? score + i : score - i;
+			cache.store(line.hash, AnalysisCacheEntry{ result.pv[i], lineScore, result.depth - i });
+			line.makeMove(result.pv[i]);
+		}
+
+		AnalysisInfo info{};
+		info.hash = position.hash;
+		info.score = result.score;
+		info.depth = result.depth;
+		info.nodes = result.nodes;
+		info.pvLength = int(std::min(result.pv.size(), info.pv.size()));
+		std::copy(result.pv.begin(), result.pv.begin() + info.pvLength, info.pv.begin());
+
+		// replaces a result the render thread has not picked up yet, it only needs the latest one
+		infos.publish(info);
+	});
+
+	thread = std::thread(&Analyzer::worker, this);
+}
+
+Analyzer::~Analyzer() {
+	running = false;
+	++generation;
+	// keep signalling, a stop sent before the worker got to start its search would be lost
+	do {
+		engine.stop();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	} while (!exited);
+	thread.join();
+}
+
+void Analyzer::worker() {
+	// mapped here rather than in the constructor, so creating or resizing the file never holds up a frame
+	if (!options.cachePath.empty()) cache.open(options.cachePath, options.cacheSizeMb);
+
+	AnalysisRequest request;
+	bool pending = false;	// the request still wants searching
+	bool resumed = false;
+
+	while (running) {
+		// only the most recent request matters
+		while (positions.pop(request)) {
+			pending = true;
+			resumed = false;
+		}
+
+		if (!pending) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(2));
+			continue;
+		}
+
+		searchGeneration = request.generation;
+		if (!resumed) reportCached(request.position);
+
+		// runs until analyze or the destructor stops it, or on its own to a mate, the last depth or a finished game
+		unsigned stopsBefore = stopsSent.load();
+		engine.search(request.position, SearchLimits());
+
+		// the stop of analyze can land on the search of its own request when the worker picked it up first,
+		// only a search cut short that way is resumed, a finished one waits for the next request
+		pending = stopsSent.load() != stopsBefore && int(generation.load() - request.generation) <= 0;
+		resumed = true;
+	}
+
+	exited = true;
+}
+
+static bool isLegal(Position& position, Move move) {
+	MoveList list;
+	position.generateLegalMoves(list);
+	return std::find(list.begin(), list.end(), move) != list.end();
+}
+
+void Analyzer::reportCached(const Position& position) {
+	cachedDepth = 0;
+
+	AnalysisCacheEntry entry;
+	Position line = position;
+	// a hash collision can hand out a move of another position
+	if (!cache.probe(position.hash, entry) || !isLegal(line, entry.move)) return;
+
+	AnalysisInfo info{};
+	info.hash = position.hash;
+	info.score = entry.score;
+	info.depth = entry.depth;
+
+	// the line follows the cached best moves for as far as they were analysed too
+	std::vector<std::uint64_t> seen;
+	AnalysisCacheEntry next = entry;
+	do {
+		info.pv[info.pvLength++] = next.move;
+		seen.push_back(line.hash);
+		line.makeMove(next.move);
+	} while (info.pvLength < int(info.pv.size()) && std::find(seen.begin(), seen.end(), line.hash) == seen.end()
+		&& cache.probe(line.hash, next) && isLegal(line, next.move));
+
+	cachedDepth = entry.depth;
+	infos.publish(info);
+}
+
+bool Analyzer::analyze(const Position& position) {
+	// published after the push, so a search is only stopped by the callback once its replacement is queued
+	unsigned next = generation.load() + 1;
+	if (!positions.push(AnalysisRequest{ position, next })) return false;
+
+	generation = next;
+	engine.stop();
+	++stopsSent;
+	return true;
+}
+
+bool Analyzer::poll(AnalysisInfo& info) {
+	return infos.take(info);
+}
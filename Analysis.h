@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "AnalysisCache.h"
+#include "Engine.h"
+#include "SpscQueue.h"
+
+/*
+	Result of one completed search iteration, as shown by the analysis overlay.
+*/
+
+struct AnalysisInfo
+{
+	std::uint64_t hash;	// position the info belongs to
+	int score;			// from the point of view of the side to move
+	int depth;
+	std::int64_t nodes;
+	std::array<Move, 16> pv;
+	int pvLength;
+};
+
+struct AnalysisRequest
+{
+	Position position;
+	unsigned generation;
+};
+
+struct AnalyzerOptions
+{
+	std::string cachePath = "analysis.cache";	// empty = no persistent cache
+	std::size_t cacheSizeMb = 64;
+};
+
+/*
+	Analyses positions on its own thread until told otherwise.
+	Positions go in through a lock-free queue and the latest result comes out through a lock-free slot, so the render
+	thread never waits on the search.
+	Completed iterations are kept in the persistent cache, a position analysed before, in this session or an
+	earlier one, gets its cached result at once and only hears from the search again once it goes deeper.
+*/
+
+class Analyzer
+{
+private:
+	Engine engine;
+	AnalyzerOptions options;
+	AnalysisCache cache;	// only touched by the search thread
+	int cachedDepth;		// depth the running search has to beat to report anything
+
+	SpscQueue<AnalysisRequest, 16> positions;	// render thread -> search thread
+	LatestValue<AnalysisInfo> infos;	// search thread -> render thread
+
+	std::atomic<bool> running;
+	std::atomic<bool> exited;			// set by the worker on its way out
+	std::atomic<unsigned> generation;	// bumped by every queued analyze request
+	unsigned searchGeneration;			// request the running search belongs to
+	std::atomic<unsigned> stopsSent;	// bumped by analyze after its stop
+	std::thread thread;
+	void worker();
+	void reportCached(const Position& position);
+public:
+	explicit Analyzer(const AnalyzerOptions& options = AnalyzerOptions());
+	~Analyzer();
+
+	// Stops analysing the previous position, returns false when the request could not be queued
+	bool analyze(const Position& position);
+	// Latest available result, false when nothing new arrived
+	bool poll(AnalysisInfo& info);
+};
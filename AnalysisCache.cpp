@@ -0,0 +1,185 @@
+#include "AnalysisCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+/*
+	Slot data, an empty slot is all zeros:
+	bits 0-7 from, 8-15 to, 16-31 score, 32-39 depth (never 0 for an entry), 40-63 session of the last use.
+*/
+
+static const std::uint32_t SESSION_MASK = 0xFFFFFF;
+
+static inline std::uint64_t packData(const AnalysisCacheEntry& entry, std::uint32_t session) {
+	return std::uint64_t(std::uint8_t(entry.move.from))
+		| std::uint64_t(std::uint8_t(entry.move.to)) << 8
+		| std::uint64_t(std::uint16_t(std::int16_t(entry.score))) << 16
+		| std::uint64_t(std::uint8_t(entry.depth)) << 32
+		| std::uint64_t(session & SESSION_MASK) << 40;
+}
+
+static inline int dataDepth(std::uint64_t data) { return int(data >> 32 & 0xFF); }
+static inline std::uint32_t dataSession(std::uint64_t data) { return std::uint32_t(data >> 40); }
+
+static inline AnalysisCacheEntry unpackData(std::uint64_t data) {
+	AnalysisCacheEntry entry;
+	entry.move = Move{ std::int8_t(data & 0xFF), std::int8_t(data >> 8 & 0xFF) };
+	entry.score = std::int16_t(std::uint16_t(data >> 16));
+	entry.depth = dataDepth(data);
+	return entry;
+}
+
+AnalysisCache::AnalysisCache() : slots{ nullptr }, slotCount{ 0 }, session{ 0 } {}
+
+AnalysisCache::~AnalysisCache() {
+	close();
+}
+
+bool AnalysisCache::create(const std::string& path, std::size_t count) {
+	close();
+
+	// truncated first so the slots start out as zeros, without writing them
+	std::string temp = path + ".new";
+	if (!std::ofstream(temp, std::ios::binary | std::ios::trunc)) return false;
+	if (!file.openWritable(temp, sizeof(AnalysisCacheHeader) + count * sizeof(AnalysisCacheSlot))) return false;
+
+	AnalysisCacheHeader header{};
+	std::memcpy(header.magic, "CHAC", 4);
+	header.version = ANALYSIS_CACHE_VERSION;
+	header.slotCount = count;
+	header.session = 1;
+	std::memcpy(file.getWritableData(), &header, sizeof(header));
+
+	slots = reinterpret_cast<AnalysisCacheSlot*>(file.getWritableData() + sizeof(AnalysisCacheHeader));
+	slotCount = count;
+	session = header.session;
+	return true;
+}
+
+bool AnalysisCache::install(const std::string& path) {
+	std::string temp = path + ".new";
+	close();
+#ifdef _WIN32
+	// rename does not replace an existing file there
+	std::remove(path.c_str());
+#endif
+	if (std::rename(temp.c_str(), path.c_str()) != 0 || !file.openWritable(path)) {
+		close();
+		return false;
+	}
+
+	const AnalysisCacheHeader* header = reinterpret_cast<const AnalysisCacheHeader*>(file.getData());
+	slots = reinterpret_cast<AnalysisCacheSlot*>(file.getWritableData() + sizeof(AnalysisCacheHeader));
+	slotCount = std::size_t(header->slotCount);
+	session = header->session;
+	return true;
+}
+
+bool AnalysisCache::open(const std::string& path, std::size_t sizeMb) {
+	close();
+
+	std::size_t count = BUCKET_SLOTS;
+	std::size_t bytes = sizeMb << 20;
+	while (sizeof(AnalysisCacheHeader) + count * 2 * sizeof(AnalysisCacheSlot) <= bytes) count *= 2;
+
+	if (!file.openWritable(path) || file.getSize() < sizeof(AnalysisCacheHeader)) return create(path, count) && install(path);
+
+	AnalysisCacheHeader* header = reinterpret_cast<AnalysisCacheHeader*>(file.getWritableData());
+	const AnalysisCacheSlot* existing = reinterpret_cast<const AnalysisCacheSlot*>(file.getData() + sizeof(AnalysisCacheHeader));
+	std::size_t existingCount = std::size_t(header->slotCount);
+	bool valid = std::memcmp(header->magic, "CHAC", 4) == 0 && header->version == ANALYSIS_CACHE_VERSION
+		&& existingCount >= BUCKET_SLOTS && (existingCount & (existingCount - 1)) == 0
+		&& file.getSize() == sizeof(AnalysisCacheHeader) + existingCount * sizeof(AnalysisCacheSlot);
+	if (!valid) return create(path, count) && install(path);
+
+	if (existingCount == count) {
+		session = header->session = (header->session + 1) & SESSION_MASK;
+		slots = reinterpret_cast<AnalysisCacheSlot*>(file.getWritableData() + sizeof(AnalysisCacheHeader));
+		slotCount = count;
+		return true;
+	}
+
+	// resized: the entries are carried over with their sessions, least valuable first so that evictions drop those
+	std::vector<AnalysisCacheSlot> entries;
+	for (std::size_t i = 0; i < existingCount; ++i)
+		if (dataDepth(existing[i].data)) entries.push_back(existing[i]);
+	std::uint32_t lastSession = header->session;
+	std::sort(entries.begin(), entries.end(), [lastSession](const AnalysisCacheSlot& a, const AnalysisCacheSlot& b) {
+		std::uint32_t ageA = (lastSession - dataSession(a.data)) & SESSION_MASK;
+		std::uint32_t ageB = (lastSession - dataSession(b.data)) & SESSION_MASK;
+		return ageA != ageB ? ageA > ageB : dataDepth(a.data) < dataDepth(b.data);
+	});
+
+	if (!create(path, count)) return false;
+	session = lastSession;
+	for (const AnalysisCacheSlot& entry : entries)
+		storeData(entry.check ^ entry.data, entry.data);
+	reinterpret_cast<AnalysisCacheHeader*>(file.getWritableData())->session = (lastSession + 1) & SESSION_MASK;
+	return install(path);
+}
+
+void AnalysisCache::close() {
+	file.close();
+	slots = nullptr;
+	slotCount = 0;
+}
+
+bool AnalysisCache::probe(std::uint64_t hash, AnalysisCacheEntry& entry) {
+	if (!slots) return false;
+
+	AnalysisCacheSlot* bucket = slots + (hash & (slotCount - 1) & ~std::uint64_t(BUCKET_SLOTS - 1));
+	for (int i = 0; i < BUCKET_SLOTS; ++i) {
+		AnalysisCacheSlot& slot = bucket[i];
+		std::uint64_t data = slot.data;
+		if ((slot.check ^ data) != hash || !dataDepth(data)) continue;
+
+		entry = unpackData(data);
+		if (dataSession(data) != session) {
+			data = packData(entry, session);
+			slot.data = data;
+			slot.check = hash ^ data;
+		}
+		return true;
+	}
+	return false;
+}
+
+void AnalysisCache::store(std::uint64_t hash, const AnalysisCacheEntry& entry) {
+	if (!slots || entry.depth <= 0) return;
+	storeData(hash, packData(entry, session));
+}
+
+void AnalysisCache::storeData(std::uint64_t hash, std::uint64_t data) {
+	int newDepth = dataDepth(data);
+	AnalysisCacheSlot* bucket = slots + (hash & (slotCount - 1) & ~std::uint64_t(BUCKET_SLOTS - 1));
+	AnalysisCacheSlot* victim = nullptr;
+	std::uint32_t victimAge = 0;
+	int victimDepth = 0;
+
+	for (int i = 0; i < BUCKET_SLOTS; ++i) {
+		AnalysisCacheSlot& slot = bucket[i];
+		std::uint64_t slotData = slot.data;
+		int depth = dataDepth(slotData);
+
+		if (depth && (slot.check ^ slotData) == hash) {
+			if (depth > newDepth) return;
+			victim = &slot;
+			break;
+		}
+
+		// empty first, then the oldest, then the shallowest
+		std::uint32_t age = depth ? (session - dataSession(slotData)) & SESSION_MASK : SESSION_MASK + 1;
+		if (!victim || age > victimAge || (age == victimAge && depth < victimDepth)) {
+			victim = &slot;
+			victimAge = age;
+			victimDepth = depth;
+		}
+	}
+
+	// a crash between the two writes leaves a slot that matches no key
+	victim->data = data;
+	victim->check = hash ^ data;
+}
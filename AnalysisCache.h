@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Engine.h"
+#include "MappedFile.h"
+
+/*
+	Persistent analysis cache: the deepest completed analysis of every position, kept across sessions.
+
+	The file is a header followed by a power of two of slots in buckets of BUCKET_SLOTS, mapped read-write so there
+	is nothing to load at startup and nothing to save at exit. A slot holds its key XORed with its data, so a slot
+	half written when the process died reads as empty instead of as a wrong result; the file is always valid.
+	A full bucket evicts the entry last used the most sessions ago, the shallowest one among those.
+*/
+
+struct AnalysisCacheHeader
+{
+	char magic[4];			// "CHAC"
+	std::uint32_t version;
+	std::uint64_t slotCount;
+	std::uint32_t session;	// bumped by every open
+	std::uint32_t reserved[3];
+};
+
+struct AnalysisCacheSlot
+{
+	std::uint64_t check;	// key ^ data
+	std::uint64_t data;		// from, to, score, depth and session, see AnalysisCache.cpp
+};
+
+static_assert(sizeof(AnalysisCacheHeader) == 32, "the cache layout is part of the file format");
+static_assert(sizeof(AnalysisCacheSlot) == 16, "the cache layout is part of the file format");
+
+const std::uint32_t ANALYSIS_CACHE_VERSION = 1;
+
+struct AnalysisCacheEntry
+{
+	Move move;
+	int score;	// from the point of view of the side to move
+	int depth;
+};
+
+class AnalysisCache
+{
+private:
+	MappedFile file;
+	AnalysisCacheSlot* slots;
+	std::size_t slotCount;
+	std::uint32_t session;
+
+	// A new cache is built in path + ".new" and then renamed over path, another process that still has the old file
+	// mapped keeps its copy instead of seeing it truncated under its feet
+	bool create(const std::string& path, std::size_t slots);
+	bool install(const std::string& path);
+	// data keeps the session it was packed with
+	void storeData(std::uint64_t hash, std::uint64_t data);
+public:
+	static const int BUCKET_SLOTS = 4;
+
+	AnalysisCache();
+	~AnalysisCache();
+	AnalysisCache(const AnalysisCache&) = delete;
+	AnalysisCache& operator=(const AnalysisCache&) = delete;
+
+	// Maps the cache, creating it when missing; a cache of another size keeps its deepest entries that fit
+	bool open(const std::string& path, std::size_t sizeMb);
+	void close();
+
+	// A hit counts as a use, it protects the entry from eviction in the next sessions
+	bool probe(std::uint64_t hash, AnalysisCacheEntry& entry);
+	// Only replaces an entry of the same position with a deeper one
+	void store(std::uint64_t hash, const AnalysisCacheEntry& entry);
+
+	// Getters
+	bool isOpen() const { return slots != nullptr; }
+	std::size_t getSlotCount() const { return slotCount; }
+};
@@ -0,0 +1,4971 @@
+// Generated by Tools/EmbedAssets.cpp, do not edit
+
+#include "Assets.h"
+
+// Textures/pieces.png
+static const unsigned char piecesTextureAssetData[] = {
+	137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,10,0,0,0,3,85,
+	8,4,0,0,0,30,134,111,196,0,0,0,4,103,65,77,65,0,0,177,143,11,252,97,
+	5,0,0,0,32,99,72,82,77,0,0,122,38,0,0,128,132,0,0,250,0,0,0,128,
+	232,0,0,117,48,0,0,234,96,0,0,58,152,0,0,23,112,156,186,81,60,0,0,0,
+	2,98,75,71,68,0,255,135,143,204,191,0,0,0,7,116,73,77,69,7,226,5,5,15,
+	15,51,91,114,85,143,0,0,128,0,73,68,65,84,120,218,236,157,117,188,22,197,247,199,
+	223,247,94,186,187,27,164,149,52,80,194,64,5,91,4,177,64,20,4,27,187,3,44,196,
+	238,194,250,218,93,40,216,221,10,38,40,37,168,164,228,165,243,238,247,15,16,129,123,159,
+	153,221,125,118,247,137,253,188,159,215,239,251,195,59,179,187,179,103,206,236,206,156,61,115,
+	14,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,
+	16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,
+	132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,
+	33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,
+	8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,
+	66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,
+	16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,
+	132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,
+	33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,
+	8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,
+	66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,
+	16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,
+	132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,
+	33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,
+	8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,
+	66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,
+	16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,
+	132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,
+	33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,
+	8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,
+	66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,
+	16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,
+	132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,33,132,16,66,8,
+	33,132,16,66,8,33,132,240,76,142,68,32,132,136,17,77,216,155,118,180,160,49,21,41,
+	11,172,34,159,153,76,225,39,62,230,15,137,71,8,207,212,163,59,173,105,206,78,84,160,
+	50,165,89,195,74,86,241,39,191,51,133,111,248,145,2,137,72,8,33,132,16,66,8,33,
+	132,16,209,208,150,155,152,133,99,248,205,100,52,109,36,40,33,92,145,195,94,220,199,84,
+	227,152,114,88,204,43,28,71,25,137,75,8,33,132,16,66,8,33,132,16,97,146,195,65,
+	124,110,49,83,252,247,251,148,94,18,153,16,70,42,113,41,211,93,143,41,135,229,60,66,
+	107,137,77,8,33,132,16,66,8,33,132,16,225,176,43,223,120,48,84,108,254,125,69,71,
+	9,78,136,34,169,204,13,228,123,30,83,14,155,120,133,118,18,159,16,66,8,33,132,16,
+	66,36,166,4,109,232,68,67,9,66,8,79,148,230,110,54,249,48,85,56,108,228,78,74,
+	73,128,66,108,71,14,3,89,224,107,68,253,107,4,124,130,170,18,163,16,66,8,33,132,
+	16,66,20,166,9,143,179,98,107,140,178,139,41,45,145,8,225,138,230,252,152,132,169,194,
+	97,146,34,2,10,177,13,245,248,40,169,17,181,249,55,143,3,37,74,33,132,16,66,8,
+	33,132,216,158,190,172,220,97,241,244,179,60,1,133,112,193,30,44,74,218,84,177,148,110,
+	18,164,16,0,244,100,126,0,230,63,7,135,2,238,164,184,4,42,132,16,66,8,33,132,
+	16,255,45,184,214,23,177,120,154,74,5,137,70,8,35,135,176,58,16,83,197,106,14,146,
+	48,133,224,60,10,2,50,255,109,254,141,167,172,132,42,132,16,66,8,33,132,16,0,37,
+	152,149,96,233,116,167,132,35,132,129,189,89,19,152,161,98,13,221,37,80,17,107,114,24,
+	17,168,241,111,243,239,91,170,75,180,66,8,33,132,16,66,68,55,173,23,233,203,177,60,
+	147,160,100,53,181,89,46,1,137,180,164,52,205,105,78,21,42,145,199,122,150,51,159,223,
+	153,201,134,8,91,208,134,47,3,245,146,93,70,23,126,87,199,138,216,114,11,231,135,114,
+	222,159,232,65,190,196,43,132,16,66,8,33,132,136,59,143,27,124,39,180,45,81,164,27,
+	121,28,192,109,252,80,100,214,221,117,124,202,8,118,141,164,29,101,153,20,184,175,210,47,
+	148,81,7,139,152,114,113,8,222,127,255,254,62,86,174,109,33,132,16,66,8,33,132,48,
+	229,91,60,77,226,17,105,68,3,110,102,174,139,229,254,111,92,76,197,144,219,50,38,20,
+	67,197,253,234,100,17,75,142,10,56,246,223,142,191,167,36,98,33,132,16,66,8,33,68,
+	220,249,210,176,104,58,87,226,17,105,66,67,30,45,50,89,77,162,223,50,174,11,49,141,
+	77,215,144,204,21,155,216,83,93,45,98,56,186,23,135,106,254,115,112,56,69,98,22,66,
+	8,33,132,16,66,196,27,25,0,69,186,83,130,75,88,229,99,201,63,151,99,67,105,79,
+	30,63,135,102,166,248,129,92,117,184,136,21,197,248,46,116,243,159,195,106,218,72,212,66,
+	8,33,132,16,66,132,63,189,23,66,8,127,52,224,121,246,240,117,100,109,158,225,104,78,
+	102,105,192,45,234,203,206,246,74,185,236,197,190,180,161,50,176,132,73,124,192,151,56,246,
+	195,218,211,135,151,34,144,106,89,118,167,37,45,168,77,121,138,225,176,140,37,76,229,55,
+	190,101,177,84,78,68,202,89,116,118,59,149,216,149,174,180,160,54,37,128,127,248,131,239,
+	248,148,101,238,14,46,205,253,244,112,51,4,133,200,74,186,115,36,45,200,225,31,102,48,
+	158,9,20,72,36,66,8,33,132,16,241,67,30,128,34,157,233,205,178,36,61,127,166,211,
+	58,208,22,229,240,163,237,154,197,156,83,157,63,156,29,153,225,12,117,242,236,237,157,24,
+	114,222,244,250,92,202,231,9,183,83,111,226,71,110,164,173,20,79,68,68,93,150,187,25,
+	199,205,156,187,157,133,78,97,214,59,175,59,189,157,28,119,207,130,129,18,183,136,37,109,
+	248,108,135,177,48,133,3,37,22,33,132,16,66,136,248,33,3,160,72,95,78,240,20,247,
+	47,209,111,49,93,2,108,83,55,219,245,90,56,19,156,68,124,231,52,179,183,119,175,208,
+	228,185,63,239,22,153,63,185,240,239,123,142,35,79,10,40,66,231,97,187,54,86,115,30,
+	113,54,58,38,190,115,118,115,163,213,115,148,13,88,196,142,226,92,204,218,34,199,195,88,
+	26,72,60,66,8,33,132,16,241,66,6,64,145,174,12,10,44,213,198,74,159,155,136,139,
+	226,33,243,181,186,56,75,140,166,138,197,206,238,182,214,62,16,138,52,187,242,141,71,169,
+	77,163,175,148,80,132,74,125,214,217,244,176,151,243,143,99,103,147,115,189,83,204,174,211,
+	202,108,47,162,166,61,151,242,0,175,243,26,15,113,17,123,82,60,210,171,119,224,55,195,
+	120,200,103,55,117,144,16,66,8,33,68,156,144,1,80,164,39,135,177,33,192,20,0,139,
+	104,21,72,171,242,88,98,186,78,107,103,169,213,84,177,216,105,97,107,107,208,137,64,42,
+	243,152,79,99,234,219,52,150,42,138,208,184,211,166,129,103,59,155,28,183,188,229,148,177,
+	233,243,44,197,36,22,145,81,130,225,204,42,164,131,243,185,146,106,17,181,224,84,214,88,
+	70,196,66,90,170,163,132,16,66,8,33,226,131,12,128,34,29,217,201,93,100,48,79,254,
+	108,21,2,104,215,110,166,107,148,112,126,117,101,168,248,201,41,110,110,107,167,64,101,217,
+	153,25,73,200,45,159,254,82,71,17,10,165,109,17,62,207,117,188,241,129,83,210,166,207,
+	135,72,236,34,18,122,48,221,144,147,250,1,106,135,124,253,114,60,227,234,9,63,139,58,
+	234,44,33,132,16,66,136,184,32,3,160,72,63,74,241,67,192,230,63,7,135,231,3,104,
+	217,197,166,43,92,224,218,80,113,142,185,165,23,4,40,203,129,1,196,81,188,46,228,196,
+	36,34,158,244,55,235,93,31,167,192,241,202,147,54,93,126,65,98,23,17,112,178,117,115,
+	251,82,134,134,120,253,218,124,239,250,249,254,138,186,75,8,33,132,16,34,46,200,0,40,
+	210,143,27,67,48,255,57,56,244,75,186,101,207,154,252,255,230,187,54,83,204,53,251,0,
+	62,29,152,36,207,11,40,142,226,24,165,4,17,129,51,214,164,115,245,93,108,167,47,138,
+	19,205,154,188,134,138,18,188,8,153,211,92,155,222,194,217,12,220,150,63,61,61,223,123,
+	171,203,132,16,66,8,33,226,129,12,128,34,221,104,29,72,238,223,162,126,115,147,94,252,
+	79,72,124,246,67,61,153,41,122,155,115,240,6,195,233,1,202,238,65,41,166,8,148,18,
+	172,50,105,220,43,142,63,22,57,85,205,154,124,184,68,47,66,101,39,107,228,189,255,126,
+	211,105,17,248,245,187,218,182,214,23,17,32,67,177,49,133,16,66,8,17,24,154,88,164,
+	74,238,173,168,105,173,101,50,136,52,167,167,229,232,77,76,231,111,137,90,4,202,104,119,
+	121,18,115,104,68,3,138,179,134,25,204,119,119,230,218,156,199,213,73,181,173,105,226,162,
+	158,158,78,116,0,227,19,23,54,9,68,142,199,112,119,128,189,50,148,121,140,144,114,138,
+	192,216,157,50,137,11,119,227,72,159,167,173,202,133,92,98,170,176,55,175,75,248,34,68,
+	46,160,148,135,55,202,151,244,225,147,0,175,222,157,183,40,231,241,152,102,28,201,139,234,
+	56,33,132,16,66,136,76,165,18,55,178,48,36,47,170,29,127,63,115,188,34,132,137,192,
+	104,231,102,211,234,30,206,227,206,194,109,188,126,102,58,183,57,205,220,104,235,146,164,82,
+	129,228,176,41,241,185,63,240,228,167,244,158,169,149,27,3,24,81,205,3,79,163,82,32,
+	223,41,17,32,87,152,180,237,69,199,63,203,157,114,38,61,254,81,162,23,33,146,195,124,
+	143,79,214,117,190,173,221,133,217,135,149,190,158,238,159,170,227,132,16,66,8,33,50,149,
+	54,252,17,145,241,239,223,223,75,148,148,216,69,32,60,101,211,182,70,206,155,69,46,251,
+	55,58,247,57,21,236,186,122,126,18,109,43,103,58,243,47,158,140,20,63,153,91,89,38,
+	73,41,150,230,215,16,198,249,34,234,74,65,69,64,60,151,88,211,170,56,107,157,100,24,
+	104,54,183,104,87,130,8,143,74,62,158,172,235,56,44,144,107,239,198,10,223,79,247,182,
+	234,58,33,132,16,66,136,76,164,38,115,34,54,255,57,56,60,35,193,139,0,168,192,106,
+	179,166,29,104,76,13,48,205,105,97,211,212,95,146,106,157,225,204,147,60,153,40,126,53,
+	183,178,124,146,114,188,38,52,83,191,16,193,240,99,98,61,59,214,73,142,23,204,90,220,
+	84,194,23,161,209,208,215,147,117,29,135,36,125,229,22,73,237,251,24,169,174,19,66,8,
+	33,132,200,68,254,151,2,243,159,131,19,192,244,85,136,147,205,90,214,219,89,103,89,250,
+	255,99,55,1,182,247,221,186,60,211,246,228,79,61,153,40,62,54,111,182,205,77,74,138,
+	59,177,54,180,113,174,124,145,34,24,12,41,64,238,75,210,0,184,192,172,195,7,73,248,
+	34,52,90,250,124,178,174,97,207,164,174,91,139,89,73,6,115,17,66,8,33,132,8,132,
+	92,137,32,66,106,114,108,138,174,60,92,194,23,73,115,176,121,101,245,2,37,44,39,168,
+	206,88,155,251,156,255,229,255,38,86,39,46,252,205,211,169,140,181,87,82,144,148,20,175,
+	118,183,37,191,25,199,115,21,55,50,146,193,180,115,27,118,240,6,69,252,20,1,80,218,
+	180,205,189,117,146,39,175,65,85,83,113,21,137,95,132,168,217,254,40,197,27,52,247,125,
+	213,146,188,66,195,164,218,189,115,64,201,167,132,16,66,8,33,68,132,28,157,34,255,63,
+	135,181,138,3,40,146,36,151,69,137,53,44,199,249,220,165,255,207,93,102,77,125,63,137,
+	22,254,26,212,182,197,163,77,45,252,41,41,41,54,101,131,109,180,22,119,78,113,126,222,
+	161,69,179,156,203,220,196,80,148,175,175,8,130,234,38,29,155,238,36,75,7,147,6,159,
+	38,241,139,208,232,146,196,44,106,58,213,125,94,245,177,0,230,112,39,171,243,132,16,66,
+	8,17,204,162,94,68,71,253,148,93,185,36,53,37,126,145,20,45,77,142,59,135,178,151,
+	203,211,156,74,99,83,241,158,228,249,110,225,148,196,69,99,89,225,250,52,203,121,203,84,
+	60,53,41,41,158,101,75,114,176,27,63,241,16,59,239,240,215,134,92,207,239,28,97,63,
+	255,57,82,84,145,52,229,124,23,186,162,188,239,66,33,146,162,116,18,199,54,229,121,95,
+	111,167,83,25,100,175,84,150,27,204,21,186,171,243,132,16,66,8,17,4,50,0,70,201,
+	250,20,94,123,173,196,47,146,162,149,169,240,76,215,167,41,206,41,230,5,90,3,223,45,
+	52,164,16,89,201,125,174,79,115,55,171,124,94,197,197,205,91,130,0,28,207,103,9,5,
+	93,155,87,24,97,187,194,62,41,252,204,32,178,133,141,190,11,93,177,193,119,161,16,73,
+	81,58,169,163,247,225,58,207,199,180,230,54,123,165,218,124,194,165,230,0,184,93,213,121,
+	66,8,33,132,8,2,25,0,163,100,82,202,174,188,144,133,18,191,72,10,67,4,164,10,
+	236,227,225,68,125,204,197,45,125,183,240,99,83,225,40,230,186,58,201,108,70,155,43,124,
+	148,132,12,123,82,195,84,220,151,255,25,227,40,230,112,53,87,218,158,232,199,72,85,69,
+	146,24,221,101,151,37,125,122,227,25,86,74,252,34,52,74,37,121,252,197,28,234,169,126,
+	73,158,177,27,29,91,243,53,157,192,28,191,161,9,149,212,125,66,8,33,132,72,158,98,
+	18,65,132,124,193,124,106,165,228,202,175,224,72,252,34,41,12,155,200,59,123,122,144,180,
+	160,50,75,125,93,199,194,87,172,73,188,216,202,231,120,222,165,184,229,20,235,57,214,108,
+	253,88,201,55,73,200,240,0,83,97,75,30,119,177,195,108,36,223,51,222,84,97,127,110,
+	150,178,138,164,48,26,225,102,208,38,169,147,23,48,211,84,188,66,226,23,161,97,48,0,
+	86,163,26,191,219,142,207,225,9,58,241,135,235,235,221,72,59,91,149,157,249,96,75,112,
+	193,238,230,43,183,55,127,226,18,34,96,138,211,135,131,104,110,157,54,121,97,29,191,242,
+	26,111,7,190,34,217,149,99,232,64,133,144,37,178,156,31,120,142,239,2,62,107,14,189,
+	56,130,182,129,70,106,223,192,84,198,241,138,60,234,69,40,20,163,49,45,105,65,99,42,
+	80,150,242,84,164,128,21,228,179,146,229,76,99,10,83,249,43,201,116,137,66,100,25,103,
+	165,36,5,200,42,101,144,19,73,243,112,98,13,27,236,49,9,64,71,147,182,158,149,68,
+	27,159,55,143,132,254,206,122,99,187,214,57,253,108,99,233,233,164,100,248,163,233,220,31,
+	184,148,222,44,167,148,121,180,43,225,143,72,150,249,137,53,108,100,146,41,64,126,53,143,
+	176,110,18,190,8,141,147,19,107,94,75,103,137,211,205,205,124,106,162,235,141,196,189,40,
+	176,157,109,23,103,225,214,145,177,194,201,51,213,61,91,221,39,34,164,11,211,66,91,147,
+	124,155,68,78,237,194,84,225,229,72,87,84,47,7,154,171,190,57,223,134,214,210,105,116,
+	145,34,139,0,41,207,193,220,194,4,214,91,117,111,53,159,113,13,251,36,237,117,47,68,
+	150,144,203,43,145,155,255,10,56,65,130,23,73,243,76,98,29,59,219,163,9,160,135,73,
+	95,47,78,162,141,7,219,70,195,190,206,188,132,173,154,99,110,215,230,95,239,36,90,87,
+	154,77,137,207,220,221,131,252,78,55,183,177,179,148,85,36,201,39,137,245,171,71,146,6,
+	192,59,205,218,91,93,194,23,161,113,106,98,205,107,231,56,206,10,103,47,55,115,170,49,
+	174,174,85,145,185,182,51,53,217,225,125,212,210,84,251,78,117,159,136,140,253,89,23,234,
+	186,100,49,109,3,106,105,53,38,71,190,170,154,76,181,128,90,223,150,197,161,182,116,29,
+	251,75,153,69,0,84,225,116,62,103,131,103,13,92,195,56,142,167,140,4,40,68,9,238,
+	54,153,1,2,255,45,225,40,9,93,4,192,163,137,181,236,20,143,38,128,206,97,249,57,
+	20,99,150,109,68,84,118,238,112,86,23,106,209,106,231,54,167,146,125,52,253,145,84,208,
+	132,93,76,231,126,194,131,252,38,152,91,121,188,148,85,36,201,152,196,250,149,235,252,157,
+	148,1,176,171,121,89,40,68,120,12,79,172,123,187,57,142,227,56,249,206,110,110,230,85,
+	135,187,184,214,221,182,179,212,116,166,239,48,54,142,49,213,127,67,221,39,34,162,38,139,
+	66,95,155,252,22,208,94,133,87,83,178,175,234,213,64,218,94,146,223,66,111,233,162,36,
+	194,234,8,1,185,28,198,43,73,126,16,88,206,99,218,221,33,4,180,227,110,126,96,137,
+	245,183,193,232,94,107,59,122,62,31,115,33,149,37,110,17,8,119,37,214,198,3,61,154,
+	0,106,152,94,20,39,39,213,202,211,221,188,140,42,59,67,156,103,157,159,157,233,206,12,
+	231,39,231,89,103,176,83,217,221,75,108,88,82,109,59,42,241,153,115,156,127,60,200,175,
+	192,169,109,106,229,8,41,171,72,146,161,166,113,112,77,18,230,191,73,78,142,73,119,223,
+	149,232,69,136,156,145,88,247,58,111,209,208,133,78,115,251,155,224,31,235,162,186,19,27,
+	205,231,40,238,124,82,104,116,92,105,58,226,23,117,159,136,136,91,34,49,162,13,13,160,
+	165,157,83,98,254,115,112,216,61,128,214,15,139,164,165,138,10,45,252,27,255,250,49,41,
+	48,77,156,64,63,114,36,84,33,236,124,105,24,72,231,74,60,34,82,174,76,172,141,213,
+	156,77,30,76,0,51,205,175,136,67,146,106,101,41,254,10,109,26,53,43,201,47,214,6,
+	163,74,3,143,102,148,131,180,85,76,132,201,78,166,145,80,221,89,225,219,0,120,156,121,
+	140,93,34,209,139,16,25,156,88,247,218,110,213,209,105,78,53,55,113,192,204,203,38,107,
+	92,175,71,139,24,29,143,153,142,88,169,165,147,136,136,191,35,49,76,125,24,64,75,111,
+	79,153,1,240,182,0,90,255,81,36,45,157,35,133,22,62,200,227,20,254,8,92,27,127,
+	112,229,63,47,34,32,87,34,16,66,184,96,106,226,162,69,124,229,225,68,99,125,95,199,
+	5,107,57,47,52,9,12,103,93,82,199,151,77,92,84,199,227,169,234,153,10,43,72,89,
+	69,146,76,227,239,196,133,11,25,233,243,180,95,242,172,185,194,135,18,189,8,145,181,110,
+	138,154,241,188,61,31,123,31,99,108,229,97,236,106,62,124,16,39,21,241,215,198,230,247,
+	71,13,117,160,136,128,106,230,9,70,96,180,79,147,115,248,163,67,0,231,104,23,73,75,
+	235,4,22,177,80,196,135,142,124,193,67,230,87,146,207,17,251,26,239,211,82,2,78,61,
+	50,0,10,33,220,240,187,169,240,1,215,167,41,224,65,83,241,122,254,72,178,157,47,49,
+	46,148,251,127,131,215,147,60,67,137,196,69,94,93,11,75,250,46,20,194,21,175,153,10,
+	239,224,11,31,167,92,201,96,28,83,133,217,124,47,193,139,16,49,24,0,255,217,230,223,
+	251,114,173,253,92,119,39,52,147,148,183,133,97,104,198,221,69,254,189,137,249,176,186,234,
+	64,17,1,149,50,232,58,21,83,38,165,138,49,147,180,136,15,149,185,159,239,2,217,228,
+	94,52,251,49,145,171,180,82,73,53,50,0,10,33,220,48,137,229,137,11,159,115,29,160,
+	232,25,38,153,138,191,103,99,210,45,61,137,185,129,223,253,252,36,227,255,1,172,74,92,
+	180,220,227,169,242,77,133,43,165,172,34,105,158,52,21,110,228,88,207,131,172,128,193,230,
+	175,8,240,20,5,18,188,8,145,127,76,207,224,101,219,252,215,37,246,88,20,149,18,88,
+	241,224,92,179,175,94,113,158,161,92,145,37,117,41,110,58,80,25,178,69,20,228,100,208,
+	117,114,50,90,74,57,89,214,163,34,27,216,149,9,156,26,178,117,168,52,35,249,138,102,
+	18,118,42,41,38,17,8,145,177,228,209,136,90,148,165,34,43,88,197,63,252,193,134,208,
+	174,181,145,207,56,56,113,225,16,62,51,185,184,109,97,30,231,155,43,124,16,200,34,239,
+	4,222,49,175,164,60,178,158,163,153,159,244,89,12,134,185,25,56,158,230,104,211,76,133,
+	43,66,212,184,226,52,161,6,101,41,79,62,171,152,207,44,54,105,24,102,37,223,49,153,
+	214,137,139,255,166,23,239,123,216,147,232,48,156,23,108,149,158,148,216,69,168,252,105,42,
+	156,181,205,126,194,28,158,160,19,51,205,103,59,130,139,139,240,88,207,179,189,228,70,38,
+	220,31,156,75,85,211,139,70,27,249,132,16,66,132,69,14,103,115,147,139,165,92,16,116,
+	96,34,67,121,78,66,23,162,48,74,2,34,138,166,42,199,240,32,191,22,74,204,190,129,
+	41,60,206,64,106,135,114,213,51,205,193,93,7,57,5,150,4,0,171,156,61,108,1,98,
+	187,4,212,214,227,216,20,88,208,218,2,6,6,210,166,253,77,87,249,201,67,34,133,85,
+	78,73,39,226,103,67,29,78,228,127,76,41,148,153,124,29,191,240,0,253,169,170,65,153,
+	117,12,177,141,140,157,156,169,46,53,118,181,115,188,125,156,141,151,200,69,200,20,43,244,
+	4,219,230,119,223,14,90,59,193,41,21,66,72,254,206,206,70,195,72,105,107,58,246,51,
+	46,229,4,186,133,244,126,23,98,51,59,69,150,72,35,121,126,72,89,18,144,31,2,104,
+	125,84,109,221,73,74,45,92,80,142,177,145,143,163,187,236,1,119,133,144,1,80,6,64,
+	145,203,17,188,86,200,240,183,227,111,35,239,112,92,160,62,112,0,213,89,111,190,238,137,
+	206,90,195,210,230,31,103,79,219,171,96,122,128,91,21,134,83,16,144,249,239,204,128,90,
+	212,192,116,157,43,61,24,0,159,55,183,248,224,64,123,189,4,199,243,46,27,45,82,90,
+	199,171,28,166,144,18,89,69,9,123,46,200,242,206,227,86,179,191,227,252,228,180,115,51,
+	210,246,146,200,69,232,204,74,172,129,253,11,105,238,109,129,47,119,242,156,239,140,99,165,
+	135,187,243,44,227,107,30,227,18,142,160,69,224,239,121,33,3,160,12,128,50,0,138,184,
+	81,197,104,115,8,239,247,26,165,37,124,33,100,0,20,137,201,227,68,126,247,240,88,157,
+	197,25,1,135,89,125,205,118,205,142,206,196,4,11,155,55,156,186,246,22,95,29,104,107,
+	79,52,121,123,184,252,173,55,230,122,244,70,14,203,19,95,169,134,179,202,181,1,208,226,
+	71,25,92,222,174,82,156,197,95,30,164,53,153,1,50,2,102,17,167,187,233,245,238,206,
+	167,6,93,157,237,156,233,20,115,163,59,239,73,220,34,2,222,74,172,131,213,156,245,59,
+	104,239,38,183,6,57,215,191,51,44,207,246,163,252,188,163,126,227,121,46,100,159,20,38,
+	68,16,50,0,202,0,40,3,160,200,92,26,122,90,93,6,251,251,88,239,46,33,100,0,
+	20,137,232,200,55,62,30,172,211,232,21,96,27,186,217,175,152,235,244,115,222,115,54,108,
+	179,164,89,233,60,231,116,119,211,214,85,30,66,138,185,163,39,243,147,122,45,205,101,239,
+	64,219,51,206,116,181,171,93,154,255,94,48,183,249,175,192,90,187,15,147,125,200,108,34,
+	123,104,176,102,9,121,76,116,215,235,187,58,119,21,218,14,188,196,121,201,233,107,222,172,
+	190,173,17,163,181,196,45,34,224,66,147,30,190,82,232,105,251,135,83,62,192,133,78,45,
+	103,153,229,233,62,48,57,111,245,41,60,205,121,116,167,188,58,90,200,0,40,3,160,12,
+	128,194,21,77,153,157,178,145,180,121,52,85,82,39,68,141,146,128,8,145,9,227,244,122,
+	46,240,229,91,213,140,241,60,204,217,172,9,164,29,159,241,41,221,205,85,10,120,145,23,
+	41,79,3,114,216,68,49,214,51,147,245,238,206,254,144,41,71,163,47,222,167,3,255,99,
+	127,159,71,191,205,32,22,4,218,158,15,233,157,184,112,20,7,177,155,245,20,115,56,195,
+	118,141,32,40,195,61,156,228,235,200,14,124,193,141,92,29,64,54,103,145,106,54,113,6,
+	159,187,121,238,124,199,119,64,77,90,81,147,138,172,97,9,83,248,195,75,74,223,219,153,
+	44,113,139,8,248,196,84,120,11,71,238,240,151,198,220,198,41,129,93,252,74,171,163,67,
+	82,123,161,114,104,78,115,142,3,10,248,133,143,248,136,79,183,75,109,44,68,210,220,70,
+	89,15,181,103,114,99,202,90,122,188,109,178,106,229,83,158,78,89,235,47,241,180,149,99,
+	21,231,73,53,133,95,106,242,14,117,253,28,214,146,22,84,166,18,101,40,96,21,43,88,
+	192,239,76,101,137,247,83,181,231,13,14,12,104,157,42,68,22,32,15,64,1,80,155,47,
+	146,252,186,242,115,96,233,214,119,13,48,185,198,246,191,197,84,15,73,126,135,122,218,198,
+	250,175,239,223,192,16,90,210,220,124,213,154,206,20,139,127,200,98,123,52,181,35,3,105,
+	231,164,36,123,243,83,106,106,224,102,5,55,71,240,245,247,23,202,72,208,34,18,138,153,
+	2,49,224,188,94,196,83,247,160,128,244,188,73,161,45,198,133,57,39,216,145,181,145,239,
+	185,153,131,228,17,40,60,96,244,0,92,228,120,225,171,20,122,0,222,239,36,203,253,41,
+	244,0,252,202,83,75,23,201,3,80,248,165,130,219,157,30,255,254,26,57,167,58,207,59,
+	255,36,212,198,89,206,99,206,64,167,186,247,88,128,74,7,34,132,12,128,98,43,205,152,
+	17,192,66,96,1,29,3,106,207,67,33,25,1,134,134,40,195,178,12,183,39,52,216,250,
+	155,207,197,161,25,36,190,50,95,187,134,49,158,218,20,167,181,221,140,90,34,233,54,118,
+	230,159,0,250,115,58,77,52,120,179,194,96,242,121,200,230,191,149,218,254,43,34,228,77,
+	243,210,102,121,161,231,238,76,167,108,32,154,254,164,139,133,252,165,225,140,177,13,124,197,
+	149,180,83,231,11,25,0,101,0,20,98,155,25,222,7,238,223,36,229,156,193,206,39,46,
+	18,191,57,142,227,172,119,198,58,253,156,226,94,222,83,15,168,59,132,144,1,80,108,166,
+	57,243,2,90,2,44,119,177,191,212,13,149,153,25,194,2,229,189,208,147,71,148,164,31,
+	19,172,237,248,158,190,1,39,78,217,158,83,108,45,40,230,156,231,44,41,226,101,186,198,
+	185,217,41,103,151,227,93,73,183,176,139,217,67,198,195,111,94,96,126,167,34,149,52,96,
+	110,136,230,191,2,142,145,136,69,132,12,48,107,228,233,69,60,125,71,7,226,255,183,209,
+	197,162,233,166,112,141,237,127,112,7,251,40,244,143,144,1,80,6,64,33,128,27,221,190,
+	61,42,56,23,59,139,61,143,161,63,157,179,157,50,238,223,80,39,170,67,132,144,1,80,
+	64,157,64,141,109,139,104,21,72,171,118,101,93,192,203,146,249,212,142,68,158,246,237,140,
+	55,135,220,130,82,204,177,203,163,188,115,170,243,246,86,79,148,181,206,231,206,197,78,109,
+	119,169,20,26,38,217,190,54,44,14,116,185,89,91,131,56,11,104,203,146,208,76,18,231,
+	75,188,34,82,202,178,194,156,198,106,114,17,190,12,109,147,214,244,187,93,45,151,198,71,
+	17,112,125,49,79,208,151,114,82,5,33,3,160,12,128,34,198,28,68,129,155,119,70,49,
+	231,92,39,223,247,56,154,227,28,235,126,63,72,43,117,74,84,232,75,160,16,233,74,73,
+	198,210,40,192,243,85,229,77,58,5,16,20,252,59,78,103,12,57,129,181,107,53,71,50,
+	47,18,137,118,10,160,70,114,172,229,102,110,183,85,90,193,3,60,0,20,39,23,135,13,
+	238,231,201,79,240,103,82,173,171,204,91,84,9,240,110,27,243,58,93,221,230,128,17,105,
+	203,175,28,193,91,161,24,12,110,228,86,137,87,68,202,42,30,227,172,196,197,5,60,206,
+	232,29,254,86,156,251,233,158,148,189,162,58,39,187,170,183,55,213,89,24,182,4,170,48,
+	128,1,172,226,21,158,224,67,47,185,122,132,8,148,25,73,159,161,94,202,218,222,58,128,
+	214,11,145,74,234,241,63,55,43,185,221,24,195,46,73,92,166,14,207,48,152,97,110,6,
+	76,89,94,96,119,86,171,107,68,220,145,7,96,188,185,39,132,111,255,111,4,100,184,187,
+	44,192,48,229,71,70,36,207,28,150,89,91,179,44,64,195,102,209,148,96,114,72,126,29,
+	249,212,73,82,62,175,132,208,170,219,53,144,179,130,96,34,67,110,191,249,119,132,196,42,
+	82,64,35,54,152,52,179,91,145,94,12,167,37,165,237,119,184,246,150,184,35,10,31,192,
+	255,126,127,113,3,45,164,18,98,27,162,243,0,12,245,23,178,7,96,200,63,121,0,138,
+	208,121,211,174,135,57,206,217,206,58,39,8,150,59,199,184,211,253,155,213,49,66,200,0,
+	24,103,14,12,105,98,49,40,160,246,93,230,206,117,220,242,91,205,17,233,49,173,141,112,
+	170,180,111,32,146,43,252,59,51,201,118,13,9,41,198,91,79,13,230,172,160,5,179,2,
+	212,139,117,161,228,217,22,194,13,143,154,116,179,117,145,203,151,21,206,174,190,181,189,143,
+	179,201,245,50,105,147,211,39,122,115,195,87,156,70,101,169,133,144,1,80,6,64,17,19,
+	250,216,181,176,172,243,186,19,36,119,56,185,110,66,25,181,85,231,8,25,0,101,0,140,
+	43,37,249,61,164,137,197,34,170,5,212,198,193,73,199,2,92,72,215,8,101,122,140,171,
+	54,69,145,146,224,142,16,250,245,3,242,146,106,83,21,22,134,164,113,83,67,77,171,34,
+	162,97,111,222,10,216,112,253,59,67,165,25,34,37,212,97,101,98,205,220,43,193,226,37,
+	223,233,239,67,207,243,156,115,156,245,158,22,73,235,157,115,156,188,232,77,14,107,24,163,
+	133,151,144,1,80,6,64,17,3,202,216,35,204,87,118,62,119,130,230,85,167,148,93,251,
+	63,11,125,39,150,128,208,51,111,10,33,252,112,142,251,109,57,21,168,75,37,247,103,174,
+	202,21,1,181,241,17,246,76,42,10,202,183,236,202,231,17,202,180,83,128,181,146,227,34,
+	190,13,248,140,115,56,134,77,73,157,97,164,123,195,112,37,234,82,193,203,114,226,76,13,
+	232,140,102,119,222,231,35,14,10,120,82,214,130,7,153,206,80,69,34,22,145,51,215,20,
+	194,191,73,194,55,237,115,124,197,169,116,164,137,203,223,30,92,192,47,220,78,113,79,141,
+	43,206,237,252,194,5,236,65,19,58,68,23,228,172,20,67,248,153,247,56,68,235,2,33,
+	132,200,106,174,182,69,152,175,193,231,236,21,248,101,143,96,44,165,108,149,186,114,130,58,
+	72,196,27,121,0,198,149,50,44,112,147,43,118,168,51,206,89,178,213,59,225,3,103,184,
+	83,213,221,182,219,154,129,181,180,34,247,176,209,199,247,205,21,92,24,249,194,255,67,87,
+	45,251,48,146,182,212,96,106,160,209,255,58,36,217,158,90,172,177,95,167,170,115,142,243,
+	225,214,236,196,75,156,183,156,83,156,114,110,218,55,143,210,26,212,25,74,107,94,8,105,
+	203,250,191,191,153,12,77,210,123,85,8,111,148,52,61,239,70,56,233,196,34,231,125,231,
+	113,103,164,115,138,211,203,105,227,198,123,34,249,223,20,206,80,142,224,24,35,15,64,121,
+	0,138,236,166,6,171,108,235,203,239,67,123,167,189,238,20,179,233,255,12,125,24,22,50,
+	0,202,0,24,71,206,176,39,101,63,207,89,92,100,156,162,145,110,150,8,55,4,218,218,
+	142,188,227,105,106,179,158,199,83,144,187,205,77,10,144,104,210,128,252,59,201,158,23,208,
+	84,113,53,251,38,221,154,27,109,87,41,237,92,235,172,44,114,226,121,142,253,101,238,112,
+	154,6,117,6,210,136,7,125,153,247,189,255,126,165,159,196,45,34,195,24,97,247,73,39,
+	125,217,228,204,112,198,57,183,58,167,56,221,157,234,97,142,200,165,220,68,13,41,138,12,
+	128,50,0,202,0,40,178,142,81,182,21,230,123,161,190,199,238,179,143,128,1,234,36,33,
+	3,160,12,128,241,99,162,249,209,88,211,24,153,225,39,167,137,237,209,58,39,112,143,155,
+	221,120,150,213,174,82,66,60,72,227,244,155,212,166,100,178,212,148,25,1,76,20,151,208,
+	45,233,150,20,179,25,35,155,57,191,26,52,238,19,251,82,244,123,13,234,12,163,30,119,
+	178,54,226,68,4,251,74,236,34,18,254,103,210,196,105,78,166,176,200,249,204,185,195,25,
+	224,180,114,19,90,221,251,111,37,163,168,34,101,145,1,208,191,1,112,66,10,77,104,143,
+	36,61,190,30,73,97,235,39,200,0,40,194,162,34,75,205,218,55,42,244,119,215,64,219,
+	8,248,77,161,40,132,12,128,50,0,198,141,157,205,15,198,90,206,84,203,163,117,158,211,
+	220,246,112,61,48,148,151,202,73,204,177,78,108,78,73,145,84,143,117,61,245,58,38,178,
+	54,213,226,243,164,19,108,180,9,160,29,189,205,87,105,225,204,183,104,220,20,167,166,173,
+	165,173,53,176,51,134,114,140,118,179,37,60,132,223,120,247,177,79,133,240,73,89,150,39,
+	214,193,186,78,38,178,220,249,196,185,213,57,214,254,230,247,30,94,98,4,21,165,50,50,
+	0,250,51,0,206,79,161,9,237,237,164,71,213,219,41,108,253,124,25,0,69,88,92,110,
+	214,189,94,30,178,214,251,101,165,211,202,54,6,142,82,71,9,25,0,101,0,140,23,87,
+	152,30,138,37,93,69,102,152,238,84,50,63,90,239,13,169,237,99,173,19,155,111,82,36,
+	213,155,93,79,189,110,142,176,85,197,24,197,38,223,147,196,103,40,31,72,43,30,52,103,
+	2,155,233,66,227,190,113,74,152,219,122,137,6,118,134,208,159,217,169,91,246,176,142,27,
+	41,171,78,16,33,98,12,177,113,130,147,217,44,112,94,112,206,118,58,57,57,193,141,201,
+	197,140,240,146,245,73,200,0,248,31,173,83,244,38,41,229,228,39,61,150,242,163,137,185,
+	89,196,175,181,103,95,96,25,0,133,75,114,204,123,143,202,59,179,35,121,83,125,107,243,
+	91,31,167,174,18,241,164,44,251,242,151,97,104,188,200,206,114,144,205,82,62,48,61,20,
+	175,119,249,112,125,212,230,94,157,42,3,160,67,251,148,72,245,35,215,147,175,15,35,110,
+	89,71,190,246,49,69,156,205,192,192,90,96,76,72,242,132,75,141,27,105,110,239,187,26,
+	216,25,64,43,222,79,102,217,82,222,25,226,124,224,92,239,52,77,110,249,243,183,34,2,
+	138,16,151,63,191,153,180,239,113,39,59,152,227,60,233,156,108,15,7,226,246,183,128,179,
+	20,150,93,6,64,239,6,192,84,197,209,27,22,200,40,26,150,33,241,11,101,0,20,174,
+	233,110,214,189,219,35,123,71,157,98,214,218,141,212,86,103,137,184,209,137,7,89,233,202,
+	4,112,99,138,226,169,137,240,40,102,138,165,87,215,89,235,242,209,90,224,236,98,214,158,
+	154,161,180,222,141,1,240,174,148,44,250,150,186,158,124,45,139,220,180,158,199,137,252,238,
+	97,122,56,143,11,40,19,216,213,107,155,174,213,193,41,112,169,113,171,157,218,166,54,175,
+	82,166,215,52,167,12,35,146,137,250,215,201,121,112,107,134,104,199,249,222,25,234,148,73,
+	102,9,244,81,32,155,219,133,216,145,163,204,126,67,203,156,236,98,134,115,135,211,211,77,
+	162,38,251,239,119,246,151,250,200,0,232,141,141,206,94,41,48,160,213,245,220,206,68,134,
+	181,186,41,104,253,94,206,70,25,0,69,88,140,49,233,74,27,103,67,132,49,108,45,59,
+	213,206,83,103,137,248,80,146,115,152,226,233,85,177,137,241,236,35,193,101,17,205,77,253,
+	125,109,112,1,140,195,209,26,55,6,192,165,1,26,175,2,145,106,90,76,151,114,185,212,
+	85,18,149,79,25,66,169,64,175,188,95,80,254,48,35,204,109,111,166,193,157,198,28,205,
+	223,126,151,43,149,156,179,157,159,139,156,222,221,238,180,212,102,96,145,78,228,242,147,73,
+	235,250,58,217,201,34,231,127,78,63,167,92,242,198,137,177,52,144,18,201,0,232,77,247,
+	118,139,216,128,214,192,152,180,204,27,191,58,13,34,110,253,110,190,100,44,3,160,112,69,
+	105,150,153,116,229,153,72,223,75,87,154,245,246,7,117,151,136,7,57,244,243,157,21,244,
+	61,218,73,128,89,194,161,166,158,254,221,195,163,117,137,147,103,210,153,83,83,102,0,116,
+	56,33,114,169,30,235,105,60,29,147,146,158,255,159,181,93,63,209,48,132,235,158,150,248,
+	138,197,60,197,209,153,100,110,253,193,26,220,105,74,93,198,251,95,106,221,186,141,223,95,
+	81,158,200,99,157,30,254,23,67,127,210,83,221,35,2,100,128,89,227,94,113,178,153,85,
+	206,171,78,63,167,100,114,6,138,229,92,64,113,41,146,12,128,238,89,235,220,96,79,19,
+	22,208,175,188,115,86,64,222,127,255,25,215,206,114,202,71,212,250,154,206,13,174,119,249,
+	200,0,40,124,176,191,73,83,154,70,232,255,231,56,142,179,216,54,178,234,169,195,194,67,
+	49,61,210,133,246,60,76,39,223,71,247,100,2,143,112,1,43,36,200,44,88,140,39,164,
+	186,167,20,153,149,105,203,79,190,174,19,58,67,120,42,226,43,118,242,88,251,185,200,101,
+	82,153,190,214,58,127,241,103,8,87,54,188,98,119,246,20,251,189,21,85,89,156,158,26,
+	39,18,211,143,251,169,234,231,192,118,156,199,177,22,91,64,14,135,112,8,63,112,59,207,
+	178,209,251,37,26,240,46,99,56,159,149,234,38,17,0,101,184,206,84,92,135,67,178,252,
+	246,143,224,8,150,242,60,79,240,149,223,147,148,231,102,78,230,44,62,144,58,9,119,148,
+	228,82,46,226,7,102,225,132,124,165,218,116,162,116,192,231,172,202,93,140,102,2,243,66,
+	110,123,14,141,232,160,72,41,34,92,140,123,191,206,137,216,40,84,133,129,230,140,148,251,
+	240,164,186,76,100,51,57,12,79,38,246,210,214,223,44,186,75,152,25,207,133,137,123,184,
+	139,199,175,43,125,77,218,114,71,40,173,31,235,82,87,91,69,44,213,143,60,141,164,15,
+	83,208,239,231,187,218,126,21,6,119,38,190,226,209,30,53,110,119,83,235,207,215,224,78,
+	59,42,243,148,223,40,69,111,184,142,14,185,153,153,206,217,78,89,127,111,182,63,244,102,
+	19,129,112,189,89,211,174,119,226,195,239,206,213,78,227,100,230,155,79,4,148,131,94,164,
+	27,129,123,0,138,240,183,248,203,3,80,184,194,144,114,176,132,179,48,114,205,253,198,172,
+	185,143,170,195,194,67,121,100,83,79,93,62,230,14,74,6,112,166,134,124,200,181,234,211,
+	12,199,16,245,170,162,231,213,189,129,212,78,222,7,69,122,181,28,58,120,170,223,41,242,
+	81,148,195,208,148,245,69,185,88,104,156,40,204,225,252,198,241,222,39,13,199,243,19,159,
+	115,40,57,158,142,107,196,157,252,201,181,84,241,222,206,198,124,200,13,148,80,135,137,164,
+	104,109,14,42,94,154,97,49,18,70,11,70,48,157,183,233,229,113,28,111,101,0,63,209,
+	77,74,37,132,16,25,66,121,58,38,46,60,132,106,145,55,104,55,90,154,138,247,83,151,
+	133,135,140,69,169,102,103,190,12,208,187,33,143,43,120,83,11,237,140,102,67,226,162,245,
+	30,79,181,214,84,184,46,165,119,121,98,164,81,132,118,242,104,201,170,64,211,136,229,177,
+	47,205,83,214,23,235,99,161,113,98,71,29,127,144,215,188,231,2,239,201,4,158,98,23,
+	159,23,173,202,21,252,201,141,158,54,150,111,121,179,93,202,4,211,212,85,8,11,197,120,
+	194,156,62,105,176,191,157,240,25,189,0,56,144,241,76,229,108,127,217,118,26,243,9,119,
+	6,242,241,90,8,33,68,216,116,54,173,188,14,79,73,147,142,48,21,54,160,182,58,45,
+	188,247,191,72,37,7,240,121,224,57,213,122,243,153,2,103,102,48,134,104,87,115,61,158,
+	106,142,169,48,181,241,34,107,114,88,132,87,235,20,193,17,201,113,170,52,78,68,200,174,
+	252,236,221,231,180,39,223,240,30,237,147,188,116,57,46,102,26,231,120,183,27,180,229,43,
+	206,82,215,9,159,92,98,126,170,151,226,146,152,10,166,25,119,50,151,59,252,76,69,115,
+	56,155,137,50,204,11,33,68,6,96,12,35,191,119,74,154,180,143,185,184,185,58,45,44,
+	100,0,76,37,253,121,203,187,43,132,11,218,241,9,245,37,222,12,101,73,226,162,233,158,
+	108,40,5,166,20,32,198,235,68,194,144,8,175,149,238,6,192,90,41,250,244,182,153,165,
+	137,139,126,244,20,180,59,159,63,124,94,71,68,202,64,62,241,154,79,122,119,222,231,61,
+	118,11,168,1,53,184,157,233,12,245,26,112,186,4,119,241,140,63,103,37,17,115,90,115,
+	185,185,194,89,177,206,82,84,129,225,204,224,25,243,118,172,68,146,253,138,203,148,187,64,
+	8,33,210,28,131,1,112,167,192,189,145,220,209,213,252,49,184,165,58,45,44,100,0,76,
+	29,125,120,50,180,132,59,77,248,80,57,55,51,148,105,137,139,54,242,158,135,19,125,107,
+	202,200,106,188,78,36,28,224,213,4,145,4,233,110,0,28,18,233,134,232,29,153,154,184,
+	104,33,223,123,56,209,187,108,242,121,29,17,25,165,121,140,255,121,75,148,216,134,215,249,
+	58,240,96,44,245,120,144,95,233,231,53,2,217,177,124,173,111,194,194,35,37,108,219,127,
+	43,113,81,236,133,84,140,99,153,196,11,222,51,6,148,224,122,62,240,30,78,64,8,33,
+	68,132,24,204,105,157,83,212,164,50,230,156,144,45,212,105,97,33,3,96,170,56,156,231,
+	66,93,244,55,227,67,106,72,204,25,200,20,83,225,35,30,78,244,72,18,215,137,228,217,
+	115,82,68,87,242,154,2,4,162,77,3,146,27,169,55,100,97,166,70,164,113,50,0,166,
+	158,6,124,226,45,1,79,89,174,102,98,104,251,245,91,240,2,31,179,179,183,131,218,242,
+	61,253,212,149,194,3,183,216,62,233,140,76,65,248,243,244,92,18,244,99,18,255,163,137,
+	215,3,123,240,125,96,14,194,66,8,33,194,176,12,36,36,117,223,85,141,78,126,202,96,
+	29,226,219,94,164,130,142,60,29,186,207,79,115,222,162,140,68,157,113,44,101,122,226,194,
+	241,124,227,242,52,51,120,194,84,188,34,229,6,64,24,28,209,182,161,157,60,39,179,141,
+	54,13,200,193,17,250,66,22,197,111,166,40,128,143,51,211,229,105,190,228,29,83,241,84,
+	242,53,184,83,204,65,252,200,174,94,14,56,132,223,24,17,114,250,221,238,76,228,14,111,
+	177,48,202,243,60,119,166,212,107,86,100,18,71,219,98,71,182,226,52,73,105,43,197,25,
+	200,100,238,246,26,125,189,30,159,112,162,164,39,132,16,105,74,149,196,69,169,219,107,219,
+	220,103,139,69,114,200,0,152,10,234,243,166,183,56,70,37,168,69,19,239,227,160,51,143,
+	171,135,51,144,143,18,23,57,156,230,42,153,106,1,167,154,51,184,126,202,198,148,223,103,
+	61,14,140,228,58,157,34,60,202,15,167,166,184,31,54,240,89,226,194,117,156,238,42,14,
+	224,90,219,18,250,67,13,236,148,146,195,85,188,73,101,247,7,236,204,39,140,141,36,152,
+	108,49,134,243,59,199,123,217,12,156,195,217,188,227,229,110,68,108,105,193,195,54,101,186,
+	71,214,228,29,40,201,153,76,231,106,111,169,122,74,241,56,15,134,252,189,64,8,33,132,
+	63,202,37,46,170,147,194,165,160,129,242,234,180,176,144,121,40,21,51,171,87,221,126,90,
+	45,197,113,60,193,12,214,49,143,25,44,102,3,223,112,43,93,220,95,171,159,45,240,181,
+	72,67,222,53,21,254,192,105,46,12,50,87,242,190,185,194,59,105,113,167,209,108,125,77,
+	111,3,96,131,136,204,160,38,140,161,37,223,230,106,235,9,28,134,242,115,18,90,45,66,
+	166,24,15,48,210,189,133,173,44,87,243,61,221,35,108,96,109,158,242,186,25,120,31,190,
+	72,177,239,172,72,127,202,242,162,109,9,49,148,125,37,167,34,40,195,8,126,229,32,111,
+	7,13,229,163,20,174,36,133,16,66,36,178,62,24,62,207,164,206,210,86,206,84,40,3,
+	160,200,34,238,195,113,243,171,226,220,236,44,117,138,102,146,51,192,201,117,117,22,54,218,
+	114,108,139,180,163,52,203,204,189,122,170,179,209,73,76,129,115,181,77,43,54,132,22,176,
+	123,172,59,237,222,218,142,40,150,10,31,123,106,211,191,191,143,34,234,237,235,61,180,105,
+	108,72,109,168,195,70,243,149,175,113,76,108,112,78,177,181,124,137,55,87,18,17,240,252,
+	106,188,23,221,63,200,153,227,164,134,13,206,53,78,113,47,163,116,14,237,213,189,34,33,
+	185,188,106,211,161,134,206,114,71,152,120,217,105,232,237,221,57,55,226,36,90,34,88,118,
+	50,245,238,34,13,136,52,100,145,121,68,42,142,154,0,168,106,210,146,105,41,211,222,177,
+	38,221,93,164,110,19,217,194,49,110,38,80,57,206,153,206,18,203,144,153,232,236,230,110,
+	50,54,79,217,217,50,142,49,182,94,237,225,204,72,160,23,115,157,195,237,58,49,46,180,
+	150,143,245,104,102,187,36,116,89,230,216,204,169,9,126,249,145,248,71,23,103,78,26,24,
+	0,225,109,219,181,251,56,243,19,104,220,116,167,155,189,229,15,106,80,167,140,90,124,239,
+	94,199,202,56,119,56,5,41,93,202,252,236,180,247,50,78,87,208,91,93,44,18,48,218,
+	62,215,122,91,214,3,43,171,156,43,157,82,94,70,229,114,122,74,249,100,0,20,50,0,
+	138,180,154,11,26,180,100,86,202,180,247,93,243,187,68,136,172,160,14,75,236,147,167,58,
+	206,187,46,189,37,174,116,242,220,76,198,94,149,224,51,140,157,41,176,245,106,105,103,184,
+	51,101,7,141,248,211,185,220,169,224,70,35,14,72,27,3,224,12,47,129,191,124,209,220,
+	151,249,47,170,73,83,127,79,45,10,207,0,216,219,126,245,138,206,149,206,95,59,104,220,
+	239,206,217,110,22,134,155,104,163,65,157,34,154,50,205,189,134,237,153,194,175,192,255,177,
+	222,185,218,221,155,237,95,63,226,83,212,205,162,8,78,178,107,207,80,217,14,92,50,201,
+	233,228,229,93,181,142,99,165,128,50,0,10,25,0,69,218,80,209,164,37,147,83,166,189,
+	175,154,93,152,68,72,20,147,8,34,101,140,61,108,249,206,188,229,50,240,122,49,174,97,
+	79,142,102,133,173,226,17,156,192,83,18,126,6,241,11,111,112,184,185,202,26,238,228,78,
+	218,208,133,70,148,101,13,127,242,29,63,82,224,230,236,223,166,81,60,182,38,236,29,242,
+	102,219,142,190,143,236,196,180,208,239,127,88,154,244,195,120,38,216,182,109,229,115,45,215,
+	211,158,221,104,64,105,86,49,147,175,152,236,238,236,175,49,73,131,58,37,236,197,235,84,
+	117,87,181,52,215,51,60,45,194,2,23,103,4,251,115,34,51,220,206,98,30,164,58,55,
+	168,179,197,118,244,182,251,29,55,228,22,201,201,37,173,249,154,91,185,146,13,238,170,151,
+	224,105,234,74,188,217,199,19,222,50,24,138,72,88,37,17,8,59,171,211,83,135,86,249,
+	110,179,16,153,194,177,246,239,166,251,57,43,60,218,206,191,115,170,216,191,198,46,82,42,
+	237,12,99,23,54,248,246,92,179,253,246,11,177,221,99,61,183,230,153,144,37,121,115,226,
+	107,151,119,202,155,90,118,115,232,189,220,210,238,233,25,145,7,32,28,24,154,190,173,151,
+	255,95,138,216,155,85,110,123,169,99,10,191,255,22,205,74,103,152,23,45,27,165,238,22,
+	219,176,59,43,109,58,83,204,249,76,174,67,30,249,198,105,225,101,84,222,25,186,135,191,
+	8,158,157,66,155,11,232,151,154,159,60,0,197,102,214,37,214,146,55,82,246,86,185,217,
+	164,187,191,168,211,194,66,89,128,163,163,12,55,218,170,116,227,53,115,62,156,34,232,204,
+	7,118,23,143,170,92,163,14,200,40,126,230,238,144,206,252,44,31,164,213,157,30,233,214,
+	67,201,39,6,191,182,14,116,240,121,100,64,12,75,163,229,209,59,188,20,210,153,111,151,
+	255,95,74,216,139,177,148,113,87,117,0,159,211,42,205,154,95,150,7,120,198,189,183,201,
+	37,17,24,236,69,166,208,150,241,118,213,185,137,174,9,74,254,228,37,46,226,72,174,231,
+	11,183,30,111,49,97,55,126,224,98,247,11,135,179,121,156,226,146,154,16,66,164,1,11,
+	19,23,205,74,89,163,140,87,94,160,78,19,153,207,181,182,175,52,157,156,149,62,237,231,
+	95,57,165,237,217,128,119,81,23,100,20,229,153,30,194,151,192,5,212,14,181,213,99,125,
+	180,105,120,136,237,49,166,0,57,215,57,215,212,174,101,33,155,231,74,187,137,8,26,153,
+	7,32,212,101,97,8,26,55,213,243,55,13,17,4,123,177,220,93,15,149,116,30,74,99,
+	143,163,223,156,214,238,117,237,38,117,187,0,42,243,167,93,91,142,74,144,236,230,109,167,
+	227,118,245,202,58,7,56,159,200,245,111,7,25,85,115,63,42,95,149,9,48,195,144,7,
+	160,60,0,69,118,242,121,98,45,57,43,101,239,147,3,76,186,251,136,58,45,44,228,1,
+	24,21,77,184,192,92,161,14,175,249,142,173,177,7,79,216,186,50,143,123,181,25,35,163,
+	88,65,127,214,5,124,206,2,6,166,97,72,213,33,161,78,101,43,38,46,236,100,118,242,
+	171,24,242,180,169,191,61,34,104,164,204,97,32,78,192,231,92,71,127,86,106,48,71,206,
+	158,140,167,188,155,138,13,248,52,173,115,104,180,228,107,250,186,173,124,33,163,213,245,130,
+	27,105,96,171,210,140,71,138,152,16,205,100,95,122,49,113,187,191,173,226,93,14,230,43,
+	73,117,27,14,228,7,118,115,91,249,8,158,83,180,113,33,132,72,57,127,38,46,154,144,
+	162,38,57,230,43,255,169,78,11,11,25,0,163,98,20,165,76,197,37,121,141,122,73,156,
+	190,47,23,217,170,116,229,72,117,67,70,49,129,51,2,62,227,85,188,147,134,247,217,150,
+	61,66,59,119,39,115,97,167,36,142,78,154,83,211,174,39,198,7,28,42,192,97,24,63,
+	104,32,71,78,23,183,230,191,131,188,44,228,83,68,121,94,224,14,183,78,68,23,49,66,
+	221,31,115,58,50,216,86,165,12,47,21,241,101,104,60,157,19,100,164,90,73,111,190,151,
+	100,183,161,30,159,218,197,252,47,125,120,154,60,201,76,8,33,82,202,31,137,139,126,76,
+	81,184,139,25,44,246,217,98,33,50,129,182,108,50,187,104,223,157,180,19,237,6,167,155,
+	205,13,252,39,249,0,102,28,87,4,184,13,224,254,8,218,59,214,87,203,194,115,242,190,
+	197,148,2,100,147,179,201,156,6,36,204,28,134,29,124,200,105,108,4,61,120,87,128,26,
+	119,137,6,112,10,216,141,124,119,253,115,185,179,41,99,54,29,190,239,84,114,171,117,151,
+	75,5,98,76,14,159,216,52,36,199,121,174,8,13,187,219,201,53,30,85,213,249,89,123,
+	127,119,224,65,167,132,219,81,249,152,220,13,50,232,13,162,77,179,217,245,219,77,74,45,
+	0,232,99,210,147,15,83,242,22,185,215,172,187,173,212,105,34,179,121,193,252,120,222,63,
+	65,52,26,111,252,109,95,34,245,81,87,100,28,215,4,52,5,248,32,146,111,240,254,12,
+	128,43,220,249,43,249,224,163,196,87,237,238,56,142,227,116,55,181,235,163,16,37,245,64,
+	154,26,0,243,248,48,32,141,27,161,193,155,2,26,51,223,77,239,228,57,247,103,152,177,
+	225,87,167,129,91,205,27,38,53,136,45,3,236,250,49,170,8,237,186,213,201,177,30,215,
+	91,22,191,66,124,231,126,84,142,209,7,232,12,225,48,153,204,178,236,119,152,148,90,0,
+	208,192,164,39,23,166,228,29,114,136,73,115,151,235,195,145,200,108,90,153,253,255,42,57,
+	179,3,26,72,15,217,94,3,218,142,151,137,156,201,198,0,166,0,243,169,146,182,6,64,
+	135,161,161,180,198,146,2,196,113,156,84,165,1,169,192,138,52,53,0,86,113,103,64,178,
+	252,54,164,225,6,231,56,80,133,223,221,244,79,89,103,108,6,26,27,230,58,29,220,105,
+	223,122,246,151,42,196,146,242,204,177,105,199,137,69,104,214,253,174,244,170,132,179,76,22,
+	191,66,204,113,218,185,125,43,220,34,5,205,8,154,203,100,150,101,191,230,82,106,177,133,
+	121,137,245,164,81,10,246,132,44,51,167,48,253,72,29,22,30,178,173,70,99,192,49,202,
+	121,4,117,3,186,208,16,186,152,43,180,103,111,117,71,198,113,15,251,49,55,233,179,212,
+	228,230,52,190,199,112,18,129,24,83,128,116,6,176,165,1,105,22,210,253,158,144,182,185,
+	113,111,161,102,210,231,88,64,111,30,208,192,141,156,18,188,72,11,123,181,170,188,203,33,
+	25,120,123,181,249,148,94,110,42,22,231,37,101,189,143,37,87,82,199,92,97,95,30,42,
+	244,183,247,56,203,213,201,215,243,166,36,92,136,58,124,226,118,90,121,62,215,74,94,25,
+	192,84,54,74,8,89,196,38,166,74,8,98,11,159,39,46,154,197,199,145,55,231,41,214,
+	152,138,63,83,135,137,76,166,188,57,34,83,107,103,125,128,214,244,9,150,56,54,60,175,
+	14,201,72,106,240,124,210,95,1,11,232,25,122,59,199,250,110,93,135,16,90,115,156,233,
+	138,83,28,199,113,156,223,205,173,58,54,36,57,77,244,37,163,240,61,0,123,80,144,180,
+	158,61,67,117,13,216,20,144,195,147,110,250,167,169,51,53,131,253,141,214,57,39,184,211,
+	194,217,73,101,213,18,153,72,51,214,154,181,162,157,179,180,144,70,77,113,31,93,210,25,
+	32,135,191,34,89,235,28,237,86,134,167,73,77,51,128,111,228,53,151,69,191,175,165,208,
+	98,43,39,155,116,165,127,196,111,142,2,103,23,179,238,118,81,135,137,76,230,44,243,195,
+	249,237,128,7,212,96,219,214,188,186,234,146,12,101,127,126,74,114,34,48,141,210,105,107,
+	0,188,39,132,214,88,82,128,56,142,147,154,52,32,123,250,148,81,216,6,192,210,76,75,
+	82,195,126,96,95,13,212,20,113,131,155,30,106,231,44,204,112,99,67,129,115,182,59,93,
+	156,144,182,94,182,34,28,198,155,53,162,133,243,79,17,166,171,142,30,158,111,135,202,214,
+	151,128,141,206,105,110,183,231,247,148,162,166,61,173,109,105,11,245,203,152,223,38,90,75,
+	161,197,86,106,153,62,242,231,69,252,121,248,77,179,238,46,86,246,120,145,201,228,48,217,
+	164,224,7,134,16,39,169,180,121,72,93,173,78,201,96,109,58,156,207,147,154,12,140,74,
+	157,1,208,242,165,103,105,8,198,73,107,10,144,20,165,1,121,34,77,13,128,163,146,210,
+	173,207,56,84,97,222,83,198,73,110,250,104,151,140,55,255,109,54,1,158,229,78,35,95,
+	151,62,198,136,195,205,218,144,235,124,87,132,46,157,235,233,25,215,83,150,62,3,55,186,
+	147,98,62,109,165,172,105,207,5,50,157,101,201,239,2,41,179,216,14,163,127,239,224,72,
+	223,25,123,153,117,247,9,117,150,200,100,118,49,63,156,63,11,97,72,13,55,15,169,73,
+	234,148,12,103,39,70,242,157,207,196,32,27,66,217,106,235,202,0,120,137,83,215,220,182,
+	1,129,155,75,13,41,64,206,115,183,4,204,15,33,78,106,85,214,164,165,1,112,103,214,
+	251,106,213,70,190,101,68,104,209,18,133,187,190,91,101,239,169,150,206,188,44,49,53,184,
+	54,1,94,44,213,136,9,37,153,106,214,133,83,138,208,163,143,93,228,254,221,246,183,175,
+	172,124,70,238,115,39,207,233,84,147,194,166,61,231,4,16,14,68,191,212,254,10,184,80,
+	138,44,118,224,76,243,135,178,239,35,123,95,188,96,211,223,253,212,89,97,162,239,227,97,
+	115,17,163,19,23,238,203,7,33,92,114,46,141,89,111,170,208,144,191,212,49,25,79,101,
+	246,160,21,205,169,73,57,42,147,207,74,150,49,192,197,136,254,142,46,108,10,209,0,152,
+	48,187,192,21,56,92,111,58,246,83,122,4,218,150,230,76,73,92,248,52,199,109,253,215,
+	9,230,179,76,11,88,70,23,248,78,199,242,38,135,134,214,115,185,124,238,34,222,134,195,
+	147,84,162,28,21,89,202,74,22,48,149,201,124,205,50,13,199,148,82,142,239,104,105,171,
+	212,146,143,168,21,122,83,22,241,39,149,104,28,122,126,49,135,179,221,68,13,216,200,190,
+	10,35,29,11,174,228,26,243,235,114,74,161,208,164,235,105,207,111,158,46,50,136,199,36,
+	105,35,247,184,75,168,242,57,61,89,39,105,165,57,135,240,10,197,237,213,202,208,92,59,
+	245,34,100,19,211,88,229,166,226,70,250,243,138,228,37,118,160,10,115,41,153,184,120,111,
+	62,140,196,52,180,138,157,153,105,170,48,139,166,20,168,187,68,230,242,145,201,190,253,106,
+	72,118,245,227,204,86,245,97,234,150,44,229,15,87,95,5,207,9,177,5,6,15,192,43,
+	156,63,204,41,106,10,220,100,48,245,192,177,38,41,252,182,117,180,252,22,109,26,144,28,
+	179,167,74,217,84,121,0,158,227,74,119,254,208,32,75,67,92,36,255,104,225,204,13,61,
+	61,199,157,78,171,45,87,171,236,156,230,252,29,186,23,224,25,110,52,118,94,4,86,79,
+	145,106,234,177,210,172,7,119,23,161,65,215,122,246,168,185,86,78,126,86,110,119,39,203,
+	103,229,126,144,1,244,118,183,91,161,147,179,68,138,31,17,249,206,30,238,70,216,58,14,
+	151,2,139,34,121,193,172,59,183,70,162,201,67,108,26,60,66,29,37,50,153,114,166,77,
+	117,141,157,141,33,13,172,175,204,195,234,101,117,76,150,242,150,171,137,193,42,26,167,198,
+	0,232,56,61,205,45,187,41,208,182,220,154,248,74,21,182,164,0,217,108,72,168,24,101,
+	26,144,158,38,9,20,115,6,165,198,0,216,128,21,174,116,231,77,13,178,180,227,116,123,
+	191,53,9,125,243,239,108,167,243,14,215,172,232,188,25,186,9,240,68,55,58,251,78,232,
+	238,136,34,205,23,52,109,156,13,133,180,103,142,83,198,179,1,240,21,217,31,92,224,210,
+	176,122,153,212,86,38,64,33,243,159,136,28,75,26,194,146,206,196,208,53,249,37,155,6,
+	175,209,167,219,176,209,196,56,92,118,54,57,208,15,11,205,109,126,15,115,160,183,78,234,
+	152,44,197,93,124,199,50,220,155,170,6,14,49,23,159,100,114,76,247,140,65,207,59,108,
+	243,232,203,161,93,148,163,229,84,83,225,161,212,75,77,199,220,227,50,99,170,34,136,166,
+	27,237,236,38,234,42,188,21,242,92,106,37,7,240,253,14,127,203,167,15,159,134,122,213,
+	28,198,176,191,189,218,1,92,46,53,201,106,186,209,215,92,225,110,138,21,250,219,72,86,
+	123,158,46,247,144,172,93,112,133,187,1,119,173,155,193,43,82,204,120,250,176,214,94,109,
+	2,251,179,84,210,10,153,229,28,200,215,110,42,174,231,104,94,151,188,68,2,190,52,79,
+	205,214,113,52,43,67,109,192,28,251,70,196,199,153,175,142,10,151,108,55,0,150,164,42,
+	77,168,74,101,202,166,228,250,59,155,10,15,11,241,194,198,115,55,160,66,68,247,95,158,
+	202,91,122,160,148,6,91,4,184,53,207,244,230,152,212,52,240,200,66,113,152,182,163,90,
+	128,49,238,114,104,159,184,176,179,225,191,118,160,99,160,79,201,90,230,161,153,162,221,249,
+	199,186,150,187,12,128,233,69,57,94,182,101,207,46,201,171,246,0,129,73,50,146,201,69,
+	174,66,78,102,67,168,215,45,206,11,180,177,87,187,154,110,82,149,172,165,24,247,152,183,
+	147,246,103,159,66,127,155,194,163,158,47,212,129,42,146,182,43,174,115,147,125,39,151,167,
+	168,45,89,165,61,50,1,166,9,50,255,137,192,176,236,38,154,206,121,33,94,188,128,19,
+	88,108,171,164,221,70,17,76,157,178,135,146,52,162,41,77,104,74,19,26,80,129,74,148,
+	163,68,161,39,232,28,22,48,155,249,204,97,54,147,152,198,198,80,219,212,54,113,81,67,
+	90,133,120,225,3,25,153,184,48,135,54,124,21,240,5,43,210,154,22,212,165,38,117,168,
+	69,109,106,81,102,135,26,27,89,65,62,171,152,203,44,102,50,147,153,204,98,129,134,96,
+	160,76,118,93,243,110,222,103,81,244,13,44,193,0,110,51,85,24,194,75,1,93,170,57,
+	21,19,23,118,50,252,215,14,84,160,25,83,3,19,192,41,38,159,224,38,236,207,231,209,
+	119,74,21,110,15,65,195,68,20,220,64,83,115,133,28,198,208,61,228,70,172,228,129,4,
+	37,51,120,149,163,67,189,118,37,222,97,15,102,155,43,229,241,63,118,118,23,55,93,100,
+	28,167,177,139,169,184,108,145,57,151,70,251,152,250,29,42,89,187,102,20,139,121,216,86,
+	169,6,79,114,128,194,188,167,61,227,233,195,43,246,143,248,19,216,159,247,168,44,121,133,
+	130,204,127,34,32,242,184,142,139,108,149,198,208,139,62,33,53,96,52,31,219,43,189,200,
+	121,9,39,150,66,108,161,62,199,112,39,223,177,193,71,146,244,117,252,196,51,92,202,33,
+	33,125,218,253,32,241,181,251,134,186,191,126,141,147,103,186,239,193,129,220,93,14,109,56,
+	153,91,120,155,191,124,38,169,255,135,55,185,138,222,84,149,26,7,66,89,54,185,150,253,
+	163,161,180,192,18,3,208,113,126,115,114,76,173,218,68,163,128,90,114,156,233,238,167,108,
+	55,90,126,143,42,13,72,30,179,76,87,26,237,56,206,21,209,199,0,124,204,181,206,108,
+	74,145,39,181,40,154,61,216,104,235,179,235,35,136,75,52,222,112,253,147,34,184,254,4,
+	167,156,93,119,111,146,186,100,37,149,89,100,238,249,235,138,208,152,121,78,73,31,243,149,
+	169,10,65,230,129,245,182,136,191,155,127,87,74,133,51,130,94,138,5,152,33,177,255,14,
+	147,178,10,3,85,120,199,221,251,174,74,72,137,220,190,113,138,187,125,231,142,9,52,40,
+	148,200,34,74,115,36,79,242,183,79,211,83,225,165,237,47,220,203,49,212,9,180,141,147,
+	19,95,113,100,200,47,140,22,166,187,189,34,169,187,42,198,238,156,207,235,182,137,183,167,
+	223,52,198,112,184,204,11,73,51,211,181,196,11,232,153,10,3,160,227,236,101,110,215,200,
+	128,90,226,50,5,72,164,105,64,14,51,221,121,9,103,65,42,12,128,123,83,224,90,103,
+	148,3,56,157,40,197,111,182,30,59,49,146,197,201,253,134,22,236,19,73,11,94,53,127,
+	86,112,112,216,200,174,82,153,44,228,110,91,250,155,53,69,232,203,149,62,230,40,187,203,
+	10,225,217,104,209,198,205,204,123,63,41,177,76,128,66,230,63,17,1,45,236,179,198,255,
+	126,221,67,72,84,186,210,105,238,229,189,251,165,194,68,136,237,41,71,127,94,96,101,128,
+	230,167,237,77,81,183,179,79,64,155,163,255,73,124,157,103,67,126,101,28,106,186,199,59,
+	125,222,79,77,134,48,54,52,201,59,172,225,45,78,163,190,84,220,55,111,122,144,246,31,
+	33,24,92,93,24,0,31,51,183,234,239,128,114,227,124,156,248,26,61,10,141,150,238,166,
+	22,125,20,152,116,198,153,238,252,56,199,137,222,0,88,154,105,30,52,102,172,6,88,26,
+	49,202,214,95,109,157,85,145,44,79,110,51,180,161,75,68,75,164,11,236,218,251,115,161,
+	144,32,34,211,105,197,122,115,175,191,81,132,174,108,114,234,250,152,157,60,38,59,132,103,
+	254,112,170,219,37,59,95,217,30,101,2,20,50,255,137,8,70,240,10,111,111,189,27,2,
+	215,230,65,94,223,188,179,205,185,20,132,127,50,47,9,72,123,30,225,31,158,163,95,104,
+	222,98,205,56,135,15,89,192,147,244,165,124,82,103,202,51,109,44,174,17,178,160,140,231,
+	175,238,227,187,193,197,124,193,92,198,112,72,136,126,122,165,56,136,251,248,139,207,24,104,
+	11,109,47,138,196,75,140,182,198,73,122,130,250,164,63,149,76,197,245,232,21,192,69,60,
+	164,0,41,250,47,219,16,84,26,144,6,28,96,42,62,53,21,157,113,53,205,66,210,46,
+	17,46,237,56,223,92,161,28,47,20,10,196,154,205,214,208,174,182,42,59,115,169,212,38,
+	203,184,205,20,83,21,246,47,50,110,223,71,204,241,124,161,218,1,70,130,136,15,141,121,
+	197,190,135,171,38,143,101,125,58,194,236,224,109,142,84,58,144,168,201,119,31,251,175,31,
+	111,72,94,34,33,71,242,26,229,188,28,208,131,131,3,111,196,32,115,200,222,194,212,229,
+	83,251,228,78,248,33,147,94,187,121,244,225,99,126,224,228,72,76,67,85,56,129,23,249,
+	135,231,232,229,219,35,169,162,233,200,106,33,223,128,209,198,231,37,230,94,53,134,243,19,
+	191,115,35,123,70,166,47,93,249,31,115,185,215,100,196,17,69,226,45,75,235,5,116,136,
+	190,137,165,109,75,169,33,1,92,196,67,10,144,162,255,178,13,21,60,25,201,18,115,170,
+	233,121,208,42,21,239,184,93,60,166,250,82,14,224,244,121,27,62,102,54,125,192,131,161,
+	166,153,74,55,138,241,172,253,157,122,89,172,68,146,253,28,98,254,88,84,130,187,139,252,
+	251,211,62,46,117,166,130,17,249,156,202,61,100,175,212,139,115,36,169,140,64,38,192,136,
+	201,167,151,204,127,34,8,78,231,37,47,47,177,250,60,199,199,94,141,117,46,232,193,4,
+	238,244,150,42,168,18,239,112,144,58,48,120,50,197,0,88,156,51,153,193,203,244,136,248,
+	186,165,232,207,120,254,100,20,45,125,181,218,64,249,144,155,94,193,188,90,114,183,200,60,
+	152,151,152,195,29,33,60,5,220,12,250,211,249,129,111,233,171,175,195,30,240,230,163,85,
+	140,7,3,218,112,235,137,97,182,101,93,242,145,56,59,121,43,236,148,196,217,92,82,130,
+	147,205,111,231,156,232,159,254,15,216,140,72,73,105,151,8,143,65,54,211,253,169,28,23,
+	51,145,212,227,57,219,195,172,68,145,9,97,69,102,82,220,22,157,245,92,90,20,249,247,
+	119,60,95,170,42,103,74,222,62,25,232,198,241,246,218,128,62,178,137,176,145,9,48,66,
+	100,254,19,1,113,33,247,186,95,73,151,226,10,126,167,127,72,77,41,198,217,76,225,20,
+	47,11,251,50,188,22,90,74,226,24,147,25,166,149,35,249,149,187,105,152,178,235,215,229,
+	18,126,227,75,142,245,184,92,54,74,55,108,187,75,142,239,66,0,106,48,130,191,120,147,
+	163,82,28,55,105,87,94,228,71,250,201,8,232,146,201,20,120,148,239,89,209,55,178,29,
+	29,205,239,135,19,147,190,132,193,100,87,148,67,159,209,97,48,24,3,96,31,106,154,222,
+	111,199,71,223,13,195,233,226,169,126,1,191,105,128,165,5,101,185,198,54,194,110,143,161,
+	88,246,227,66,91,149,131,149,114,32,107,56,51,129,125,111,11,181,185,188,200,191,255,206,
+	92,207,151,186,212,252,65,85,24,185,206,62,232,202,240,112,244,95,192,132,47,100,2,140,
+	8,153,255,68,96,239,202,155,220,87,62,132,73,92,27,114,248,152,234,60,196,247,94,118,
+	61,21,231,57,14,81,71,6,75,250,155,85,58,243,49,175,208,60,13,90,210,133,103,248,
+	139,17,166,184,126,59,144,164,13,46,57,146,184,120,83,238,100,38,87,7,156,17,217,63,
+	59,243,2,191,48,48,21,190,106,25,199,42,254,242,120,196,245,52,137,190,153,67,108,197,
+	201,62,153,12,38,187,14,69,156,60,135,118,62,207,230,26,163,219,227,113,222,92,226,131,
+	160,129,205,136,84,136,63,89,165,1,150,22,92,104,126,54,23,227,17,74,197,82,48,35,
+	105,107,171,114,171,62,38,101,5,85,108,17,108,71,37,216,101,241,137,231,75,213,231,12,
+	201,59,169,101,198,211,246,60,31,61,82,19,4,87,248,64,38,192,8,144,249,79,4,196,
+	137,238,211,126,54,231,45,198,70,180,36,236,192,167,188,64,3,183,213,139,243,2,251,168,
+	51,131,125,51,167,51,149,120,156,111,35,223,246,107,162,22,87,243,39,119,187,220,174,96,
+	52,179,109,10,185,169,155,252,181,172,43,175,49,149,179,211,46,122,124,107,254,199,4,246,
+	212,144,181,226,53,78,91,25,238,141,190,145,199,153,51,201,52,97,239,164,78,239,49,5,
+	72,226,191,110,33,249,52,32,45,205,207,177,97,209,119,193,61,222,194,1,163,8,128,233,
+	66,77,91,228,198,139,2,177,88,103,34,37,120,196,246,157,168,29,3,165,66,89,192,245,
+	230,79,177,29,25,144,160,228,119,207,151,186,35,166,230,244,32,31,89,46,242,124,220,76,
+	99,73,42,67,144,9,48,100,100,254,19,1,113,52,143,184,91,191,148,231,54,126,141,52,
+	216,94,14,253,248,149,11,93,198,36,163,52,111,176,171,58,52,56,210,217,0,184,39,19,
+	56,49,13,183,5,148,227,76,166,240,130,11,175,196,21,230,7,124,184,44,243,222,178,221,
+	248,128,207,56,60,109,181,162,29,159,243,132,143,12,198,241,194,123,156,182,94,209,39,56,
+	172,72,63,115,133,228,18,129,120,76,1,146,248,175,91,72,62,13,200,169,166,39,217,174,
+	102,243,99,24,28,87,100,122,204,160,53,75,132,193,117,230,0,178,45,184,50,198,194,217,
+	141,225,118,249,149,149,18,101,56,173,205,111,136,28,238,72,56,141,153,238,241,82,7,41,
+	248,80,0,244,226,34,91,149,178,140,209,54,224,140,193,181,9,176,10,57,250,121,254,85,
+	146,249,79,4,65,39,30,115,183,119,110,55,38,114,174,199,40,103,65,80,158,155,248,146,
+	157,220,90,95,222,160,190,58,53,40,210,213,212,83,138,27,249,44,21,91,19,93,203,173,
+	31,191,241,2,77,141,181,86,152,220,240,150,133,220,196,124,111,133,45,121,129,175,217,55,
+	205,245,53,135,1,76,97,184,54,113,25,240,227,167,117,87,244,102,85,139,133,239,168,164,
+	90,212,201,123,97,168,105,64,74,39,116,71,1,82,224,255,87,197,87,136,56,121,0,166,
+	3,109,56,201,252,106,122,36,230,254,74,215,90,94,203,212,85,206,209,140,231,118,179,211,
+	192,49,116,75,88,54,207,211,133,42,112,191,164,29,208,184,180,70,124,218,207,252,158,20,
+	105,133,75,19,160,8,13,153,255,132,153,250,188,233,102,55,95,30,87,243,69,10,243,48,
+	237,202,68,243,180,246,63,106,241,134,231,189,75,34,225,106,33,29,217,153,239,184,56,237,
+	141,60,185,244,99,50,247,82,55,97,13,135,229,137,15,15,219,49,222,131,1,176,62,143,
+	240,43,253,50,228,235,107,101,238,224,227,52,54,14,167,26,63,126,90,213,188,132,136,13,
+	134,189,104,99,42,46,145,84,86,12,143,41,64,32,228,52,32,199,152,182,171,85,228,152,
+	168,133,127,27,53,34,210,44,17,52,151,154,191,231,158,193,94,49,23,80,25,187,35,209,
+	185,242,1,204,104,142,224,0,83,113,105,70,25,74,75,122,186,212,189,238,99,20,9,35,
+	197,120,150,106,182,74,119,26,230,211,34,221,120,155,126,172,147,24,82,196,58,142,146,249,
+	79,24,40,199,88,123,240,85,168,194,56,70,184,221,134,27,90,83,31,101,140,187,140,163,
+	237,121,74,46,64,193,144,142,98,60,136,47,236,145,188,211,132,18,156,206,52,70,36,180,
+	177,27,172,112,179,67,110,154,241,252,255,181,171,20,87,49,149,147,51,44,193,70,55,38,
+	218,246,144,198,22,175,121,128,55,51,136,253,163,110,232,201,230,226,161,73,156,218,96,174,
+	75,20,206,207,24,54,48,89,3,160,49,188,249,137,81,91,35,246,246,21,5,77,57,128,
+	211,129,70,244,55,21,87,227,90,201,136,125,56,218,92,161,42,131,37,165,140,165,132,237,
+	115,213,69,52,52,148,122,241,143,29,192,9,146,119,96,212,227,97,91,149,74,220,38,57,
+	101,16,111,114,132,188,0,83,194,122,142,230,77,137,65,24,184,207,156,219,112,51,45,248,
+	194,252,61,45,50,134,240,49,181,221,84,60,220,30,79,66,184,161,88,218,181,232,12,238,
+	76,198,24,85,147,38,52,165,41,77,168,76,57,42,80,145,98,20,0,203,217,196,90,230,
+	50,151,121,204,101,54,147,89,16,84,139,75,115,53,39,113,1,47,22,81,54,143,70,137,
+	14,251,59,100,65,254,105,42,156,187,229,255,31,192,61,110,55,223,187,81,166,38,52,167,
+	54,117,168,69,29,106,82,140,226,148,3,114,217,72,62,43,88,197,114,254,102,38,179,152,
+	201,172,100,63,28,86,228,5,30,224,92,77,62,10,177,138,191,18,107,157,129,135,104,27,
+	109,150,215,19,185,204,164,5,173,232,194,87,190,78,108,180,229,117,50,148,24,242,67,118,
+	36,215,151,97,21,160,29,187,153,138,79,137,86,63,74,251,140,180,164,28,192,233,192,249,
+	230,119,246,213,102,63,214,216,48,138,215,204,111,152,11,184,159,13,146,83,70,114,142,121,
+	206,82,151,11,141,135,215,114,125,161,182,169,200,143,149,213,28,206,113,60,99,174,114,52,
+	247,249,72,212,44,82,197,219,28,201,171,202,146,19,49,218,252,43,108,12,114,19,80,97,
+	31,94,163,66,218,52,185,11,95,115,160,155,52,93,215,242,41,95,170,139,179,139,60,110,
+	199,241,243,43,229,236,229,92,224,188,234,204,119,220,179,200,249,200,185,199,25,230,180,117,
+	114,28,130,248,125,196,46,133,238,232,185,196,245,143,117,194,100,131,147,103,106,235,225,64,
+	93,158,15,226,190,203,59,7,58,151,57,207,56,63,56,107,61,180,111,163,243,179,243,176,
+	51,212,105,239,20,75,230,234,63,209,82,195,166,16,111,250,148,230,141,1,92,123,108,226,
+	243,95,81,72,11,250,155,219,243,136,207,54,180,48,157,245,153,132,58,249,180,185,53,205,
+	125,203,228,33,211,121,187,239,208,138,43,76,109,24,27,64,15,141,246,169,29,99,53,176,
+	82,78,85,86,154,250,168,169,179,206,73,5,183,25,218,212,197,73,13,231,219,244,89,174,
+	93,153,73,13,150,153,123,246,41,139,102,60,231,242,137,87,211,153,233,136,160,89,228,212,
+	180,73,254,7,109,240,202,48,122,177,6,71,191,200,126,235,56,76,74,39,140,236,196,114,
+	187,38,29,234,172,78,187,55,196,98,167,139,155,49,240,23,85,213,201,217,68,41,94,247,
+	254,40,172,232,28,239,188,146,164,18,47,114,94,119,206,115,118,117,114,147,125,44,111,228,
+	174,29,194,83,222,148,184,246,174,161,14,162,169,230,150,118,228,44,55,143,7,211,175,170,
+	115,132,115,187,243,157,179,49,201,150,174,112,94,113,78,182,79,10,19,253,86,112,164,134,
+	78,64,38,158,13,116,140,214,0,248,158,185,61,43,125,126,154,58,206,116,214,41,9,53,
+	241,119,115,107,252,102,74,46,111,30,105,207,68,107,0,220,133,245,41,52,15,139,228,24,
+	105,238,163,87,82,52,101,75,71,3,224,82,167,170,89,159,127,86,198,209,140,228,65,243,
+	24,216,195,41,176,206,56,74,185,120,222,149,115,190,150,181,46,20,92,24,96,79,150,154,
+	203,4,168,159,204,127,194,39,37,248,209,174,73,3,146,94,189,135,195,114,167,187,155,113,
+	240,162,186,57,89,138,165,145,194,190,196,193,94,14,200,229,80,78,161,167,199,144,206,69,
+	81,149,195,56,12,248,135,177,188,193,251,172,246,123,162,60,206,226,80,134,242,222,214,191,
+	24,246,249,254,134,19,226,10,196,18,175,255,54,122,248,63,119,83,14,231,48,186,6,20,
+	54,176,28,71,114,36,5,124,199,43,60,193,124,239,135,191,200,112,237,212,241,210,249,134,
+	167,193,131,236,97,202,92,29,52,251,209,140,233,137,139,203,114,44,15,250,56,173,143,20,
+	32,176,57,13,72,190,233,172,207,250,186,201,129,148,79,92,88,141,62,81,106,70,46,15,
+	82,60,98,173,18,65,81,150,51,76,197,93,245,45,100,27,42,113,5,231,154,42,236,76,
+	111,198,73,78,25,70,43,179,113,40,135,91,172,179,170,114,244,226,53,75,157,242,140,99,
+	119,73,59,20,250,243,2,175,152,171,140,226,37,83,2,61,145,118,188,77,63,94,218,113,
+	49,86,105,187,224,232,39,37,21,214,57,46,60,196,99,219,252,215,106,150,237,88,97,29,
+	125,21,251,79,88,184,196,30,253,175,15,143,166,105,232,255,242,140,163,23,159,219,170,245,
+	165,143,237,69,34,50,131,60,94,244,230,247,119,158,243,71,72,214,231,85,206,107,206,241,
+	78,105,255,223,103,10,24,179,53,16,211,65,166,154,179,66,180,161,223,96,110,161,207,123,
+	107,230,92,235,252,26,98,171,215,59,175,56,7,153,55,47,39,242,78,146,55,199,127,116,
+	78,226,235,226,185,73,94,219,147,7,160,227,92,103,110,205,119,190,218,240,113,226,51,238,
+	109,212,191,30,230,45,254,254,248,217,116,135,23,23,106,67,168,30,128,231,37,161,25,157,
+	52,176,82,204,73,230,30,250,36,101,95,108,211,209,3,208,113,214,58,117,181,169,61,219,
+	24,103,243,105,112,195,108,167,169,101,119,195,23,114,212,11,145,121,78,101,219,219,102,148,
+	84,61,227,176,120,1,94,46,197,119,193,229,242,254,19,201,210,146,181,246,205,191,235,211,
+	122,28,44,113,218,219,215,36,115,169,172,206,78,134,244,240,0,204,229,17,250,186,183,14,
+	95,204,240,29,118,218,6,73,25,14,231,112,242,121,129,199,253,69,153,204,97,8,189,24,
+	198,56,96,146,169,226,175,198,92,117,201,241,155,185,133,158,41,75,95,78,166,91,200,118,
+	182,226,28,201,145,252,205,29,60,224,205,15,243,98,234,50,152,245,26,208,192,230,60,192,
+	126,163,232,92,199,235,252,17,93,83,7,51,210,20,139,191,51,29,248,193,243,248,107,159,
+	184,208,108,197,10,33,13,72,87,118,54,63,42,34,164,1,35,125,31,91,224,38,50,175,
+	8,217,0,104,96,119,186,135,112,201,165,188,207,52,171,51,142,201,78,255,39,151,88,142,
+	174,64,117,186,133,16,204,181,36,231,152,211,65,244,162,54,243,164,86,25,68,79,122,155,
+	103,41,55,184,58,77,93,62,162,7,51,19,62,232,95,162,113,198,136,228,103,190,98,25,
+	229,216,149,93,51,230,43,104,45,110,181,237,242,61,135,49,81,206,67,68,0,188,205,145,
+	188,165,248,141,33,82,160,212,31,194,74,46,15,217,54,70,118,226,57,223,91,129,162,161,
+	50,227,217,205,150,42,181,54,55,71,187,132,18,193,147,195,125,110,189,80,138,57,195,60,
+	37,250,72,150,41,206,69,246,111,149,137,126,99,40,67,142,41,254,215,200,16,91,222,42,
+	192,152,19,109,156,135,156,229,17,219,255,231,59,231,59,101,188,181,243,189,16,173,194,153,
+	198,204,36,250,123,124,82,87,246,232,1,232,56,135,153,91,115,143,231,22,248,76,1,18,
+	82,26,144,39,77,103,236,85,68,27,66,244,0,124,35,9,173,208,98,44,213,52,54,123,
+	110,191,30,248,51,56,223,57,211,41,25,89,100,163,30,206,15,33,196,146,169,100,190,234,
+	133,82,171,140,90,216,88,226,26,93,227,65,55,166,23,233,31,90,214,185,194,83,50,179,
+	212,242,133,179,219,54,109,111,229,140,203,152,150,23,56,7,216,158,8,47,73,225,51,144,
+	111,228,1,24,162,7,224,119,82,48,97,229,36,219,92,171,190,51,47,35,198,194,15,78,
+	89,251,126,203,61,213,225,201,76,169,82,207,229,156,230,174,226,30,252,200,3,212,140,176,
+	105,205,25,205,223,220,99,136,27,102,96,8,223,209,198,228,55,19,222,211,124,5,83,2,
+	58,211,190,140,227,23,78,49,133,49,11,133,154,220,194,76,206,245,242,149,162,39,175,83,
+	74,67,26,128,95,147,56,182,23,199,69,217,212,83,204,197,199,111,23,70,198,13,29,125,
+	23,218,118,185,122,223,4,91,205,236,217,60,44,74,65,31,199,161,73,28,61,73,131,42,
+	197,12,54,57,248,180,228,144,128,47,55,151,221,185,135,117,145,221,222,39,116,177,70,102,
+	243,74,121,219,212,98,176,212,42,131,56,209,28,215,168,1,23,120,56,89,83,62,230,2,
+	118,219,102,19,76,13,78,103,58,215,6,16,85,58,26,254,71,15,190,221,230,191,127,227,
+	224,140,201,212,148,195,221,182,185,221,81,201,196,169,22,41,98,161,68,16,34,11,36,2,
+	97,161,44,215,217,42,140,165,86,70,220,74,123,158,178,121,181,187,9,250,43,18,146,122,
+	3,224,129,238,182,165,21,231,90,62,163,77,74,198,211,25,76,225,53,63,27,172,90,243,
+	173,105,91,106,120,6,192,239,125,236,85,44,172,26,199,50,129,15,232,157,178,241,85,131,
+	219,152,72,55,247,7,236,203,139,105,238,215,28,21,134,132,13,181,104,109,59,250,78,170,
+	71,215,212,222,212,55,21,87,114,31,28,96,11,157,19,23,85,96,39,227,161,205,183,6,
+	239,44,18,239,6,192,147,76,38,233,122,129,27,109,12,84,225,118,44,247,94,195,84,44,
+	3,96,170,223,212,3,76,197,23,7,252,42,223,200,225,145,239,249,94,203,49,252,28,240,
+	57,207,161,180,169,184,133,50,61,100,208,194,230,90,115,133,209,230,190,46,68,51,110,230,
+	27,150,48,158,235,120,150,63,88,192,189,25,178,48,2,248,156,193,108,220,225,111,14,151,
+	102,76,106,196,230,156,105,171,50,90,74,47,132,16,30,184,128,58,230,10,119,219,243,131,
+	164,13,71,112,158,173,74,23,250,169,211,253,47,43,82,75,67,158,118,211,134,86,124,197,
+	21,41,12,88,152,203,225,124,194,7,222,189,77,75,179,87,226,194,5,252,25,82,123,191,
+	73,250,12,135,241,19,207,88,252,165,162,160,45,159,240,152,123,123,212,33,60,153,166,137,
+	141,162,101,178,73,235,110,179,13,185,106,220,20,93,83,243,56,209,92,193,107,140,7,131,
+	153,174,163,229,206,141,225,3,189,27,0,45,33,254,134,68,249,68,187,205,108,223,203,225,
+	54,243,199,123,229,0,78,45,61,105,144,184,176,86,224,78,187,15,243,125,10,110,114,29,
+	231,4,124,198,26,54,201,156,44,213,202,16,206,163,174,169,120,79,250,251,58,109,121,122,
+	113,57,199,100,80,212,191,205,156,201,166,34,255,62,60,66,175,221,228,184,138,106,230,10,
+	187,155,35,62,10,33,132,216,134,154,156,111,174,112,180,57,148,116,218,49,138,46,182,42,
+	55,102,140,211,126,218,145,90,3,96,41,94,162,170,189,218,161,124,155,22,41,40,247,229,
+	11,198,177,107,128,103,252,52,164,150,126,146,212,209,221,249,130,215,105,155,38,42,154,195,
+	32,126,167,143,219,234,253,121,72,46,193,38,127,45,135,74,118,155,218,32,246,143,174,177,
+	39,155,31,67,221,236,46,139,219,169,75,251,196,133,246,167,136,177,70,71,143,207,203,158,
+	166,168,129,197,162,140,94,187,55,3,205,21,134,82,21,199,167,70,137,8,56,214,84,120,
+	2,37,2,190,220,67,41,186,205,143,152,22,240,25,45,187,124,251,166,73,34,52,97,166,
+	22,23,153,31,251,241,218,9,244,13,63,37,40,153,199,155,25,114,15,149,236,155,127,174,
+	150,226,11,33,132,75,46,51,71,235,106,204,195,25,118,67,197,121,218,22,128,172,113,134,
+	217,52,211,136,212,26,0,239,54,109,215,251,151,179,121,53,141,178,59,244,230,27,94,163,
+	69,64,103,251,36,148,54,110,244,151,189,24,128,157,120,147,79,210,46,174,102,21,94,230,
+	110,183,102,254,147,185,53,246,227,122,178,105,15,248,100,110,54,59,83,108,182,0,148,141,
+	170,177,141,217,207,92,193,203,227,221,184,139,55,73,3,96,5,143,193,64,79,53,21,30,
+	102,239,131,160,40,205,24,243,234,184,22,163,204,46,126,202,1,156,234,247,180,209,23,102,
+	96,192,151,91,153,208,188,16,62,95,4,124,190,46,230,252,194,85,20,68,58,35,184,198,
+	60,9,236,103,247,19,200,42,62,55,148,125,150,49,119,49,212,246,153,89,62,128,66,8,
+	225,142,170,182,239,157,15,68,30,205,63,136,245,225,245,182,42,23,234,51,174,223,133,69,
+	234,232,111,119,129,201,227,46,238,76,179,61,157,57,28,206,207,220,66,133,0,206,21,142,
+	1,240,71,150,251,180,19,92,195,47,28,156,166,170,122,38,95,185,77,195,122,110,236,131,
+	187,175,230,175,196,133,147,168,192,157,182,51,52,226,202,232,154,107,121,16,12,242,224,226,
+	221,201,119,161,155,26,94,28,145,107,155,147,110,68,152,0,100,132,205,112,121,47,149,205,
+	46,126,127,178,74,47,203,20,178,155,41,247,213,110,236,28,240,229,22,5,16,67,214,47,
+	193,71,145,183,132,24,56,88,234,149,246,180,53,111,213,46,201,168,152,9,196,52,74,50,
+	39,83,64,49,110,179,85,145,15,160,16,66,184,225,28,179,219,198,137,28,144,145,183,117,
+	134,41,146,26,64,19,207,145,226,5,144,74,3,96,21,187,13,34,151,199,56,43,45,197,
+	86,130,243,153,202,73,73,139,111,186,201,78,227,155,15,125,29,117,16,191,114,101,90,111,
+	166,239,192,247,28,238,174,234,189,177,15,238,110,176,231,76,6,142,226,8,219,25,206,143,
+	46,4,228,17,230,0,117,213,56,204,245,169,12,38,58,55,14,124,1,166,1,57,197,148,
+	144,166,41,61,163,18,238,46,156,107,174,112,48,125,176,4,249,211,6,224,212,98,52,82,
+	5,191,255,161,98,10,111,181,66,224,103,28,100,254,60,124,136,212,43,237,185,217,252,21,
+	248,12,154,196,76,32,166,117,94,126,6,221,199,254,182,212,244,242,1,20,66,8,59,229,
+	57,195,84,92,53,99,183,198,229,242,160,205,197,239,18,5,254,242,39,217,84,113,139,201,
+	167,1,32,135,251,204,137,15,83,76,77,30,229,107,58,36,121,150,183,66,104,153,247,24,
+	48,213,121,145,183,50,96,18,93,158,151,57,221,77,197,146,188,156,65,9,253,194,96,146,
+	173,232,62,42,153,207,80,140,71,162,114,172,46,97,27,233,238,195,229,25,130,10,184,9,
+	225,103,73,3,210,217,117,59,242,204,62,43,195,162,122,244,230,241,136,57,51,118,5,30,
+	176,41,140,12,128,169,230,16,211,163,174,127,224,151,171,156,194,119,65,231,192,207,88,203,
+	28,208,180,117,236,172,71,153,198,190,244,50,107,235,229,177,19,137,105,63,244,178,140,186,
+	147,91,204,175,39,249,0,10,33,132,157,19,169,108,42,190,210,77,194,133,52,165,141,109,
+	9,216,142,125,164,0,222,73,149,1,112,111,6,217,170,220,24,229,38,57,159,236,202,183,
+	73,166,160,9,222,0,184,132,175,60,30,113,32,63,102,140,7,109,30,247,114,135,27,181,
+	173,203,43,129,71,198,207,36,12,14,93,127,147,15,212,182,71,86,104,31,157,3,238,41,
+	230,15,56,251,211,212,213,105,114,76,25,238,221,185,239,25,107,117,112,253,196,60,132,134,
+	137,11,75,216,182,37,6,199,112,155,69,229,70,234,1,203,153,237,83,155,68,232,212,51,
+	105,245,62,230,89,159,79,82,245,233,173,77,40,110,199,71,152,139,181,9,56,189,95,249,
+	183,155,43,92,69,149,216,9,197,52,181,89,159,81,119,210,220,246,46,148,15,160,16,66,
+	216,48,6,190,106,194,105,25,125,115,35,109,123,67,134,72,1,188,147,26,3,160,53,40,
+	61,92,110,78,250,150,54,20,227,98,38,176,155,239,227,63,100,117,192,45,122,135,141,30,
+	106,151,229,126,198,83,39,163,148,118,56,255,115,99,219,235,98,91,56,100,53,198,60,192,
+	155,51,58,156,74,87,219,89,174,139,202,59,166,133,57,202,67,142,75,139,89,146,41,64,
+	172,181,220,167,1,49,38,0,233,103,222,242,28,28,13,109,137,22,119,223,242,153,101,178,
+	114,0,167,47,7,154,222,150,225,88,175,206,163,94,74,110,245,134,80,118,114,28,108,62,
+	107,47,169,88,26,115,18,187,100,243,194,198,31,75,13,101,149,50,236,94,174,176,205,230,
+	174,213,246,46,33,132,48,176,155,121,243,210,232,12,247,135,169,193,249,230,10,125,50,216,
+	193,49,101,164,198,0,120,149,109,25,221,155,107,50,72,136,109,248,146,155,40,229,235,216,
+	53,62,35,246,37,230,13,15,117,119,101,34,167,102,224,236,234,4,158,118,147,26,230,116,
+	250,197,118,100,27,243,0,79,218,50,248,31,182,121,175,150,225,222,168,26,108,249,128,115,
+	178,171,92,64,73,166,0,113,81,203,221,73,26,155,163,237,158,26,149,80,239,49,231,206,
+	44,193,35,91,94,1,70,11,159,114,0,167,22,99,158,218,112,12,128,21,120,37,132,104,
+	124,54,174,241,16,236,211,11,117,205,161,58,246,144,129,33,109,41,107,251,132,113,83,90,
+	199,45,14,139,57,198,177,155,89,52,180,101,49,239,196,126,26,8,66,8,145,144,83,76,
+	133,45,233,147,241,55,56,220,28,155,186,100,90,71,140,75,83,82,97,0,172,195,112,219,
+	132,224,137,148,166,39,246,78,30,23,50,193,103,46,198,96,55,1,175,229,21,215,117,7,
+	240,137,219,188,186,105,71,95,30,115,163,35,247,217,34,77,102,45,171,249,51,113,225,191,
+	59,58,91,112,177,237,60,189,56,46,154,6,31,109,222,202,88,215,213,70,160,36,83,128,
+	64,64,105,64,134,154,148,179,149,45,167,85,80,28,111,75,112,112,41,109,118,208,136,34,
+	153,165,28,192,41,197,144,208,104,103,26,135,116,209,93,249,134,46,17,222,100,13,158,10,
+	49,241,184,113,32,84,113,237,215,43,162,230,2,243,246,132,189,178,96,97,227,135,95,13,
+	101,149,50,238,110,172,62,128,195,53,16,132,16,34,1,165,204,161,160,47,201,48,139,74,
+	81,84,180,5,133,27,36,53,240,74,177,20,92,243,42,74,155,53,249,21,170,101,160,40,
+	91,243,21,103,242,184,231,227,222,228,190,192,28,16,54,112,160,203,8,48,37,185,39,195,
+	55,205,15,96,57,103,218,42,85,227,62,142,138,233,216,158,156,216,54,240,159,191,215,229,
+	188,100,11,240,118,39,239,177,48,252,230,150,230,88,238,51,85,24,226,34,187,77,146,41,
+	64,96,115,26,144,79,124,93,97,43,37,204,137,89,207,136,198,225,168,42,183,153,43,180,
+	224,146,34,52,162,72,77,18,169,163,60,45,19,23,30,20,226,133,91,242,5,159,49,142,
+	169,172,176,212,252,139,169,134,105,219,174,214,137,93,53,186,114,164,49,179,105,178,28,108,
+	222,83,176,7,211,164,104,105,72,109,46,48,63,171,111,141,165,243,230,122,126,52,148,102,
+	158,53,187,33,3,121,216,60,124,91,202,11,93,8,33,138,100,127,202,39,46,108,16,149,
+	23,71,200,156,203,157,172,75,92,220,142,102,76,151,42,120,33,122,3,96,19,115,118,76,
+	184,45,148,48,224,81,80,150,199,232,201,105,214,229,210,246,204,230,103,83,140,119,15,56,
+	12,227,83,87,53,235,243,82,18,113,11,211,133,51,88,193,165,182,74,125,56,150,103,99,
+	57,182,39,37,222,29,248,159,69,167,4,143,176,151,105,183,48,84,227,230,104,190,173,12,
+	51,27,0,15,166,14,115,49,175,7,147,78,1,178,185,166,193,0,216,129,92,179,184,128,
+	163,76,126,167,101,56,62,154,254,191,205,28,104,48,151,135,183,9,91,48,217,172,73,34,
+	117,236,106,218,252,30,110,234,179,28,186,211,221,69,189,219,57,47,97,89,107,222,75,3,
+	33,118,166,2,203,19,23,239,206,147,82,180,52,228,90,115,8,131,254,38,231,216,44,230,
+	11,86,26,74,119,206,192,59,186,130,39,76,159,174,115,56,35,186,132,100,66,8,145,81,
+	24,29,225,79,177,101,90,207,16,106,209,199,188,152,63,146,155,165,10,94,136,222,47,244,
+	42,179,46,118,143,46,62,86,40,28,207,4,115,204,234,34,120,45,160,107,143,228,49,87,
+	245,186,36,149,182,36,157,184,196,28,248,96,51,119,83,43,150,99,219,154,7,120,51,123,
+	216,101,120,34,251,71,209,224,93,204,70,186,98,86,51,100,0,41,64,172,53,221,236,36,
+	30,102,126,66,84,138,66,152,251,216,34,98,12,221,38,5,140,114,0,167,49,187,155,214,
+	197,157,37,31,151,19,157,78,62,101,44,82,70,27,243,19,191,36,55,196,84,48,230,176,
+	49,109,51,240,142,172,113,0,79,142,97,170,103,33,132,176,147,103,138,113,146,231,50,131,
+	98,38,96,217,181,120,164,84,193,235,188,56,90,118,50,187,191,148,228,129,140,223,210,177,
+	19,95,122,220,117,250,84,32,215,125,196,22,45,123,11,135,241,62,213,179,70,129,239,165,
+	155,173,74,85,30,138,229,216,118,145,7,120,51,55,81,215,118,174,135,66,221,159,231,246,
+	241,62,196,242,188,50,90,67,2,50,0,218,55,1,183,50,59,77,13,139,66,144,214,60,
+	235,181,25,181,205,127,41,7,112,26,211,217,244,174,81,226,51,183,24,109,124,237,98,153,
+	73,34,221,185,206,156,248,233,172,208,226,95,166,55,27,121,198,80,90,141,70,25,121,87,
+	150,56,128,101,204,97,53,132,16,34,166,116,53,69,77,235,77,253,172,185,209,125,104,106,
+	158,228,213,146,50,120,33,106,3,224,53,230,77,199,87,208,42,11,132,90,150,23,185,218,
+	131,33,115,58,19,146,190,230,120,151,158,147,67,121,133,50,89,164,192,197,121,206,62,230,
+	15,229,240,24,142,109,23,121,128,55,83,129,187,108,231,106,196,85,81,52,249,120,243,142,
+	175,198,150,29,143,1,164,0,129,164,211,128,24,211,106,239,230,193,16,153,4,35,205,239,
+	73,184,119,59,63,68,229,0,78,99,90,154,230,59,194,45,123,152,95,35,141,36,161,180,
+	235,48,227,91,187,42,151,199,84,48,239,50,207,80,218,51,67,63,161,55,180,197,169,58,
+	211,108,14,22,66,136,88,178,175,169,240,132,44,186,209,28,179,7,89,46,123,75,25,188,
+	16,173,1,176,49,253,76,197,109,184,40,107,212,116,4,47,122,112,154,74,54,72,221,4,
+	142,102,163,139,86,141,228,193,172,155,69,213,225,37,91,14,57,236,201,110,179,16,87,121,
+	128,55,211,199,238,59,125,94,20,161,57,203,155,31,16,54,23,65,131,109,173,163,135,71,
+	93,14,237,125,94,5,40,109,222,122,27,137,255,223,46,156,99,174,112,200,14,253,173,28,
+	192,105,252,42,49,184,57,201,0,232,30,75,70,227,166,146,80,154,113,131,217,146,117,85,
+	6,102,187,13,6,243,231,186,3,50,246,190,44,169,126,27,113,132,6,133,16,66,236,192,
+	222,137,139,74,210,59,171,110,181,143,185,184,187,148,193,11,209,26,0,207,49,91,159,70,
+	219,13,57,25,196,81,124,65,61,151,117,31,179,230,21,48,177,128,195,141,65,161,255,93,
+	73,222,23,141,27,87,228,236,197,45,246,213,223,30,49,28,221,6,187,206,142,62,95,247,
+	218,150,83,197,120,52,138,148,65,67,108,79,255,234,134,103,89,251,196,7,122,243,187,51,
+	214,54,219,18,143,165,114,226,194,74,244,15,95,132,121,60,106,142,179,90,129,251,45,218,
+	224,86,139,68,232,212,165,116,226,194,93,36,31,215,212,48,101,230,201,196,212,169,217,77,
+	47,179,183,247,78,25,30,43,218,63,191,242,174,113,150,183,127,198,222,89,123,155,251,198,
+	112,13,11,33,132,216,142,146,166,144,254,61,169,144,85,55,219,206,252,173,182,135,212,193,
+	11,81,26,0,43,155,243,255,238,145,56,105,105,198,170,234,23,46,183,52,47,225,54,223,
+	87,217,72,127,230,88,107,229,240,64,22,79,153,207,164,167,173,202,57,49,28,221,6,187,
+	206,142,86,157,218,246,128,234,237,56,59,252,38,239,73,27,83,113,9,131,63,251,78,166,
+	55,93,128,6,192,242,70,99,129,113,144,157,24,69,40,197,115,108,55,59,186,208,135,9,
+	229,0,78,91,154,249,46,20,59,208,196,119,161,136,124,94,106,121,29,221,152,85,31,139,
+	189,112,163,49,94,235,94,174,63,58,167,35,22,11,95,55,118,213,208,16,66,136,109,216,
+	157,82,137,11,15,203,186,219,53,222,81,171,44,74,112,16,201,68,43,58,78,53,7,248,
+	186,54,11,197,219,128,47,216,203,85,205,203,152,232,243,26,23,243,137,181,78,14,247,48,
+	52,139,213,56,135,199,109,30,108,125,99,24,49,220,101,30,224,205,12,219,38,43,108,194,
+	33,26,193,50,121,176,185,120,104,194,141,97,198,228,28,222,178,165,118,246,91,220,222,188,
+	68,57,37,124,241,53,100,132,185,194,30,133,158,4,202,1,156,198,24,62,119,150,81,196,
+	227,160,68,169,45,192,233,197,209,116,48,21,119,181,109,4,202,90,126,182,132,139,201,236,
+	124,143,135,217,134,225,16,13,13,33,132,216,6,99,36,152,189,179,238,118,247,54,155,2,
+	20,23,199,3,209,25,0,139,115,186,121,74,215,51,43,5,92,153,119,57,200,69,189,13,
+	28,200,52,31,231,127,141,219,173,117,114,184,199,44,252,44,160,46,55,153,43,228,101,189,
+	8,10,227,58,15,240,230,71,193,195,166,15,73,0,101,184,47,252,70,15,52,183,162,101,
+	194,96,94,198,20,32,222,214,247,59,249,77,3,114,134,233,176,30,102,239,198,96,184,199,
+	252,153,165,4,143,20,122,232,43,7,112,26,99,48,185,55,205,208,112,255,169,66,6,192,
+	12,161,184,237,107,240,232,216,138,230,114,99,176,152,210,182,24,186,105,191,28,57,195,92,
+	225,152,172,202,96,39,132,16,201,210,54,113,81,109,154,103,221,237,118,51,155,173,218,72,
+	33,188,188,113,163,162,159,121,111,194,13,89,43,226,50,188,102,206,11,176,133,69,28,204,
+	66,143,231,254,141,129,230,197,251,22,155,64,28,108,95,67,232,101,171,80,58,102,163,219,
+	117,30,224,205,180,176,231,74,57,208,156,132,41,8,170,218,98,125,39,242,2,8,40,5,
+	8,248,78,3,82,145,99,77,135,69,176,5,255,4,14,49,87,184,140,214,46,52,97,27,
+	148,3,56,181,212,72,92,36,155,149,55,140,238,203,218,56,146,62,12,54,239,109,63,140,
+	61,99,42,152,119,120,211,88,126,140,249,195,85,70,204,226,140,119,80,193,158,173,76,8,
+	33,98,132,193,0,152,141,33,241,42,155,110,24,115,161,216,158,232,12,128,70,195,65,55,
+	186,101,177,144,139,243,56,39,185,168,55,141,35,89,239,225,188,171,233,195,10,107,173,43,
+	98,226,250,150,195,253,230,44,21,149,178,44,29,146,27,5,113,157,7,120,51,69,153,135,
+	118,224,206,240,151,202,150,125,62,199,20,185,219,59,192,20,32,214,35,18,217,19,7,152,
+	66,252,85,11,127,237,82,149,91,205,21,138,54,241,42,7,112,26,99,136,107,89,79,210,
+	241,132,81,94,21,37,159,52,161,52,87,152,167,172,215,196,84,48,235,173,89,48,206,201,
+	248,123,44,111,219,196,124,146,6,136,16,66,108,33,207,148,104,32,59,131,166,26,239,106,
+	103,169,132,123,162,50,0,86,51,39,39,187,32,235,197,252,136,171,24,124,95,48,204,195,
+	89,47,116,225,156,115,92,140,166,203,141,56,202,92,225,168,216,141,111,15,121,128,161,232,
+	13,162,59,80,213,158,114,57,89,246,53,59,128,148,230,152,34,254,218,60,184,20,32,214,
+	35,202,179,83,145,127,55,14,241,33,148,12,91,112,183,155,252,197,18,111,242,86,14,224,
+	52,166,178,175,34,81,4,149,76,133,197,181,185,48,77,56,135,186,166,226,19,104,23,83,
+	193,220,194,20,99,121,175,172,200,10,126,14,121,230,201,129,210,245,8,33,196,102,154,152,
+	118,182,101,167,59,156,241,174,90,154,95,32,98,251,53,97,52,244,165,120,226,194,157,108,
+	251,214,178,128,28,238,103,160,139,122,143,243,128,203,51,190,207,253,214,58,251,240,88,172,
+	226,68,89,12,201,135,218,130,220,101,29,147,188,22,237,97,55,84,15,228,128,176,199,138,
+	229,51,127,81,46,130,70,139,93,103,207,109,176,28,81,212,213,186,153,190,61,229,216,146,
+	155,36,207,62,134,12,201,64,226,52,47,147,124,106,144,136,128,138,190,138,132,119,121,73,
+	156,233,64,101,46,50,21,151,100,100,76,5,51,217,250,41,247,194,172,184,207,198,28,104,
+	158,28,12,208,32,17,66,8,0,26,154,10,179,211,0,184,179,121,138,160,220,120,174,137,
+	202,0,120,140,169,240,188,72,147,17,167,78,212,143,186,154,187,156,237,34,171,47,228,115,
+	178,53,250,223,206,188,74,137,88,169,115,103,115,116,160,242,97,155,174,210,14,131,249,102,
+	118,161,60,192,155,25,109,223,90,248,160,105,171,107,16,156,108,250,94,0,157,232,88,196,
+	223,18,82,193,71,180,52,31,105,64,140,206,187,189,204,94,141,201,83,134,49,102,91,127,
+	237,4,113,86,151,51,199,167,6,137,8,144,1,48,10,81,74,156,233,194,37,102,71,205,
+	83,105,20,75,177,108,100,16,235,140,53,122,176,111,150,220,235,201,230,226,65,177,88,46,
+	8,33,132,157,218,137,139,42,81,39,43,111,217,146,231,163,142,148,194,45,209,188,74,235,
+	154,66,252,85,117,229,25,151,13,228,241,24,71,91,107,109,224,24,102,91,107,157,193,223,
+	150,26,53,24,23,195,53,141,37,74,78,223,152,137,195,176,129,211,73,176,129,188,130,221,
+	179,180,17,87,135,219,236,90,182,204,217,133,221,233,2,76,1,2,62,210,128,84,51,111,
+	48,15,61,1,200,72,155,149,243,222,4,43,107,75,14,96,109,1,78,45,229,19,23,85,
+	144,116,60,33,3,96,218,83,151,179,204,131,225,178,152,10,230,70,190,179,188,175,110,202,
+	154,123,61,212,28,102,184,17,221,53,80,132,16,2,99,104,227,134,89,122,203,53,205,91,
+	249,234,74,41,220,18,141,1,240,48,211,117,250,197,40,248,78,30,79,176,143,181,214,124,
+	142,98,173,177,198,75,60,109,57,71,49,158,139,101,144,248,67,41,103,42,62,36,102,95,
+	143,61,230,1,254,87,72,214,116,21,231,250,8,171,231,9,75,34,144,227,119,120,104,24,
+	83,128,116,246,213,2,227,81,133,109,138,39,155,222,73,245,56,56,92,113,181,179,89,190,
+	251,36,236,83,229,0,78,243,87,70,66,74,73,58,158,40,110,14,14,35,191,162,212,115,
+	149,41,158,17,156,107,14,114,154,181,124,101,221,248,124,36,187,101,205,221,150,224,88,115,
+	5,37,2,17,66,8,48,250,187,101,171,43,92,142,121,151,175,12,128,174,137,102,210,187,
+	183,169,240,152,88,9,188,36,175,186,8,98,253,173,49,16,206,98,78,179,158,225,6,23,
+	134,198,108,164,180,217,212,82,217,158,230,54,171,240,156,7,120,51,247,154,247,97,65,49,
+	30,49,239,210,77,150,222,52,48,21,87,164,223,118,255,29,112,10,16,235,81,59,166,1,
+	201,49,91,44,135,134,27,151,54,207,214,27,21,184,203,135,22,160,28,192,169,103,67,226,
+	162,141,105,180,100,79,76,241,180,105,101,1,155,76,197,235,165,108,41,166,185,121,247,103,
+	53,206,143,165,88,242,57,222,50,214,139,49,42,171,238,216,98,225,235,43,231,103,33,132,
+	0,147,187,116,246,238,133,53,218,248,106,72,41,220,18,133,1,48,135,30,38,21,237,22,
+	51,145,87,100,188,139,56,54,247,240,70,194,178,75,89,100,57,250,240,172,207,171,108,154,
+	29,26,217,35,102,226,152,228,167,168,182,125,65,209,142,179,195,108,118,30,39,154,43,108,
+	111,112,51,90,235,66,48,0,238,88,188,127,130,188,192,91,150,103,39,135,219,199,86,127,
+	204,155,12,47,76,165,0,73,107,54,248,42,138,24,67,24,154,52,154,132,174,247,45,105,
+	17,9,215,82,204,84,124,89,44,237,62,14,39,49,211,82,167,7,205,179,234,158,219,155,
+	3,112,148,49,135,219,16,66,136,152,96,240,153,207,94,75,88,13,159,18,17,219,19,133,
+	1,176,5,53,19,23,30,19,195,157,55,181,25,79,85,235,180,111,8,243,138,44,249,150,
+	71,44,199,182,228,201,88,229,254,221,158,131,204,91,202,119,143,153,56,12,14,94,38,235,
+	206,208,4,25,99,183,225,26,31,185,53,60,48,196,236,53,215,117,59,95,206,128,83,128,
+	128,199,52,32,198,16,127,135,135,235,147,222,208,22,145,113,15,78,193,159,22,40,2,96,
+	202,201,8,3,96,87,131,229,102,239,76,16,101,122,137,51,158,116,218,193,171,187,208,99,
+	238,244,88,138,229,26,94,181,214,233,146,117,119,109,245,1,20,66,8,81,218,87,81,246,
+	222,180,98,227,120,32,10,235,91,15,83,97,159,88,138,189,37,175,89,243,243,46,100,96,
+	17,1,220,10,56,195,20,214,13,40,193,51,166,200,241,89,79,25,243,146,83,30,128,91,
+	73,148,7,120,243,131,225,97,219,115,180,12,15,133,105,103,110,192,126,230,10,39,111,183,
+	120,76,72,71,159,15,57,15,105,64,106,115,136,169,106,200,9,64,30,50,135,189,44,193,
+	35,6,9,40,7,112,154,99,48,75,165,207,158,213,26,9,109,55,149,109,241,188,34,100,
+	125,82,197,34,100,110,48,191,77,174,166,100,12,133,242,58,215,184,122,87,101,27,199,155,
+	123,123,127,42,107,192,8,33,98,143,12,128,241,185,237,192,73,177,1,176,44,187,198,84,
+	240,93,13,81,185,254,229,125,110,41,98,181,255,189,229,168,171,232,16,115,165,54,218,248,
+	90,199,108,31,145,143,60,192,155,105,193,37,182,115,239,203,241,97,54,221,146,8,100,208,
+	214,53,66,8,41,64,172,71,110,107,87,28,106,10,116,214,148,125,195,20,210,0,14,48,
+	87,184,220,24,246,82,57,128,211,28,131,89,106,89,26,53,243,230,4,62,237,119,164,209,
+	227,54,223,92,188,81,202,150,66,246,53,63,199,90,51,48,134,66,153,204,0,203,231,222,
+	205,100,159,243,106,85,243,55,181,226,230,98,33,132,136,5,165,124,21,101,56,50,0,6,
+	67,20,6,64,131,61,170,139,213,15,46,123,25,198,48,107,157,43,248,110,187,255,94,200,
+	229,150,35,118,231,226,216,43,245,238,102,141,223,57,102,107,8,31,121,128,55,115,41,109,
+	108,103,191,195,20,130,54,89,14,55,71,122,168,202,225,91,254,21,66,10,16,235,145,255,
+	165,1,201,51,135,248,59,53,204,135,108,213,34,190,17,108,71,11,203,243,64,57,128,211,
+	156,197,137,139,230,166,81,51,235,50,174,208,163,32,135,81,105,101,182,153,227,91,210,34,
+	116,70,152,139,175,15,55,141,82,90,178,148,35,88,225,170,102,54,58,175,90,54,1,43,
+	10,160,16,66,228,248,42,202,112,114,125,23,138,104,69,149,71,147,196,133,61,98,45,252,
+	187,216,203,82,99,3,131,88,183,205,127,95,193,18,99,253,50,60,97,142,163,29,11,118,
+	51,171,117,131,88,9,195,103,30,96,176,109,30,5,92,24,160,146,161,132,205,124,240,175,
+	139,96,8,41,64,92,28,249,111,241,161,38,141,42,105,75,102,146,28,183,155,109,164,185,
+	60,108,217,56,167,28,192,105,206,92,95,69,41,121,234,254,192,192,109,180,109,119,222,183,
+	251,16,167,139,40,33,159,149,82,182,148,113,128,57,23,220,238,91,191,245,196,135,77,28,
+	199,52,151,117,179,209,0,120,32,213,204,197,229,53,108,132,16,49,103,125,188,222,11,155,
+	89,235,187,80,108,191,66,12,155,70,38,39,191,238,177,22,126,9,94,178,166,7,152,204,
+	13,91,255,61,141,71,45,181,71,103,89,54,56,127,84,50,165,100,133,122,49,19,135,175,
+	60,192,255,46,188,134,218,206,62,208,182,5,53,25,134,152,191,97,245,220,146,223,35,132,
+	20,32,224,58,13,136,49,196,223,209,97,186,72,238,195,9,230,10,195,172,169,92,148,3,
+	56,205,201,24,3,32,212,229,127,204,231,109,30,228,121,166,243,117,184,91,223,125,48,207,
+	167,156,69,232,92,105,46,190,33,134,73,205,206,227,109,215,117,179,49,127,77,49,179,209,
+	183,20,7,107,216,8,33,98,206,58,95,69,217,123,211,50,0,122,32,124,3,160,209,22,
+	211,58,230,226,175,197,203,166,240,97,0,220,200,47,91,254,53,210,18,166,168,11,103,72,
+	163,1,104,108,42,172,31,51,97,248,204,3,188,153,209,118,123,233,131,148,13,171,233,45,
+	204,6,172,28,6,1,70,3,96,167,36,30,113,57,230,104,154,155,175,218,132,253,77,149,
+	134,133,215,175,101,24,99,94,23,215,222,230,227,129,47,13,80,4,192,212,99,48,76,205,
+	78,195,230,86,226,64,134,114,116,184,9,194,131,23,37,204,151,170,165,140,222,230,199,124,
+	175,180,51,37,135,207,213,46,98,68,255,71,118,122,122,28,149,84,177,16,66,100,61,6,
+	115,215,138,172,189,105,227,157,173,147,82,184,37,124,3,96,139,196,69,85,204,78,254,177,
+	96,119,174,179,78,238,6,179,9,152,196,179,198,122,121,220,27,195,239,228,69,83,207,119,
+	97,22,226,51,15,240,102,42,112,191,237,252,141,184,58,188,198,91,18,129,12,166,152,57,
+	5,72,167,164,174,110,60,122,115,26,144,97,166,103,104,107,235,38,255,36,24,105,179,178,
+	220,75,37,203,41,148,3,56,237,49,88,173,102,177,90,242,9,230,65,104,13,16,40,66,
+	196,248,254,200,225,250,216,9,228,126,87,185,127,255,99,67,86,74,161,39,85,76,197,7,
+	133,247,225,81,8,33,50,130,229,137,139,254,201,218,155,94,96,42,204,151,82,184,37,124,
+	3,160,33,2,160,182,171,2,92,64,79,75,141,239,184,11,184,210,146,15,238,180,216,103,
+	255,253,143,250,190,11,179,16,223,121,128,55,115,8,71,218,170,156,155,164,157,205,64,63,
+	42,155,138,107,211,59,172,20,32,214,163,203,179,19,37,182,248,32,38,32,68,143,220,118,
+	12,55,87,232,99,239,55,229,0,78,127,12,134,169,77,252,42,249,120,224,39,83,161,182,
+	0,167,138,131,205,89,187,250,211,49,102,2,121,141,179,60,30,145,157,30,128,150,84,191,
+	101,232,165,193,35,132,136,53,11,124,21,101,56,255,248,46,20,219,18,190,1,176,82,226,
+	162,157,36,127,32,151,39,172,113,194,174,228,5,94,51,214,168,201,181,18,229,86,140,78,
+	126,21,99,38,140,36,242,0,111,198,234,73,86,140,71,172,59,217,125,82,154,227,204,21,
+	134,132,149,2,196,197,209,157,232,107,74,194,81,206,22,162,207,63,121,54,137,87,112,181,
+	133,76,57,128,51,96,244,26,108,180,63,74,62,174,89,40,111,215,116,36,199,236,255,87,
+	140,145,49,19,200,135,28,195,38,143,199,20,100,169,44,250,154,139,181,9,88,8,17,247,
+	137,77,66,230,101,237,77,27,239,76,6,64,215,132,111,0,52,120,231,212,146,252,1,168,
+	205,163,150,205,187,171,56,214,236,171,195,77,214,237,126,113,162,108,106,117,62,189,48,230,
+	1,158,228,74,63,71,217,170,180,227,236,176,154,111,73,67,114,16,135,153,30,62,201,197,
+	34,179,166,1,49,38,0,57,206,244,240,75,14,171,207,229,77,214,244,66,214,222,87,14,
+	224,116,96,57,51,19,23,254,36,249,184,230,199,164,138,69,72,28,204,174,166,226,227,99,
+	182,79,100,34,71,250,8,97,84,42,75,165,177,191,249,13,122,112,88,159,29,133,16,34,
+	35,48,184,249,77,207,210,91,158,199,74,83,177,12,128,174,73,169,1,176,130,228,191,133,
+	67,56,211,82,195,252,141,119,15,6,72,136,110,213,58,55,118,226,72,34,15,240,102,134,
+	210,205,86,229,26,115,230,21,255,236,98,94,33,22,163,95,226,194,142,73,118,182,37,13,
+	200,81,102,177,132,150,0,164,177,205,45,166,27,167,184,58,209,100,223,133,34,50,12,86,
+	190,111,36,29,215,124,107,42,92,47,111,215,20,113,149,169,48,143,203,98,37,140,159,57,
+	208,20,210,41,33,165,179,84,30,165,204,155,128,43,176,167,6,144,16,34,198,252,149,184,
+	104,25,139,178,242,150,167,153,139,255,148,82,184,69,6,192,52,97,52,205,146,56,250,122,
+	165,255,216,142,28,223,133,89,137,193,202,231,206,202,147,203,24,155,151,65,25,30,14,75,
+	178,131,125,119,118,231,164,175,109,116,180,107,104,42,220,61,188,216,85,15,80,198,84,92,
+	130,7,92,62,216,141,230,95,5,152,75,15,12,6,192,31,244,177,211,53,239,154,7,194,
+	122,73,40,5,28,106,254,186,51,48,86,254,127,191,176,159,207,5,91,169,172,149,137,101,
+	151,239,129,26,66,66,136,24,99,180,134,101,231,119,77,227,93,173,229,111,41,133,91,194,
+	55,0,150,79,92,36,3,224,127,148,78,194,126,178,31,251,74,128,238,213,58,126,30,128,
+	6,43,223,108,151,41,147,90,112,137,173,202,190,28,31,78,243,143,55,61,68,140,36,159,
+	155,196,255,25,78,13,171,55,7,112,128,185,194,229,180,118,117,34,75,14,96,121,0,166,
+	7,63,38,46,42,224,3,201,199,21,43,248,202,84,172,189,212,169,193,248,82,41,206,21,
+	49,18,197,239,28,224,219,95,35,123,13,128,189,204,225,92,148,6,68,8,17,103,102,153,
+	62,94,126,159,149,183,60,193,84,56,61,107,67,226,134,64,110,108,47,158,118,244,96,136,
+	207,35,175,147,240,118,96,181,169,80,30,128,219,224,240,155,203,147,92,74,27,91,149,59,
+	76,41,49,252,83,206,180,203,215,72,234,12,128,149,56,58,156,190,172,202,45,230,10,45,
+	184,216,181,90,56,62,181,70,68,136,113,14,247,142,228,227,138,143,216,224,123,70,41,66,
+	98,95,243,22,206,129,52,137,209,43,186,7,243,125,31,93,50,107,229,82,198,236,228,215,
+	94,129,196,133,16,49,102,147,41,74,116,12,13,128,211,164,18,238,9,223,6,183,218,87,
+	81,44,185,217,156,189,54,1,135,178,135,68,183,3,198,28,65,139,98,39,142,223,76,223,
+	68,220,58,122,149,224,17,219,227,194,106,156,242,139,63,211,120,197,36,83,128,0,236,228,
+	51,185,206,32,243,46,93,255,88,140,172,185,60,236,122,57,104,236,249,2,166,232,57,146,
+	22,204,49,117,212,59,158,51,134,198,147,113,230,226,247,36,161,20,96,12,240,87,60,70,
+	241,255,166,176,127,82,155,249,75,103,177,108,140,78,126,57,54,111,120,33,132,200,106,12,
+	251,23,190,206,194,219,93,205,47,62,165,33,10,175,23,195,102,149,175,162,88,82,145,187,
+	124,116,224,181,18,92,33,22,152,10,227,23,54,107,53,179,18,23,186,119,244,218,221,190,
+	173,117,128,57,166,147,95,186,208,214,199,81,29,2,120,188,229,208,222,215,81,67,195,233,
+	201,93,57,193,92,225,84,186,186,62,153,209,0,168,28,192,233,131,193,60,53,95,155,128,
+	93,176,158,151,77,197,127,202,216,157,2,118,99,63,83,241,160,216,248,255,77,166,135,249,
+	147,165,149,82,89,44,157,222,230,98,69,1,20,66,196,25,131,155,223,12,211,210,47,67,
+	249,212,28,176,249,123,41,132,123,82,234,1,168,21,230,142,28,105,11,122,92,136,131,105,
+	39,177,21,194,104,0,156,31,67,129,76,246,85,84,136,81,118,31,213,154,225,220,192,96,
+	31,199,116,14,228,202,126,54,1,239,77,171,112,196,96,145,110,109,174,247,112,178,73,190,
+	11,69,164,24,243,87,252,79,242,177,242,134,217,237,251,93,73,40,5,88,252,255,46,141,
+	137,24,38,176,183,121,190,242,47,134,96,189,217,108,0,172,103,142,104,123,128,34,9,9,
+	33,98,140,209,228,245,97,214,221,238,7,182,23,170,112,77,74,61,0,23,74,254,133,184,
+	197,227,100,238,92,137,172,8,254,48,21,198,209,0,56,201,87,81,33,42,240,64,138,110,
+	96,128,143,69,78,167,64,174,236,231,44,195,82,36,165,251,60,109,88,150,1,48,67,248,
+	152,117,137,11,95,101,153,36,100,193,98,36,149,1,48,122,218,114,152,169,248,100,26,199,
+	66,12,31,177,143,187,121,240,231,166,121,75,169,172,150,145,113,19,112,181,128,190,243,9,
+	33,68,38,50,193,20,7,38,251,162,68,191,109,42,252,59,150,235,123,223,132,111,0,92,
+	154,184,232,15,201,191,16,141,56,207,67,237,246,236,35,145,21,162,128,159,77,197,242,0,
+	220,14,183,121,128,55,115,48,125,82,114,3,85,57,210,243,49,169,50,0,86,231,136,148,
+	200,232,40,79,215,85,14,224,140,97,53,159,39,46,92,195,11,146,144,145,121,230,73,240,
+	38,237,162,78,1,151,152,146,113,229,113,97,44,132,240,38,7,179,194,77,197,95,57,140,
+	42,137,139,203,100,181,148,14,76,170,88,8,33,178,152,229,76,76,92,56,142,53,89,117,
+	179,211,248,213,84,252,161,212,193,11,225,27,0,13,25,106,100,0,44,138,75,169,237,186,
+	174,252,255,138,98,42,43,125,106,100,214,18,72,30,224,205,220,75,229,148,220,130,215,68,
+	32,65,164,0,1,63,105,64,78,73,73,86,198,10,220,233,81,37,148,3,56,99,48,218,
+	248,110,86,34,16,35,119,152,51,0,191,103,250,72,41,66,161,9,253,77,197,199,5,244,
+	236,78,111,158,228,72,119,139,179,153,28,200,74,170,38,174,80,35,171,229,212,221,108,224,
+	148,1,80,8,17,103,12,159,48,87,102,153,15,224,139,190,37,33,10,19,190,1,208,96,
+	229,155,101,74,78,26,91,202,185,142,227,85,155,99,36,174,34,248,209,92,252,67,12,69,
+	18,72,30,224,205,212,98,84,74,110,97,31,118,242,84,191,99,64,15,55,175,105,64,114,
+	125,230,44,78,150,155,169,235,169,190,114,0,103,16,207,155,44,5,211,205,41,46,98,78,
+	62,15,154,43,40,136,98,244,92,68,49,211,19,244,146,24,136,224,110,78,100,163,155,138,
+	179,216,135,185,84,55,189,206,178,219,0,88,138,30,166,226,61,82,244,69,82,8,33,210,
+	129,247,77,133,207,101,217,84,216,128,35,3,160,55,82,106,0,92,171,85,102,145,156,232,
+	114,219,225,233,148,144,176,138,224,75,83,225,98,254,138,161,72,86,243,103,226,66,175,206,
+	94,67,217,55,5,183,144,195,73,158,234,119,10,236,202,222,206,212,43,37,209,171,186,113,
+	138,199,35,38,153,23,157,202,208,148,78,228,243,134,169,248,6,179,55,103,172,185,211,28,
+	226,32,159,215,37,163,136,169,198,64,83,241,17,230,180,15,89,128,195,213,156,237,110,204,
+	254,201,62,252,9,212,50,85,170,157,229,242,58,192,84,152,231,33,241,189,16,66,100,27,
+	95,152,54,189,189,102,78,129,150,81,124,103,14,239,245,43,115,165,12,94,72,169,1,16,
+	190,82,15,20,217,41,183,185,168,149,199,201,18,85,145,140,55,21,254,24,83,161,24,236,
+	61,94,195,189,229,112,127,74,194,142,159,68,113,15,181,83,101,0,60,53,5,146,41,201,
+	3,166,144,90,222,123,93,27,128,211,141,199,77,133,63,153,237,131,49,102,25,119,155,43,
+	60,159,101,33,114,50,129,211,41,109,42,206,246,252,191,27,57,149,107,220,85,253,155,253,
+	152,5,24,13,128,197,178,222,5,174,151,185,88,6,64,33,68,124,89,203,184,196,133,235,
+	120,42,107,110,244,97,115,177,182,194,120,36,124,3,224,63,166,36,133,95,170,7,138,164,
+	59,61,173,117,122,82,71,130,42,130,105,76,55,21,255,16,83,177,4,148,7,120,51,205,
+	83,178,72,171,197,193,30,106,167,198,0,88,159,131,82,32,153,203,125,248,204,40,7,112,
+	70,241,30,179,77,197,231,179,86,50,42,130,171,108,95,191,31,151,140,34,166,36,167,153,
+	138,15,204,242,180,174,43,57,140,135,220,85,157,205,62,204,216,242,239,154,137,171,213,140,
+	96,26,159,90,90,154,189,234,187,105,80,9,33,98,140,209,244,117,119,150,68,137,94,202,
+	51,230,10,47,73,17,188,17,197,204,225,219,196,69,50,0,38,98,132,181,198,0,9,169,
+	72,222,54,23,127,31,83,177,4,150,7,120,51,151,208,38,5,55,225,62,186,94,69,154,
+	5,118,85,47,105,64,134,146,151,130,229,209,69,158,143,81,14,224,12,99,147,249,227,231,
+	12,110,150,140,10,241,19,247,155,43,252,200,215,146,82,196,28,103,222,206,154,221,254,127,
+	115,233,110,222,161,176,237,107,249,63,243,159,209,0,88,35,6,74,99,252,32,222,41,203,
+	211,32,11,33,132,137,55,89,157,184,240,143,44,137,115,114,159,57,189,231,84,57,46,120,
+	37,10,3,160,97,159,239,111,177,76,201,234,134,189,44,62,128,229,57,82,66,42,146,151,
+	205,203,232,247,99,42,150,0,243,0,3,148,224,145,20,248,29,244,166,129,203,154,29,61,
+	111,137,77,140,251,52,32,197,82,176,45,63,151,135,125,100,29,86,14,224,140,227,110,86,
+	152,138,71,233,93,90,232,185,54,220,150,102,97,148,130,39,70,206,112,243,188,167,71,22,
+	223,250,47,236,238,118,11,194,28,246,217,110,43,131,193,104,90,59,6,74,211,205,60,25,
+	217,77,195,74,8,17,91,86,155,109,124,217,240,121,120,29,247,154,43,60,37,53,240,190,
+	122,12,31,163,155,159,34,112,39,98,132,177,180,175,62,122,22,201,12,62,53,21,127,203,
+	226,152,10,198,152,7,216,143,189,103,247,20,68,187,203,101,144,203,154,157,2,189,174,219,
+	179,29,145,130,109,249,167,177,151,143,163,140,61,174,28,192,233,200,18,115,58,219,53,156,
+	148,37,27,61,130,226,46,62,177,189,44,20,51,38,106,246,165,157,169,56,155,253,255,222,
+	167,155,121,31,255,182,154,217,125,135,72,38,6,43,95,28,60,0,187,37,85,44,132,16,
+	89,205,35,166,194,175,109,59,227,50,128,251,153,103,94,181,252,79,74,224,125,69,29,62,
+	223,152,76,15,175,169,15,18,176,23,187,24,74,119,150,128,138,228,113,179,75,199,248,216,
+	10,102,245,150,96,226,69,226,111,199,231,40,234,69,126,27,67,92,110,177,77,141,1,48,
+	122,147,104,109,174,243,117,156,177,199,103,42,7,112,90,114,139,57,97,197,39,140,146,140,
+	182,242,51,151,216,31,96,178,152,70,205,121,166,194,22,244,206,218,27,31,195,65,110,67,
+	109,76,166,71,161,228,121,45,18,87,175,21,3,181,105,68,125,83,177,210,128,8,33,226,
+	204,135,219,4,140,40,130,43,50,124,179,195,74,110,52,87,120,155,191,164,4,94,137,194,
+	0,152,111,202,220,252,57,11,212,11,9,40,43,17,120,196,250,17,96,124,140,133,99,176,
+	249,248,219,241,89,129,7,34,191,137,250,46,210,227,64,106,12,128,77,217,55,114,121,220,
+	231,33,62,161,235,30,87,4,192,244,100,129,45,101,197,8,62,146,148,182,76,23,143,182,
+	165,69,153,205,147,146,83,196,52,55,91,248,206,203,210,116,22,155,184,132,161,108,112,87,
+	249,59,122,20,10,208,154,75,115,211,59,49,14,24,109,124,93,40,166,193,37,132,136,45,
+	142,217,7,112,2,47,100,244,237,221,98,179,20,141,145,10,120,39,154,249,214,88,211,212,
+	232,113,245,130,8,136,215,249,219,84,60,159,137,49,22,142,193,230,227,215,226,115,48,71,
+	69,126,27,110,18,129,4,153,2,4,220,166,1,57,45,192,184,131,238,232,203,17,62,143,
+	156,236,83,83,68,74,185,193,28,5,121,19,3,205,201,93,98,66,1,39,217,119,177,143,
+	100,189,36,21,49,103,152,102,156,213,56,33,43,111,122,41,189,24,237,182,242,123,236,83,
+	68,226,234,6,148,78,124,72,203,88,168,142,209,0,88,222,188,177,92,8,33,178,156,7,
+	204,179,195,11,204,197,105,205,95,182,40,134,127,152,172,76,34,17,209,24,0,95,51,21,
+	62,100,218,33,44,132,7,44,15,137,167,98,173,106,1,231,1,222,204,61,84,142,248,54,
+	14,119,177,229,169,99,192,166,56,55,105,64,74,50,48,98,73,84,228,14,159,71,42,7,
+	112,134,50,155,235,109,21,14,100,105,236,197,116,62,47,217,170,124,207,163,82,167,136,41,
+	201,113,166,226,83,179,50,174,241,116,246,116,159,121,236,117,14,43,50,252,130,209,198,39,
+	3,32,138,2,40,132,136,55,75,205,115,154,217,62,195,5,165,3,103,153,146,28,3,220,
+	162,112,46,126,136,198,113,126,34,51,105,156,168,240,15,62,116,185,173,79,8,19,31,154,
+	18,78,3,60,17,107,241,24,243,0,79,166,139,175,147,214,226,70,134,69,122,27,197,25,
+	96,205,105,213,154,5,172,162,128,124,96,35,171,129,127,88,207,186,45,155,176,10,88,201,
+	186,237,242,131,174,99,3,101,182,249,26,82,140,146,64,25,138,1,101,201,161,148,139,237,
+	248,71,83,61,226,14,189,137,186,190,85,193,24,15,68,6,192,244,229,54,78,52,175,248,
+	39,113,4,239,80,42,198,34,26,101,55,140,23,112,134,190,59,70,78,31,170,153,158,235,
+	167,102,225,45,191,75,127,150,185,173,252,36,39,39,72,91,109,24,241,229,99,145,5,24,
+	218,82,133,37,137,139,187,250,254,26,38,132,16,217,192,237,156,110,178,233,220,202,81,236,
+	154,129,183,245,26,111,152,43,44,142,249,218,222,55,81,69,206,24,203,217,137,11,239,148,
+	1,80,4,128,101,155,205,183,252,18,107,241,252,70,65,98,143,95,191,6,64,56,133,167,
+	205,153,151,147,38,159,149,172,98,5,203,248,135,165,44,117,145,73,241,94,91,194,248,16,
+	120,133,15,40,73,9,202,82,156,202,148,163,34,213,168,64,57,202,81,158,138,148,163,28,
+	229,168,68,57,74,4,116,189,238,156,226,251,88,163,133,175,128,223,244,44,73,91,214,51,
+	156,119,204,85,62,229,24,158,139,173,9,240,126,46,183,87,26,195,183,82,165,200,57,217,
+	84,120,172,225,115,134,195,63,172,162,102,198,69,69,190,141,139,220,59,38,92,199,85,9,
+	191,203,24,82,128,180,140,60,240,68,106,200,165,11,111,153,94,135,57,25,30,229,94,8,
+	33,146,97,22,79,49,40,113,241,70,78,100,98,198,205,12,23,218,93,76,110,86,218,66,
+	127,68,101,0,124,193,100,0,124,139,31,93,108,177,19,194,196,199,188,107,174,240,88,204,
+	5,180,154,89,52,73,84,232,63,236,91,14,15,210,158,117,73,53,109,57,75,88,204,98,
+	254,102,54,243,249,135,69,44,37,159,149,172,101,131,219,208,233,41,103,149,203,119,80,49,
+	202,80,137,10,212,160,26,85,183,254,170,80,149,106,30,182,83,151,228,193,36,22,126,147,
+	204,147,136,213,122,154,164,49,239,242,10,125,204,85,94,167,55,175,81,49,134,194,185,134,
+	171,237,149,22,113,153,212,40,114,26,155,115,36,157,91,228,95,103,242,60,175,243,221,22,
+	51,90,69,246,229,48,250,155,2,226,165,13,107,57,213,150,146,236,63,54,113,166,49,163,
+	86,11,95,69,89,70,55,147,1,176,58,141,152,169,65,38,132,136,49,35,57,150,146,137,
+	139,127,227,42,110,202,168,27,114,24,204,63,230,42,243,184,91,29,239,143,168,12,128,95,
+	48,153,214,137,187,248,122,94,84,95,136,36,40,224,2,115,133,85,60,23,123,33,77,74,
+	108,0,76,102,215,103,75,46,231,42,87,53,87,49,151,5,204,96,58,179,249,155,133,44,
+	99,5,107,88,23,171,79,247,27,89,206,242,4,101,121,84,113,105,240,188,60,169,200,79,
+	74,1,146,209,156,70,23,219,190,191,143,233,202,219,190,183,136,103,38,14,23,112,155,155,
+	138,67,77,123,9,69,72,156,108,138,56,221,163,136,79,192,11,25,201,67,219,61,15,243,
+	121,149,87,185,146,171,205,39,75,3,102,208,135,159,221,86,94,65,63,139,87,111,155,196,
+	69,113,50,0,26,233,44,3,160,16,34,214,204,98,12,103,154,42,220,194,94,28,158,65,
+	55,116,155,61,187,199,117,114,89,240,75,116,179,168,135,76,133,175,240,171,250,66,36,193,
+	211,76,48,87,120,216,125,40,158,172,197,96,247,73,206,234,115,177,105,133,178,149,235,41,
+	71,115,186,49,136,235,120,156,15,248,153,191,88,202,90,237,220,217,202,38,22,186,82,211,
+	22,92,156,212,117,38,249,212,18,145,22,252,195,64,123,4,187,95,217,147,47,98,36,148,
+	133,28,236,206,252,119,15,175,74,133,82,48,211,52,230,72,26,90,232,47,63,177,43,247,
+	22,249,57,100,54,167,112,168,239,180,85,81,240,54,187,186,55,255,205,99,111,139,249,175,
+	41,53,18,23,182,140,141,10,117,54,39,137,233,164,65,38,132,136,57,215,153,95,141,14,
+	39,243,103,198,220,204,87,92,106,171,50,149,135,213,233,254,167,101,81,241,36,107,18,23,
+	22,112,161,250,66,248,102,149,45,238,211,6,119,107,195,44,199,96,247,153,147,212,130,170,
+	4,247,184,120,148,200,208,23,20,83,168,65,71,250,114,33,247,243,14,211,88,239,233,232,
+	124,115,14,96,121,0,166,63,239,219,2,158,2,252,69,15,70,196,36,57,218,71,180,103,
+	188,155,138,191,112,145,212,39,5,28,72,131,196,133,149,11,237,105,255,140,61,141,203,148,
+	113,236,195,138,180,188,81,135,235,57,216,125,38,238,95,217,131,137,150,58,198,240,188,241,
+	49,0,150,48,7,10,146,1,80,8,17,119,22,48,210,92,97,9,7,165,245,231,179,109,
+	87,165,253,236,59,162,206,245,184,252,17,219,80,44,178,43,45,225,37,6,36,46,126,155,
+	241,244,86,127,8,95,92,201,223,230,10,79,243,151,164,100,242,237,242,154,7,120,54,95,
+	51,145,169,252,197,63,44,97,181,114,176,71,76,62,63,240,195,214,255,202,163,30,77,104,
+	66,99,154,208,130,86,150,24,89,147,149,3,56,243,185,138,238,236,101,171,180,137,145,124,
+	198,3,236,148,213,162,88,197,53,220,226,46,169,239,74,250,154,62,68,138,208,56,214,84,
+	120,252,14,129,201,103,209,215,186,171,231,7,250,51,150,188,52,187,205,165,156,196,235,238,
+	171,127,200,81,46,92,190,13,47,230,210,52,143,145,18,117,226,75,83,161,210,128,8,33,
+	226,206,221,12,98,23,243,20,255,216,52,124,119,238,200,10,14,50,187,42,0,188,202,56,
+	117,184,127,138,69,120,173,91,57,193,20,183,254,60,122,82,92,61,34,60,243,29,119,153,
+	43,56,220,34,41,145,100,30,224,191,249,128,111,152,194,95,44,100,165,187,229,182,136,136,
+	77,252,201,159,124,180,229,191,242,104,204,206,180,161,45,109,104,81,196,51,85,57,128,179,
+	128,141,28,203,215,212,113,99,99,104,203,185,92,78,249,172,20,131,195,115,92,228,34,47,
+	248,22,221,30,204,84,169,78,10,40,201,97,166,226,193,59,252,247,41,182,176,223,0,140,
+	231,209,36,50,161,135,193,247,244,231,15,247,213,199,112,166,43,239,133,61,19,23,237,26,
+	88,86,249,76,192,232,228,87,89,105,64,132,16,154,27,114,22,31,155,115,4,142,231,116,
+	30,72,235,252,241,107,57,210,30,70,99,21,231,169,187,147,33,74,3,224,79,188,201,161,
+	137,139,127,231,118,237,206,17,158,217,192,16,155,255,217,75,218,214,8,192,106,102,210,52,
+	81,225,164,66,111,145,207,249,134,159,153,198,28,150,176,86,210,203,24,54,49,157,233,91,
+	2,157,21,163,49,29,216,133,214,236,76,147,45,214,95,227,96,152,169,128,186,25,194,223,
+	244,230,83,55,169,126,215,51,154,39,25,193,64,83,122,184,140,228,19,174,228,51,247,213,
+	207,227,5,169,77,74,56,192,164,167,157,119,216,218,249,46,239,187,60,237,213,28,71,217,
+	52,185,69,135,187,184,200,253,110,164,77,92,238,102,27,63,80,150,182,137,11,187,196,74,
+	141,58,217,138,101,0,20,66,196,157,79,185,135,179,204,85,30,162,20,119,166,241,26,102,
+	0,31,216,171,93,200,44,117,118,50,20,139,244,106,215,155,12,128,48,130,35,98,181,161,
+	65,4,193,117,182,239,4,235,185,76,82,218,194,228,196,6,192,201,192,26,190,226,3,38,
+	50,149,249,178,3,101,5,27,153,198,180,45,118,143,210,180,166,59,123,240,157,89,67,68,
+	166,240,51,135,243,246,14,187,39,19,48,151,161,92,193,105,156,73,181,172,184,245,2,222,
+	226,6,190,246,114,200,232,52,158,239,102,59,158,252,255,110,117,125,218,121,188,200,160,180,
+	184,193,69,12,226,45,247,213,151,210,159,247,92,214,221,221,52,75,143,151,1,176,21,101,
+	89,149,184,184,19,47,105,168,9,33,98,207,165,244,166,153,185,202,93,148,229,134,180,108,
+	252,6,78,112,243,40,255,128,7,212,209,201,145,27,233,213,190,49,79,122,214,48,72,91,
+	11,133,39,62,227,122,91,149,123,152,46,57,109,97,146,233,105,90,134,50,236,199,13,188,
+	205,31,50,255,101,33,107,152,192,237,244,231,115,159,26,34,210,142,79,220,228,3,254,151,
+	127,24,73,67,78,100,44,235,50,250,166,39,112,41,141,57,204,155,249,239,73,123,58,57,
+	17,26,7,36,46,42,181,67,120,192,124,62,246,112,226,215,210,226,246,62,167,131,23,243,
+	223,84,246,112,109,254,179,216,248,246,136,149,26,229,209,206,84,172,52,32,66,8,1,171,
+	56,201,30,152,125,20,195,211,48,108,234,90,142,114,179,85,35,159,193,138,249,154,44,197,
+	34,190,222,8,122,154,54,158,127,197,61,156,173,94,17,46,89,194,241,182,167,220,82,187,
+	133,48,70,24,252,187,54,178,81,242,17,242,0,204,44,94,164,18,247,187,143,231,188,154,
+	39,120,130,226,212,166,62,181,34,254,254,151,60,249,252,201,108,147,15,80,34,94,213,100,
+	49,133,180,50,101,0,238,181,195,238,224,207,61,37,245,251,32,229,55,231,112,23,23,218,
+	115,21,254,199,123,244,119,159,36,24,232,149,184,168,25,53,99,166,74,74,3,34,132,16,
+	86,62,231,106,174,179,85,186,139,37,140,113,183,137,36,34,22,209,151,79,220,84,28,204,
+	159,234,228,100,137,218,0,248,37,207,115,140,169,194,197,116,223,33,34,140,16,137,166,222,
+	67,108,217,127,225,58,150,72,82,91,145,127,151,144,134,100,23,99,88,202,83,222,194,251,
+	109,224,175,56,165,69,31,195,105,74,83,158,66,246,49,21,246,221,225,191,231,120,58,245,
+	74,150,82,57,133,183,246,15,3,120,215,203,1,119,112,161,167,47,109,85,76,78,126,123,
+	198,78,149,58,153,101,213,80,49,161,132,16,2,24,69,87,211,231,163,205,60,197,36,94,
+	51,125,161,139,148,95,56,194,93,26,173,59,121,89,29,156,60,209,187,0,92,104,222,93,
+	184,150,126,172,80,191,8,23,220,180,37,209,129,241,121,114,183,228,180,13,191,107,143,189,
+	48,80,192,239,18,66,198,241,18,189,89,46,49,36,224,122,134,201,252,151,82,12,86,155,
+	226,133,194,66,255,227,241,228,11,82,120,99,31,209,222,139,249,111,53,39,112,174,71,71,
+	251,131,21,1,208,165,42,185,40,22,66,136,216,204,230,7,216,61,100,224,7,186,240,77,
+	90,52,248,53,246,116,103,254,251,70,249,98,131,33,122,3,224,108,110,55,87,152,206,153,
+	234,23,97,229,29,46,183,85,217,196,16,47,123,115,98,192,234,248,230,201,203,165,242,54,
+	191,154,52,217,230,87,115,187,178,220,248,234,135,114,0,103,38,31,177,119,74,45,33,233,
+	59,5,30,206,21,218,22,152,98,58,38,46,234,66,133,29,254,82,206,227,201,43,164,232,
+	166,28,70,179,63,243,220,31,240,55,61,120,218,243,101,14,50,21,118,139,157,42,181,162,
+	140,169,88,6,64,33,132,216,204,34,14,101,165,189,218,92,246,230,137,20,55,213,225,90,
+	250,184,105,44,252,197,145,158,226,132,136,132,20,75,193,53,111,228,68,234,153,42,60,65,
+	103,91,14,107,17,115,166,115,172,221,173,227,46,190,149,164,118,192,144,7,56,221,41,78,
+	57,42,83,142,114,148,165,18,229,41,71,105,42,146,75,57,138,83,154,82,20,167,28,185,
+	84,132,237,254,154,28,107,88,203,6,86,82,64,62,144,79,1,43,217,176,221,95,215,176,
+	146,21,44,99,21,43,89,201,82,86,102,178,205,89,17,0,51,149,31,216,141,103,99,184,
+	39,208,196,66,6,49,78,98,72,49,185,180,78,92,216,179,208,95,106,121,58,121,94,138,
+	162,224,205,226,68,62,245,114,192,59,28,231,35,24,73,49,211,22,174,134,180,137,157,50,
+	229,209,222,20,5,176,173,134,155,16,66,108,225,39,142,102,172,61,70,244,90,78,228,11,
+	238,77,137,65,104,243,245,79,225,41,119,85,87,114,152,151,239,110,194,60,193,136,158,149,
+	156,202,155,230,42,231,209,134,125,213,59,34,1,203,56,194,30,71,123,22,87,74,82,133,
+	152,84,104,207,85,218,80,156,42,84,165,202,150,255,221,252,175,10,148,163,28,229,169,68,
+	57,74,164,160,77,165,41,13,212,240,116,204,58,86,177,140,21,172,100,37,203,89,194,18,
+	22,111,249,191,205,255,187,33,157,181,67,100,42,127,209,131,107,184,56,206,14,172,219,241,
+	17,39,48,87,98,72,57,149,77,15,238,194,1,238,118,245,116,242,246,238,243,223,4,200,
+	139,12,243,146,199,195,225,38,46,247,181,13,189,27,149,18,23,30,22,75,117,50,166,1,
+	105,173,225,38,132,16,91,25,207,147,12,114,83,241,33,254,228,57,211,11,39,196,169,235,
+	225,252,232,182,242,117,252,164,78,13,138,212,24,124,223,226,105,142,55,85,216,200,209,124,
+	75,19,245,143,40,130,117,28,97,183,84,20,48,196,79,186,200,172,103,122,234,155,80,150,
+	58,212,164,38,117,168,190,213,216,87,149,170,148,207,18,17,151,164,36,85,12,229,43,88,
+	204,226,173,70,193,127,152,199,2,22,48,55,29,212,117,186,6,72,6,179,145,203,248,144,
+	39,61,58,81,101,35,155,24,201,13,138,252,151,22,84,53,21,238,92,232,47,77,105,227,
+	225,59,196,17,145,223,206,66,134,217,99,15,111,75,62,39,243,138,207,139,25,109,124,7,
+	199,82,157,58,152,10,27,83,154,53,26,114,66,8,1,236,206,40,115,18,174,109,121,135,
+	221,121,157,150,17,55,241,115,142,242,18,249,119,20,29,185,130,105,234,218,32,72,149,199,
+	231,112,122,154,247,110,44,230,0,190,244,232,121,35,226,128,195,16,55,105,194,71,243,129,
+	100,85,4,145,38,255,44,73,117,234,82,131,90,212,166,58,117,168,73,45,106,155,163,248,
+	196,128,242,148,167,81,17,127,95,181,213,20,248,207,54,255,90,159,181,218,33,66,224,125,
+	218,115,59,199,144,19,99,25,252,194,105,124,33,85,72,19,42,154,10,171,23,241,183,1,
+	92,226,122,250,122,76,196,55,51,150,83,188,5,219,252,158,99,152,225,123,118,110,184,189,
+	114,236,29,75,117,106,101,42,204,165,133,123,87,18,33,132,200,90,42,48,138,83,189,237,
+	8,153,202,30,60,99,14,60,27,48,99,56,211,219,26,39,135,163,57,156,235,24,173,248,
+	254,201,147,42,3,224,98,206,224,37,115,149,25,28,193,251,177,55,22,136,29,57,223,77,
+	172,128,111,184,90,146,74,176,56,14,145,202,52,161,54,117,104,178,229,255,55,210,126,68,
+	15,148,165,25,205,10,253,117,41,115,153,199,31,252,177,229,255,255,25,166,99,147,156,235,
+	51,159,5,28,199,253,220,105,118,149,201,90,150,112,21,15,122,204,180,42,194,196,241,90,
+	120,54,247,186,73,94,8,156,82,196,243,50,60,86,115,41,119,123,203,40,243,16,103,179,
+	206,247,5,15,49,249,242,30,64,201,88,170,83,107,114,76,125,208,90,6,64,33,68,236,
+	57,152,251,169,239,253,176,124,14,227,134,136,146,236,110,228,92,238,241,115,96,73,174,165,
+	31,131,249,94,221,156,28,197,82,118,229,151,25,195,41,230,42,95,113,44,47,167,176,137,
+	34,253,24,105,75,34,189,249,25,118,156,190,14,36,96,97,112,167,42,69,19,26,81,159,
+	250,52,160,1,245,169,151,146,40,125,217,78,101,42,111,23,236,125,61,179,249,155,191,248,
+	139,191,249,155,89,252,193,218,224,46,182,72,242,206,10,62,163,43,63,103,110,186,31,223,
+	20,112,152,124,255,210,140,13,230,194,194,243,187,210,220,198,209,46,12,109,245,24,17,225,
+	109,124,205,64,111,251,142,150,115,10,47,36,117,201,147,204,235,187,120,82,129,186,204,78,
+	92,220,74,3,78,8,17,243,69,195,141,12,245,123,240,38,46,230,7,30,9,221,249,106,
+	9,71,39,179,77,111,23,190,225,97,206,119,151,56,88,20,77,42,173,107,231,176,167,45,
+	141,217,27,156,200,19,41,9,243,44,210,145,155,221,77,249,135,241,135,100,149,240,233,190,
+	222,191,157,174,2,77,105,70,211,45,255,91,47,214,251,12,83,69,9,154,108,23,29,213,
+	97,54,51,152,190,245,255,86,248,63,245,58,10,36,223,172,160,36,47,199,208,252,7,185,
+	188,204,222,252,46,5,72,35,54,122,47,236,203,229,92,103,57,109,41,94,137,44,68,204,
+	6,174,231,58,111,158,215,223,211,63,201,89,72,77,122,155,20,253,160,216,42,84,107,147,
+	1,176,141,6,156,16,34,198,28,199,29,69,198,214,112,77,125,26,178,56,116,3,224,92,
+	154,243,35,139,147,153,237,13,101,95,134,242,145,186,220,47,169,52,0,174,166,63,223,218,
+	180,236,25,74,242,176,54,18,10,224,62,46,118,83,237,102,158,151,172,12,44,162,142,251,
+	202,213,182,24,251,154,209,140,166,138,201,153,134,228,80,159,250,219,196,131,250,135,25,76,
+	223,98,12,156,238,237,245,42,255,191,108,121,171,63,75,175,152,222,123,77,222,167,187,62,
+	0,165,17,70,15,192,117,9,82,63,93,67,14,215,25,188,0,171,241,162,199,124,193,254,
+	249,157,227,248,193,203,1,14,183,114,89,210,123,16,78,160,120,226,194,30,49,206,244,211,
+	138,119,77,133,66,8,17,79,74,115,15,39,251,63,188,34,135,209,143,131,34,113,186,106,
+	203,125,220,205,71,60,193,43,254,19,32,54,227,3,238,230,2,237,248,243,187,84,72,37,
+	147,56,147,71,109,149,30,163,4,247,203,215,40,246,220,205,112,55,241,119,222,229,82,201,
+	202,200,52,155,1,176,54,173,105,69,27,90,209,134,106,146,87,134,81,131,26,116,217,250,
+	95,139,152,196,111,76,226,55,38,51,207,174,25,34,243,201,229,113,142,140,241,253,215,229,
+	3,186,153,156,132,68,164,24,231,246,203,19,188,97,114,184,134,118,12,103,78,145,165,251,
+	50,102,59,47,232,48,121,130,211,189,45,79,22,115,34,111,37,125,217,28,243,6,224,65,
+	49,86,168,214,230,5,97,137,104,243,102,9,33,68,90,208,130,151,104,235,239,208,146,236,
+	79,63,250,70,156,117,33,143,158,244,228,65,222,228,9,222,246,23,186,57,135,179,105,207,
+	49,246,229,141,40,76,170,3,236,61,70,123,206,182,85,122,144,21,252,79,177,0,99,205,
+	77,238,188,255,102,113,124,152,57,18,178,130,223,232,145,168,168,56,31,208,150,202,146,81,
+	214,80,141,30,91,187,123,41,191,176,159,233,37,251,155,228,149,5,220,192,241,49,151,64,
+	35,198,210,61,153,189,240,34,64,242,77,133,203,12,101,71,209,155,187,120,146,201,219,189,
+	161,246,230,156,200,182,191,46,227,52,158,243,118,200,183,28,195,204,0,46,221,203,180,153,
+	181,28,125,98,172,80,173,204,43,154,230,252,170,65,39,132,136,25,199,48,134,114,222,15,
+	203,165,27,199,211,55,133,235,190,210,244,163,31,115,121,150,167,189,249,218,255,75,119,190,
+	231,24,62,147,10,120,37,245,86,181,243,105,203,190,182,74,207,80,192,147,50,1,198,150,
+	171,185,198,77,181,229,28,170,109,140,86,12,17,178,54,176,76,230,191,172,165,50,75,204,
+	223,216,100,0,204,124,134,184,251,82,146,75,87,246,200,56,191,250,191,120,211,157,93,175,
+	61,207,114,184,62,5,165,5,171,216,152,120,234,102,180,14,82,134,75,184,132,105,124,207,
+	124,150,81,147,6,116,163,98,100,13,255,136,1,9,60,16,19,80,192,104,174,10,40,3,
+	245,133,230,149,94,185,24,43,84,107,115,113,43,25,0,133,16,177,162,24,215,185,155,249,
+	237,248,44,237,199,192,200,188,233,205,212,225,124,206,231,55,158,231,41,102,120,63,248,67,
+	174,231,26,69,49,247,170,54,169,102,35,71,243,29,141,109,213,158,99,37,207,81,86,61,
+	22,59,10,24,238,46,85,248,122,250,104,234,231,2,227,39,150,219,56,84,18,202,90,44,
+	25,180,39,74,66,25,206,126,220,231,166,90,67,158,99,143,140,188,193,197,12,226,77,55,
+	21,15,230,86,206,145,66,164,1,14,249,84,77,84,232,38,41,253,78,236,148,130,102,223,
+	201,249,222,44,200,11,24,104,10,78,231,137,206,236,99,42,30,20,107,133,170,74,77,22,
+	152,214,180,66,8,17,31,234,243,34,187,123,59,164,12,3,56,141,118,105,119,43,173,24,
+	193,213,124,198,61,188,234,237,91,90,49,174,166,29,131,44,223,20,197,118,164,67,118,141,
+	197,28,204,18,123,181,55,233,17,147,109,222,235,89,202,82,150,26,213,63,46,49,17,215,
+	209,223,157,249,207,225,228,100,114,138,199,136,175,76,143,200,143,25,43,9,101,41,116,254,
+	255,102,0,0,128,0,73,68,65,84,175,242,169,169,120,25,223,72,70,25,77,77,158,50,
+	37,14,248,151,46,124,147,161,230,63,168,202,27,92,237,238,237,55,60,246,91,161,211,5,
+	195,236,110,78,90,54,120,61,167,112,142,55,243,223,171,236,28,152,249,207,226,255,183,19,
+	123,198,92,161,90,249,46,20,66,136,172,98,87,190,245,102,254,43,207,213,252,197,3,105,
+	104,254,219,76,14,221,121,129,233,156,65,9,111,7,30,193,23,52,148,66,184,39,61,118,
+	213,254,198,225,188,71,41,91,181,9,116,225,45,83,104,148,180,167,128,133,44,228,31,254,
+	33,159,101,44,99,25,249,228,147,207,90,86,178,129,229,108,98,153,155,68,23,192,40,158,
+	162,56,21,169,72,37,42,83,145,138,84,164,26,181,168,78,117,55,107,192,12,33,159,35,
+	248,216,93,213,75,121,90,195,217,21,27,248,192,20,66,232,52,246,76,236,176,33,50,150,
+	69,156,97,174,240,110,64,155,215,68,106,200,229,105,55,169,65,143,229,17,74,103,240,109,
+	230,48,130,86,156,196,26,123,213,7,248,158,41,82,140,148,51,39,177,11,95,58,26,0,
+	23,211,143,143,188,28,176,156,11,121,40,192,6,52,225,40,83,241,73,177,79,137,215,218,
+	52,43,108,169,1,39,132,136,9,71,242,148,151,204,29,37,24,196,200,140,200,33,223,144,
+	123,184,136,235,121,196,203,167,184,54,124,207,17,124,33,181,112,71,186,132,213,251,156,19,
+	120,193,238,143,248,39,93,121,217,30,50,48,109,38,146,179,249,155,191,153,195,223,204,102,
+	1,139,88,24,216,22,245,127,248,39,97,89,21,106,80,157,250,212,165,30,13,168,71,61,
+	106,102,228,148,113,26,135,187,13,75,118,39,163,53,152,93,243,150,201,0,56,135,129,188,
+	17,73,26,120,17,29,27,57,193,230,63,61,78,82,202,104,174,97,63,91,149,28,174,207,
+	138,36,233,253,105,192,161,44,182,85,43,199,179,116,97,157,84,35,197,24,172,124,127,167,
+	93,99,39,115,40,127,120,57,224,19,6,49,43,208,38,92,98,122,253,150,50,167,7,142,
+	5,198,93,190,77,52,224,132,16,177,224,92,110,113,191,143,51,143,1,140,200,40,23,185,
+	6,60,200,25,92,198,91,238,15,169,198,187,28,203,27,82,13,55,164,79,94,141,151,57,
+	147,123,237,118,170,101,244,230,33,78,76,83,113,206,101,50,127,108,249,77,77,89,26,194,
+	37,44,217,33,211,67,113,234,211,100,235,175,85,196,169,190,253,241,62,71,179,212,93,213,
+	49,156,171,161,236,129,23,185,157,10,137,139,199,113,14,119,75,74,89,197,89,188,99,123,
+	176,190,44,41,101,48,187,114,137,173,74,14,119,112,118,150,220,110,23,62,99,127,187,255,
+	88,7,174,228,10,41,71,138,49,116,211,239,1,93,226,55,222,100,54,255,176,122,203,62,
+	136,61,216,221,215,71,207,239,232,109,55,44,255,199,58,174,224,182,128,3,143,183,50,91,
+	248,6,102,132,247,70,184,24,157,252,202,83,221,85,104,73,33,132,200,100,174,231,50,247,
+	149,59,243,112,218,110,250,53,177,11,111,242,62,195,220,127,150,43,195,203,12,230,9,169,
+	135,157,116,74,172,123,63,165,185,213,94,109,61,39,241,43,163,210,164,233,27,249,139,73,
+	76,102,18,147,249,141,213,105,218,205,27,248,99,155,225,83,140,6,52,161,53,109,104,77,
+	135,52,77,172,114,23,231,187,221,145,248,52,167,186,220,55,45,54,179,130,199,205,150,128,
+	123,168,202,8,201,41,107,184,156,7,108,85,30,101,165,228,148,177,20,231,17,155,211,110,
+	46,143,49,48,139,110,185,21,31,211,131,185,182,106,23,241,2,63,75,65,82,202,159,137,
+	139,166,178,41,73,111,243,77,220,205,227,252,84,232,239,245,184,144,211,61,206,18,63,225,
+	48,150,187,175,254,35,3,66,72,59,54,218,212,232,92,101,182,1,91,206,192,198,50,0,
+	10,33,178,154,28,110,115,255,50,40,205,213,92,144,193,251,186,122,242,43,35,185,197,237,
+	102,224,98,60,78,53,110,147,146,100,26,151,225,184,251,117,119,230,58,169,99,133,243,153,
+	115,151,51,200,217,197,41,238,144,209,191,92,167,185,211,223,25,237,188,231,44,114,210,133,
+	117,206,16,247,119,240,114,90,25,177,51,133,230,108,178,73,246,58,71,100,7,215,216,71,
+	209,38,154,105,80,100,48,87,218,122,56,199,185,47,11,53,123,138,83,203,174,219,223,42,
+	158,65,138,217,215,212,63,83,146,210,128,69,78,79,195,185,219,57,147,60,156,107,156,83,
+	218,253,188,99,35,163,188,70,40,119,69,119,243,117,143,210,235,204,113,156,13,230,121,247,
+	49,26,114,41,227,205,196,253,114,185,20,215,5,151,155,52,251,77,41,152,216,98,226,122,
+	218,253,42,127,95,103,122,86,140,141,111,156,182,94,172,27,87,73,77,236,106,148,94,220,
+	64,73,119,221,246,41,157,120,142,238,145,54,110,3,63,242,21,223,48,145,169,1,239,250,
+	72,29,5,76,101,42,207,3,208,144,14,236,78,23,118,77,233,22,225,133,28,197,103,110,
+	43,191,200,241,74,93,224,131,169,252,207,22,74,232,10,86,112,163,36,149,241,140,96,164,
+	189,210,35,76,151,164,50,150,102,92,110,171,114,61,167,101,225,141,55,103,28,221,109,174,
+	171,187,114,6,119,73,73,82,136,113,159,239,119,52,247,125,226,159,57,130,153,134,242,159,
+	232,201,103,52,117,117,174,151,57,142,245,110,47,252,7,3,67,9,52,158,99,123,229,158,
+	47,109,2,138,81,207,212,239,141,37,33,33,68,22,63,0,159,162,191,187,170,101,185,131,
+	193,89,146,54,106,55,38,112,3,215,185,245,3,28,73,174,54,178,101,30,174,189,0,139,
+	57,55,59,5,17,216,157,23,56,175,58,23,57,221,188,124,31,206,232,95,49,167,147,115,
+	166,243,180,51,43,5,54,254,175,156,6,238,91,250,63,249,118,248,166,38,249,118,9,95,
+	160,15,178,25,77,129,115,158,155,113,180,92,97,165,50,154,231,108,61,124,82,22,235,248,
+	56,39,207,166,223,11,77,17,79,69,4,44,75,220,59,103,249,238,249,85,78,125,23,79,
+	183,70,206,10,23,231,122,203,203,94,142,39,66,211,167,99,205,87,238,166,87,218,22,246,
+	51,201,105,140,6,92,202,144,7,160,60,0,69,184,228,241,148,219,119,85,115,231,231,172,
+	27,33,31,59,181,221,191,171,175,150,186,152,200,77,195,54,221,192,121,238,98,186,109,228,
+	66,142,100,81,104,13,89,201,251,92,66,103,106,115,36,55,241,25,107,98,162,20,27,153,
+	192,61,28,79,35,234,112,52,15,241,87,68,215,117,184,137,238,238,175,246,32,39,121,201,
+	15,46,182,99,1,55,216,43,221,194,112,133,87,204,88,28,206,116,23,6,99,36,243,37,
+	173,140,165,3,253,204,21,246,230,193,44,190,253,222,220,100,171,82,141,243,164,38,41,229,
+	199,196,69,159,250,62,233,77,174,114,8,207,114,225,254,249,21,71,179,193,221,69,151,51,
+	128,129,94,2,5,122,160,146,237,113,125,177,52,105,11,77,124,23,10,33,68,198,146,199,
+	83,28,239,174,106,127,38,176,115,214,9,160,7,223,211,213,109,229,17,218,8,108,34,55,
+	45,91,117,59,167,185,53,237,188,206,206,140,15,248,242,235,249,144,11,233,68,69,246,103,
+	52,19,178,102,187,175,119,230,241,34,195,104,72,43,78,231,117,86,133,122,173,133,28,196,
+	197,110,167,225,112,11,167,197,184,99,130,224,102,62,182,87,186,139,225,146,84,70,226,112,
+	22,247,185,169,248,25,119,72,90,25,204,13,230,183,120,77,158,166,120,86,11,224,60,142,
+	178,85,57,159,154,82,148,20,242,77,226,162,159,237,137,92,138,100,54,55,187,158,42,152,
+	55,137,79,164,183,219,185,205,231,180,227,169,208,164,52,218,236,137,189,7,7,73,147,182,
+	208,216,119,161,16,66,100,40,57,220,231,46,198,105,49,110,228,57,202,101,165,16,234,240,
+	17,87,187,221,214,60,82,159,127,19,147,155,166,237,122,144,131,89,225,174,234,124,14,98,
+	96,64,198,169,127,120,130,163,169,193,126,220,194,68,217,151,182,242,59,247,115,4,149,232,
+	202,104,38,132,114,133,143,105,207,219,110,43,59,92,194,133,114,77,75,146,2,6,176,196,
+	94,237,110,206,149,172,50,144,75,184,215,77,181,165,156,32,63,218,12,166,11,189,76,197,
+	121,60,67,157,172,23,194,195,54,167,159,114,92,32,85,73,33,223,154,94,230,227,124,157,
+	242,85,86,187,172,185,148,73,134,210,169,244,34,223,221,137,110,103,111,102,133,38,163,61,
+	24,98,174,112,75,150,68,114,10,2,227,120,175,159,229,95,60,132,16,241,228,122,134,186,
+	169,86,159,207,178,218,95,188,24,35,120,217,109,36,142,91,24,32,197,41,154,220,180,109,
+	217,59,236,235,126,99,218,147,116,226,187,164,46,55,153,107,232,72,45,78,228,69,183,211,
+	193,216,177,145,47,184,132,206,236,196,5,124,21,160,253,109,19,35,232,233,222,15,96,61,
+	39,48,90,189,17,0,179,57,209,141,241,231,14,174,148,172,50,140,75,237,27,35,55,15,
+	233,227,34,219,225,47,194,224,44,115,241,57,236,27,3,33,84,226,41,219,84,102,8,101,
+	165,44,41,195,56,93,120,214,215,41,189,108,29,254,51,97,201,18,14,97,161,187,89,199,
+	16,206,11,241,83,73,9,30,49,171,112,95,246,146,30,109,165,177,121,117,88,95,18,18,
+	66,100,221,108,239,82,55,213,218,241,37,123,100,189,48,142,228,75,26,186,169,152,195,99,
+	244,145,242,20,69,110,26,183,237,123,186,48,217,109,229,41,236,201,69,174,191,9,111,203,
+	36,70,208,134,54,92,205,15,114,42,115,197,116,110,101,79,26,48,140,177,1,164,224,157,
+	66,87,70,186,159,89,231,115,8,207,168,15,2,226,77,119,238,209,215,113,157,100,149,65,
+	140,112,155,191,249,28,247,110,183,34,13,169,97,158,216,52,138,77,18,180,46,12,51,87,
+	168,228,110,227,140,8,133,185,252,154,184,240,99,131,129,46,49,223,122,168,59,43,193,223,
+	215,211,135,105,110,78,176,136,253,121,36,84,9,93,78,107,83,113,113,174,151,22,109,131,
+	37,179,179,162,0,10,33,178,139,126,238,130,245,244,226,51,234,197,66,32,109,248,154,206,
+	110,42,230,241,84,12,44,162,62,200,77,235,214,205,98,47,62,114,91,121,35,55,211,150,
+	247,60,156,126,58,87,211,156,182,140,116,111,103,20,91,153,205,67,28,70,3,134,39,177,
+	41,216,225,33,58,241,181,251,3,102,176,167,167,46,22,54,238,114,151,39,226,74,23,161,
+	212,69,122,112,59,35,221,85,188,217,221,46,97,145,182,12,165,164,169,248,161,44,141,1,
+	83,20,55,218,182,58,159,46,117,73,33,134,15,13,5,190,30,67,75,60,212,77,100,96,
+	28,198,39,110,14,159,198,110,73,228,42,113,195,94,92,102,174,48,140,230,210,161,109,168,
+	106,222,254,165,40,128,66,136,108,98,47,158,112,99,175,57,141,55,41,31,27,161,212,226,
+	99,14,116,83,177,52,175,209,72,74,180,35,185,105,222,190,101,244,226,73,247,213,103,114,
+	32,39,185,200,11,156,207,19,236,79,115,174,113,247,253,87,36,100,30,119,209,153,214,140,
+	96,166,231,99,255,96,111,134,121,137,222,248,30,187,202,86,27,56,23,112,191,155,106,231,
+	242,186,100,149,1,188,197,133,238,42,62,170,164,146,25,255,246,54,186,189,245,98,255,24,
+	9,163,130,205,219,177,35,187,75,101,82,134,49,83,219,67,44,246,124,66,47,187,61,42,
+	22,249,215,91,120,220,205,193,191,208,221,199,228,198,11,149,120,154,98,102,221,86,16,142,
+	29,81,30,96,33,68,76,104,204,43,148,178,87,187,152,251,200,139,149,96,202,242,6,71,
+	187,169,88,147,183,168,36,69,218,158,98,105,223,194,245,156,200,175,92,239,182,165,14,143,
+	243,6,215,112,106,130,97,224,240,62,99,24,203,218,148,222,84,117,170,83,145,138,84,164,
+	18,149,168,68,69,242,168,76,46,21,41,190,197,103,163,114,161,99,150,179,9,88,195,90,
+	86,178,129,229,108,98,41,249,44,35,159,124,242,89,198,34,22,166,44,154,255,111,140,228,
+	90,246,101,8,71,82,194,101,63,61,192,69,150,236,124,59,112,23,231,7,176,227,88,20,
+	238,138,51,41,197,73,182,106,5,12,224,51,218,165,164,137,5,228,179,129,149,172,99,53,
+	171,89,199,74,54,144,79,1,75,1,135,101,219,140,143,213,172,3,214,177,26,216,196,242,
+	66,15,19,155,185,185,108,33,253,173,64,30,80,134,146,64,73,202,0,121,91,188,15,42,
+	111,249,223,60,42,80,156,114,148,162,52,101,40,73,57,138,83,49,69,223,86,38,210,223,
+	221,83,224,17,134,42,226,65,134,179,187,105,167,71,78,236,54,13,158,204,237,252,102,170,
+	112,148,41,27,173,8,149,79,153,159,56,199,109,62,55,112,171,199,19,150,242,96,2,236,
+	80,196,223,62,114,23,78,233,91,122,123,114,54,244,195,67,182,80,70,215,81,67,26,180,
+	3,77,248,49,113,97,35,201,71,8,145,37,84,98,188,253,21,144,195,77,177,204,117,86,
+	130,103,168,192,195,246,138,173,121,129,222,74,121,184,45,197,50,160,141,14,55,241,45,207,
+	81,211,237,1,75,56,147,49,220,73,143,66,127,127,156,7,34,246,249,203,165,22,13,168,
+	75,61,26,80,147,154,212,164,26,213,67,18,187,195,66,22,178,136,249,44,224,111,230,240,
+	55,127,51,151,13,17,221,105,1,239,243,62,181,24,204,80,26,88,234,254,202,169,124,225,
+	229,228,235,57,195,205,8,23,62,187,110,48,43,109,233,4,96,5,135,241,3,85,2,189,
+	244,74,150,176,130,21,172,96,25,203,183,252,43,159,124,86,108,249,175,205,134,238,204,100,
+	179,105,176,2,229,41,79,121,42,82,113,203,191,42,80,105,203,191,170,6,156,153,96,41,
+	71,185,243,168,125,136,211,148,228,60,227,57,196,84,216,135,142,49,19,71,30,87,113,172,
+	169,194,161,92,36,165,73,17,155,120,142,115,18,23,223,205,0,218,123,58,97,185,164,12,
+	128,179,57,198,205,215,196,79,57,132,21,33,75,102,8,253,204,21,118,211,238,245,34,48,
+	238,242,173,35,249,8,33,178,130,92,158,162,133,189,218,168,88,154,255,54,207,252,30,162,
+	4,247,217,43,238,207,141,110,55,72,197,131,156,140,105,105,13,158,245,154,208,176,39,183,
+	108,245,88,250,158,123,121,158,53,17,52,180,34,77,183,254,154,80,135,226,41,21,91,1,
+	243,153,197,116,102,108,249,45,140,100,56,30,204,233,28,144,64,185,214,48,154,81,172,247,
+	114,194,197,244,115,31,11,82,248,124,18,220,102,90,160,253,183,134,126,221,199,67,99,57,
+	11,88,188,205,111,225,214,127,173,139,185,216,75,82,149,170,84,165,26,213,182,252,107,243,
+	175,150,143,56,30,14,125,120,205,77,197,251,56,83,222,127,89,192,47,180,53,217,46,186,
+	197,78,32,27,105,196,28,83,133,22,76,149,218,164,136,206,124,103,42,110,195,215,158,34,
+	86,54,113,189,47,183,9,211,119,120,103,173,167,135,155,200,195,223,177,95,232,230,191,246,
+	124,65,25,83,133,226,124,207,46,210,158,66,220,197,240,196,133,51,104,38,9,165,132,55,
+	57,56,81,81,215,66,46,25,162,48,159,240,121,226,194,183,204,31,253,68,86,114,45,87,
+	216,43,221,24,243,136,62,14,103,186,49,1,194,32,254,39,149,250,111,217,159,57,20,103,
+	52,231,120,107,113,30,131,185,153,159,25,205,155,161,54,173,50,77,104,77,27,90,211,38,
+	205,195,143,228,51,157,73,76,102,18,147,153,21,170,19,208,78,156,193,176,66,97,11,198,
+	115,134,215,128,58,223,211,215,87,154,64,225,149,155,220,124,29,185,195,52,241,6,96,41,
+	127,48,151,121,91,255,111,198,150,77,186,194,11,165,168,67,237,45,255,215,132,218,212,161,
+	129,197,115,248,86,119,95,0,71,217,2,206,139,140,160,97,194,228,166,64,59,211,6,185,
+	44,102,132,57,1,206,5,158,119,154,138,224,248,202,156,137,239,80,94,246,240,185,212,189,
+	45,247,10,174,221,225,47,231,112,167,253,176,201,116,247,17,154,208,27,85,248,206,54,97,
+	188,76,249,127,139,228,37,147,227,228,26,179,81,85,132,134,193,0,40,146,70,6,192,248,
+	113,4,175,216,173,30,183,112,126,236,5,85,192,41,60,106,175,182,154,61,249,73,106,181,
+	153,156,12,107,111,95,30,49,167,255,42,76,201,144,188,140,114,104,74,7,58,210,145,14,
+	84,207,200,206,95,206,143,252,192,68,38,242,123,72,193,245,234,113,14,67,183,250,50,205,
+	224,124,175,137,36,28,238,228,98,111,238,130,34,9,92,124,70,42,201,15,180,218,238,47,
+	107,153,198,84,166,50,141,223,249,147,5,10,178,16,18,121,212,164,17,45,104,206,78,52,
+	167,249,14,9,96,39,209,209,205,64,185,222,205,215,68,145,1,12,54,5,69,184,55,166,
+	219,6,231,208,192,244,89,107,60,7,73,113,82,70,127,158,51,87,56,148,103,93,7,69,
+	104,109,142,247,184,205,60,237,183,29,246,79,189,70,31,187,3,244,76,186,50,55,244,7,
+	250,91,182,20,134,205,248,153,210,210,156,34,248,146,189,76,197,85,50,54,114,72,102,35,
+	3,96,152,200,0,24,55,154,49,193,110,241,184,156,235,36,41,96,19,253,121,217,94,109,
+	6,157,200,151,180,54,207,142,50,141,70,60,145,218,189,77,53,217,131,61,217,157,246,9,
+	114,203,101,34,107,248,153,111,249,154,47,77,78,37,62,169,196,153,156,71,113,174,231,118,
+	175,166,216,197,156,196,88,13,210,72,25,109,143,147,181,59,95,176,130,137,76,98,10,83,
+	153,198,95,10,39,151,2,114,105,64,115,154,211,130,54,116,164,60,221,248,210,126,208,29,
+	156,43,201,101,9,247,112,70,226,215,250,95,166,252,32,89,205,238,124,155,184,112,158,162,
+	131,165,144,98,76,53,135,110,131,150,60,102,118,19,220,74,53,151,238,121,135,236,48,133,
+	152,69,71,187,109,104,41,93,152,18,186,60,110,179,61,141,115,121,159,125,164,55,69,50,
+	203,172,74,109,153,36,25,165,0,25,0,195,68,6,192,120,81,146,47,237,161,156,79,229,
+	126,73,106,11,235,57,156,183,237,213,94,178,197,221,21,233,75,30,23,179,14,39,218,95,
+	142,211,214,57,195,121,210,153,238,100,55,115,157,87,156,243,157,221,157,98,129,74,175,140,
+	83,222,251,81,159,81,95,202,30,57,57,220,99,239,155,106,78,142,131,126,105,243,203,113,
+	170,185,169,119,151,212,59,139,248,44,113,79,119,114,226,203,181,230,49,160,116,170,169,228,
+	4,55,207,178,126,206,199,206,38,75,47,127,238,250,217,248,241,118,199,173,115,118,179,31,
+	179,62,18,171,219,137,246,182,95,236,136,68,172,53,207,65,246,215,96,75,9,239,105,54,
+	22,226,239,61,41,88,172,184,211,174,19,125,173,239,202,120,177,194,233,236,102,36,13,147,
+	114,109,94,238,103,38,29,120,138,214,209,92,170,9,123,209,149,131,98,230,81,177,138,175,
+	120,159,247,249,33,53,222,93,5,140,98,68,72,251,146,133,237,153,240,16,67,36,134,172,
+	227,33,78,85,234,143,44,26,165,75,19,187,160,215,142,177,163,219,106,243,214,208,253,121,
+	95,202,147,50,114,153,184,53,47,155,145,218,244,162,35,187,80,139,106,84,1,150,178,134,
+	69,44,102,33,139,88,194,82,94,117,25,73,120,247,29,146,125,156,199,237,246,131,134,240,
+	72,232,146,216,155,183,119,136,225,80,136,78,124,73,9,233,76,66,170,179,40,113,161,66,
+	189,167,134,191,99,235,122,30,5,179,229,20,17,35,14,225,13,155,133,102,87,62,86,184,
+	211,29,152,207,30,246,164,1,107,233,18,211,48,217,59,44,35,50,149,210,220,192,217,228,
+	134,119,129,10,236,207,65,28,72,221,88,43,200,18,222,103,28,111,179,32,202,139,206,97,
+	144,150,105,41,36,143,87,56,76,98,200,42,198,113,152,130,51,102,17,141,249,67,66,240,
+	129,210,128,164,150,174,124,18,230,172,109,71,94,226,168,109,254,235,117,142,180,127,3,185,
+	157,243,66,111,86,27,62,167,146,185,74,57,38,208,92,250,98,160,29,63,39,46,188,140,
+	81,146,80,10,70,247,103,18,66,168,116,51,37,9,22,89,68,29,126,161,138,185,74,19,
+	190,206,208,252,3,225,242,11,93,89,110,171,52,153,78,172,141,187,164,114,50,186,245,93,
+	24,67,155,224,79,219,154,131,233,77,87,15,25,233,178,157,2,38,48,142,113,124,23,133,
+	11,209,19,12,87,218,216,20,83,158,207,217,69,98,200,26,126,160,59,43,37,134,44,98,
+	63,125,34,241,197,125,137,35,39,138,72,184,155,51,163,186,84,51,126,39,111,235,127,77,
+	99,55,251,196,226,83,246,11,125,231,65,29,190,182,123,242,60,193,0,233,138,145,131,24,
+	159,184,240,30,206,146,132,34,166,24,223,155,252,123,59,219,195,153,9,38,242,189,169,248,
+	39,58,107,103,84,12,200,225,77,91,194,178,74,124,69,75,73,170,72,222,225,96,187,191,
+	195,109,74,157,156,233,148,224,106,214,6,23,99,161,189,115,157,243,187,182,209,39,228,111,
+	231,78,167,187,147,27,94,140,139,249,28,46,165,78,11,154,177,76,49,87,178,228,183,212,
+	22,122,95,100,28,71,73,175,125,253,158,150,234,164,152,114,252,30,85,111,223,183,205,220,
+	101,165,211,214,126,196,28,106,133,126,255,149,248,217,222,242,227,53,217,180,50,216,36,193,
+	151,53,208,34,231,108,179,78,223,46,149,117,193,237,182,103,195,217,82,180,24,48,212,246,
+	134,200,117,198,106,176,24,184,201,254,182,223,196,222,113,87,179,220,12,111,255,122,70,210,
+	33,8,167,232,14,220,200,116,126,224,114,90,232,225,147,144,122,156,205,39,204,225,62,246,
+	9,67,117,94,160,45,175,75,202,105,193,116,197,1,204,18,28,78,118,25,48,75,100,14,
+	85,37,2,95,52,147,8,82,204,74,250,68,227,141,92,141,19,183,254,187,128,65,252,106,
+	59,96,3,71,51,63,228,70,149,225,13,118,182,85,218,133,7,165,39,86,234,248,46,20,
+	33,80,147,107,204,21,58,75,70,46,176,74,233,26,106,74,74,89,78,35,110,177,85,25,
+	161,132,208,70,46,228,24,91,149,92,30,163,66,188,165,148,155,5,247,240,27,221,57,209,
+	255,196,173,14,103,51,145,137,92,76,83,141,26,87,212,226,52,62,228,47,238,112,23,207,
+	219,29,11,233,79,127,83,84,103,17,49,47,241,152,132,144,5,60,194,171,18,66,214,209,
+	95,34,240,197,46,138,153,157,114,38,115,98,20,241,72,207,216,166,171,47,226,37,251,1,
+	87,240,69,200,77,42,193,75,116,179,85,170,194,43,148,149,150,88,169,109,158,214,139,104,
+	185,41,113,82,42,128,102,236,41,25,185,96,79,155,11,74,69,70,75,74,89,77,14,143,
+	80,222,92,229,48,174,144,156,44,60,108,143,98,213,136,155,226,174,106,217,66,5,174,243,
+	26,245,163,20,125,25,200,190,219,68,137,17,94,249,150,39,121,42,217,144,125,14,143,113,
+	17,139,37,205,52,163,34,147,98,158,3,39,243,153,71,27,150,74,12,89,70,61,102,233,
+	181,229,147,51,184,79,66,72,57,39,241,72,184,179,207,18,204,222,26,32,125,20,151,217,
+	15,24,199,33,33,135,56,206,227,89,250,217,43,189,73,47,233,135,11,222,48,197,139,217,
+	64,41,10,36,163,200,232,202,167,230,241,252,52,199,73,74,174,120,134,227,109,235,165,238,
+	74,5,146,197,156,108,203,66,95,159,31,109,249,65,4,48,157,78,182,100,32,5,244,136,
+	243,88,202,201,162,123,105,200,44,247,149,155,49,140,147,180,143,42,16,86,243,28,247,155,
+	67,215,154,152,204,169,202,29,150,166,244,229,197,244,107,84,69,114,169,76,30,21,40,78,
+	57,32,103,75,66,197,10,228,1,101,40,9,148,216,226,67,81,150,18,69,44,13,139,242,
+	175,88,197,250,66,127,91,207,170,109,202,214,177,26,216,180,229,149,178,12,7,88,201,6,
+	242,41,96,233,214,191,167,25,125,228,255,151,133,92,198,245,18,130,79,38,104,47,90,90,
+	48,148,251,194,52,98,31,201,43,91,86,203,151,113,163,189,250,223,116,12,121,255,65,46,
+	79,216,86,246,0,183,70,144,132,56,59,248,158,93,77,197,181,88,32,25,69,68,30,223,
+	211,222,84,193,106,31,20,219,176,47,31,153,43,252,74,7,165,2,201,82,170,241,27,213,
+	76,21,138,241,137,188,105,93,242,188,125,35,240,20,218,177,46,174,242,201,201,170,129,179,
+	208,221,60,236,80,78,99,255,172,216,253,156,78,124,199,253,60,199,26,111,7,173,225,58,
+	110,41,194,242,34,210,133,31,131,220,231,157,152,178,148,167,60,21,168,68,249,45,191,202,
+	148,167,60,101,168,72,113,202,81,146,50,148,161,36,229,210,58,55,247,6,86,178,150,53,
+	172,102,221,22,211,224,106,86,176,130,165,172,216,242,91,198,114,86,176,98,139,97,49,116,
+	126,181,199,155,18,25,200,167,246,141,132,34,1,14,181,101,26,72,11,14,225,185,240,246,
+	186,62,71,127,96,30,39,243,182,189,242,70,246,14,121,251,111,30,143,185,73,235,59,128,
+	39,164,23,46,153,107,222,158,208,142,159,37,163,136,24,206,29,102,147,197,4,251,118,60,
+	177,149,73,116,96,131,77,226,119,73,78,89,201,179,54,155,213,205,92,32,41,185,230,100,
+	123,36,171,171,109,209,75,179,151,108,50,0,86,181,127,193,45,205,137,156,175,56,224,161,
+	241,15,119,115,31,75,220,86,127,149,11,248,67,82,75,107,246,227,253,160,78,85,154,170,
+	84,165,42,213,183,252,255,205,191,106,84,166,98,236,204,241,5,228,179,132,197,219,252,22,
+	177,104,203,191,214,4,119,153,3,121,87,42,156,117,84,96,81,90,219,193,211,157,129,60,
+	41,33,164,5,109,120,54,172,79,20,63,50,143,215,249,159,187,167,233,37,33,199,213,202,
+	227,127,110,188,255,246,230,109,74,74,43,92,178,137,18,166,93,190,86,55,42,17,16,53,
+	249,125,203,38,140,4,156,111,207,105,32,118,144,216,109,230,10,203,105,201,60,201,41,235,
+	232,205,56,219,148,126,188,124,105,61,176,138,78,76,49,87,89,199,46,76,141,167,116,98,
+	100,0,172,202,233,156,73,13,141,136,208,7,220,195,220,206,159,182,106,83,56,151,241,146,
+	86,6,48,147,70,222,15,42,73,29,234,82,151,58,212,167,54,245,168,67,45,69,223,119,
+	201,106,230,51,135,217,204,227,111,230,49,155,57,204,243,231,163,62,139,198,146,102,22,178,
+	183,150,182,73,113,143,215,104,193,34,52,74,113,29,103,167,216,156,61,142,67,67,141,23,
+	151,199,227,156,96,175,214,154,207,169,44,141,240,52,229,55,124,108,238,231,38,239,139,8,
+	128,255,49,208,84,92,139,223,205,249,65,68,33,86,208,146,185,54,169,15,146,156,178,140,
+	18,252,108,206,1,83,137,159,169,47,57,121,98,2,93,108,254,180,239,113,64,60,101,19,
+	27,3,224,249,140,84,102,181,200,216,200,147,12,54,69,212,190,158,17,138,97,145,33,116,
+	96,130,155,231,68,29,154,211,156,230,236,68,67,106,203,208,30,48,255,48,143,63,153,202,
+	52,166,50,213,54,53,220,140,67,39,126,144,228,178,144,19,121,92,66,72,130,177,28,38,
+	33,164,17,173,185,53,133,121,47,102,176,107,168,105,146,92,122,255,213,225,75,26,74,23,
+	60,209,156,105,137,11,79,229,65,73,40,2,246,226,51,165,255,8,158,167,109,223,12,28,
+	246,225,19,201,41,171,184,208,150,149,86,99,201,15,87,216,67,102,31,108,243,188,204,78,
+	98,99,0,156,202,78,105,210,204,2,22,178,144,101,228,179,140,124,242,201,103,41,107,88,
+	203,42,214,179,130,141,228,111,249,24,189,109,82,129,255,82,25,84,34,151,74,228,81,129,
+	18,148,165,2,21,169,72,165,45,255,91,157,234,105,180,51,172,44,171,19,23,238,199,135,
+	122,44,101,12,215,112,165,185,66,103,62,180,229,173,23,1,178,130,158,124,107,171,52,146,
+	17,146,84,86,114,21,35,37,132,36,248,57,154,184,166,194,3,187,114,33,135,82,42,242,
+	235,174,98,207,80,99,197,229,241,36,199,218,171,149,231,83,115,22,5,81,4,93,248,58,
+	169,85,159,8,64,191,39,152,159,166,221,248,68,91,22,125,161,84,32,49,163,38,83,204,
+	174,178,135,243,154,164,228,131,141,116,177,37,41,157,78,219,56,166,2,41,38,229,8,147,
+	245,204,101,54,127,51,155,217,44,100,30,11,89,200,66,147,103,92,2,220,127,160,174,66,
+	13,170,83,131,90,212,166,62,245,169,71,253,20,204,170,69,150,25,28,58,114,176,169,194,
+	247,124,204,161,146,83,100,188,103,55,255,189,35,243,95,214,162,61,32,201,81,79,34,72,
+	59,190,227,104,42,112,24,253,57,160,136,196,237,97,81,192,201,161,154,255,74,240,28,71,
+	218,171,149,228,85,153,255,124,96,76,150,89,85,242,137,128,51,205,230,191,98,220,35,243,
+	159,79,238,161,189,121,235,98,91,78,87,42,144,44,226,6,179,249,175,10,15,73,70,190,
+	40,198,195,116,54,219,202,155,113,86,28,3,149,202,3,48,96,230,49,157,25,204,96,6,
+	127,240,23,243,125,24,251,130,167,58,245,104,66,83,154,209,148,166,212,143,40,225,130,60,
+	0,179,136,234,252,66,77,83,133,22,252,162,188,4,17,177,158,54,76,55,87,153,207,46,
+	238,114,162,139,12,228,17,78,78,84,212,133,195,37,31,96,6,99,18,23,230,155,67,214,
+	139,148,82,129,78,116,164,3,187,208,160,208,130,168,128,197,91,115,37,45,102,9,23,39,
+	217,147,23,134,58,233,47,193,243,28,97,175,150,199,115,244,85,191,251,96,16,255,75,92,
+	248,4,39,74,66,33,163,244,31,161,162,84,32,49,162,29,19,205,75,243,71,57,73,82,
+	242,205,197,182,221,213,249,52,101,113,220,164,34,15,192,164,217,200,12,38,241,27,191,242,
+	59,83,77,70,175,148,177,144,133,219,4,3,43,73,19,90,211,138,54,180,162,165,114,206,
+	9,119,42,116,10,111,152,42,76,97,44,125,36,167,72,120,205,102,254,131,83,100,254,203,
+	98,214,39,46,218,133,139,37,31,224,93,147,1,112,189,228,147,198,44,231,163,173,123,223,
+	138,83,141,106,91,60,2,87,176,184,208,4,125,23,55,219,107,19,114,119,168,214,137,146,
+	188,196,33,246,106,185,60,46,243,159,79,170,250,46,20,129,112,179,217,252,87,203,22,59,
+	70,24,25,193,243,204,49,85,168,192,141,50,115,103,9,55,154,205,127,61,148,243,37,201,
+	177,244,50,51,76,21,42,114,25,231,199,77,42,50,0,250,100,25,19,249,129,137,252,194,
+	148,12,91,79,172,227,55,126,219,242,239,60,154,176,51,29,232,72,7,106,171,83,69,98,
+	198,242,104,98,191,35,128,71,101,0,140,136,71,109,21,30,230,77,73,41,139,49,188,112,
+	86,75,58,0,172,245,41,63,145,86,108,96,158,209,195,229,165,36,12,128,143,114,78,136,
+	45,47,201,139,110,204,127,112,171,155,4,193,162,72,100,0,76,41,123,217,84,247,54,101,
+	255,77,138,242,220,100,203,31,52,128,71,149,10,36,11,232,97,78,131,85,154,49,218,74,
+	159,20,165,185,143,3,205,85,78,231,78,254,138,151,84,100,0,244,196,74,190,229,107,126,
+	96,34,127,100,197,253,108,98,26,211,120,5,128,218,116,160,35,187,179,135,57,178,138,136,
+	43,103,211,157,102,137,139,223,103,13,165,37,165,208,89,101,219,61,63,147,243,36,165,172,
+	198,16,172,120,150,164,179,101,16,24,144,1,48,91,120,157,169,52,247,117,228,189,156,189,
+	37,219,90,24,148,229,117,246,115,83,113,116,168,86,200,108,71,6,192,20,146,199,189,102,
+	155,68,55,142,145,148,146,228,56,30,54,167,2,201,225,30,58,154,67,5,138,12,96,148,
+	185,248,162,180,73,98,154,185,28,64,95,94,50,85,40,197,8,179,147,75,246,145,43,181,
+	112,195,92,94,100,56,93,169,202,126,92,206,75,89,98,254,219,158,121,140,227,58,14,165,
+	58,117,56,154,59,249,92,111,21,177,45,171,24,196,166,196,197,235,236,137,41,68,0,124,
+	109,30,151,5,156,196,10,73,41,171,89,144,184,232,119,73,7,96,171,143,123,130,87,157,
+	200,14,54,113,157,143,163,28,174,226,204,80,205,127,111,184,51,255,93,199,69,234,195,36,
+	48,218,248,244,29,59,92,148,254,35,18,238,177,197,214,110,203,105,146,82,134,115,36,93,
+	76,197,245,245,158,8,132,91,108,46,42,3,105,29,47,137,200,3,208,200,31,124,206,23,
+	140,231,239,88,221,245,60,94,228,69,160,28,123,208,147,158,116,144,157,88,0,124,193,24,
+	78,77,92,60,145,30,146,81,232,252,96,46,126,64,27,66,178,30,131,117,107,33,139,180,
+	242,197,98,8,157,34,249,100,13,79,210,207,99,2,250,127,56,137,113,33,182,168,34,227,
+	205,203,185,127,185,158,203,212,127,73,97,52,0,86,162,152,57,241,163,240,69,43,6,176,
+	27,213,105,99,174,86,50,110,206,52,161,81,194,230,138,113,27,131,89,200,183,60,105,254,
+	238,37,210,148,28,46,55,87,184,133,50,146,82,0,52,228,34,70,154,42,228,113,5,199,
+	197,75,245,178,105,54,16,88,22,224,5,188,205,135,124,20,51,195,95,34,170,209,131,125,
+	57,144,166,158,142,82,22,224,172,84,133,105,137,195,62,95,192,205,146,80,232,156,203,29,
+	137,11,151,178,83,252,50,89,197,142,166,166,44,48,175,41,15,48,235,169,202,202,196,197,
+	214,132,112,34,131,168,201,215,52,114,93,123,44,131,67,77,144,84,137,183,217,221,205,196,
+	251,54,109,254,77,154,95,216,197,84,92,67,169,176,2,166,52,183,49,84,254,0,105,74,
+	1,15,113,30,107,36,136,12,227,48,94,55,21,239,197,103,242,165,13,136,53,180,54,135,
+	201,217,68,155,56,125,32,214,163,124,135,39,232,4,70,211,149,58,12,226,9,153,255,182,
+	176,136,151,57,131,102,52,101,24,99,77,1,168,68,246,171,130,33,189,196,63,146,79,4,
+	24,165,252,134,204,127,49,96,150,41,199,197,219,146,15,159,153,204,127,218,39,157,93,44,
+	160,39,115,93,213,252,130,195,56,60,84,163,80,101,222,117,103,254,187,93,230,191,0,168,
+	154,84,177,240,72,41,198,113,170,214,140,105,188,154,63,149,113,148,146,32,50,140,203,205,
+	239,138,91,101,254,11,140,210,92,99,174,144,199,165,241,122,100,8,0,214,240,10,3,169,
+	69,103,46,225,139,16,195,195,100,50,127,240,16,135,81,141,35,121,156,37,18,71,60,89,
+	150,184,200,145,116,82,141,134,101,28,216,196,180,196,133,175,101,101,132,90,47,172,227,46,
+	115,5,25,0,179,139,25,116,181,4,160,93,207,219,236,67,87,198,134,250,146,170,193,39,
+	236,106,175,150,195,157,12,87,175,5,128,12,128,145,114,45,123,75,8,105,206,222,92,43,
+	33,100,20,7,178,155,169,184,175,155,47,74,194,53,199,211,222,92,225,132,56,229,91,145,
+	1,144,53,140,101,32,53,57,138,39,181,99,192,5,43,121,141,147,168,65,87,238,100,190,
+	196,161,57,247,86,20,80,52,10,242,76,133,10,255,22,15,62,79,92,52,159,14,60,21,
+	99,209,252,78,23,222,48,85,88,104,218,64,45,50,146,153,116,225,40,94,102,250,14,9,
+	144,86,242,43,119,112,8,85,233,205,199,33,183,161,22,31,179,179,189,90,14,247,113,150,
+	122,44,16,74,82,206,231,92,69,120,166,134,212,54,35,56,155,218,18,66,6,97,244,255,
+	43,230,43,203,149,72,76,174,205,66,158,199,133,113,146,70,140,89,203,139,244,161,42,135,
+	241,164,18,103,122,100,19,95,112,14,245,216,143,49,38,167,48,145,109,52,50,173,128,68,
+	248,212,244,217,59,34,139,48,38,49,88,206,0,6,196,114,67,254,70,238,162,147,45,77,
+	206,187,114,240,207,66,10,120,133,190,236,68,5,74,83,159,142,180,163,30,165,40,207,206,
+	156,203,91,230,29,225,129,80,131,15,104,229,102,194,253,160,41,143,150,240,72,21,83,97,
+	5,201,39,64,250,82,82,66,200,0,74,112,132,132,144,49,116,166,155,169,120,48,205,37,
+	163,128,57,196,230,200,60,48,62,75,217,216,26,0,39,48,156,250,28,205,171,138,153,154,
+	4,155,248,144,161,212,226,80,94,180,101,170,18,217,65,163,196,69,13,37,157,8,104,232,
+	179,119,68,22,241,129,237,181,245,20,45,24,205,250,88,9,229,83,58,49,220,148,122,106,
+	51,239,72,125,178,154,181,204,230,7,126,102,78,132,225,138,171,243,1,173,221,76,183,199,
+	112,138,122,40,64,140,54,190,242,146,79,128,180,147,8,50,132,246,18,65,198,112,129,169,
+	176,36,87,72,66,33,48,210,92,92,146,97,113,145,68,12,119,237,253,205,163,60,201,140,
+	52,152,186,84,164,34,21,169,68,69,202,81,158,98,84,34,151,74,20,219,102,222,82,142,
+	226,20,144,191,245,191,87,179,142,21,108,100,25,5,44,99,13,249,44,35,159,124,242,89,
+	154,194,59,89,199,155,188,73,77,142,101,48,109,245,116,201,102,42,154,190,141,52,72,129,
+	230,173,38,159,117,172,100,5,27,89,193,198,45,163,101,45,107,96,155,255,254,183,238,246,
+	228,83,0,228,21,90,68,84,222,238,95,37,40,11,148,165,4,80,137,28,138,83,142,226,
+	148,163,28,37,169,72,153,200,63,139,55,50,21,214,165,92,4,222,46,34,213,172,225,99,
+	122,155,171,44,227,18,30,227,114,142,141,197,75,254,59,174,225,45,55,1,222,28,222,147,
+	250,136,64,169,196,120,55,19,159,60,30,225,68,73,43,80,202,249,46,20,158,231,126,66,
+	61,37,130,164,30,125,76,197,39,81,79,50,10,129,238,116,231,83,83,133,211,25,109,74,
+	180,151,61,196,202,0,232,240,30,247,51,150,77,17,95,183,12,13,169,75,93,234,82,157,
+	234,212,164,38,213,169,22,176,232,29,22,178,144,69,204,231,31,22,50,159,57,252,197,236,
+	72,55,231,46,224,14,238,160,59,167,209,135,18,122,198,100,39,29,76,9,169,26,5,120,
+	161,2,242,89,202,178,173,38,238,127,255,181,156,149,172,35,159,213,172,75,169,209,123,91,
+	42,83,138,210,84,164,20,101,169,64,165,173,102,253,127,255,85,153,138,1,186,90,27,205,
+	172,185,116,224,51,169,105,12,24,103,51,0,2,76,97,32,215,112,49,199,81,38,139,69,
+	241,17,55,51,222,109,229,159,20,184,86,4,188,220,254,144,14,110,166,218,79,114,140,164,
+	21,48,229,125,23,10,143,40,21,169,122,74,4,203,57,20,79,92,88,156,139,36,161,144,
+	184,146,253,77,197,53,56,142,71,227,32,135,216,24,0,243,185,149,7,34,138,254,93,146,
+	38,52,165,25,77,105,76,3,234,109,227,81,20,230,51,191,6,53,10,253,117,37,127,49,
+	155,89,204,96,58,51,152,17,129,115,208,167,124,74,77,6,51,84,207,152,108,196,176,208,
+	201,245,225,1,232,176,104,203,111,179,249,122,17,139,89,200,63,44,205,168,152,156,110,12,
+	145,229,169,76,13,170,83,141,170,84,163,6,213,169,74,53,170,81,205,243,108,173,49,57,
+	38,79,167,142,50,0,198,130,113,220,237,174,226,116,78,225,34,78,226,212,44,76,110,182,
+	156,39,184,159,201,94,14,121,75,170,35,2,164,52,111,184,49,255,21,231,89,142,146,180,
+	2,71,30,128,66,136,12,125,120,13,54,21,159,64,99,201,40,36,122,210,133,175,76,21,
+	206,145,1,48,171,232,30,114,172,191,170,180,161,21,109,104,77,115,234,166,77,104,197,114,
+	180,222,46,52,205,2,166,49,121,203,111,78,104,87,93,192,13,140,214,51,38,27,233,148,
+	184,168,57,101,141,135,110,224,31,102,51,159,217,44,224,111,22,48,155,5,44,116,179,105,
+	47,43,88,193,10,254,42,226,239,185,84,163,38,245,168,73,125,106,82,143,90,212,163,166,
+	241,177,92,158,166,166,15,25,29,165,164,177,224,15,126,167,165,219,202,75,185,141,219,233,
+	202,113,244,203,146,212,152,27,120,151,103,120,205,30,241,111,123,214,49,70,170,35,2,163,
+	56,47,210,221,94,173,4,207,43,50,127,40,200,3,80,8,145,145,28,71,165,196,133,121,
+	92,42,9,133,200,21,28,108,42,222,153,174,124,158,253,82,136,141,1,48,12,243,95,30,
+	45,232,64,71,218,211,182,8,239,187,116,164,38,53,233,186,229,223,249,76,226,71,126,96,
+	34,191,134,16,44,126,19,34,11,233,232,190,104,1,179,152,197,159,204,226,47,230,48,159,
+	5,177,49,246,121,161,128,127,248,135,95,182,251,91,14,53,169,77,93,234,211,136,70,52,
+	164,209,14,153,127,59,154,12,128,157,36,211,152,112,30,47,121,217,217,235,240,25,159,49,
+	156,3,56,156,67,50,56,205,217,26,62,226,13,94,102,145,159,131,71,242,167,20,71,4,
+	68,14,15,154,87,17,155,41,201,139,28,42,105,133,130,209,198,39,15,64,33,68,186,98,
+	220,38,119,68,22,238,216,72,39,14,98,23,126,54,85,56,69,6,64,81,36,205,232,194,
+	238,116,100,23,139,207,83,122,83,145,61,217,19,128,13,252,202,68,190,227,75,38,203,112,
+	39,76,19,106,67,78,250,150,124,203,204,173,70,191,89,202,174,237,27,135,249,204,231,135,
+	109,254,82,154,198,52,220,98,12,108,76,43,211,193,45,41,203,42,201,48,6,140,231,0,
+	198,122,141,47,177,158,55,121,147,92,58,115,40,61,233,156,81,19,128,25,124,192,56,222,
+	243,234,245,247,31,247,112,163,212,70,4,198,237,156,100,175,84,134,55,216,79,178,10,9,
+	121,0,10,33,50,144,246,230,143,245,231,74,66,33,115,22,167,152,138,251,113,46,75,178,
+	93,6,50,0,186,166,20,187,177,39,93,216,35,67,188,253,220,83,156,14,116,96,48,176,
+	156,111,248,138,175,249,130,229,234,112,81,248,149,149,151,184,240,106,174,146,132,66,98,13,
+	147,221,70,58,203,99,23,115,112,11,145,53,124,65,15,222,161,182,247,3,11,248,150,111,
+	185,146,242,116,103,31,186,210,33,173,211,54,77,227,43,62,228,163,34,183,208,187,198,225,
+	82,197,165,16,1,50,156,225,246,74,101,121,131,125,37,171,208,48,58,249,201,0,40,132,
+	72,79,78,51,21,118,102,47,73,40,100,6,112,5,11,18,23,151,102,0,119,102,187,12,
+	100,0,116,33,162,118,244,164,39,93,41,149,245,247,90,129,253,217,31,216,196,143,124,206,
+	23,188,75,190,20,64,252,75,71,243,10,91,164,5,157,100,0,140,13,191,176,23,239,210,
+	204,239,225,43,120,139,183,128,146,116,96,119,118,163,61,205,211,102,74,48,155,159,249,142,
+	111,249,134,197,201,159,108,61,39,243,180,212,69,4,198,33,220,106,175,84,158,183,183,236,
+	178,16,225,32,15,192,116,160,149,34,143,68,204,4,126,147,16,50,153,114,230,148,240,23,
+	72,66,161,83,146,97,92,99,170,48,140,187,178,125,89,43,3,160,129,22,28,196,129,116,
+	205,232,141,190,254,200,163,19,157,24,206,6,190,225,93,198,49,81,230,29,129,155,108,135,
+	34,229,40,13,72,156,152,201,238,60,148,108,130,209,117,124,205,215,91,38,69,109,216,133,
+	182,180,160,57,141,41,30,241,205,204,97,42,211,152,196,47,252,20,228,238,139,233,28,207,
+	183,82,21,17,24,109,121,202,228,13,191,153,50,140,149,249,47,244,117,180,223,66,17,28,
+	189,221,88,195,69,128,156,47,3,96,102,211,151,10,137,11,235,40,99,124,36,156,202,40,
+	54,36,46,110,197,110,124,147,221,18,144,1,176,8,74,179,55,7,113,16,77,98,47,137,
+	226,116,165,43,215,48,159,241,140,151,63,96,220,209,103,222,76,64,6,192,120,177,132,190,
+	156,194,237,193,124,167,90,199,68,38,110,157,28,52,98,39,26,210,128,250,52,162,30,213,
+	3,254,20,182,158,197,204,229,47,254,98,22,127,49,147,169,225,4,175,124,156,179,89,33,
+	53,17,129,81,155,113,84,180,85,42,195,155,244,144,172,66,70,30,128,66,136,140,227,4,
+	83,225,96,25,102,34,122,145,31,202,43,166,10,199,201,0,24,179,233,196,193,244,165,183,
+	151,228,138,177,160,22,39,113,18,27,248,136,151,121,149,133,18,72,28,233,74,107,9,33,
+	3,104,75,199,173,54,28,17,15,198,240,41,15,6,109,111,216,200,244,29,242,77,151,162,
+	42,213,168,74,117,170,81,149,170,84,165,12,229,129,50,148,4,42,145,67,241,45,110,55,
+	235,89,5,172,100,3,14,203,128,117,172,102,49,139,88,204,98,22,179,136,69,44,138,34,
+	206,236,28,206,229,69,169,135,8,144,226,188,68,125,91,165,50,140,101,31,201,42,130,25,
+	187,223,66,33,132,72,9,117,216,59,113,97,46,39,75,66,17,49,212,108,0,60,150,243,
+	217,152,205,247,47,3,224,22,42,114,40,125,57,48,6,113,254,146,153,249,30,192,1,220,
+	199,167,188,196,171,204,147,64,226,68,63,158,176,111,122,18,105,64,30,159,209,135,119,36,
+	136,88,49,133,189,57,148,187,105,24,230,69,214,50,135,57,153,34,145,13,220,207,149,202,
+	102,37,2,230,86,251,190,222,146,188,166,212,31,145,96,180,241,149,33,151,2,201,72,8,
+	145,86,28,103,90,75,245,162,145,36,20,17,7,208,148,25,137,139,171,179,63,227,179,249,
+	254,115,165,2,197,56,136,103,153,199,147,28,46,243,159,43,251,194,62,220,203,223,140,231,
+	56,74,75,239,226,193,112,158,215,224,200,24,202,240,6,253,36,134,216,49,150,54,92,167,
+	237,174,128,195,171,180,97,184,204,127,34,96,142,230,44,251,12,233,73,246,151,164,34,193,
+	24,230,47,39,134,225,187,133,16,233,206,241,166,194,161,146,79,100,228,216,188,45,143,207,
+	238,251,207,141,247,189,180,227,54,254,207,222,93,199,89,81,253,127,28,127,45,187,44,205,
+	46,221,221,160,210,24,96,160,32,6,40,6,96,139,221,221,29,63,59,190,118,97,183,130,
+	152,216,34,168,128,129,216,116,40,221,221,177,59,191,63,88,96,119,185,59,119,230,222,233,
+	121,63,239,227,235,151,189,51,247,222,115,63,115,230,206,204,103,78,204,229,83,78,72,61,
+	149,21,83,153,28,198,155,44,226,37,14,36,195,254,203,27,42,130,33,242,63,30,77,101,
+	35,139,111,178,121,155,227,21,134,216,89,207,45,52,225,14,86,197,56,6,6,35,232,198,
+	177,76,87,117,16,135,181,230,133,228,151,20,207,234,238,139,103,146,244,242,173,172,8,137,
+	72,160,180,165,67,201,11,107,114,164,34,228,161,211,205,19,71,253,163,125,19,41,74,93,
+	128,109,109,168,178,156,192,249,236,173,250,159,150,202,156,193,25,76,227,89,94,97,165,131,
+	231,109,18,32,247,112,69,24,138,89,5,168,76,38,153,84,6,202,82,174,200,223,59,228,
+	36,185,79,176,134,188,157,255,222,53,130,217,38,54,22,44,203,99,13,216,171,235,254,200,
+	228,53,230,104,238,211,24,90,206,237,60,198,37,156,79,157,216,125,247,205,12,227,1,254,
+	86,37,16,23,148,103,88,242,51,151,123,57,91,145,242,76,197,100,167,249,34,34,65,114,
+	172,217,194,65,26,151,205,83,245,56,136,111,75,94,92,129,62,230,195,4,134,91,148,234,
+	154,229,41,4,91,112,30,103,80,85,117,223,33,45,249,31,119,243,14,207,48,222,234,75,
+	212,77,45,44,174,231,6,63,63,62,147,28,114,169,66,14,185,228,144,67,46,229,200,165,
+	44,229,200,161,44,21,168,68,25,42,23,76,66,224,109,166,97,3,107,216,196,58,214,177,
+	153,213,108,100,19,171,216,200,42,86,179,138,213,172,102,37,171,88,93,40,157,232,185,114,
+	124,196,222,204,81,21,142,161,149,220,201,221,28,193,165,28,18,155,182,187,11,120,158,167,
+	89,162,141,47,46,185,135,61,146,173,114,9,215,41,78,30,42,147,214,98,17,17,143,29,
+	99,182,240,100,197,199,99,39,155,37,0,225,24,37,0,195,193,210,112,191,61,184,150,190,
+	234,207,232,184,114,156,193,25,252,200,131,124,100,101,67,40,45,17,14,71,115,183,23,31,
+	83,153,90,84,167,26,213,169,78,77,170,83,157,170,228,146,67,110,178,59,252,62,94,120,
+	148,161,138,133,245,214,178,154,213,172,98,5,203,88,198,18,150,177,140,229,44,99,177,23,
+	195,147,213,230,13,14,210,48,232,49,149,199,39,124,194,30,12,230,4,234,69,250,155,110,
+	228,99,222,224,115,63,179,237,18,121,221,147,143,254,119,56,255,83,156,60,149,157,214,98,
+	17,17,79,53,162,99,201,11,155,209,77,17,242,216,241,92,204,198,146,23,247,37,155,45,
+	81,253,238,49,106,109,90,138,163,185,134,125,85,223,93,180,47,239,51,149,135,121,141,205,
+	230,43,42,41,17,6,237,120,221,233,81,66,203,82,135,186,212,165,14,245,168,67,221,130,
+	116,95,233,200,134,176,18,149,168,159,112,201,22,150,179,140,37,44,40,120,44,100,62,11,
+	147,237,55,118,237,207,197,60,174,138,28,99,255,112,53,215,114,32,39,115,172,165,140,117,
+	184,108,99,36,111,241,129,90,148,139,203,42,240,74,178,99,97,59,222,86,247,45,143,169,
+	5,160,136,132,72,127,179,246,71,167,168,113,146,231,42,211,151,97,37,47,206,229,32,190,
+	138,234,119,143,205,249,202,209,220,79,43,213,117,15,180,98,8,119,242,160,238,133,135,93,
+	89,222,77,119,172,198,108,26,208,152,198,52,162,33,181,169,71,29,170,41,174,59,99,83,
+	39,193,32,109,203,88,196,60,22,51,135,217,252,199,127,204,77,247,230,211,61,124,204,127,
+	138,118,172,229,51,138,81,156,199,190,244,165,31,109,35,241,157,86,242,13,35,248,36,12,
+	195,113,74,4,60,64,115,243,21,234,240,57,57,138,147,199,74,145,197,182,146,23,43,1,
+	40,34,65,98,218,1,120,144,226,227,131,65,102,9,64,56,70,9,192,208,123,144,22,129,
+	42,207,170,130,174,129,171,89,205,90,214,176,149,117,108,102,3,27,217,4,5,83,13,20,
+	85,129,108,160,52,21,41,67,121,202,21,140,128,182,99,108,180,42,73,167,55,240,82,109,
+	30,230,25,179,102,181,18,124,247,208,206,238,75,50,105,92,144,240,107,76,19,26,83,55,
+	82,211,140,123,161,58,213,139,12,52,149,207,2,254,227,95,254,227,63,102,243,47,179,237,
+	246,115,172,192,109,156,161,184,10,121,140,97,12,215,211,138,62,244,228,192,144,182,7,220,
+	202,207,140,98,36,99,205,174,251,69,28,213,147,11,204,87,40,205,112,26,40,78,62,40,
+	203,186,146,23,42,1,40,34,193,145,75,247,146,23,182,162,141,34,228,131,195,40,103,150,
+	173,232,151,236,232,31,94,234,177,224,186,213,204,99,14,11,88,200,82,150,178,136,165,44,
+	101,169,43,125,96,171,81,147,26,212,164,22,53,168,73,125,26,80,143,26,190,125,111,53,
+	101,14,181,253,185,204,106,173,107,69,43,90,209,146,86,52,215,160,59,14,43,69,125,234,
+	211,99,231,223,91,152,193,84,166,50,141,41,76,99,185,149,183,56,133,123,153,166,72,74,
+	129,169,76,229,113,74,209,129,158,116,103,111,234,134,162,212,235,152,192,143,140,102,140,245,
+	201,190,68,28,145,201,227,201,78,103,30,212,224,50,62,49,61,227,80,2,80,68,130,163,
+	151,89,206,229,24,197,199,23,21,56,148,143,74,94,92,143,118,76,140,230,55,87,2,208,
+	113,171,152,89,240,152,203,60,230,152,221,159,116,216,114,150,51,185,216,115,101,105,64,61,
+	26,208,140,230,52,163,153,143,9,65,9,217,37,79,210,198,123,205,184,159,131,212,169,215,
+	227,203,157,182,133,250,112,46,231,91,174,78,54,163,78,22,215,113,150,34,39,69,228,243,
+	27,191,241,48,208,128,189,217,155,142,180,167,122,224,74,185,145,137,252,193,47,252,204,68,
+	77,241,33,62,185,32,217,236,191,71,115,169,162,228,147,50,230,135,75,17,145,160,232,99,
+	182,80,9,64,191,28,99,150,0,132,62,74,0,74,137,242,248,151,127,152,204,36,166,51,
+	147,101,129,42,219,38,166,51,189,208,223,149,105,70,11,218,208,150,182,180,212,249,145,36,
+	118,54,29,146,173,114,10,47,170,254,248,172,26,3,56,140,254,230,211,216,195,64,46,243,
+	240,62,132,132,203,92,230,242,30,0,117,216,139,246,180,161,21,45,124,76,6,110,100,58,
+	211,153,194,95,252,201,12,165,253,196,103,85,184,205,124,133,230,188,170,254,14,190,41,147,
+	242,66,17,17,79,29,90,242,162,186,116,85,124,124,210,207,124,44,217,67,163,58,165,129,
+	18,128,41,91,202,239,252,198,159,76,97,178,211,115,119,186,104,13,191,243,251,206,141,223,
+	156,118,236,65,71,58,105,252,26,41,252,171,112,99,178,85,174,230,1,93,244,4,66,37,
+	62,229,16,198,153,173,82,145,1,188,172,72,73,18,11,89,200,151,64,21,90,179,47,7,
+	209,209,227,65,60,87,241,15,99,25,205,100,102,107,99,72,64,220,110,158,12,207,226,45,
+	77,254,225,35,117,1,22,145,80,104,67,195,146,23,246,213,21,149,111,170,210,157,239,74,
+	94,124,128,249,32,129,97,190,212,23,91,150,240,51,191,241,59,191,49,55,244,223,101,27,
+	83,152,194,112,0,170,211,137,142,116,98,111,26,105,35,199,221,0,179,195,20,192,165,60,
+	168,40,5,70,89,62,160,35,11,204,86,57,78,9,64,49,85,151,214,180,166,29,173,105,
+	75,109,159,202,144,75,15,122,112,29,176,142,41,76,98,50,147,153,196,127,108,213,230,17,
+	159,180,78,54,0,248,13,106,183,225,43,181,0,20,145,80,48,237,0,124,152,226,227,163,
+	67,205,18,128,229,232,193,215,81,252,214,74,0,90,146,199,20,38,48,150,49,76,198,136,
+	228,55,92,198,87,5,115,93,215,166,11,157,233,65,119,202,105,195,199,211,85,230,139,251,
+	243,136,98,20,40,53,121,150,163,204,86,56,144,210,74,163,72,129,74,84,165,54,245,168,
+	79,125,234,210,144,122,212,11,216,165,114,69,186,208,165,224,223,249,44,102,30,243,153,203,
+	124,230,51,135,69,44,103,165,43,179,104,137,20,119,39,165,205,22,239,197,205,138,145,175,
+	202,154,45,84,2,80,68,130,226,224,146,23,101,153,45,20,215,245,225,38,243,45,167,4,
+	96,252,108,99,60,163,24,197,79,49,26,66,107,17,35,24,1,100,211,133,131,232,169,68,
+	96,220,28,68,103,179,197,173,120,205,211,126,129,98,69,63,122,50,170,228,197,21,233,198,
+	88,69,41,146,42,20,244,130,203,161,20,144,73,101,160,60,101,168,66,54,21,168,72,54,
+	185,148,167,10,85,119,254,47,92,71,253,82,212,161,206,110,205,172,86,177,146,21,172,96,
+	37,43,88,205,6,54,179,138,205,172,103,29,91,88,5,108,100,19,0,107,217,6,24,172,
+	82,69,17,219,154,113,172,249,233,243,75,26,7,215,103,217,41,47,20,17,241,76,6,251,
+	149,188,112,95,13,36,225,171,142,212,100,73,201,139,247,143,230,183,86,2,48,33,131,223,
+	249,150,81,252,192,218,216,198,96,11,227,24,199,61,148,97,31,122,114,48,251,170,178,196,
+	195,37,102,11,75,243,6,149,20,163,0,186,218,44,1,8,29,148,0,12,156,178,212,160,
+	2,21,201,165,226,206,255,47,13,84,38,19,10,254,93,158,50,64,57,202,2,101,40,15,
+	148,42,56,83,204,166,66,48,191,86,11,102,186,223,64,47,151,92,154,216,126,213,214,130,
+	59,121,27,216,188,243,175,60,214,176,43,69,184,10,3,88,77,62,176,138,117,172,99,61,
+	43,89,199,122,214,177,44,198,167,3,241,116,3,153,102,139,175,49,191,87,38,30,40,99,
+	254,11,43,34,18,4,237,168,86,242,194,62,138,143,175,74,209,139,183,74,94,220,149,242,
+	108,136,222,183,86,78,167,152,245,124,203,8,62,101,190,66,81,96,51,223,241,29,183,83,
+	129,158,244,227,8,234,43,36,81,86,222,124,40,138,75,119,246,204,147,96,233,67,117,179,
+	25,200,219,41,66,190,202,160,33,45,104,66,29,106,80,135,90,212,160,14,149,163,247,53,
+	235,115,47,39,243,39,87,37,155,153,218,31,165,169,2,80,240,95,251,54,177,148,5,44,
+	97,9,11,89,202,92,166,50,51,68,51,128,137,221,202,124,170,217,226,90,92,175,24,249,
+	78,45,0,69,36,4,122,152,45,236,173,248,248,236,80,179,4,96,54,93,205,6,9,12,
+	43,37,0,119,154,206,7,124,206,24,179,201,160,99,109,61,35,24,65,6,157,56,156,163,
+	149,6,138,238,175,96,249,146,23,86,227,86,69,40,160,50,233,201,176,146,23,107,154,111,
+	239,149,165,61,109,105,73,11,90,208,50,250,173,81,170,115,5,151,83,30,232,192,72,62,
+	230,246,157,243,205,71,104,139,54,40,182,39,229,51,155,233,76,99,26,83,249,205,44,3,
+	47,161,115,149,121,2,233,254,40,102,240,67,71,147,128,136,72,8,152,116,35,173,72,39,
+	197,199,103,7,152,47,238,161,4,96,68,205,226,19,134,169,135,156,37,6,19,152,192,93,
+	52,164,63,3,232,174,137,203,163,166,191,217,194,243,117,201,19,96,237,205,18,128,234,183,
+	237,157,186,28,204,254,116,101,15,243,9,4,162,164,14,87,115,94,145,62,201,71,209,143,
+	207,184,155,31,163,253,197,75,209,132,38,28,90,240,215,127,140,103,28,163,248,43,162,115,
+	133,197,73,53,206,49,91,220,197,188,121,160,120,68,147,128,136,72,8,152,180,0,212,0,
+	91,254,107,66,3,230,150,188,56,146,163,0,198,188,214,77,225,109,222,99,146,234,190,109,
+	115,120,156,199,105,192,177,156,192,62,10,71,84,100,112,164,217,217,244,197,138,80,128,213,
+	52,91,88,81,241,113,89,61,14,98,79,218,208,134,22,241,250,226,29,185,128,83,19,92,
+	136,103,112,36,71,50,138,39,249,56,46,237,234,27,211,152,1,192,50,70,241,54,159,178,
+	69,187,69,104,157,106,62,198,230,35,154,10,43,16,76,7,105,212,38,42,249,124,224,76,
+	142,164,149,141,59,186,38,123,195,211,188,172,136,122,106,163,217,194,254,172,176,248,54,219,
+	88,205,44,62,229,165,24,205,114,233,223,249,97,195,146,23,238,175,248,4,64,119,222,41,
+	121,225,62,100,68,239,182,110,108,19,128,43,25,198,107,140,211,141,250,180,204,229,49,30,
+	163,17,39,112,14,205,20,142,240,107,74,245,146,23,14,160,182,34,20,96,21,204,79,248,
+	197,29,165,232,205,209,28,76,171,248,125,245,178,28,207,133,236,107,186,78,79,122,50,159,
+	33,188,192,130,248,4,166,58,3,24,192,82,222,224,57,166,106,23,9,165,193,102,11,15,
+	49,31,208,73,60,147,145,242,194,24,59,140,87,168,229,220,219,109,42,152,114,93,2,33,
+	219,198,216,151,53,104,206,161,220,200,96,190,80,224,92,101,58,95,148,18,128,65,176,191,
+	89,2,48,135,102,204,136,218,55,142,97,2,112,43,35,120,149,207,3,114,115,62,135,92,
+	114,168,72,121,202,83,134,74,100,145,83,112,219,178,82,161,141,179,99,138,66,88,69,30,
+	171,217,198,90,54,179,142,85,172,42,152,182,208,79,179,185,159,7,56,128,211,24,168,60,
+	67,132,15,82,199,41,62,1,255,101,51,61,41,20,231,53,228,68,206,167,113,252,190,120,
+	41,246,101,0,39,155,221,47,40,164,30,119,112,27,227,24,198,91,113,26,38,175,6,87,
+	112,57,35,121,156,17,186,211,24,50,29,105,111,182,248,6,69,40,48,191,68,169,46,140,
+	173,254,188,103,222,112,82,98,166,22,35,56,158,15,21,8,127,174,173,74,211,77,241,9,
+	128,36,105,216,46,74,0,134,220,92,134,240,34,11,125,248,228,218,212,167,54,53,168,77,
+	77,170,83,139,154,228,144,147,242,100,132,69,173,97,53,171,88,206,66,150,178,140,197,44,
+	102,9,115,88,68,158,135,223,207,224,59,190,227,10,78,225,2,246,208,47,73,88,153,140,
+	68,91,126,231,64,87,18,76,139,205,22,106,122,2,103,101,112,36,215,176,127,252,218,152,
+	148,225,64,250,113,28,117,108,95,168,247,160,7,247,243,25,31,243,25,75,227,83,79,122,
+	209,139,241,220,198,231,218,105,66,228,116,179,133,93,57,68,17,10,204,14,150,234,194,152,
+	170,203,43,74,255,73,49,153,188,66,219,56,53,210,15,210,181,85,7,179,153,23,197,51,
+	237,168,204,154,146,23,119,54,107,32,24,78,177,73,0,26,124,197,51,124,226,81,82,44,
+	147,6,52,163,25,77,168,79,35,234,81,207,213,209,136,43,83,57,193,36,159,219,88,196,
+	28,230,49,143,127,153,201,12,102,123,208,230,113,13,79,243,52,7,112,1,199,234,215,36,
+	124,42,154,141,0,216,77,7,169,128,155,108,182,112,137,226,227,160,254,220,110,222,66,40,
+	138,154,208,147,35,233,157,214,124,50,101,57,150,99,201,227,103,70,240,13,191,121,122,147,
+	202,71,93,249,140,113,220,202,72,237,58,33,57,47,62,193,108,177,218,255,5,135,18,128,
+	54,93,69,142,130,32,187,201,225,42,174,82,24,92,211,165,228,69,157,21,157,64,40,69,
+	7,190,143,213,102,138,77,2,176,15,255,185,252,9,85,104,75,91,218,210,146,102,52,9,
+	64,143,187,44,234,83,191,208,223,121,204,97,38,51,152,200,100,38,178,200,197,79,254,158,
+	239,169,101,222,33,81,130,120,38,253,182,89,227,77,77,83,31,116,166,243,173,118,165,174,
+	238,239,58,162,51,15,115,96,156,126,22,90,176,15,61,57,200,193,158,206,153,236,199,126,
+	220,195,26,190,103,20,99,249,131,205,209,15,228,126,124,195,183,92,206,223,218,133,2,239,
+	72,179,17,210,154,115,180,34,20,160,139,182,84,23,198,148,70,114,145,196,6,40,1,232,
+	154,122,102,3,168,43,1,24,156,147,251,239,205,46,129,35,55,13,72,108,18,128,255,185,
+	242,174,165,105,75,71,58,210,142,182,182,187,68,121,45,147,38,52,161,87,193,95,43,152,
+	196,36,126,231,119,254,50,159,81,42,69,139,245,91,18,54,167,209,215,108,113,75,69,40,
+	208,182,48,205,108,113,77,94,161,143,70,34,75,83,69,238,230,226,56,92,86,102,209,148,
+	118,180,103,111,186,81,213,181,79,169,76,95,250,2,91,248,157,95,152,192,68,166,68,123,
+	58,194,131,249,141,103,184,141,149,218,149,2,126,41,108,226,116,229,149,2,68,45,0,109,
+	254,228,54,82,16,36,161,6,84,98,173,194,224,138,14,102,11,213,184,34,40,76,83,177,
+	57,52,97,86,212,206,243,197,182,76,246,96,31,58,209,137,61,93,237,218,235,166,170,244,
+	40,152,199,110,27,83,248,173,224,2,108,179,54,110,92,213,224,97,243,21,52,3,112,176,
+	109,73,150,221,235,205,5,60,173,56,165,161,23,207,71,121,194,143,178,180,166,53,109,105,
+	67,27,90,120,218,134,61,155,189,217,187,224,223,179,153,194,36,38,51,153,201,44,143,94,
+	144,179,184,132,19,184,137,23,201,215,14,21,80,165,232,93,242,194,12,78,86,132,2,181,
+	177,48,219,88,82,84,37,133,64,74,84,89,9,64,151,180,45,121,81,25,141,154,31,24,
+	93,204,23,183,81,2,48,214,191,142,221,232,78,103,122,56,52,121,71,80,170,192,30,236,
+	193,105,192,54,254,100,12,19,24,195,191,218,216,113,243,8,213,204,87,104,168,24,5,90,
+	69,170,36,107,88,244,32,95,69,111,30,43,207,126,38,239,224,250,40,53,253,41,67,61,
+	234,209,144,186,212,167,1,117,105,64,237,64,124,189,70,52,162,79,193,191,87,176,128,217,
+	44,96,62,115,153,207,60,230,177,58,10,161,175,193,16,6,115,186,246,197,128,234,76,205,
+	146,23,30,76,19,69,40,64,76,115,124,106,170,105,43,92,162,218,33,174,104,83,242,162,
+	61,3,48,96,152,108,215,194,188,17,108,91,62,141,218,101,141,88,184,180,222,135,94,244,
+	162,99,196,207,39,178,232,92,208,4,118,1,99,249,134,47,152,163,141,31,15,237,146,53,
+	107,168,193,94,138,82,192,29,194,123,230,43,148,231,14,53,95,73,73,93,222,10,215,184,
+	127,185,100,83,145,138,100,147,75,89,202,145,67,85,170,20,249,95,24,70,130,175,74,213,
+	98,119,199,55,178,130,149,197,254,183,153,181,108,96,51,43,217,194,122,214,178,45,12,27,
+	104,63,254,224,26,158,85,167,252,0,58,204,108,225,233,138,79,120,114,22,74,104,136,136,
+	255,76,19,128,18,20,165,104,203,207,41,109,197,112,82,2,208,68,25,246,167,15,61,35,
+	159,248,75,116,189,59,128,1,192,20,70,241,53,95,71,123,92,38,129,243,147,173,112,49,
+	153,138,82,192,93,202,240,100,249,132,65,220,101,62,89,176,36,208,158,79,169,231,222,219,
+	103,83,145,92,42,81,129,138,228,0,25,228,2,144,67,41,160,34,165,129,114,148,5,178,
+	169,80,104,73,38,149,1,40,75,57,0,42,147,9,148,138,244,36,143,229,168,103,97,83,
+	108,40,24,204,98,53,249,64,30,107,0,216,84,48,218,237,246,20,225,86,214,1,249,5,
+	109,10,87,97,236,92,178,253,213,27,89,199,90,86,179,142,117,238,28,255,42,240,52,253,
+	57,147,249,218,193,2,166,143,89,253,59,86,241,9,216,37,91,170,11,69,68,60,209,186,
+	228,69,109,20,157,0,49,77,0,182,141,218,183,85,2,48,161,6,28,206,225,244,162,98,
+	236,127,181,90,115,1,91,248,129,207,248,148,169,170,24,209,84,129,83,205,87,216,147,107,
+	21,165,192,219,159,115,24,98,190,74,38,183,113,130,34,101,203,97,12,117,106,228,164,74,
+	180,160,62,181,169,69,77,106,83,139,26,212,164,18,165,21,99,135,149,167,60,128,131,67,
+	117,172,98,45,11,88,194,82,22,176,148,197,44,96,6,11,211,127,219,67,249,155,11,120,
+	87,91,44,64,170,236,28,142,50,129,131,10,82,240,18,20,106,1,40,34,129,86,183,224,
+	158,110,66,74,0,6,73,27,243,133,17,155,7,88,9,192,98,218,113,60,199,208,94,129,
+	40,36,155,67,56,132,135,153,197,7,12,231,39,245,90,138,154,129,230,141,134,234,241,41,
+	101,21,165,16,120,146,255,248,202,124,149,227,168,206,50,69,202,178,211,120,49,189,163,100,
+	67,58,209,146,22,180,164,165,38,210,9,173,92,114,105,80,236,185,181,76,103,58,211,153,
+	198,223,252,147,106,199,227,42,188,67,23,174,39,79,49,14,136,67,204,246,247,62,138,79,
+	192,168,5,160,136,4,154,105,86,169,181,226,19,32,166,141,252,42,83,143,121,81,250,182,
+	74,0,238,212,158,227,57,94,59,163,137,166,92,197,85,204,227,125,134,51,70,147,24,70,
+	199,254,230,191,121,35,118,187,244,149,96,42,205,7,28,194,79,230,191,248,71,241,146,34,
+	101,209,233,188,148,218,69,100,6,123,210,139,158,116,51,155,79,64,66,173,18,157,232,84,
+	240,239,141,252,206,88,70,50,134,245,246,223,232,106,246,228,196,100,51,248,136,71,246,54,
+	91,120,184,226,19,48,106,1,40,34,129,214,172,228,69,101,53,169,84,160,36,105,143,217,
+	84,9,192,200,105,196,41,156,74,43,5,194,146,250,92,202,165,44,224,45,94,227,111,87,
+	206,218,196,99,166,163,208,62,79,7,69,40,52,202,243,1,237,89,98,182,202,49,74,0,
+	90,52,152,23,237,165,255,50,233,194,1,236,65,45,58,80,43,134,1,219,200,103,124,207,
+	66,42,210,145,99,221,28,54,49,112,202,177,31,251,113,13,27,121,159,23,24,109,247,229,
+	125,248,153,254,76,210,46,23,0,29,75,94,212,132,150,138,79,192,40,1,232,156,103,168,
+	102,97,173,77,204,101,165,154,44,7,72,38,85,104,96,169,151,206,114,46,80,184,252,72,
+	49,148,168,165,70,87,15,148,198,148,43,24,43,186,132,197,223,71,233,219,70,41,1,152,
+	194,193,190,18,199,115,26,7,168,167,128,109,117,185,154,171,249,131,87,121,155,197,169,188,
+	92,130,115,246,208,174,228,133,135,51,80,17,10,149,218,188,192,81,102,43,244,34,83,103,
+	239,22,12,176,147,254,203,160,59,103,114,108,164,39,224,48,247,27,47,242,22,171,10,254,
+	122,153,43,232,195,89,244,37,59,86,81,40,199,201,156,204,31,252,143,119,217,98,231,133,
+	45,248,145,83,248,68,187,157,239,58,152,29,13,37,104,212,5,216,57,125,169,175,32,68,
+	218,60,37,0,253,208,184,228,69,205,20,157,128,29,79,26,155,205,147,216,56,70,71,207,
+	144,177,57,58,115,103,158,103,17,47,113,144,206,18,210,56,87,126,132,121,12,167,151,221,
+	236,107,21,197,46,48,234,22,76,34,154,208,21,138,79,232,244,227,8,179,197,101,105,168,
+	24,37,181,31,175,89,61,48,148,229,66,166,242,3,103,196,50,253,103,48,129,27,105,69,
+	103,158,222,153,254,3,200,227,51,142,163,54,131,249,216,236,142,106,68,143,139,175,49,141,
+	179,236,77,239,82,153,15,185,72,59,158,207,26,153,53,130,234,161,248,4,142,90,0,138,
+	72,160,53,78,105,145,4,109,99,153,182,229,12,163,40,229,190,54,217,89,185,62,231,115,
+	90,193,92,129,146,142,44,142,225,98,246,176,247,162,165,138,91,96,152,182,6,235,162,248,
+	132,208,13,230,139,155,43,66,36,139,208,71,214,230,189,41,197,89,204,228,41,90,196,48,
+	72,51,120,153,147,169,77,23,238,101,90,9,235,172,228,85,142,166,42,189,121,128,159,217,
+	26,163,232,52,226,5,38,115,170,157,83,172,82,60,201,45,218,249,124,213,209,108,97,7,
+	197,39,112,148,0,20,145,64,107,156,210,34,9,218,198,138,92,2,48,74,93,128,109,77,
+	195,55,143,115,184,131,171,57,147,74,170,241,105,216,202,80,238,227,31,187,47,251,92,145,
+	11,140,45,230,251,137,26,107,134,79,119,106,154,141,3,168,81,135,205,229,240,25,213,173,
+	172,216,129,23,119,78,3,17,15,155,153,202,20,38,241,27,63,217,184,139,179,137,111,248,
+	6,40,75,103,186,209,150,54,180,161,106,12,162,213,140,215,184,152,75,248,197,250,75,238,
+	164,10,87,97,104,39,244,137,201,238,92,65,227,68,135,237,180,127,155,226,35,34,190,42,
+	67,237,146,23,54,86,124,2,198,52,199,23,177,205,21,235,73,64,230,113,57,183,112,34,
+	151,153,79,253,44,37,88,194,203,60,197,92,251,47,252,175,72,95,49,241,251,154,222,196,
+	83,60,171,8,133,78,6,141,205,18,128,106,23,97,238,5,43,13,250,50,185,133,27,237,
+	117,242,12,161,124,150,176,136,249,44,100,58,147,153,204,191,105,13,31,185,137,177,140,45,
+	248,119,45,218,210,154,86,52,160,54,245,168,77,153,136,70,176,27,63,242,10,55,90,31,
+	41,247,10,242,185,90,59,161,79,58,148,188,168,189,6,139,9,160,188,148,23,138,136,184,
+	174,129,217,129,163,145,226,19,48,77,204,183,101,70,148,110,207,70,41,1,184,137,121,246,
+	199,176,93,203,16,94,224,48,46,229,80,93,23,219,240,43,143,51,212,60,119,84,178,243,
+	20,191,0,89,203,226,146,167,44,125,158,227,233,165,24,133,206,114,179,133,155,21,31,19,
+	23,113,124,242,149,106,243,22,61,211,184,104,93,198,82,150,177,140,77,108,96,61,91,88,
+	205,54,86,3,171,138,156,93,172,39,191,80,11,245,172,130,127,103,82,57,233,127,183,43,
+	87,164,31,115,185,221,122,53,175,101,27,176,129,205,192,90,214,178,150,117,172,44,248,255,
+	101,44,98,62,139,93,107,68,179,152,197,140,42,244,119,117,106,83,143,26,84,162,50,57,
+	84,162,82,193,191,74,81,170,96,108,197,156,98,231,209,249,172,46,225,175,77,108,220,249,
+	223,141,108,74,248,223,29,203,119,188,98,19,185,69,222,189,34,165,41,79,25,42,147,69,
+	46,165,169,72,69,106,81,131,234,102,67,166,38,84,138,51,57,150,75,120,195,234,11,174,
+	98,51,55,105,71,244,133,201,240,8,157,20,157,0,82,11,64,17,9,176,90,102,11,27,
+	43,62,1,99,154,146,205,166,170,249,197,85,184,68,41,1,184,158,54,60,203,201,246,95,
+	152,207,103,124,70,83,6,51,152,6,170,255,73,172,224,45,94,230,183,212,223,224,73,190,
+	82,20,3,101,12,199,149,188,111,12,100,164,249,192,72,18,56,147,153,105,182,120,147,34,
+	100,114,149,255,112,242,149,246,226,83,27,247,154,12,230,50,131,233,204,224,95,150,20,164,
+	254,164,184,101,44,179,63,148,132,47,42,82,131,154,212,160,62,205,105,65,75,154,90,152,
+	233,56,151,215,233,207,249,86,183,252,141,172,230,1,213,9,31,212,43,121,81,7,69,39,
+	128,76,115,124,106,1,40,34,254,170,101,118,46,145,163,248,132,231,20,0,160,166,18,128,
+	65,181,142,83,120,159,215,236,206,7,188,221,44,110,229,118,122,113,6,253,173,141,255,30,
+	59,121,124,205,203,124,148,78,3,162,60,110,229,30,69,50,96,198,150,156,0,132,149,28,
+	196,155,244,85,148,66,36,73,243,161,105,138,80,9,74,243,70,242,190,168,135,242,158,133,
+	145,99,231,49,158,95,153,204,12,166,43,227,26,177,211,140,117,252,91,232,239,76,26,210,
+	156,86,116,162,11,109,201,44,241,117,199,209,157,115,249,196,218,135,220,205,55,233,220,101,
+	147,148,228,20,106,62,187,155,150,138,79,0,153,38,0,183,42,62,34,226,43,147,4,96,
+	77,69,39,112,106,154,247,242,173,197,228,232,124,215,232,141,1,248,62,31,241,8,231,164,
+	150,195,203,231,43,190,162,10,253,25,196,33,241,30,32,177,8,131,159,24,202,48,230,167,
+	243,38,249,124,201,25,214,135,66,18,207,140,224,97,179,254,239,107,56,154,27,185,197,66,
+	59,23,9,130,199,248,192,252,162,104,162,98,84,130,227,105,147,108,149,35,25,110,154,35,
+	156,206,183,124,203,247,44,82,52,99,34,143,127,249,151,175,1,168,64,87,14,230,96,186,
+	37,28,29,178,54,31,243,63,174,179,210,51,49,139,155,57,86,177,245,152,105,7,144,250,
+	138,79,32,247,190,84,23,138,136,184,206,36,203,87,75,209,9,156,108,114,204,38,41,136,
+	212,38,139,98,142,43,143,75,185,141,219,185,56,213,49,155,87,242,50,47,83,133,190,12,
+	224,176,200,15,243,158,204,68,134,241,38,51,210,125,155,239,185,152,191,245,227,18,72,211,
+	249,130,195,205,86,200,231,46,158,164,5,205,105,70,115,154,211,204,108,90,43,241,193,34,
+	102,48,179,224,127,73,26,14,253,173,49,0,75,148,52,229,114,68,137,233,191,124,126,230,
+	125,62,98,186,162,24,99,235,25,205,104,110,37,151,35,56,134,195,19,116,70,184,146,61,
+	57,129,21,201,223,234,112,202,170,233,168,199,76,114,124,25,212,85,124,2,72,99,0,138,
+	72,128,41,1,24,50,181,148,0,12,185,149,92,198,123,60,205,30,233,188,197,235,188,78,
+	117,142,160,47,125,204,122,134,68,212,38,70,51,130,17,204,78,255,173,230,115,13,111,235,
+	103,37,192,158,48,79,0,2,172,98,60,227,119,254,85,145,102,52,167,25,141,104,72,3,
+	26,80,85,49,244,212,10,230,50,135,185,204,46,72,251,173,179,254,210,15,20,189,18,37,
+	153,14,190,10,47,37,72,255,45,99,28,95,241,1,11,20,63,217,249,107,249,22,111,81,
+	142,195,232,75,143,98,157,71,123,243,11,253,147,143,119,88,150,166,76,82,36,61,213,192,
+	236,188,191,140,226,19,64,106,1,40,34,1,166,46,192,161,219,96,83,99,178,201,162,220,
+	203,245,7,58,48,152,219,211,235,185,177,140,215,120,141,108,14,224,72,142,164,69,44,170,
+	255,2,62,231,83,190,98,189,19,111,182,154,7,120,148,13,250,81,9,180,47,24,75,119,
+	59,47,88,199,159,252,89,232,239,242,52,162,1,245,105,72,67,26,80,159,6,169,13,196,
+	41,9,173,103,46,115,153,199,28,230,48,143,185,204,78,103,135,122,71,241,44,81,146,94,
+	238,43,105,78,63,186,211,152,50,228,179,136,217,252,203,79,76,49,27,49,68,98,108,35,
+	31,240,1,80,139,253,104,67,3,26,80,134,124,22,50,129,181,14,212,70,113,92,253,148,
+	22,137,143,212,2,80,68,2,172,90,201,139,106,40,58,1,100,154,227,171,30,165,111,26,
+	237,97,238,242,120,145,215,25,204,93,233,238,103,91,248,134,111,184,130,218,236,79,47,14,
+	143,232,92,193,235,248,137,111,248,134,223,156,186,160,221,194,43,220,194,18,253,160,4,158,
+	193,249,252,150,78,111,247,13,76,46,54,54,106,5,234,80,139,90,212,161,38,181,169,77,
+	77,234,82,83,211,235,36,177,137,197,44,100,9,139,88,196,18,22,176,132,197,44,116,38,
+	21,191,221,55,233,247,230,143,176,57,52,79,246,27,249,182,26,51,139,77,139,11,18,129,
+	54,127,147,231,42,114,30,51,25,217,162,158,162,19,208,147,252,84,23,138,136,184,206,100,
+	198,184,234,138,78,0,85,79,113,107,134,79,244,231,185,216,194,16,134,113,61,23,83,62,
+	253,55,91,196,48,134,1,237,56,152,253,216,143,134,145,8,209,82,126,98,44,163,249,213,
+	201,243,165,60,222,224,86,230,232,199,36,36,254,225,62,110,113,242,13,215,51,35,65,174,
+	41,135,218,84,165,218,206,255,85,163,122,193,255,151,143,81,176,215,179,130,229,172,96,105,
+	193,255,111,255,223,114,22,179,218,237,143,190,93,85,221,196,87,28,172,32,72,32,252,198,
+	114,5,193,99,38,205,214,23,114,191,226,19,64,211,204,207,66,197,134,167,201,81,16,34,
+	109,181,66,224,189,202,41,45,18,223,84,74,121,97,216,196,99,162,219,149,92,199,195,92,
+	193,133,78,237,111,19,153,200,19,64,61,246,99,63,246,161,67,8,91,54,109,99,18,63,
+	242,35,63,154,159,66,165,98,11,175,115,159,90,26,133,204,29,116,163,143,251,39,32,37,
+	157,130,148,165,26,57,84,166,18,185,84,166,50,149,168,76,37,170,20,252,127,37,114,40,
+	19,138,36,225,122,182,176,138,117,172,97,45,107,89,89,240,255,107,88,195,42,214,178,134,
+	213,44,247,111,108,255,17,140,85,69,55,241,18,55,69,235,0,239,185,95,25,206,7,116,
+	229,120,250,168,185,111,90,30,85,8,60,87,174,228,69,191,240,139,226,19,190,147,92,177,
+	225,94,133,64,196,105,149,82,90,36,65,220,96,74,0,134,212,18,110,224,30,206,228,122,
+	39,39,48,157,95,208,34,48,139,150,116,166,29,109,217,207,172,195,127,0,108,101,26,19,
+	152,192,4,126,119,103,96,190,205,188,202,93,234,188,20,66,121,156,196,56,90,249,245,241,
+	155,152,207,252,164,107,85,32,155,92,74,83,137,114,148,165,50,165,119,38,6,43,145,5,
+	84,38,19,200,161,20,144,75,6,80,165,200,235,179,77,199,38,92,207,150,34,127,175,4,
+	12,86,1,249,172,6,242,88,3,108,99,45,176,129,205,172,102,43,107,216,196,70,214,178,
+	149,85,108,113,178,179,174,243,214,114,145,170,185,169,165,92,197,16,133,33,5,27,249,129,
+	47,120,191,96,206,168,169,188,65,69,142,164,47,189,52,97,120,74,190,228,77,5,193,115,
+	229,20,130,72,81,2,80,68,252,165,22,128,209,217,96,17,219,100,89,177,218,174,107,121,
+	140,23,57,143,75,157,238,187,187,141,73,5,19,246,101,208,152,214,180,165,53,109,104,19,
+	144,185,81,215,50,149,201,76,98,42,19,153,229,230,57,209,10,134,240,40,139,245,3,18,
+	82,43,56,132,209,201,70,65,243,215,122,214,179,82,91,42,53,23,171,75,126,82,207,179,
+	63,167,42,12,54,118,200,95,25,199,72,198,238,214,172,117,29,239,242,46,25,236,65,111,
+	122,176,15,117,20,44,203,230,112,138,102,150,241,129,18,128,209,162,46,192,34,226,167,76,
+	179,163,138,90,0,6,145,90,0,70,215,58,30,230,49,250,115,9,7,184,241,246,6,255,
+	242,47,159,23,252,85,131,102,52,161,9,77,105,66,19,234,167,51,203,130,13,249,44,228,
+	95,102,21,252,239,95,230,121,241,161,255,240,4,111,104,182,223,144,155,207,193,140,96,47,
+	5,34,130,238,225,53,5,193,130,11,104,67,23,133,193,212,60,38,51,153,73,252,194,223,
+	73,238,40,25,252,205,223,252,15,104,196,62,236,73,107,218,210,220,163,3,97,120,207,81,
+	142,99,153,194,224,3,117,90,143,22,181,0,20,17,63,85,34,163,228,133,106,1,24,68,
+	241,105,1,152,17,227,173,220,129,75,56,201,203,83,190,12,106,82,139,250,5,255,171,182,
+	115,42,132,212,107,212,122,86,20,60,150,178,152,133,44,96,33,11,88,236,237,141,207,124,
+	62,230,9,190,213,207,70,68,84,224,85,142,83,24,34,230,61,6,145,175,48,88,82,131,
+	31,252,235,10,31,208,11,233,197,204,103,1,83,153,194,36,166,176,38,173,119,43,77,179,
+	130,70,242,141,168,77,189,88,205,255,147,220,102,250,242,141,194,224,139,63,104,175,32,68,
+	200,21,26,73,179,152,250,26,158,71,74,212,192,155,214,34,177,82,135,5,37,47,220,79,
+	39,63,1,180,140,63,74,94,184,54,74,41,192,140,152,111,233,234,156,194,25,126,183,120,
+	202,162,18,85,40,67,121,114,40,67,69,50,200,45,88,82,150,114,133,198,21,91,203,54,
+	54,178,137,85,108,98,3,107,88,203,102,191,227,55,155,87,120,133,255,244,147,17,41,25,
+	220,194,237,177,255,109,136,146,79,24,196,70,133,193,198,137,240,23,180,245,228,76,99,13,
+	235,216,202,74,182,177,150,77,108,132,18,7,146,172,64,118,193,191,182,15,113,89,120,160,
+	203,194,255,173,146,98,89,12,86,21,204,88,179,174,224,95,43,153,207,34,230,179,136,197,
+	174,118,72,173,76,61,234,80,151,58,212,40,152,7,104,251,172,63,57,84,164,76,138,239,
+	185,142,173,197,254,187,150,109,197,254,187,99,128,207,221,109,31,42,52,147,202,148,161,60,
+	21,41,77,46,229,168,190,115,11,184,103,3,131,24,161,29,208,39,83,105,169,32,68,200,
+	37,60,169,32,20,161,4,160,152,157,247,40,1,168,61,78,204,172,167,98,148,46,245,5,
+	218,113,42,103,81,93,129,176,97,51,31,243,58,159,105,148,149,136,234,193,243,180,86,24,
+	34,225,21,206,81,103,40,155,170,240,161,195,131,68,172,99,6,211,153,193,2,150,178,152,
+	101,44,99,169,171,191,158,187,238,35,193,246,187,76,187,100,83,161,96,40,205,237,169,176,
+	141,254,77,76,157,84,102,193,29,215,237,233,205,138,192,186,66,75,55,21,73,108,111,112,
+	249,158,88,46,53,169,78,13,170,83,151,38,180,160,5,181,28,125,255,165,244,227,103,237,
+	124,190,249,151,198,10,66,132,92,192,179,10,66,17,245,148,226,145,18,213,183,48,15,159,
+	216,211,176,96,98,52,137,134,141,81,106,180,169,4,224,14,101,233,207,73,28,154,114,139,
+	131,248,200,231,7,222,230,29,86,43,20,145,86,142,91,185,66,251,67,232,15,87,215,170,
+	21,68,74,178,185,147,107,40,149,214,123,108,226,79,126,229,15,166,49,157,133,10,105,4,
+	85,162,5,205,217,147,46,116,73,251,22,226,183,156,174,203,115,95,169,11,112,180,12,98,
+	168,130,80,68,121,214,233,170,79,18,50,168,168,81,220,29,215,132,89,10,66,132,108,142,
+	210,72,193,58,20,20,149,203,81,12,224,80,15,186,250,132,211,4,94,103,152,217,152,6,
+	18,41,141,184,144,35,104,29,195,201,130,194,111,27,83,248,140,39,148,82,72,195,129,60,
+	201,30,41,188,46,159,159,248,154,145,252,204,22,5,49,54,90,115,48,135,208,59,165,121,
+	226,86,114,39,143,107,148,78,159,189,200,153,10,66,132,52,211,197,247,110,38,209,70,65,
+	144,4,38,123,50,236,73,252,126,131,102,40,8,145,186,174,138,208,20,118,74,0,38,82,
+	149,99,56,142,158,154,19,110,167,60,126,228,3,134,105,52,131,88,42,77,3,154,238,124,
+	180,166,130,66,18,72,91,152,199,172,157,143,73,26,245,207,1,153,12,230,70,154,218,56,
+	61,24,205,251,124,168,246,126,177,85,150,67,57,142,126,54,198,98,92,195,16,238,101,133,
+	66,231,187,131,25,169,32,68,198,56,186,43,8,187,185,137,187,20,4,73,88,51,238,81,
+	16,28,215,130,105,10,66,132,228,147,25,157,47,163,4,96,201,202,209,157,126,28,75,253,
+	88,71,97,61,163,248,132,143,89,164,10,33,0,148,162,1,205,104,70,115,26,83,159,70,
+	212,73,179,155,164,164,42,143,69,204,102,46,255,49,147,153,204,96,158,90,16,185,84,227,
+	15,227,76,14,53,109,217,149,199,95,140,97,44,223,176,92,1,19,74,115,0,251,211,157,
+	125,76,135,140,206,227,39,222,228,13,214,42,96,1,241,17,71,41,8,17,185,80,235,201,
+	247,10,195,110,42,243,55,13,21,6,41,102,62,123,148,48,37,150,164,163,21,83,20,132,
+	72,201,208,87,137,211,198,238,204,145,244,166,91,148,26,126,90,58,125,250,139,111,248,140,
+	31,52,125,128,36,81,133,166,52,165,46,117,10,254,191,182,126,87,92,177,146,133,44,96,
+	86,193,127,103,49,151,173,10,138,103,178,233,78,55,246,162,25,181,11,166,165,216,196,92,
+	230,49,151,185,252,205,143,74,226,72,2,89,116,160,43,13,169,79,35,234,23,76,203,178,
+	145,101,204,230,47,126,103,148,218,253,5,76,13,190,215,228,87,145,112,21,255,83,16,18,
+	234,194,200,130,35,152,200,118,107,56,132,95,21,6,23,180,97,146,130,16,177,115,186,200,
+	76,125,170,11,117,171,202,179,31,189,232,69,199,200,183,119,154,197,88,198,240,169,230,131,
+	146,20,149,163,30,181,168,73,93,106,82,155,218,5,255,82,135,122,235,54,177,132,5,44,
+	97,17,139,118,254,107,129,186,244,138,136,184,170,10,207,48,80,103,198,161,182,136,203,52,
+	253,135,137,214,188,74,55,133,65,10,252,194,233,106,167,230,146,118,252,163,32,68,74,118,
+	116,26,94,232,52,199,174,154,5,29,123,58,71,108,162,144,60,38,50,142,31,249,158,255,
+	180,145,197,5,185,212,161,6,181,168,70,53,170,238,252,111,85,170,197,182,11,113,62,203,
+	89,206,138,66,255,91,206,98,150,176,72,93,49,68,68,124,178,39,199,211,94,99,221,134,
+	210,108,190,227,125,214,43,16,73,174,252,122,210,143,86,49,235,215,36,197,109,101,42,159,
+	48,10,67,161,112,201,94,252,169,32,68,74,89,54,71,231,48,32,169,86,130,206,236,67,
+	119,58,135,124,60,141,37,76,224,39,198,241,179,186,176,137,79,170,20,164,3,115,168,76,
+	46,149,169,68,101,42,145,67,78,193,191,43,134,244,123,173,101,45,107,89,195,106,86,179,
+	166,224,223,171,88,195,234,130,100,223,74,109,122,17,17,17,17,145,136,233,192,239,10,66,
+	164,148,143,78,95,44,37,0,211,151,195,158,116,166,51,157,105,21,154,249,97,22,50,129,
+	9,76,100,18,19,181,1,37,240,191,82,185,84,166,52,57,148,161,60,21,41,77,21,178,
+	168,68,57,202,22,60,15,21,41,13,84,34,11,200,161,20,144,75,6,25,5,163,110,165,
+	110,21,6,6,171,128,124,86,3,219,88,11,108,97,61,176,154,173,172,97,19,27,89,203,
+	86,86,177,149,117,108,96,115,193,243,171,116,87,85,68,68,68,68,36,118,58,49,65,65,
+	136,148,138,209,105,95,174,4,160,147,42,208,154,54,180,165,53,109,105,70,86,160,202,150,
+	207,108,166,48,137,41,76,102,146,218,30,73,12,229,22,251,189,203,162,18,176,182,216,52,
+	55,219,19,125,34,34,34,34,34,34,246,117,97,188,130,16,41,57,172,137,202,87,81,2,
+	208,45,217,52,163,41,77,104,74,19,154,208,148,74,158,151,96,19,255,242,47,179,10,254,
+	59,157,13,218,40,34,34,34,34,34,34,34,174,233,198,207,10,66,164,84,137,206,24,237,
+	74,0,122,165,42,117,169,75,109,234,81,155,186,212,161,42,85,169,234,208,16,188,249,44,
+	103,5,43,88,194,124,22,49,159,197,204,103,17,139,20,116,17,17,17,17,17,17,17,207,
+	212,229,84,5,33,82,30,215,24,128,226,140,74,84,165,42,213,168,64,89,114,40,71,217,
+	130,209,205,118,44,221,222,141,216,216,153,113,222,62,194,216,102,214,177,142,77,59,167,19,
+	88,165,64,138,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,
+	136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,136,72,116,100,40,
+	4,34,34,34,146,134,50,52,167,57,85,168,64,69,54,179,158,85,204,97,26,43,21,24,
+	17,17,17,17,145,160,80,2,80,68,68,68,82,81,155,67,232,201,254,52,35,51,193,210,
+	37,252,196,40,70,241,167,2,37,34,34,34,34,34,34,34,34,18,46,21,56,149,175,201,
+	195,176,240,152,202,45,52,86,200,68,68,68,68,68,68,68,68,68,194,161,50,215,177,220,
+	82,234,111,215,35,143,79,232,162,208,137,136,136,136,136,136,136,136,136,4,91,25,110,102,
+	173,205,228,223,142,71,62,239,209,80,33,20,17,17,17,17,241,131,198,0,12,131,102,12,
+	162,19,57,204,229,123,134,179,86,1,17,73,67,107,246,164,21,77,168,68,14,176,154,181,
+	204,98,26,127,49,85,161,17,73,226,96,158,161,101,90,239,176,158,59,249,31,219,20,74,
+	17,17,17,17,17,145,194,202,241,12,219,10,181,160,88,194,41,10,138,72,10,74,115,20,
+	111,176,160,196,214,73,243,121,141,126,148,86,160,68,18,202,226,118,139,99,254,37,123,124,
+	71,61,133,83,68,68,68,68,68,100,151,10,140,77,112,241,116,147,2,35,98,75,45,238,
+	99,137,165,212,196,18,238,161,166,2,38,178,219,62,52,214,145,228,223,142,253,236,96,133,
+	84,68,68,68,68,68,100,135,23,74,184,120,234,163,208,136,88,84,153,135,217,96,43,57,
+	177,158,7,169,164,192,137,236,212,152,169,14,166,255,12,12,54,115,130,194,42,34,34,34,
+	34,34,2,208,178,196,238,86,127,105,244,70,17,75,6,154,116,250,53,123,204,227,56,5,
+	79,4,128,54,41,238,69,201,230,5,62,87,161,21,17,17,17,17,17,129,59,76,46,157,
+	218,41,60,34,73,148,229,177,180,18,20,175,81,94,65,148,216,171,207,127,46,164,255,182,
+	167,0,7,41,188,34,34,34,34,34,34,35,76,46,156,78,83,120,68,76,213,225,247,180,
+	19,20,191,81,91,129,148,88,171,202,100,151,210,127,6,6,155,232,169,16,139,136,136,136,
+	136,72,220,153,13,185,126,153,194,35,98,162,57,179,28,73,80,204,164,185,130,41,177,149,
+	193,7,46,166,255,182,79,7,162,25,129,69,68,68,68,68,36,230,198,153,92,52,93,161,
+	240,136,148,168,158,131,157,22,231,210,80,1,149,152,186,202,229,244,159,129,193,119,100,41,
+	208,34,34,34,34,34,110,211,105,183,136,56,175,14,213,41,79,37,86,177,129,69,172,240,
+	248,211,171,240,21,141,28,123,183,250,124,70,15,86,121,252,29,170,82,155,242,228,178,150,
+	13,44,101,145,170,148,248,160,13,247,120,240,41,7,112,5,15,42,216,18,99,85,104,11,
+	44,96,1,155,21,12,17,17,17,145,120,82,11,64,9,219,69,204,177,60,193,120,86,23,
+	171,173,75,249,142,123,232,77,89,79,74,225,70,167,197,79,60,154,119,187,28,135,114,47,
+	223,179,180,216,231,175,102,60,143,115,12,185,170,100,226,153,12,190,245,160,253,159,129,193,
+	90,26,40,220,18,83,189,248,150,188,130,61,97,3,159,114,178,71,71,27,17,17,17,17,
+	9,20,37,0,37,44,74,113,52,239,179,57,201,101,254,42,158,103,63,215,203,114,185,43,
+	41,138,75,93,47,119,15,94,220,45,117,186,251,148,9,195,57,138,82,170,112,226,129,19,
+	61,74,255,25,24,188,171,112,75,12,85,225,185,4,123,195,120,186,42,52,34,34,34,34,
+	113,163,4,160,132,65,22,103,48,213,198,165,254,24,14,119,177,52,13,89,231,74,130,98,
+	61,141,93,44,245,145,166,83,254,20,127,76,97,176,134,111,16,151,149,114,117,246,223,226,
+	143,124,246,84,200,197,115,153,212,161,3,237,169,235,203,47,234,105,44,43,97,127,216,202,
+	195,250,141,23,17,17,17,137,23,37,0,37,248,122,240,87,10,151,251,223,210,198,165,242,
+	124,228,90,138,226,125,151,74,220,156,207,83,40,205,159,116,87,229,19,23,29,239,97,250,
+	207,192,224,109,133,92,60,84,158,51,248,128,245,133,186,161,127,201,165,84,242,236,243,43,
+	243,110,146,61,226,37,117,5,22,17,17,17,137,19,37,0,37,216,202,240,4,249,41,94,
+	238,111,228,82,23,46,111,246,113,53,69,225,124,247,229,12,46,103,83,202,109,166,30,163,
+	140,42,161,184,228,39,143,19,128,219,28,156,184,71,196,76,38,103,49,175,132,97,42,30,
+	240,100,60,202,246,76,179,176,79,220,167,77,37,34,34,34,18,31,74,0,74,144,53,102,
+	66,218,109,234,156,110,111,49,194,213,20,197,199,14,151,182,50,31,166,89,162,241,74,154,
+	136,43,218,120,156,254,51,48,184,73,97,23,15,84,230,51,211,122,184,133,123,92,190,181,
+	114,18,27,45,238,19,167,107,115,137,136,136,136,196,133,18,128,18,92,237,152,235,192,37,
+	255,95,212,117,176,76,45,83,110,143,104,181,205,93,11,7,75,91,43,237,4,170,129,193,
+	66,58,168,50,138,227,238,241,33,1,56,77,93,30,197,117,117,249,199,66,93,252,155,206,
+	174,149,224,38,27,199,169,37,84,209,38,19,17,17,17,137,7,37,0,37,168,186,176,210,
+	177,139,254,58,142,149,234,46,215,83,20,119,56,86,214,58,76,119,168,76,43,93,188,84,
+	149,184,154,230,67,2,208,96,47,5,94,92,149,201,143,22,235,226,22,46,119,225,243,179,
+	120,209,230,62,241,180,54,154,136,136,136,72,60,40,1,40,193,212,156,69,14,94,244,255,
+	229,88,27,135,89,174,39,40,102,58,84,210,28,126,119,176,84,75,105,165,74,41,14,170,
+	239,75,250,207,224,50,133,94,92,117,134,173,250,248,20,153,142,126,122,105,134,165,48,54,
+	102,19,109,54,17,17,17,113,138,58,220,248,161,6,39,211,131,70,73,163,223,154,10,37,
+	46,155,199,98,211,215,110,100,19,179,249,140,143,217,166,128,139,163,114,153,64,83,71,223,
+	241,43,14,39,63,237,119,105,201,84,15,190,125,115,7,146,128,165,248,146,94,142,150,106,
+	6,93,88,173,170,41,14,57,149,215,124,249,220,143,57,90,193,23,23,141,99,95,91,235,
+	127,198,64,214,59,244,217,217,188,195,49,41,188,238,33,174,209,134,19,17,17,17,9,171,
+	203,88,235,97,139,138,201,116,85,200,197,81,195,3,58,252,255,121,158,236,81,231,56,80,
+	210,219,92,40,215,48,85,76,113,204,147,62,181,0,92,164,208,139,139,178,217,106,187,78,
+	142,162,188,35,159,157,197,7,41,238,21,43,28,42,129,136,136,136,136,120,238,81,207,47,
+	169,54,114,176,194,46,142,57,211,149,90,186,141,46,105,151,236,69,79,246,167,231,211,46,
+	103,55,182,185,82,178,193,170,156,226,144,111,124,74,0,26,154,242,64,92,84,39,165,58,
+	57,146,114,105,127,114,70,90,199,167,19,180,233,68,68,68,68,194,104,144,47,151,84,75,
+	169,161,208,139,35,170,178,196,165,90,58,62,237,209,150,198,120,178,55,125,159,102,41,75,
+	241,179,75,37,91,70,117,85,80,113,196,92,223,18,128,251,40,248,226,154,230,41,214,202,
+	47,201,78,243,147,239,77,107,175,24,170,77,39,34,34,34,18,62,165,152,225,211,69,213,
+	253,10,190,56,194,205,174,129,103,164,89,182,37,161,232,164,120,142,139,101,123,76,21,84,
+	28,144,73,190,111,9,192,129,10,191,184,102,143,148,235,229,171,105,141,152,157,238,175,254,
+	90,202,106,227,137,136,136,136,132,205,190,190,93,84,205,81,240,197,1,181,217,224,98,45,
+	157,65,86,90,165,219,234,201,190,180,37,205,212,202,116,87,187,251,215,85,37,149,180,85,
+	246,237,72,101,112,150,194,47,174,233,154,70,205,188,51,229,79,221,159,205,105,239,23,135,
+	104,227,137,136,136,136,19,74,41,4,30,234,224,219,39,55,80,231,64,113,192,149,14,140,
+	133,84,178,102,12,72,227,213,229,210,76,31,90,85,154,50,105,188,250,4,154,187,88,182,
+	178,92,166,74,42,105,171,228,227,103,87,84,248,197,53,233,28,191,110,225,180,20,207,190,
+	222,75,187,3,49,28,160,141,39,34,34,34,78,80,2,48,46,151,54,21,20,126,73,83,
+	86,138,23,64,214,165,211,250,39,219,179,56,164,211,25,235,108,151,203,54,152,210,170,168,
+	146,166,108,31,63,91,93,29,37,168,181,235,25,246,178,253,154,76,222,160,166,3,37,87,
+	2,80,68,68,68,28,161,4,160,151,22,249,246,201,121,44,85,248,37,77,135,83,203,229,
+	79,232,73,131,148,95,187,222,179,56,164,254,73,141,92,191,140,171,73,111,85,84,73,211,
+	6,31,63,123,157,194,47,174,73,175,5,123,121,222,35,199,230,107,110,112,232,55,191,139,
+	206,214,69,68,68,196,9,89,10,129,135,190,199,72,107,32,233,212,141,247,245,146,78,162,
+	161,191,235,159,80,138,163,121,50,197,215,110,99,115,90,157,115,173,218,192,182,52,34,232,
+	254,69,220,177,124,166,170,42,105,89,27,211,207,150,168,75,183,125,105,11,94,230,56,12,
+	203,235,239,195,109,14,149,188,34,45,153,162,13,40,30,107,74,11,42,59,248,126,203,153,
+	194,2,87,74,90,133,61,168,229,234,21,150,193,98,254,97,165,43,239,93,151,214,84,115,
+	240,253,214,48,157,89,170,190,226,178,26,84,34,135,138,84,32,159,117,172,103,45,203,89,
+	173,176,136,236,110,132,79,3,171,159,166,208,75,218,254,245,160,166,14,79,163,124,51,61,
+	217,151,166,167,81,194,15,61,40,223,76,85,84,73,83,6,155,124,155,4,164,159,194,47,
+	174,57,205,129,26,122,181,229,79,171,196,12,7,247,140,19,181,249,196,211,163,192,96,38,
+	185,242,27,255,19,71,58,92,214,78,140,96,155,39,199,167,109,140,160,147,195,165,63,146,
+	159,92,41,235,36,6,251,212,228,68,162,44,135,126,220,202,91,252,202,154,132,245,110,57,
+	227,120,137,235,233,229,234,152,241,34,33,211,162,132,29,198,221,199,40,117,30,145,180,53,
+	244,164,174,46,75,163,132,159,121,82,194,17,105,156,80,175,240,164,132,13,84,89,37,77,
+	19,125,75,0,182,86,240,197,53,231,56,80,67,183,90,238,212,251,170,163,123,198,237,218,
+	124,226,153,114,124,228,234,239,252,19,14,166,166,46,96,171,167,199,168,173,92,224,88,217,
+	51,120,194,213,178,126,164,36,140,56,36,147,222,60,192,120,27,169,246,77,124,199,109,236,
+	173,208,137,0,244,100,149,199,23,84,191,80,85,97,151,180,29,225,81,125,77,125,156,193,
+	135,60,41,223,131,41,151,175,174,71,17,236,163,202,42,105,122,223,167,244,223,86,95,39,
+	32,145,168,187,216,145,90,58,223,210,57,85,111,135,247,141,87,181,249,196,51,67,93,255,
+	173,191,219,161,146,14,36,223,243,227,84,62,3,29,42,253,221,174,151,117,168,42,179,164,
+	173,29,183,243,95,202,117,240,63,238,163,185,130,40,210,140,247,60,106,172,110,176,146,219,
+	60,25,23,77,162,239,10,143,234,108,234,67,166,31,29,240,46,138,61,61,138,224,165,170,
+	172,146,166,255,243,41,1,56,89,161,23,23,93,234,80,61,125,43,233,39,149,97,154,195,
+	251,198,15,218,124,226,145,163,60,233,76,187,135,3,37,173,196,82,95,142,84,75,169,228,
+	64,233,247,240,228,90,240,40,85,104,73,89,38,39,242,155,35,73,243,145,28,170,112,6,
+	137,38,1,241,222,76,142,167,38,221,169,145,116,205,235,104,90,226,178,97,124,147,228,213,
+	249,204,100,28,155,21,112,113,132,87,29,75,27,166,252,202,239,200,35,211,229,210,229,165,
+	113,25,22,252,8,138,108,231,87,178,225,59,133,94,92,180,197,161,247,57,145,15,147,180,
+	172,185,158,22,14,151,189,137,54,159,120,228,50,79,18,11,23,115,126,218,239,114,50,213,
+	125,137,80,117,78,230,217,180,223,229,98,215,207,88,183,111,205,143,85,165,37,5,165,57,
+	145,27,105,229,200,123,101,112,48,7,243,7,143,240,38,121,10,173,136,185,113,38,217,244,
+	43,20,30,241,212,243,30,221,89,77,103,116,149,81,174,151,110,100,26,165,187,200,163,8,
+	62,167,202,42,105,42,207,102,95,218,85,12,82,232,197,69,167,59,56,90,109,109,147,207,
+	105,198,70,199,247,141,188,180,231,48,22,177,162,172,71,191,254,51,28,40,235,123,190,141,
+	86,251,158,3,165,159,225,73,73,55,235,151,67,82,112,180,75,19,63,78,208,168,128,193,
+	160,201,33,68,196,138,10,30,125,78,58,29,43,94,119,189,116,175,69,60,130,34,0,27,
+	24,235,195,167,110,227,91,133,94,92,228,92,143,136,106,60,111,178,244,127,46,92,114,151,
+	82,219,110,241,68,77,143,70,98,173,239,192,123,248,55,229,89,131,128,68,32,185,108,106,
+	170,82,139,45,77,248,132,15,105,236,202,123,119,98,28,67,168,166,32,251,77,9,64,17,
+	177,118,113,238,141,173,105,188,118,24,107,92,45,219,106,222,79,227,213,121,33,136,160,200,
+	118,111,250,240,153,95,179,84,129,23,23,173,117,240,189,250,50,184,132,37,221,93,26,117,
+	75,151,241,226,133,50,33,250,28,255,38,141,202,142,89,164,37,46,50,184,146,137,244,117,
+	241,19,74,113,14,83,24,160,80,251,75,9,64,17,177,98,93,8,46,209,214,242,180,171,
+	101,123,50,205,210,133,239,34,87,226,106,24,27,60,255,204,215,20,118,113,213,92,71,223,
+	237,161,18,70,114,190,203,165,210,215,208,6,20,17,17,215,228,48,140,135,41,231,250,231,
+	84,103,40,175,121,240,57,82,34,77,2,34,18,78,117,233,65,43,90,83,147,202,100,146,
+	207,106,150,51,141,201,252,196,191,174,124,222,74,143,190,87,122,159,243,8,151,184,214,213,
+	118,29,143,197,32,130,37,107,202,62,180,166,21,85,201,161,20,219,88,203,18,38,51,141,
+	49,44,208,238,24,57,107,24,198,233,158,126,226,82,62,82,216,197,85,179,29,125,183,106,
+	252,194,242,4,103,213,237,93,251,5,22,17,17,113,71,87,222,245,112,186,169,83,217,131,
+	129,142,140,5,42,41,80,2,80,36,108,58,114,42,71,152,204,204,244,31,159,243,6,63,
+	98,56,250,169,94,253,72,79,79,235,213,75,184,155,123,92,42,217,157,105,118,80,12,71,
+	4,119,151,65,119,78,225,48,26,149,184,198,20,62,227,117,254,208,174,25,41,247,115,170,
+	167,125,4,30,97,163,130,46,174,90,205,42,114,29,124,191,198,46,141,146,148,216,67,220,
+	197,60,230,50,141,169,76,102,10,115,200,215,38,21,17,17,7,28,203,155,30,79,24,211,
+	145,95,56,138,49,10,189,72,81,154,5,88,138,202,226,100,254,176,56,211,210,52,206,115,
+	116,228,143,253,60,153,175,44,143,242,105,150,51,155,73,174,148,236,31,74,167,89,178,10,
+	228,123,18,67,39,103,216,42,203,5,76,183,248,185,191,115,18,153,218,73,35,196,203,25,
+	22,87,80,89,1,23,215,253,238,219,172,161,206,63,54,240,59,111,115,27,131,104,163,225,
+	124,196,49,45,60,171,193,97,222,159,127,119,160,244,94,149,181,133,42,181,36,117,17,121,
+	190,236,73,155,56,86,193,23,81,2,80,74,118,12,51,108,254,176,206,103,48,25,14,125,
+	122,69,182,120,112,40,248,199,129,146,238,197,6,23,14,81,157,28,40,217,36,15,34,184,
+	217,177,46,208,25,156,201,2,155,159,62,141,163,181,163,70,70,43,54,121,118,18,168,35,
+	154,120,225,169,8,37,0,11,63,214,240,29,15,115,18,45,29,59,226,139,18,128,74,0,
+	42,1,40,241,112,151,143,71,175,173,37,78,168,37,162,4,160,46,151,98,174,62,35,82,
+	252,105,253,129,214,14,149,97,140,7,7,130,199,28,41,233,69,142,151,235,252,208,92,124,
+	126,231,208,214,110,195,216,20,75,240,9,245,180,195,234,164,208,214,227,47,13,71,34,158,
+	24,24,209,4,224,174,199,42,190,229,1,250,83,85,27,91,148,0,84,2,80,9,64,73,
+	234,54,159,143,90,121,156,168,141,32,162,4,160,20,215,139,69,105,117,20,58,59,52,135,
+	136,163,28,138,216,35,142,150,234,41,135,74,117,140,7,17,188,213,145,146,158,198,218,52,
+	202,176,148,35,180,211,70,66,121,203,29,192,211,121,108,163,187,66,45,158,168,229,209,64,
+	12,65,120,204,228,57,6,80,69,27,93,148,0,84,2,80,164,4,231,7,224,104,181,153,
+	222,218,16,34,74,0,74,97,215,58,112,201,242,63,7,58,6,181,112,253,210,105,185,99,
+	163,22,150,226,45,199,74,245,166,99,227,43,149,101,165,235,135,209,86,14,196,238,209,180,
+	75,145,207,85,218,113,35,193,141,14,245,238,36,173,69,172,152,20,155,4,224,142,244,250,
+	207,220,207,97,148,211,166,23,37,0,149,0,20,41,226,120,182,5,226,72,181,150,46,218,
+	24,34,74,0,202,118,25,60,228,208,143,235,27,14,116,178,251,201,229,3,192,51,14,70,
+	46,147,103,28,41,211,75,142,118,78,124,206,229,8,142,75,187,132,89,188,233,80,89,30,
+	208,104,84,145,112,145,203,117,246,107,77,96,32,30,122,48,102,9,192,29,143,117,12,231,
+	116,170,171,2,136,18,128,74,0,138,0,208,145,141,129,57,70,45,164,150,54,136,136,18,
+	128,2,112,143,131,63,174,175,167,157,144,57,201,213,31,255,124,246,112,56,122,55,165,121,
+	103,107,27,55,56,92,162,182,46,207,179,117,66,218,9,231,151,28,44,205,255,105,7,142,
+	132,71,92,172,177,19,53,86,153,120,106,175,152,38,0,119,28,211,70,115,37,205,84,13,
+	68,9,64,37,0,37,230,42,51,45,80,199,39,221,14,246,144,6,222,22,9,174,139,29,
+	77,64,157,194,92,110,76,235,29,222,229,118,23,79,37,134,59,50,7,112,97,119,51,142,
+	55,169,147,226,171,23,112,146,99,83,106,236,48,137,79,92,156,39,119,6,195,210,124,135,
+	251,56,195,193,242,220,204,2,71,91,117,138,63,174,164,26,167,186,242,206,243,57,156,21,
+	10,176,120,232,47,126,141,113,87,163,76,14,228,64,30,230,31,222,231,117,102,168,58,136,
+	143,6,164,253,14,185,190,149,61,215,129,210,139,248,235,233,128,37,135,123,113,147,26,14,
+	136,168,5,96,220,117,99,179,227,109,236,142,73,179,76,39,186,118,231,103,11,237,92,58,
+	77,123,44,133,118,128,121,188,70,53,87,202,179,23,91,93,139,225,160,52,203,214,207,241,
+	81,30,183,176,159,118,228,8,200,230,29,23,234,235,44,181,76,16,31,12,138,117,27,192,
+	194,231,3,99,56,135,28,85,8,41,162,133,246,141,136,61,116,156,149,68,206,10,100,27,
+	245,30,218,48,34,74,0,198,89,46,179,93,248,113,93,65,131,52,203,53,210,165,159,253,
+	7,93,140,101,71,62,176,145,218,202,99,56,237,93,44,205,163,174,53,158,79,79,35,87,
+	166,40,249,79,23,152,145,224,220,104,164,59,30,127,83,79,97,21,31,100,50,35,154,23,
+	250,39,24,63,27,207,24,231,24,157,141,108,235,175,218,192,91,28,70,166,170,133,40,1,
+	168,4,160,196,70,77,86,4,178,182,254,67,105,109,28,81,2,80,9,192,248,122,202,165,
+	31,215,247,211,44,87,43,214,185,80,170,25,84,114,57,158,123,240,56,107,146,150,99,53,
+	143,187,212,18,113,151,202,204,114,101,6,173,150,105,150,235,99,151,106,220,227,218,153,35,
+	161,163,163,147,0,173,228,92,157,230,137,79,6,70,243,66,127,184,177,195,86,99,162,49,
+	212,184,221,232,103,52,181,246,218,249,220,71,99,85,12,81,2,80,9,64,137,133,87,2,
+	91,95,175,209,198,17,37,0,149,0,140,171,206,46,78,204,126,68,154,101,115,190,27,240,
+	22,246,241,36,170,201,39,51,120,196,147,114,116,117,188,115,183,193,105,105,150,233,40,23,
+	155,244,119,212,14,29,114,7,50,202,133,154,49,155,11,201,86,112,197,115,25,62,78,30,
+	224,218,163,172,177,214,72,100,161,241,158,113,169,209,222,40,149,252,151,122,152,186,95,137,
+	18,128,74,0,74,228,237,239,248,128,63,78,54,103,104,160,13,36,74,0,42,1,24,79,
+	159,185,248,227,250,71,218,179,1,63,227,112,137,206,241,40,170,223,37,45,201,119,30,149,
+	228,124,135,35,248,100,218,23,196,127,186,88,227,62,209,14,29,98,123,50,212,197,186,49,
+	155,115,213,253,80,60,247,111,244,46,243,143,52,204,173,48,62,50,174,52,90,37,123,159,
+	241,156,172,180,188,18,128,122,40,1,40,145,149,193,132,64,215,216,215,180,137,68,9,64,
+	37,0,227,168,131,203,247,102,142,76,179,124,153,12,115,176,52,183,121,20,213,76,214,90,
+	184,243,228,85,50,226,78,7,35,248,81,218,165,62,202,229,195,121,103,237,212,161,212,154,
+	161,30,220,39,158,196,128,180,111,74,136,88,215,36,138,151,249,207,27,214,204,52,30,51,
+	122,25,89,230,29,130,111,162,186,170,137,18,128,122,40,1,40,17,116,68,192,107,236,54,
+	213,89,81,2,80,9,192,56,122,217,229,31,215,175,210,46,97,89,62,114,168,44,247,123,
+	22,213,61,45,149,103,15,207,202,243,128,67,17,252,144,178,105,151,229,27,151,107,220,75,
+	218,169,67,167,33,207,185,56,99,117,241,199,47,244,83,200,197,35,87,71,239,34,191,148,
+	177,208,176,99,161,241,156,177,191,145,81,242,59,174,231,1,37,1,149,0,212,67,9,64,
+	137,156,49,129,175,179,207,107,35,137,18,128,74,0,198,77,5,11,147,85,164,247,200,163,
+	126,218,165,204,226,69,7,202,225,101,61,62,211,82,153,206,240,176,68,87,57,208,186,234,
+	121,7,218,44,214,115,113,196,201,29,147,171,148,215,142,29,34,181,120,194,133,113,42,147,
+	61,190,245,104,44,80,137,187,223,162,119,145,223,221,72,197,28,227,62,163,73,201,239,186,
+	142,251,168,162,234,162,4,160,30,74,0,74,100,28,20,130,58,187,133,70,218,80,238,42,
+	165,16,136,4,76,63,215,103,196,45,197,192,180,223,99,27,103,113,58,27,211,120,135,101,
+	244,245,104,210,141,237,172,117,67,237,226,97,137,30,166,55,139,210,120,253,102,46,231,28,
+	242,210,46,199,73,174,119,124,174,76,95,237,216,33,145,197,229,76,227,98,31,198,1,235,
+	201,56,94,165,182,54,129,184,170,83,20,167,37,58,42,165,87,53,224,58,102,240,37,39,
+	36,158,146,187,2,215,49,139,155,93,63,35,17,17,17,111,92,30,130,50,150,230,2,109,
+	40,137,175,31,213,2,48,150,94,244,224,238,202,103,14,149,181,99,202,67,201,126,76,93,
+	143,227,250,171,165,114,141,247,184,84,245,24,145,98,4,127,165,189,67,101,248,202,131,26,
+	55,68,59,118,40,28,192,95,62,223,249,93,197,165,100,105,67,136,107,94,141,98,43,159,
+	41,70,122,22,26,183,27,85,75,122,247,101,220,174,36,96,108,168,5,160,90,0,74,116,
+	85,243,161,119,71,42,143,121,154,30,78,226,168,25,183,243,61,121,38,187,198,26,134,115,
+	6,21,21,170,8,154,229,193,79,235,58,199,218,247,100,114,49,75,109,126,250,26,31,198,
+	251,202,102,147,165,178,109,166,140,231,101,235,111,97,122,146,162,143,37,92,232,216,193,49,
+	155,117,30,212,184,25,218,177,3,175,54,175,121,48,229,135,149,199,159,244,208,230,16,87,
+	212,181,120,36,8,213,163,141,225,132,181,198,115,37,207,18,60,151,65,170,60,74,0,234,
+	161,4,160,132,218,37,161,169,183,135,104,99,73,156,148,97,0,95,91,190,8,219,192,80,
+	122,105,254,196,72,169,234,209,79,171,147,147,93,84,224,74,230,218,248,236,77,84,243,60,
+	174,93,45,151,174,139,15,219,124,163,141,232,205,225,10,42,56,248,233,237,61,170,113,85,
+	181,115,7,88,22,151,177,42,80,39,127,159,56,48,82,169,72,113,79,69,241,18,255,58,
+	195,41,219,140,119,141,54,37,125,206,104,15,39,201,18,37,0,245,80,2,80,156,54,62,
+	52,245,246,21,109,44,137,139,82,156,198,130,20,118,146,113,106,45,17,33,251,121,244,211,
+	122,188,227,181,183,55,175,176,208,226,167,95,228,121,92,47,180,28,25,239,71,158,184,216,
+	98,201,22,240,50,135,56,62,114,235,32,143,106,156,38,120,8,242,175,206,95,1,60,253,
+	91,197,37,26,167,88,28,213,40,138,237,255,48,126,50,156,148,103,12,53,154,149,52,52,
+	251,195,84,86,53,82,2,80,15,37,0,37,132,154,133,168,222,174,241,97,36,106,17,31,
+	28,197,164,148,119,147,124,222,165,153,66,24,9,167,123,244,211,122,131,75,229,111,203,185,
+	150,198,175,243,218,203,150,35,243,146,231,101,179,50,142,226,185,180,117,233,211,111,242,168,
+	198,157,170,157,59,144,74,115,187,235,179,64,167,254,24,75,115,109,34,113,204,155,81,188,
+	192,175,101,228,25,78,219,98,60,103,212,41,233,70,212,105,234,119,162,4,160,30,74,0,
+	74,232,156,19,170,154,171,198,77,46,210,221,245,96,200,225,117,62,162,77,202,175,207,96,
+	32,255,112,157,182,103,4,84,241,232,115,114,93,122,223,73,188,101,97,173,206,116,240,56,
+	174,93,93,88,211,25,123,210,201,210,133,235,164,144,213,4,191,62,71,236,213,190,95,184,
+	45,192,131,45,239,199,159,92,166,116,131,56,84,155,78,140,226,215,58,208,133,83,191,210,
+	156,203,116,238,164,252,238,139,234,240,42,223,209,82,213,73,68,36,84,14,86,105,101,59,
+	37,140,130,224,16,254,225,148,180,223,165,44,247,241,5,245,20,206,144,243,106,98,23,247,
+	230,244,179,214,104,123,176,199,81,109,109,121,221,182,30,207,119,120,182,131,81,13,86,77,
+	240,231,115,196,170,44,174,227,87,207,83,241,118,149,231,81,62,215,145,77,28,168,239,79,
+	70,51,149,60,148,90,156,206,48,214,57,252,190,21,184,133,169,156,150,104,209,254,252,206,
+	69,74,204,139,136,132,70,6,7,133,170,188,61,181,201,220,163,4,160,255,187,227,173,124,
+	237,216,96,231,189,249,141,125,21,212,80,43,237,209,231,100,251,252,13,78,241,116,182,221,
+	78,54,218,56,149,242,52,37,146,205,73,62,215,139,172,208,215,56,73,69,107,198,113,95,
+	72,182,74,31,254,212,28,164,146,166,235,232,24,213,175,182,132,215,24,72,109,142,227,109,
+	214,58,250,206,245,121,149,79,104,178,251,130,242,60,201,87,52,80,181,18,17,9,133,86,
+	212,14,85,121,247,165,172,54,154,91,148,0,244,87,54,175,112,135,163,119,81,107,50,138,
+	147,21,216,16,91,239,209,231,172,117,177,86,91,81,141,163,60,140,106,87,23,215,78,79,
+	127,170,59,24,213,120,214,56,177,43,131,203,248,205,243,206,238,233,168,198,59,188,163,110,
+	228,146,178,182,220,28,253,147,135,247,57,137,154,28,195,91,172,113,240,125,251,50,145,91,
+	18,221,177,235,197,223,156,171,170,37,34,18,2,123,134,172,188,101,52,6,180,123,148,0,
+	244,83,101,190,74,220,187,34,205,29,230,117,174,85,112,67,107,141,71,159,179,206,181,119,
+	182,218,86,237,12,15,163,26,220,4,224,25,14,71,213,190,181,161,175,113,98,79,37,222,
+	229,81,202,133,174,220,131,248,51,84,73,75,9,142,44,94,141,75,91,130,77,124,200,201,
+	212,98,32,35,216,234,208,123,150,227,206,196,163,5,228,240,28,67,169,166,10,38,34,18,
+	112,173,84,98,217,65,9,64,255,84,224,99,14,116,229,157,51,184,159,155,20,224,144,154,
+	231,209,231,204,113,237,157,173,182,85,235,227,97,247,161,160,38,0,235,209,219,225,168,198,
+	177,198,137,29,173,249,137,1,33,45,123,67,190,183,56,102,166,72,97,215,209,37,94,95,
+	120,19,195,232,71,109,206,99,172,67,239,184,7,191,112,123,162,177,52,6,240,183,6,107,
+	23,17,9,184,240,77,221,212,90,27,205,45,74,0,250,165,60,35,92,74,255,109,119,23,
+	55,40,200,161,52,53,244,159,99,181,173,90,41,23,218,191,38,86,53,209,16,70,38,154,
+	122,214,162,225,12,203,99,19,150,86,141,19,7,156,192,120,218,134,184,252,101,121,158,103,
+	60,29,63,84,194,175,27,183,198,243,139,175,96,8,61,104,207,179,142,52,244,46,205,109,
+	124,71,211,221,23,212,225,43,174,211,148,32,34,34,1,22,190,116,154,102,155,119,141,18,
+	128,254,200,226,125,215,231,226,185,135,179,20,232,16,250,151,13,30,124,138,193,100,215,222,
+	219,122,91,181,179,60,186,100,232,106,243,115,50,232,236,73,185,50,56,221,133,168,218,53,
+	201,147,239,186,158,217,218,185,125,63,238,220,199,219,158,205,51,238,158,243,25,103,51,165,
+	47,113,86,133,119,226,61,5,209,95,92,64,61,46,224,79,7,222,171,59,127,38,106,132,
+	155,201,125,124,64,101,85,54,17,145,128,170,31,186,18,107,154,41,215,40,1,232,143,71,
+	233,227,193,167,60,99,185,123,161,4,199,54,198,121,240,41,147,88,234,218,123,91,111,171,
+	214,132,3,60,137,105,87,15,94,145,138,3,109,12,112,235,94,11,192,197,158,180,205,27,
+	67,158,118,110,95,213,101,52,215,69,228,187,116,226,23,29,221,196,226,89,238,27,74,23,
+	195,90,158,165,3,251,243,17,249,105,190,83,69,158,231,117,202,239,190,224,104,198,210,66,
+	145,22,17,9,164,74,42,177,236,58,53,18,239,93,198,69,158,124,78,105,134,170,255,124,
+	8,141,242,224,51,190,117,181,222,89,231,205,68,32,246,71,127,242,38,1,56,216,198,186,
+	217,33,173,13,94,214,106,41,217,30,252,68,247,8,125,159,234,124,206,133,218,172,146,212,
+	141,28,161,32,236,48,134,254,180,228,113,54,166,249,62,167,48,142,102,137,126,101,38,112,
+	140,162,44,34,18,56,165,18,221,183,9,56,37,0,37,66,186,179,5,195,179,199,223,33,
+	220,225,227,174,141,7,245,194,205,33,187,15,182,81,142,117,158,116,26,154,111,59,62,243,
+	61,40,85,101,214,5,100,139,29,234,65,141,211,173,8,63,29,204,42,15,143,58,222,61,
+	238,210,184,99,98,234,48,182,69,178,230,167,249,168,109,220,103,172,53,210,179,194,56,60,
+	209,123,231,113,187,246,202,80,107,161,253,35,98,15,181,203,149,237,201,180,240,213,221,249,
+	218,108,238,229,131,197,91,213,121,199,197,206,124,187,219,131,167,20,244,144,153,204,175,174,
+	39,196,190,115,241,221,237,180,85,171,192,64,215,227,89,143,186,182,95,83,151,122,174,151,
+	107,32,21,92,138,170,93,223,184,62,19,240,47,76,209,142,237,155,227,249,148,156,72,126,
+	179,155,120,213,211,227,169,132,75,27,222,182,60,205,82,172,44,226,122,154,112,127,90,45,
+	1,171,240,41,247,237,126,17,81,138,219,120,93,123,165,136,72,160,84,8,97,153,43,106,
+	179,185,69,9,64,175,189,228,249,32,156,131,57,81,97,15,153,23,92,175,133,110,142,199,
+	102,239,212,255,76,215,163,217,197,195,87,185,247,205,221,188,160,202,231,85,151,191,235,139,
+	218,169,125,115,25,239,82,54,178,223,238,84,62,143,104,114,83,210,85,157,79,200,85,24,
+	74,178,140,235,105,201,179,108,73,249,29,50,184,142,247,40,183,251,130,147,249,68,23,110,
+	34,34,1,178,45,132,101,222,170,205,230,22,37,0,189,117,58,253,124,248,212,39,168,173,
+	208,135,202,43,44,112,241,221,215,243,132,171,165,183,215,86,109,95,218,184,28,205,174,30,
+	190,202,186,54,236,235,98,84,237,122,148,117,46,190,251,66,94,211,78,237,139,76,158,228,
+	209,136,31,231,15,97,76,8,231,182,19,183,149,231,227,68,195,212,73,97,243,184,128,182,
+	124,148,198,59,28,195,55,84,219,253,233,62,140,162,166,226,43,34,18,16,27,84,102,217,
+	69,9,64,47,213,229,81,95,62,183,26,207,40,248,161,178,153,135,92,124,247,167,93,156,
+	1,24,236,183,85,115,123,34,144,96,38,0,207,112,57,170,246,44,227,121,23,223,253,62,
+	54,105,167,246,65,54,67,61,154,112,202,95,123,48,198,198,124,218,18,7,165,25,106,243,
+	22,75,108,205,164,63,135,240,79,202,175,223,143,159,19,237,126,93,248,81,123,165,136,72,
+	64,108,76,123,10,120,239,41,1,40,145,240,134,143,3,105,106,30,188,176,93,186,79,114,
+	169,38,44,114,189,83,212,105,54,75,180,144,44,23,75,147,193,242,148,226,180,220,213,129,
+	204,179,88,104,179,60,167,185,188,213,42,179,192,165,26,55,81,227,65,249,148,2,249,32,
+	70,195,156,207,85,107,47,41,244,171,255,114,186,53,170,146,209,222,200,142,209,68,1,89,
+	198,101,198,170,148,39,4,89,104,116,78,124,108,239,160,202,24,58,154,4,68,147,128,72,
+	52,173,14,93,221,253,69,27,205,189,203,80,241,202,126,156,228,227,167,63,194,55,105,12,
+	245,34,94,219,194,69,140,116,37,5,117,37,171,92,79,60,216,83,155,35,248,216,181,210,
+	52,163,106,74,175,171,74,51,102,184,86,170,35,108,119,203,119,59,137,182,134,235,92,233,
+	168,107,112,161,70,241,240,65,38,175,209,63,70,223,183,62,163,232,201,76,109,120,1,30,
+	100,112,234,47,62,138,99,232,74,107,50,217,192,88,70,51,154,159,93,29,52,55,24,182,
+	241,24,239,240,52,199,166,244,234,218,124,199,64,62,219,253,233,209,28,197,247,170,144,97,
+	61,136,28,70,215,8,15,32,27,93,155,24,207,23,49,248,213,18,155,230,210,46,116,37,
+	22,9,185,82,252,226,115,30,253,90,109,132,144,121,200,133,90,240,174,7,229,62,223,118,
+	169,62,116,177,52,39,164,28,171,19,92,44,213,135,182,75,115,190,7,91,206,141,54,202,
+	247,105,71,246,229,202,237,173,24,182,115,152,163,86,128,2,28,145,122,29,58,208,24,151,
+	160,125,219,112,35,43,54,123,209,0,99,105,138,173,0,183,24,253,19,189,227,122,14,82,
+	149,12,149,130,22,128,205,140,63,12,9,175,63,140,102,106,1,40,69,125,26,186,35,210,
+	195,218,104,238,165,165,196,27,103,184,62,166,88,50,55,83,71,155,33,84,110,224,71,135,
+	223,113,42,103,123,80,110,251,211,85,28,65,45,215,74,211,213,135,87,38,83,43,133,46,
+	249,217,30,108,185,11,153,238,240,59,142,229,102,237,200,62,164,255,94,139,229,220,239,13,
+	24,69,83,109,254,152,203,230,145,212,94,152,197,125,140,74,56,112,224,177,188,77,102,76,
+	194,55,140,118,12,75,233,149,165,25,154,168,209,113,121,70,208,67,213,50,108,42,240,5,
+	237,21,134,16,107,207,23,84,80,24,164,176,217,42,177,236,160,4,160,55,202,112,187,239,
+	101,168,196,141,218,16,161,178,149,163,152,234,224,251,45,229,40,214,122,114,1,102,255,202,
+	225,84,215,74,211,45,229,87,186,151,0,60,45,133,14,189,94,140,163,183,134,195,89,228,
+	224,251,205,224,56,182,105,71,246,88,38,111,248,58,220,132,159,26,48,146,70,170,2,177,
+	118,53,45,83,121,89,77,70,114,93,137,163,110,28,207,115,174,14,10,27,36,75,24,200,
+	169,41,77,11,95,154,119,57,122,247,167,43,48,130,46,170,152,161,145,1,112,182,102,112,
+	9,189,230,59,238,248,103,40,22,2,192,164,208,149,120,178,54,154,91,148,0,244,198,89,
+	212,15,64,41,206,166,158,54,69,168,44,227,112,230,57,244,94,43,233,195,52,79,74,157,
+	74,170,202,173,153,128,51,233,152,242,107,59,185,214,232,99,112,10,175,201,246,100,219,205,
+	228,72,86,58,244,94,115,233,205,98,237,196,158,123,206,213,206,235,65,215,152,111,168,161,
+	74,16,91,245,83,187,209,89,155,81,28,144,228,36,238,166,24,133,241,13,58,243,71,74,
+	135,169,97,137,90,1,230,240,117,26,71,98,241,86,117,128,94,138,67,4,20,108,197,106,
+	138,132,0,240,107,200,202,107,132,174,196,33,162,4,160,23,202,112,125,32,202,81,150,235,
+	180,49,66,230,95,246,230,111,7,222,103,9,61,249,221,163,50,167,146,170,106,203,62,174,
+	148,165,109,26,125,32,42,208,198,149,50,237,75,219,20,94,229,213,76,186,191,177,191,35,
+	173,0,39,211,131,255,180,3,123,238,102,206,138,121,4,154,243,41,229,85,17,98,234,161,
+	84,126,241,235,48,218,194,143,114,188,118,172,105,236,203,227,41,29,168,18,118,4,206,229,
+	115,90,171,122,134,66,62,160,159,208,72,40,216,138,134,34,33,0,252,25,178,41,249,102,
+	56,214,32,65,118,163,4,160,23,78,164,65,64,74,114,150,238,4,133,206,2,122,242,77,
+	218,239,50,147,191,60,43,113,106,169,42,119,218,0,118,245,241,213,206,126,211,210,158,109,
+	191,73,14,140,4,248,21,61,152,163,157,215,115,131,184,83,65,160,43,175,234,220,38,150,
+	14,100,144,253,23,149,227,3,90,89,88,175,49,157,98,21,204,77,92,198,9,172,79,225,
+	80,245,46,135,237,254,116,45,70,91,10,179,248,109,18,224,200,125,103,241,219,223,133,182,
+	168,8,27,67,182,99,255,162,77,230,30,157,36,123,225,130,192,148,164,188,107,93,45,197,
+	61,203,233,195,45,105,142,165,182,47,103,122,86,222,212,82,85,39,184,114,203,57,120,9,
+	192,114,12,240,48,170,169,56,139,253,211,122,253,86,110,226,112,86,104,199,245,220,1,188,
+	170,209,126,0,56,158,251,21,132,216,201,228,49,251,47,202,224,53,246,182,184,238,177,177,
+	11,233,187,236,151,194,40,236,217,12,79,212,164,191,22,95,82,91,213,52,240,214,176,2,
+	158,11,89,83,33,73,116,42,246,28,192,10,214,40,22,82,224,203,80,149,246,43,109,48,
+	247,40,1,232,190,206,105,76,67,224,188,243,181,205,67,40,159,187,216,35,205,118,128,15,
+	123,54,14,101,106,163,213,85,230,56,23,202,18,188,4,224,0,114,61,140,170,125,117,120,
+	32,173,215,255,64,103,238,217,222,137,72,60,213,134,15,41,163,48,20,184,154,11,21,132,
+	152,185,32,149,105,75,175,229,120,203,235,182,141,97,80,255,98,223,20,154,97,148,231,147,
+	68,115,177,52,98,132,250,150,134,192,211,48,153,11,200,83,36,66,44,143,11,182,207,160,
+	240,180,98,33,59,125,22,170,43,223,47,180,193,220,163,214,2,238,123,149,211,2,85,158,
+	35,67,245,3,32,133,247,214,99,185,41,141,161,180,63,165,175,39,229,124,146,139,82,122,
+	221,40,14,118,184,36,101,88,157,86,74,100,11,149,217,236,112,153,70,113,80,138,81,189,
+	196,147,173,247,65,162,1,156,44,250,141,187,248,80,227,205,248,162,22,63,210,68,97,40,
+	114,253,211,159,17,10,67,108,212,96,42,85,236,190,168,11,99,109,220,91,249,156,35,98,
+	25,218,50,188,200,201,182,95,53,147,238,137,102,129,122,143,65,186,65,20,120,179,105,8,
+	123,115,53,123,83,81,209,8,157,117,252,204,67,252,12,48,135,70,138,135,236,148,201,18,
+	170,134,164,172,191,88,110,156,47,18,64,57,108,194,8,212,227,125,109,148,16,203,224,80,
+	222,100,125,138,219,222,155,217,65,135,164,88,186,124,154,57,92,146,110,105,239,45,78,183,
+	1,108,66,126,138,37,121,206,147,109,119,98,138,165,91,207,27,244,214,238,233,227,73,221,
+	55,1,59,206,4,225,177,86,211,14,196,72,10,199,157,138,198,76,195,142,81,177,221,151,
+	50,140,187,13,251,126,54,42,36,122,183,255,83,101,13,188,202,44,208,17,36,2,143,5,
+	84,86,101,150,34,94,8,77,237,189,90,27,203,77,234,14,234,182,67,2,215,41,171,183,
+	103,157,9,197,121,6,95,113,50,181,57,138,71,25,207,90,155,175,126,130,154,30,148,49,
+	213,209,234,50,56,221,225,146,116,13,192,59,20,117,102,202,173,174,189,24,3,176,58,143,
+	218,124,197,26,198,243,8,71,81,139,83,248,90,187,167,111,254,143,67,20,132,221,84,100,
+	40,229,20,134,88,232,148,202,40,183,119,208,212,214,250,171,99,124,226,113,19,151,218,110,
+	220,221,141,161,100,237,254,244,77,156,170,10,27,112,107,104,168,246,211,161,55,138,70,26,
+	255,79,138,121,37,36,229,220,198,27,218,88,18,102,67,2,152,85,215,165,98,116,212,161,
+	51,7,50,212,242,182,127,211,131,50,189,145,114,205,156,67,166,163,37,121,57,237,125,229,
+	101,71,203,147,201,156,148,75,226,197,161,240,77,203,165,25,202,129,116,214,128,238,1,113,
+	56,121,65,56,178,148,51,6,26,79,25,67,141,87,141,203,141,250,65,57,218,61,167,234,
+	17,3,25,124,111,191,110,116,48,182,218,108,209,246,112,204,219,19,157,103,228,217,110,5,
+	248,104,162,119,218,66,79,85,218,16,56,139,45,106,69,23,210,199,22,206,82,5,150,132,
+	71,203,169,161,168,193,31,105,83,73,184,205,14,224,110,245,128,54,75,196,156,96,99,235,
+	247,119,189,52,67,211,168,155,125,28,45,201,196,180,247,149,127,28,45,207,97,105,148,228,
+	93,215,183,219,145,54,74,51,72,59,93,96,52,96,105,16,142,43,199,25,243,10,93,246,
+	111,54,30,54,202,4,227,120,119,178,170,72,228,157,158,74,167,214,31,109,39,179,46,140,
+	125,90,225,68,99,139,237,168,13,78,244,78,203,104,161,106,27,2,221,89,172,100,90,8,
+	31,203,149,98,151,18,93,29,138,58,124,132,54,148,132,89,179,64,238,86,191,104,195,68,
+	76,115,91,99,130,84,113,185,52,31,164,81,55,223,113,176,28,21,217,150,246,190,146,71,
+	37,7,75,244,110,128,199,238,204,97,174,141,210,52,211,78,23,16,89,252,16,132,163,202,
+	21,70,254,110,23,254,223,26,101,131,112,188,91,23,203,201,91,227,164,82,42,227,149,29,
+	159,194,152,118,29,149,88,48,142,49,54,219,140,218,122,163,67,162,119,154,72,5,85,221,
+	16,104,202,63,170,245,33,123,76,165,149,42,174,148,168,50,43,3,95,135,255,210,36,181,
+	18,110,253,3,185,99,173,211,216,143,17,147,97,235,231,252,121,151,75,243,105,26,117,115,
+	51,213,29,43,199,129,142,236,45,7,56,86,158,170,105,77,8,228,246,120,60,118,6,6,
+	94,165,67,115,96,60,20,132,99,202,65,9,210,127,134,97,24,79,6,227,136,247,55,229,
+	85,81,180,15,20,126,100,25,83,109,167,255,150,25,165,148,90,48,48,142,177,221,117,250,
+	63,163,122,162,119,122,75,85,55,20,42,242,145,106,125,136,30,95,144,163,74,43,166,238,
+	14,124,45,86,207,13,215,101,69,240,59,229,208,140,134,228,80,145,138,84,161,18,89,192,
+	122,182,96,176,138,205,44,102,30,139,153,199,6,79,202,178,103,32,35,84,129,38,204,116,
+	233,189,171,83,155,58,212,161,38,165,201,1,202,82,14,216,198,90,86,179,158,117,172,97,
+	33,255,178,208,246,104,210,98,198,224,119,27,13,254,207,98,24,95,185,88,154,116,166,171,
+	200,230,68,158,112,168,28,93,29,122,151,239,29,42,207,41,105,77,8,228,238,36,32,61,
+	109,13,161,63,65,251,111,64,28,200,149,65,40,198,253,37,100,132,47,224,9,166,250,95,
+	188,61,184,135,203,85,89,34,170,53,151,218,127,209,233,180,180,253,154,145,228,43,218,192,
+	7,156,205,203,182,238,1,53,226,29,250,144,87,252,233,19,249,146,87,21,207,192,91,199,
+	177,220,205,117,10,68,40,12,225,34,182,41,12,98,162,62,251,6,190,140,135,241,137,38,
+	176,17,43,170,113,36,119,242,54,63,179,204,98,118,121,53,127,243,46,183,112,28,45,29,
+	158,120,160,176,119,2,154,91,63,218,193,239,88,153,125,56,155,255,241,21,255,89,110,225,
+	180,145,201,124,206,211,92,68,87,205,73,236,136,7,108,109,255,127,169,232,98,89,70,167,
+	85,55,255,116,172,28,239,58,178,175,56,215,41,249,247,180,202,49,202,197,45,86,158,25,
+	182,202,114,191,118,184,64,40,207,244,32,28,79,218,152,180,253,185,45,24,71,188,60,122,
+	168,186,68,212,103,169,140,255,55,49,133,14,192,199,170,109,209,206,199,37,182,163,119,159,
+	186,231,135,219,89,108,86,189,15,248,99,43,23,169,162,74,18,251,179,40,20,181,121,58,
+	237,180,177,164,100,205,56,139,151,152,76,126,90,213,108,35,227,121,148,227,168,233,120,249,
+	198,7,116,199,186,34,237,111,150,73,71,46,101,24,255,165,93,150,77,252,196,227,156,66,
+	3,85,231,52,12,178,25,245,71,93,44,203,216,52,107,68,71,135,202,49,203,145,125,197,
+	169,182,178,157,210,44,199,24,23,183,216,99,54,203,50,80,59,92,32,60,20,140,227,201,
+	169,38,151,253,159,4,229,152,55,41,173,246,183,18,84,71,164,82,27,14,79,33,253,183,
+	34,40,147,218,4,228,113,187,205,248,229,27,253,18,79,179,165,238,249,97,161,9,65,130,
+	253,88,166,137,63,36,169,75,217,26,154,26,189,154,163,180,193,100,119,109,185,133,63,28,
+	175,110,147,25,194,201,84,115,172,148,255,6,116,183,186,55,229,111,148,65,103,110,224,83,
+	86,187,80,170,223,184,147,110,26,159,48,37,205,109,198,218,205,22,49,233,166,189,31,119,
+	164,20,85,211,188,45,176,227,145,239,208,239,193,19,129,157,186,103,31,219,147,165,104,10,
+	144,32,232,230,192,36,55,142,60,46,51,185,236,31,19,156,163,222,93,170,50,145,147,149,
+	218,4,5,159,165,144,0,124,90,9,134,98,143,39,109,70,112,137,81,59,209,251,12,81,
+	53,14,13,77,8,18,228,137,63,90,170,130,138,169,50,188,28,178,90,157,199,45,26,113,
+	92,118,105,194,255,49,201,213,42,183,141,209,92,233,200,69,238,250,128,238,84,47,164,240,
+	93,178,57,148,167,152,227,122,217,22,242,2,135,104,151,183,157,152,181,59,171,211,20,202,
+	186,84,150,116,19,243,203,29,105,171,115,152,99,53,178,143,3,165,201,102,105,154,165,248,
+	221,181,83,130,137,54,75,162,41,64,130,32,155,191,131,114,60,185,194,228,162,127,92,144,
+	186,71,117,86,181,137,152,203,83,169,9,181,141,109,182,211,127,249,70,107,165,24,138,61,
+	50,141,79,108,70,241,75,35,35,209,59,157,162,138,28,26,154,16,68,19,127,72,88,247,
+	221,175,67,89,183,159,119,113,152,54,9,145,158,124,224,97,171,135,127,184,139,54,105,148,
+	182,124,96,119,168,143,108,94,106,30,195,59,172,242,180,132,51,184,145,58,170,240,54,124,
+	107,59,198,119,187,84,146,244,211,243,78,116,49,189,197,177,186,120,179,3,165,25,148,118,
+	41,38,186,180,181,238,177,93,146,145,218,217,2,224,142,224,28,79,66,146,0,52,248,195,
+	229,169,116,196,91,85,45,143,249,108,185,190,150,100,132,82,12,9,30,149,140,191,108,198,
+	241,226,68,239,179,134,22,170,204,161,145,201,195,170,249,1,123,60,172,20,137,36,81,133,
+	113,161,173,223,31,186,214,92,69,66,161,28,103,243,167,47,85,239,71,206,39,55,165,50,
+	215,12,236,238,100,253,18,126,15,254,199,18,223,90,108,124,200,145,106,109,100,209,3,41,
+	196,215,157,22,49,233,79,76,240,185,3,165,248,216,167,116,121,98,95,164,93,138,105,174,
+	108,171,246,108,177,93,18,77,1,226,191,38,150,39,92,82,2,176,240,227,18,85,157,8,
+	121,42,181,90,48,38,133,4,224,254,74,50,36,124,52,54,22,219,138,227,70,99,175,196,
+	103,217,74,96,132,201,153,154,16,36,64,45,219,47,84,133,148,36,234,187,220,111,210,253,
+	156,69,69,109,196,120,42,197,233,204,245,181,242,109,228,109,14,181,157,138,170,29,216,157,
+	233,91,11,165,207,225,66,126,9,64,89,255,226,120,141,11,104,65,42,109,204,220,105,17,
+	147,254,196,48,121,52,76,187,20,11,28,236,148,158,254,193,55,253,118,203,255,186,176,165,
+	178,248,213,167,246,153,146,158,161,65,58,158,132,40,1,184,130,170,170,60,17,209,46,181,
+	193,204,43,26,91,108,167,255,62,83,154,161,196,71,119,99,147,173,88,254,99,148,77,244,
+	62,151,170,66,135,202,1,105,15,106,162,135,19,143,165,28,160,202,40,73,212,12,121,250,
+	207,192,96,12,21,180,33,157,190,0,12,190,131,121,200,177,121,65,83,85,150,19,56,129,
+	25,60,201,11,172,183,145,184,12,170,100,169,204,218,156,207,165,84,9,68,89,247,100,24,
+	19,121,128,55,201,211,14,107,98,66,10,175,105,207,53,220,227,120,73,178,29,72,249,159,
+	150,230,144,253,245,29,236,64,94,155,122,204,79,235,29,206,112,160,125,67,182,11,117,230,
+	186,148,218,128,78,208,206,230,179,125,56,94,65,72,73,21,174,231,90,133,33,18,30,78,
+	237,252,117,127,219,119,189,242,185,81,209,46,209,88,46,224,37,27,235,183,227,46,174,222,
+	253,233,123,249,148,153,138,102,104,124,207,222,124,76,187,196,11,203,112,46,199,80,95,205,
+	58,211,148,199,60,62,96,8,155,75,90,97,26,253,92,234,27,34,209,145,203,23,105,13,
+	102,22,12,221,249,128,126,37,239,10,18,61,173,25,17,176,44,244,50,238,182,156,90,168,
+	23,216,92,250,119,38,165,238,200,27,41,116,11,244,98,68,198,99,181,67,152,176,63,13,
+	136,129,193,166,146,78,225,210,224,196,157,225,89,105,118,253,62,198,209,186,215,63,205,45,
+	51,195,129,50,44,113,124,59,181,98,99,10,229,208,20,32,254,27,19,172,223,230,16,181,
+	0,52,216,172,57,172,35,225,168,84,107,192,45,182,219,255,189,170,118,70,73,30,47,217,
+	138,103,158,177,95,226,126,41,58,178,132,75,9,19,130,84,49,198,27,226,156,241,70,21,
+	77,252,33,169,202,97,124,100,142,52,31,132,162,209,90,104,4,57,152,165,184,156,187,237,
+	15,253,88,154,58,212,34,7,200,37,131,74,100,177,146,13,108,100,53,235,88,195,34,140,
+	244,74,85,141,27,185,154,119,184,219,194,125,151,173,129,141,237,150,18,158,63,128,91,232,
+	229,92,229,170,67,101,202,147,67,5,202,83,137,77,108,100,27,107,129,229,44,98,49,249,
+	246,222,174,29,195,249,130,139,117,151,184,4,6,191,211,211,246,171,202,240,34,221,29,110,
+	91,233,68,91,181,38,28,200,232,52,94,223,213,209,111,212,149,15,211,120,245,65,142,164,
+	28,156,110,1,88,138,23,82,26,88,119,66,186,63,161,146,166,1,116,87,16,210,216,143,
+	254,143,147,20,134,208,111,197,7,83,125,105,115,155,235,47,79,212,94,77,138,184,144,142,
+	116,176,113,232,121,142,78,187,159,30,247,228,44,94,80,44,67,100,29,199,114,55,215,21,
+	127,250,25,186,40,54,14,234,194,51,156,176,251,211,67,184,136,109,138,142,152,42,205,251,
+	17,218,29,251,243,36,231,107,163,70,95,3,70,90,205,10,151,50,218,24,167,24,15,27,
+	195,141,159,140,249,70,158,233,189,148,205,198,76,227,59,227,53,227,46,227,28,163,155,81,
+	62,157,81,202,134,38,61,147,204,14,108,30,125,88,130,210,182,75,127,92,169,202,70,15,
+	227,2,227,126,227,45,99,140,49,215,216,102,186,37,182,24,179,141,49,198,59,198,125,198,
+	64,163,185,145,97,189,253,198,125,154,15,168,4,15,164,184,221,46,115,184,28,27,28,169,
+	163,175,166,85,6,103,167,187,255,42,173,178,188,230,72,25,214,59,188,149,46,79,177,28,
+	154,2,196,239,212,199,180,160,29,79,66,213,2,208,32,159,253,84,141,66,238,234,212,183,
+	191,221,41,64,206,84,11,63,11,143,22,198,106,91,81,189,33,209,187,172,166,190,170,118,
+	232,20,155,16,164,158,145,175,70,123,14,203,55,234,105,226,15,73,197,211,145,59,214,92,
+	166,141,26,117,39,91,233,206,88,209,56,214,120,196,248,222,88,147,242,207,106,158,49,213,
+	24,102,220,108,244,53,114,83,169,136,91,120,142,6,30,164,66,156,127,20,191,207,218,140,
+	55,201,75,245,221,114,141,190,198,173,198,112,99,70,26,7,254,213,198,104,227,127,198,177,
+	70,101,43,159,56,213,185,86,138,145,50,40,229,212,146,179,157,226,182,57,82,71,55,164,
+	56,247,54,64,6,203,29,158,58,32,245,206,73,149,89,239,208,92,111,78,106,204,218,20,
+	203,161,41,64,252,117,126,240,142,39,33,75,0,26,124,173,106,20,106,53,88,149,250,214,
+	255,217,214,153,201,231,214,111,78,198,252,49,200,86,92,55,25,173,18,189,203,8,85,238,
+	16,218,191,240,176,47,125,149,175,115,65,95,77,252,33,246,93,30,193,35,205,54,142,208,
+	134,141,174,108,94,73,86,5,26,27,231,26,159,216,156,123,44,153,153,198,115,198,0,163,
+	134,253,49,212,30,163,90,137,223,101,97,64,119,161,135,11,149,177,26,79,166,54,230,95,
+	69,163,151,113,159,49,38,133,57,245,74,182,205,248,213,184,221,232,156,236,164,59,159,199,
+	41,163,93,165,152,230,105,204,10,237,220,232,59,165,28,171,165,231,166,92,134,22,142,239,
+	49,205,83,46,203,121,142,149,193,185,73,133,50,248,42,229,82,104,4,53,63,101,58,50,
+	158,100,220,19,128,70,74,147,223,72,80,60,151,206,182,255,206,198,249,200,98,163,182,82,
+	123,150,31,67,108,157,235,141,74,124,150,119,162,170,119,8,53,225,172,79,36,98,0,0,
+	125,121,73,68,65,84,159,29,91,176,183,178,117,46,232,93,184,1,68,75,85,56,177,160,
+	183,67,141,49,130,246,88,77,43,109,220,104,170,202,104,179,77,159,99,92,106,252,233,106,
+	83,235,63,141,187,141,110,246,238,250,46,231,194,18,166,187,250,39,160,59,208,77,59,19,
+	1,103,166,50,101,67,75,227,58,227,167,36,93,124,211,51,219,184,203,104,102,94,138,9,
+	180,208,238,82,44,173,179,50,229,26,113,182,99,165,40,227,88,45,253,49,229,50,156,228,
+	248,30,147,250,101,201,79,142,149,193,185,81,0,207,73,185,12,154,2,196,95,39,4,241,
+	120,18,194,4,224,80,85,165,208,106,159,222,101,205,231,54,122,136,244,81,90,207,198,163,
+	156,49,217,214,89,222,105,137,222,101,17,149,85,197,67,104,231,132,32,149,141,13,202,215,
+	57,108,195,174,190,81,154,248,67,172,169,205,162,200,30,107,126,215,64,96,81,212,156,169,
+	37,111,244,54,198,99,198,90,143,126,112,151,24,175,25,3,140,10,214,43,228,159,28,148,
+	224,251,124,30,208,221,231,84,0,246,178,63,155,100,59,227,118,227,87,207,14,123,191,26,
+	231,154,141,211,184,70,131,185,23,51,50,141,123,42,78,141,190,83,209,193,122,218,54,197,
+	50,60,226,248,30,243,191,20,75,210,218,193,50,84,112,104,11,213,101,69,202,101,248,70,
+	59,153,175,38,40,1,232,80,55,18,221,62,10,171,175,210,219,246,183,91,62,255,184,70,
+	73,61,155,143,78,182,250,131,44,75,220,227,230,30,85,241,80,202,228,190,237,91,240,78,
+	101,236,28,118,231,142,125,227,57,205,130,42,150,148,74,247,56,25,240,199,147,218,196,81,
+	211,189,228,214,104,71,24,227,124,248,217,93,109,188,100,28,104,189,53,224,80,26,22,251,
+	70,207,5,116,231,233,73,37,30,102,171,157,215,212,51,110,52,166,249,176,13,86,24,15,
+	26,53,205,70,51,44,167,29,103,167,7,210,168,19,78,141,190,83,213,193,122,154,234,76,
+	143,99,28,223,99,126,72,177,36,15,57,88,134,42,14,109,161,15,210,40,131,166,0,241,
+	211,161,193,60,158,132,48,1,104,240,172,170,83,40,29,147,238,150,223,211,226,153,199,75,
+	74,232,165,240,184,219,214,217,221,144,68,239,177,57,141,1,55,196,95,191,97,96,100,26,
+	207,104,34,16,7,123,165,61,99,100,110,223,51,254,86,5,19,139,110,142,252,177,230,88,
+	109,228,116,5,169,59,87,31,62,76,220,172,179,43,247,211,211,199,130,205,227,77,94,98,
+	154,149,85,215,113,3,79,147,95,104,39,252,191,64,110,247,147,184,151,70,86,87,206,166,
+	15,167,114,140,143,183,158,214,243,34,247,177,48,241,194,113,28,197,114,237,202,0,12,226,
+	157,180,106,197,219,14,148,161,22,139,28,251,62,139,105,144,194,228,23,153,172,118,172,181,
+	220,14,27,200,97,155,237,87,101,49,151,218,142,149,161,22,75,28,217,247,223,76,171,134,
+	169,243,164,127,70,114,112,16,139,117,133,73,3,217,31,131,58,229,238,102,154,148,116,72,
+	145,192,42,205,196,244,219,110,78,179,240,22,239,113,146,195,243,46,197,101,3,253,104,99,
+	128,205,60,58,38,202,106,188,199,0,69,50,148,70,112,228,246,127,116,226,104,7,79,125,
+	226,107,17,31,241,219,142,63,62,165,175,34,34,22,236,197,175,148,142,248,119,92,78,91,
+	71,174,136,36,0,246,99,93,162,44,111,115,99,104,64,238,37,141,53,78,50,178,173,228,
+	165,199,210,122,231,183,58,53,144,153,243,124,235,99,232,52,48,30,52,150,5,34,254,235,
+	140,251,75,154,162,101,134,186,115,21,104,158,86,189,88,70,77,7,202,208,192,209,186,122,
+	116,74,7,63,55,246,154,61,83,40,73,127,71,75,224,68,39,237,234,44,78,171,12,154,
+	2,196,63,237,131,122,47,54,148,45,0,13,238,80,149,10,29,71,102,53,60,47,233,217,
+	198,187,70,150,90,243,165,248,104,111,108,182,113,94,55,50,241,187,28,168,170,30,210,4,
+	160,246,0,247,30,154,35,91,172,200,100,124,44,246,135,55,180,169,211,83,42,32,229,232,
+	198,23,187,183,217,201,226,14,38,49,32,32,205,20,247,227,77,102,115,91,242,187,90,251,
+	241,27,87,22,76,10,50,37,144,91,61,163,132,41,75,138,233,204,91,204,228,106,147,73,
+	142,189,84,129,107,153,206,69,137,170,108,51,190,167,147,118,102,96,38,171,210,120,117,53,
+	30,115,160,12,206,222,119,58,51,133,215,116,113,37,182,93,83,120,205,25,142,150,192,137,
+	73,64,158,72,43,201,187,138,89,218,201,124,115,150,66,224,240,111,75,166,130,16,42,185,
+	220,236,196,219,60,103,250,54,6,15,113,114,10,205,189,101,187,63,185,203,198,218,7,115,
+	120,162,167,31,213,190,41,34,146,130,203,92,186,6,10,154,147,57,66,27,59,252,246,98,
+	249,238,217,221,86,198,47,129,28,145,97,179,241,186,209,213,202,12,166,173,128,10,228,135,
+	49,179,158,97,244,51,70,7,116,68,140,31,141,61,19,79,8,114,168,118,36,210,153,6,
+	100,251,227,152,180,75,208,218,209,186,184,149,58,182,75,240,172,43,123,197,51,182,203,81,
+	139,45,142,150,160,85,218,219,166,111,154,37,208,20,32,254,201,78,101,190,246,244,30,245,
+	141,7,140,127,108,13,235,159,154,185,198,219,70,79,63,142,116,189,85,173,66,229,65,231,
+	182,253,255,149,80,23,87,26,199,169,165,81,154,143,44,227,119,27,123,255,196,196,173,45,
+	117,187,35,140,212,2,80,45,0,197,95,141,19,247,166,140,228,99,54,21,181,193,195,173,
+	197,238,157,210,50,140,115,141,117,129,30,152,117,140,113,112,178,170,185,142,211,129,127,195,
+	183,83,245,242,112,158,223,84,108,53,30,51,42,238,94,238,45,14,36,175,194,239,129,52,
+	183,254,130,180,167,154,216,211,225,250,120,141,237,18,184,51,83,234,175,182,203,113,173,195,
+	37,216,35,205,45,147,195,220,52,75,160,41,64,252,115,188,215,199,129,115,141,13,158,254,
+	174,191,157,232,87,221,221,199,91,170,86,33,210,132,77,78,110,253,251,140,109,197,106,224,
+	70,227,97,163,154,210,12,14,60,186,26,121,54,246,252,243,19,189,199,66,42,169,202,43,
+	1,168,135,18,128,98,203,187,177,218,39,110,215,6,15,179,138,252,83,124,147,230,26,159,
+	134,98,118,166,111,141,131,146,85,206,215,249,34,92,187,211,161,198,79,161,136,253,116,163,
+	227,238,165,223,164,86,128,12,74,187,14,188,144,102,9,58,59,92,39,167,216,28,3,160,
+	12,155,93,217,55,54,83,198,102,36,38,57,92,130,116,187,185,191,152,118,9,6,234,128,
+	229,155,79,189,61,18,92,236,195,175,250,72,163,180,183,199,187,141,142,205,172,45,238,123,
+	199,233,237,95,217,56,194,184,223,248,209,216,108,76,54,94,53,46,50,26,40,197,224,216,
+	99,136,141,253,126,137,145,147,232,61,238,81,149,87,2,80,15,37,0,197,134,125,194,217,
+	235,48,229,199,58,234,106,163,135,215,219,197,55,104,67,227,239,16,77,209,254,125,178,150,
+	128,203,195,179,43,237,111,124,31,162,200,111,52,206,218,253,59,172,167,71,204,247,167,230,
+	105,215,131,252,52,211,168,251,56,94,51,247,181,245,249,123,187,182,135,116,179,85,142,253,
+	28,255,252,189,211,218,46,7,59,112,98,160,41,64,252,82,135,173,94,30,11,218,218,26,
+	200,223,57,55,120,125,212,59,95,85,43,36,246,118,239,194,38,67,169,5,199,31,85,141,
+	37,54,246,251,123,19,189,199,90,106,168,218,43,1,168,135,18,128,98,217,152,216,237,21,
+	47,104,163,167,202,239,73,64,46,231,132,162,79,116,224,199,180,123,186,1,172,99,37,11,
+	152,197,84,38,241,31,43,217,226,210,23,216,159,145,124,70,187,146,87,168,26,142,138,208,
+	136,161,124,207,254,174,188,247,70,150,51,139,191,152,197,44,150,178,146,205,142,188,107,89,
+	94,224,69,202,22,125,178,60,35,232,28,235,61,122,38,43,210,124,135,12,134,164,53,174,
+	130,243,147,207,219,155,74,163,171,107,177,237,234,98,169,221,142,108,121,134,164,61,155,210,
+	74,77,1,226,155,83,200,242,242,227,174,117,100,198,25,251,174,166,156,183,31,56,88,85,
+	43,20,50,120,216,189,217,224,12,197,215,113,43,184,206,214,133,64,130,161,126,43,114,149,
+	226,40,34,98,209,177,116,143,221,119,30,108,150,128,17,243,211,42,63,245,224,219,162,23,
+	181,125,24,150,242,192,31,203,152,192,111,204,100,62,115,153,203,154,221,150,103,81,157,6,
+	52,160,1,141,104,194,94,52,113,240,203,231,241,18,183,178,40,164,149,160,60,215,114,173,
+	99,23,94,121,204,224,15,254,99,46,115,152,205,66,150,38,88,167,38,245,168,79,125,154,
+	209,137,142,228,166,241,105,191,115,124,241,172,196,50,14,98,98,140,247,233,145,28,156,246,
+	123,60,206,101,41,191,246,16,199,167,138,88,71,29,214,89,94,251,85,78,115,41,178,175,
+	218,72,23,84,96,1,149,29,254,252,67,248,54,141,45,122,137,3,53,171,151,14,153,62,
+	25,103,179,29,108,90,74,177,204,183,190,177,135,241,165,151,31,103,208,128,249,170,94,129,
+	119,28,239,41,8,97,187,184,248,150,131,44,175,253,80,162,193,126,215,209,52,225,9,164,
+	4,213,8,142,84,16,92,243,41,125,21,4,49,241,107,44,27,192,188,193,169,218,244,97,
+	83,139,5,69,155,114,158,152,210,124,131,243,141,33,198,241,70,163,20,198,127,233,110,156,
+	111,12,49,38,57,212,121,105,173,113,139,81,62,132,13,104,7,24,179,29,249,254,83,140,
+	33,198,121,198,222,41,196,160,153,49,208,120,54,229,82,44,53,58,23,127,199,121,212,142,
+	241,126,245,128,3,181,34,47,141,174,212,135,185,80,75,79,183,241,249,147,92,219,87,236,
+	164,149,7,187,240,249,125,82,222,38,251,176,205,129,207,215,20,32,126,169,238,200,246,179,
+	252,168,227,227,208,14,151,122,125,4,60,91,213,43,240,178,153,174,14,128,225,123,236,97,
+	227,140,126,189,81,43,209,123,220,167,202,31,178,4,160,234,189,186,0,139,63,250,196,116,
+	191,216,166,193,137,194,167,216,92,53,199,24,91,109,94,42,204,48,110,55,58,59,48,126,
+	75,45,99,128,241,132,35,35,15,254,103,244,11,213,142,211,200,248,34,237,239,60,195,24,
+	98,156,100,212,113,160,52,237,140,171,141,113,41,148,96,181,113,64,241,247,250,193,133,142,
+	168,97,49,200,145,186,49,165,120,239,106,203,142,114,161,166,142,182,252,233,149,200,115,109,
+	127,201,179,209,166,239,59,23,62,191,95,138,91,164,12,19,29,249,124,77,1,226,151,211,
+	188,61,46,52,240,49,1,120,165,215,71,193,15,84,189,2,239,114,93,252,135,243,241,184,
+	141,61,255,1,141,3,168,4,160,30,74,0,74,170,70,197,118,207,120,74,27,63,92,250,
+	21,159,125,214,206,160,227,219,140,143,140,195,140,82,142,167,195,46,54,190,78,169,21,98,
+	97,31,132,100,46,185,82,198,69,198,154,180,190,233,111,198,45,198,30,46,12,63,255,176,
+	173,225,163,183,223,61,62,92,63,8,59,52,119,104,75,164,58,7,223,113,46,212,214,124,
+	154,91,252,244,131,92,221,107,14,180,88,138,38,174,12,88,127,108,138,91,228,94,135,62,
+	95,119,217,2,114,179,204,237,71,182,177,193,183,4,224,177,222,207,34,87,86,21,44,208,
+	170,132,105,42,53,61,138,78,5,178,220,242,158,191,206,168,169,54,128,74,0,234,161,4,
+	160,164,162,91,140,247,140,13,186,81,148,10,191,38,1,169,84,52,65,179,7,195,44,15,
+	58,190,141,231,105,202,209,124,65,190,195,133,154,205,147,244,166,38,39,241,97,26,147,134,
+	244,103,18,87,122,59,98,123,10,90,50,154,39,83,30,111,241,111,174,166,41,157,248,63,
+	254,113,188,100,147,184,138,250,156,100,171,191,101,121,62,100,64,209,167,46,228,204,152,238,
+	211,233,79,3,178,221,53,41,142,38,225,198,236,1,25,150,59,1,119,117,53,182,86,223,
+	253,44,87,70,87,77,45,178,237,29,26,74,93,83,128,248,165,116,154,243,114,219,182,37,
+	141,193,38,211,179,201,70,99,95,135,84,176,156,214,23,127,220,28,150,169,212,164,184,21,
+	60,96,99,71,76,120,160,186,72,151,118,34,34,73,92,16,227,239,94,206,214,48,81,226,
+	179,39,138,118,193,253,215,242,93,194,247,141,214,158,100,148,171,25,23,27,63,167,209,142,
+	225,119,163,99,128,219,254,93,157,114,11,143,149,198,83,70,23,143,74,57,208,248,199,86,
+	171,208,19,139,190,195,38,246,142,233,222,53,210,161,109,240,103,74,29,169,221,233,174,56,
+	143,76,75,159,62,212,213,90,249,174,165,50,148,98,142,43,159,158,202,64,183,89,76,112,
+	232,211,191,209,97,203,39,61,189,63,70,244,244,169,253,223,211,126,28,17,159,80,21,11,
+	176,38,108,82,219,159,240,62,178,141,153,106,3,24,31,106,1,168,22,128,226,135,28,214,
+	197,122,223,152,234,243,148,182,161,228,79,11,192,125,185,112,215,31,25,188,70,99,75,47,
+	155,197,129,28,203,20,79,138,184,156,39,217,155,182,60,152,98,115,170,14,252,196,141,22,
+	115,22,222,170,205,23,60,152,210,156,191,191,112,50,117,184,136,95,61,41,103,62,67,217,
+	139,147,88,96,113,253,76,94,161,103,225,39,202,48,60,166,247,142,39,56,244,62,123,113,
+	109,10,175,202,118,229,59,213,163,183,165,245,130,208,2,176,15,13,92,249,244,84,34,123,
+	61,157,2,86,171,196,174,131,188,255,200,81,60,227,195,23,157,201,141,126,196,87,45,0,
+	131,236,62,202,40,8,225,181,133,91,45,175,91,129,43,19,61,125,17,213,21,71,17,145,
+	18,157,72,133,88,127,255,150,28,160,74,96,87,41,95,62,243,233,194,159,123,149,197,254,
+	77,175,211,129,239,61,46,234,100,174,165,46,167,243,87,74,87,235,119,51,150,150,1,219,
+	224,189,248,205,98,38,165,176,124,70,208,155,189,121,139,77,158,150,54,159,183,105,203,227,
+	228,89,140,248,135,180,47,252,68,61,158,142,229,94,237,92,170,230,22,218,217,126,141,91,
+	211,175,156,97,97,157,234,22,239,37,164,170,137,165,148,242,25,46,125,186,253,200,182,230,
+	166,0,214,42,177,199,151,150,204,151,240,188,199,159,248,55,189,88,229,199,87,109,103,99,
+	114,31,241,186,238,15,80,16,194,237,45,198,91,94,247,66,114,119,127,178,34,231,43,138,
+	34,34,37,58,91,17,80,37,176,203,143,4,224,0,58,236,250,163,19,119,91,120,201,74,
+	142,225,52,214,250,18,162,205,188,70,123,14,230,195,20,198,28,220,155,223,56,47,48,45,
+	83,179,121,136,175,168,99,243,85,155,120,138,86,244,243,173,7,224,106,46,99,127,139,99,
+	13,86,230,19,234,22,126,226,120,6,197,112,175,118,46,85,83,134,23,109,55,99,117,43,
+	1,216,223,66,59,128,174,174,199,54,249,184,136,213,56,202,165,207,182,27,217,82,188,224,
+	224,4,7,74,0,250,35,131,46,126,124,108,30,231,114,24,223,58,62,210,110,98,51,184,
+	134,189,249,207,175,179,160,206,170,102,1,173,251,255,83,199,158,176,51,184,218,242,186,149,
+	18,95,197,93,232,82,191,2,17,145,240,107,174,115,24,250,107,58,55,187,188,159,171,34,
+	147,219,119,253,81,129,183,44,28,217,103,115,56,147,125,14,212,40,70,177,7,55,49,208,
+	102,206,180,2,207,210,151,211,29,154,151,33,29,13,121,207,118,126,100,11,47,113,55,243,
+	124,47,251,143,116,229,9,75,9,254,6,124,198,1,172,217,245,196,147,140,102,113,204,246,
+	234,153,172,112,108,216,244,189,185,132,71,109,189,194,173,83,245,108,78,226,241,36,235,184,
+	159,0,236,202,23,73,214,56,197,181,46,107,118,35,123,25,221,29,251,108,77,1,226,151,
+	22,84,243,235,163,191,228,75,42,208,60,233,105,194,73,137,187,238,1,240,183,133,6,177,
+	243,89,228,111,140,247,102,148,42,90,0,13,96,63,5,33,252,190,231,83,142,180,184,238,
+	197,60,202,182,226,79,214,97,32,111,40,142,34,34,9,28,163,16,80,145,94,26,37,51,
+	232,138,76,17,240,188,133,129,129,39,24,117,2,52,212,100,107,227,117,99,171,237,161,205,
+	255,53,186,250,92,238,3,140,197,54,203,188,213,120,217,104,18,168,97,62,207,176,56,117,
+	201,39,70,70,225,215,125,16,195,189,108,164,131,113,95,79,115,91,159,125,131,107,53,32,
+	121,79,252,79,92,175,133,31,39,45,195,239,174,125,246,245,182,182,67,99,214,58,248,217,
+	154,2,196,47,167,6,127,0,230,43,76,126,141,199,133,97,0,233,15,84,205,2,40,155,
+	25,26,248,63,26,143,206,70,190,229,51,207,129,137,222,65,237,207,195,65,147,128,104,18,
+	16,241,222,143,218,59,48,120,81,21,193,30,175,187,0,151,46,60,34,112,79,11,109,186,
+	70,114,32,11,3,20,176,41,156,74,27,222,197,176,121,45,254,67,225,121,79,60,119,33,
+	223,80,211,230,113,124,15,206,224,223,64,85,214,151,217,207,82,51,164,190,92,94,248,207,
+	254,156,28,187,253,218,201,211,229,242,60,111,171,27,150,123,157,117,246,76,58,161,133,251,
+	205,224,187,38,45,65,7,23,47,136,173,203,96,8,21,3,90,163,196,142,189,21,2,215,
+	237,163,16,4,208,57,52,83,16,162,114,66,242,165,229,117,19,118,24,238,228,96,107,118,
+	17,145,232,168,77,55,5,1,56,218,135,62,173,161,230,117,2,112,240,174,83,186,44,30,
+	75,186,250,56,250,179,46,112,65,155,193,9,236,109,115,66,146,50,60,197,251,228,248,80,
+	218,50,60,207,83,182,134,15,155,78,63,250,49,53,128,213,245,15,246,227,79,11,235,221,
+	95,244,170,249,113,106,197,238,124,219,73,7,217,26,94,181,180,139,223,203,188,55,97,3,
+	219,3,92,166,114,168,173,159,70,9,211,99,39,178,231,164,48,215,143,119,53,74,172,219,
+	75,33,240,96,175,174,169,32,4,76,5,110,86,16,162,227,14,203,107,118,77,156,143,191,
+	76,49,20,17,217,205,17,190,204,230,16,60,213,60,24,4,42,82,188,173,54,89,133,231,
+	164,188,148,61,147,172,62,145,195,3,152,254,219,110,60,7,114,28,211,109,189,230,24,126,
+	180,217,155,50,125,53,24,101,43,123,179,134,107,216,35,192,45,205,23,211,147,159,146,174,
+	85,154,215,10,55,127,170,202,181,49,219,175,157,78,215,60,68,3,203,235,186,153,0,60,
+	133,114,166,87,14,94,48,251,148,178,156,228,226,39,91,143,108,93,238,15,120,141,18,171,
+	154,43,4,30,80,91,179,160,185,130,218,10,66,116,252,196,87,54,54,125,194,211,231,70,
+	138,162,136,72,49,7,42,4,5,14,80,8,236,240,54,1,120,252,174,67,120,78,225,92,
+	96,66,75,232,91,120,50,135,0,122,159,118,92,203,122,27,175,104,195,79,158,214,208,38,
+	140,101,95,27,235,127,64,107,30,98,75,160,163,190,146,222,124,155,116,173,150,60,85,248,
+	207,179,169,28,171,253,122,166,195,179,206,84,230,89,203,235,186,57,95,95,46,71,155,44,
+	245,63,1,120,12,85,92,252,100,235,145,125,154,92,135,119,58,77,1,226,143,10,74,131,
+	120,66,9,192,96,169,102,99,234,88,9,133,219,45,175,121,28,77,118,127,50,139,139,20,
+	67,17,145,98,148,0,220,65,9,64,91,188,77,0,22,186,177,119,117,146,105,74,13,6,
+	243,95,224,195,183,149,7,105,199,39,182,206,107,191,230,116,143,74,215,129,177,180,176,188,
+	246,98,6,114,108,160,198,91,44,201,58,142,100,116,210,181,78,227,132,93,127,84,230,204,
+	88,237,215,6,127,56,252,142,71,88,110,219,86,218,213,111,102,214,197,214,255,4,224,25,
+	174,126,178,213,200,158,108,154,38,77,197,111,54,7,61,21,167,52,179,53,254,166,164,30,
+	103,9,146,27,124,25,47,69,92,244,35,95,91,92,51,147,11,18,61,125,54,21,20,69,
+	17,145,66,26,168,109,244,78,61,200,84,16,172,243,50,1,120,192,174,129,42,171,23,157,
+	166,33,129,199,249,60,36,33,156,205,81,28,195,92,203,235,103,243,10,119,123,112,85,119,
+	48,223,217,24,18,237,117,218,49,44,52,213,118,19,199,240,79,210,181,30,165,236,174,63,
+	46,141,217,15,131,243,93,54,173,142,164,152,237,234,247,234,69,195,18,150,100,120,48,5,
+	8,64,215,18,119,222,250,28,236,234,39,91,139,108,117,254,23,130,218,36,214,40,49,229,
+	141,166,10,65,128,212,243,117,206,52,113,201,237,150,215,60,147,50,187,63,89,133,83,21,
+	67,17,145,66,212,254,111,151,202,180,87,16,172,243,50,1,88,168,75,199,224,36,19,84,
+	254,197,245,161,10,227,135,180,229,41,27,141,100,110,100,104,225,228,148,11,6,241,153,229,
+	94,175,203,56,138,211,88,30,170,136,175,226,8,22,36,89,167,22,3,119,253,209,196,241,
+	86,81,193,230,124,202,166,154,133,89,123,192,237,22,128,165,74,108,64,219,194,225,110,175,
+	37,201,41,113,84,182,51,93,78,50,91,139,236,83,46,76,104,160,4,160,95,52,2,160,
+	55,148,104,13,146,59,76,199,122,149,144,26,199,88,203,39,27,253,19,31,97,69,68,100,
+	23,165,188,20,141,148,47,167,189,210,138,35,119,252,51,35,201,180,20,91,56,137,77,33,
+	11,228,58,46,230,48,230,91,94,255,120,62,163,146,107,165,57,157,55,19,221,65,77,232,
+	91,218,219,234,196,28,20,115,57,34,233,24,145,69,122,100,94,17,171,61,219,141,148,205,
+	32,142,177,176,86,182,203,223,236,140,18,126,181,186,120,22,219,196,159,148,193,105,46,127,
+	174,149,200,246,45,156,245,14,116,109,18,43,26,40,4,158,104,168,16,4,70,107,207,70,
+	73,17,143,61,102,121,205,179,18,61,217,85,115,162,139,136,20,178,135,66,160,104,164,198,
+	187,4,224,153,187,62,107,127,90,153,174,250,48,19,67,25,204,175,216,147,183,45,175,221,
+	147,111,168,230,74,57,206,224,37,139,77,145,182,113,51,189,147,182,164,11,170,63,57,45,
+	73,171,203,3,11,247,236,234,65,235,24,237,217,78,79,3,178,221,83,22,38,185,40,237,
+	242,55,107,82,66,147,119,239,38,128,239,90,194,14,237,118,43,162,228,145,205,177,49,89,
+	139,117,154,2,196,63,185,10,129,226,28,51,119,147,165,32,68,211,251,252,107,113,205,94,
+	137,15,167,167,41,134,34,34,59,41,229,85,216,158,10,129,117,94,37,0,51,24,180,235,
+	143,115,76,87,157,199,221,161,13,231,74,78,226,4,86,90,92,187,155,173,81,250,172,58,
+	155,23,44,110,214,185,28,200,221,228,135,184,250,126,84,116,174,223,4,213,110,112,225,63,
+	143,143,209,158,237,252,52,32,0,117,120,40,233,58,165,93,255,110,137,167,218,240,59,1,
+	120,134,235,159,155,60,178,143,80,207,133,207,213,20,32,254,201,85,8,60,81,81,73,167,
+	128,232,106,169,157,185,132,82,30,207,88,190,100,72,152,235,59,213,131,243,11,17,145,112,
+	200,113,229,156,63,188,148,14,181,193,171,4,96,247,93,243,212,228,114,172,233,170,119,176,
+	62,212,33,125,151,14,252,108,113,221,118,140,115,120,144,167,179,121,206,226,70,29,75,55,
+	198,133,190,2,95,157,36,207,117,70,225,182,144,199,197,106,223,118,167,219,230,153,244,73,
+	178,70,182,235,223,236,248,4,105,145,76,58,120,22,217,78,9,146,5,57,73,126,214,156,
+	144,44,178,7,23,205,119,7,188,38,137,181,211,59,241,66,134,139,35,114,136,29,247,106,
+	222,235,40,123,158,117,150,79,53,18,244,99,169,201,17,138,161,136,8,0,45,117,188,44,
+	162,142,206,228,172,243,42,1,120,194,174,127,14,162,188,201,138,51,120,37,244,65,157,195,
+	129,150,123,226,53,102,52,45,28,251,228,115,24,98,113,147,62,67,79,22,69,160,2,111,
+	230,36,211,132,113,125,246,223,245,71,135,36,125,207,163,197,173,180,205,115,73,126,96,221,
+	191,67,95,174,112,123,226,2,237,168,224,89,100,203,211,102,183,231,78,52,253,89,115,134,
+	121,100,43,240,188,75,167,2,74,0,250,71,9,64,69,58,78,122,115,136,130,16,101,171,
+	120,205,226,154,245,57,52,209,211,131,21,67,17,145,130,159,73,41,74,45,34,45,243,38,
+	1,152,89,184,243,101,95,211,85,159,99,91,4,194,186,153,11,56,213,98,75,198,122,124,
+	179,171,121,100,90,142,227,25,75,25,128,45,156,203,133,108,141,72,21,158,156,164,83,201,
+	97,133,255,136,83,231,162,95,93,122,223,70,73,250,232,103,123,240,221,118,239,110,219,213,
+	211,216,118,181,80,34,231,153,71,246,190,194,3,94,134,162,38,73,114,74,75,41,210,241,
+	145,193,61,10,66,212,61,106,121,216,153,132,19,129,244,165,182,98,40,34,2,46,140,34,
+	22,118,74,0,90,230,77,2,176,39,181,118,252,179,156,233,13,222,45,188,26,153,208,190,
+	193,222,204,180,180,102,67,70,82,55,237,207,59,136,55,44,77,253,177,130,67,120,62,82,
+	149,248,101,211,165,189,10,255,17,167,78,192,179,92,153,6,4,224,162,194,205,42,119,227,
+	197,24,61,123,239,54,27,160,191,9,192,118,116,243,224,83,205,34,187,47,23,186,244,169,
+	43,45,143,219,46,206,43,175,16,120,164,162,66,224,187,1,30,206,229,46,62,153,206,151,
+	22,215,60,58,81,174,47,139,19,21,67,17,17,148,238,218,93,93,133,192,42,111,18,128,
+	189,119,253,179,23,229,76,86,252,144,165,17,10,238,68,186,49,218,210,154,205,24,149,230,
+	109,205,61,249,128,178,22,214,91,64,79,198,68,172,18,79,50,29,115,177,35,53,118,253,
+	209,217,194,44,182,81,225,206,52,32,219,127,53,94,48,217,141,179,61,249,118,197,71,8,
+	247,55,1,120,166,39,159,90,114,100,203,88,158,249,199,62,77,1,226,167,188,112,252,212,
+	68,192,86,85,54,159,101,241,127,10,66,28,60,101,185,66,156,144,232,233,51,20,65,17,
+	17,148,238,82,68,210,186,148,247,194,65,187,254,121,164,233,138,207,71,44,188,43,56,140,
+	215,45,173,217,146,47,168,154,242,231,52,229,43,75,211,69,254,67,55,254,138,96,53,126,
+	217,180,138,31,188,235,143,12,246,142,209,222,237,222,216,109,45,185,181,196,101,222,204,210,
+	87,116,54,192,178,30,207,253,180,87,145,108,123,22,39,121,242,169,37,71,246,14,218,134,
+	176,22,73,114,161,72,75,173,73,113,153,34,45,133,156,65,75,5,33,14,190,100,129,197,
+	53,19,38,0,247,164,179,98,40,34,66,101,133,160,24,13,230,98,153,23,9,192,138,116,
+	218,245,135,217,20,94,203,24,21,185,0,111,230,116,110,177,212,66,162,61,159,154,182,142,
+	44,89,85,190,180,212,126,240,123,246,103,126,36,171,241,39,166,17,238,93,248,143,125,98,
+	180,119,187,153,186,185,186,196,206,90,222,180,0,172,89,100,48,209,246,30,125,234,14,165,
+	139,116,65,62,202,163,81,137,74,250,142,29,184,50,164,181,72,146,9,69,90,234,31,147,
+	101,127,135,37,210,91,84,217,124,85,214,228,166,146,68,202,54,139,183,197,97,111,154,37,
+	122,250,4,197,80,68,36,197,164,65,180,207,36,196,34,47,18,128,61,200,218,241,207,250,
+	52,48,89,241,243,112,244,119,178,201,224,46,78,182,116,29,183,15,175,167,176,65,178,24,
+	74,115,11,235,125,74,31,86,69,180,26,47,96,162,233,73,100,73,127,68,156,155,147,55,
+	100,241,98,9,9,169,210,30,125,187,194,29,129,186,122,30,219,174,37,148,196,77,165,75,
+	216,18,47,185,26,115,77,1,226,167,80,164,165,38,152,12,19,57,60,44,145,86,11,64,
+	127,93,170,249,12,227,227,37,203,195,6,12,72,244,228,241,46,205,119,47,34,18,38,74,
+	119,21,167,148,168,101,94,36,0,15,180,122,157,254,73,100,195,252,54,253,217,104,97,189,
+	227,184,223,246,123,63,98,58,173,202,14,159,115,60,155,34,92,145,191,49,89,214,114,87,
+	6,26,246,137,209,169,163,123,211,128,0,236,197,117,9,159,247,42,1,120,120,161,249,175,
+	252,76,0,214,42,58,209,180,139,18,71,246,70,58,186,248,153,154,2,196,95,161,72,75,
+	229,113,71,9,75,62,229,39,69,90,146,203,45,225,104,34,145,52,205,242,239,194,160,68,
+	79,54,46,220,171,72,68,36,166,148,238,82,68,82,230,69,2,176,251,174,127,118,54,61,
+	255,254,58,194,129,254,140,62,172,182,176,222,213,92,100,235,125,7,115,177,165,79,63,38,
+	210,233,63,76,235,78,118,225,110,36,185,180,136,205,222,237,222,52,32,219,221,156,112,228,
+	61,175,58,227,102,113,234,206,127,251,153,0,28,92,56,191,236,170,68,145,109,205,13,174,
+	126,166,166,0,241,215,134,112,20,243,85,94,77,240,236,44,206,9,79,164,55,170,178,249,
+	232,234,52,134,64,150,16,122,217,226,122,29,104,147,232,233,227,20,65,17,137,189,108,133,
+	160,152,50,10,129,85,94,36,0,91,239,250,167,89,2,112,66,100,59,168,110,247,3,135,
+	176,204,194,122,143,114,184,229,247,236,206,115,22,214,250,144,99,216,28,241,138,108,126,63,
+	185,200,12,9,205,99,180,127,187,219,125,51,155,23,201,220,237,217,210,158,125,187,179,10,
+	90,115,86,162,149,231,145,109,189,115,240,221,211,61,251,204,210,9,126,191,95,116,185,11,
+	128,58,0,251,107,97,88,10,122,22,247,176,173,200,51,163,217,63,60,197,223,198,82,85,
+	54,223,84,227,82,5,33,94,222,102,157,197,53,75,232,4,44,34,18,119,219,20,130,98,
+	212,151,195,50,247,19,128,185,212,216,245,71,151,88,95,105,78,224,64,22,39,93,43,139,
+	119,45,78,233,89,143,225,22,210,255,35,24,24,131,241,205,87,152,70,182,200,61,228,6,
+	49,218,191,221,158,192,161,27,151,237,246,156,119,119,164,90,178,47,0,157,61,154,205,188,
+	232,47,231,246,142,183,221,19,55,80,112,197,238,145,189,130,253,66,94,131,196,220,130,176,
+	20,52,143,155,104,203,3,252,204,44,38,242,6,71,208,51,60,133,135,69,145,28,128,56,
+	44,174,166,146,130,16,47,235,248,192,226,154,39,38,122,178,69,145,105,184,68,68,226,104,
+	179,66,80,204,38,133,192,250,101,172,251,23,233,59,85,167,186,201,138,113,104,106,50,137,
+	222,44,79,186,86,37,222,163,162,133,77,247,58,181,146,174,53,142,65,49,73,136,79,182,
+	86,9,149,0,116,214,255,237,214,162,178,180,135,223,111,251,244,27,93,125,137,109,215,66,
+	37,240,70,241,200,54,41,113,232,181,48,213,32,49,179,32,76,133,157,206,117,236,67,51,
+	246,224,84,62,87,156,197,154,106,54,199,61,145,72,120,201,226,122,173,217,51,209,211,234,
+	4,44,34,113,167,116,87,113,74,137,90,230,105,2,208,124,146,183,241,177,8,248,223,244,
+	98,101,210,181,218,240,66,210,117,110,162,103,210,117,38,210,47,44,131,72,165,109,146,201,
+	178,34,195,11,197,105,174,65,119,167,1,1,40,207,11,197,166,85,241,114,76,138,19,168,
+	136,159,9,192,10,12,244,240,19,139,70,54,131,33,84,112,249,19,53,5,136,223,148,152,
+	242,198,34,133,192,55,215,170,253,95,28,125,111,249,199,109,144,229,39,69,68,98,68,9,
+	192,226,52,154,179,101,238,39,0,11,77,185,80,215,100,181,109,76,141,73,200,255,224,72,
+	11,163,159,12,74,114,83,188,59,183,38,125,143,57,28,230,122,254,39,56,230,153,44,203,
+	41,252,71,156,90,0,186,61,13,8,192,129,156,91,228,23,37,211,195,239,87,145,227,241,
+	51,1,56,208,211,75,215,172,34,191,215,231,209,203,245,79,212,20,32,126,83,2,208,27,
+	243,21,2,159,212,80,251,191,120,202,231,125,139,107,30,155,232,201,86,30,14,190,33,34,
+	18,68,203,20,130,98,52,154,179,101,238,39,0,235,236,250,103,61,147,213,226,52,4,207,
+	143,244,179,144,164,254,31,221,74,92,86,133,183,146,78,61,186,130,62,166,73,177,168,49,
+	155,99,57,167,132,26,25,3,94,244,172,127,160,80,82,181,180,199,223,239,12,170,211,216,
+	151,200,54,161,134,167,29,128,129,66,59,125,93,238,141,72,237,17,51,106,129,233,141,255,
+	20,2,159,92,227,122,59,102,9,168,247,44,174,215,38,241,204,109,154,8,68,68,226,109,
+	137,66,160,136,164,202,253,4,96,229,93,255,52,75,0,198,235,6,252,104,78,35,63,201,
+	58,217,12,43,218,117,181,144,23,104,152,228,213,219,24,200,148,88,197,116,149,201,178,34,
+	9,192,210,177,10,139,23,99,184,85,46,52,25,181,215,209,61,128,83,125,139,237,9,244,
+	240,248,19,119,69,247,25,114,35,82,123,196,204,76,203,147,101,74,58,254,80,8,124,81,
+	157,11,20,132,184,250,193,242,44,225,71,38,122,82,163,0,138,72,188,41,221,85,220,98,
+	133,192,42,79,19,128,53,76,86,155,23,179,192,191,199,13,73,215,105,200,147,9,159,63,
+	41,113,151,136,34,174,98,100,204,34,186,218,90,37,196,135,25,99,253,228,77,10,231,112,
+	78,41,248,87,182,231,223,240,22,223,98,123,71,177,209,15,221,87,166,224,255,79,225,40,
+	79,62,239,55,29,34,125,150,207,95,10,130,7,254,84,8,124,113,189,133,249,206,36,178,
+	63,110,31,90,92,179,111,162,39,219,199,106,56,23,17,145,226,22,42,4,197,40,1,104,
+	153,251,201,144,66,99,100,153,117,90,93,25,187,208,63,192,144,164,235,156,200,128,221,158,
+	171,193,99,73,95,247,34,143,199,46,158,134,213,101,241,74,0,206,242,104,24,200,71,11,
+	166,164,246,190,125,101,21,223,98,235,253,39,111,255,9,173,206,255,60,249,180,149,204,210,
+	33,210,119,74,77,121,113,18,173,147,70,63,212,86,251,191,120,27,110,113,189,3,139,246,
+	226,216,225,80,69,80,68,98,108,166,66,160,136,164,202,211,22,128,102,9,192,173,49,12,
+	254,133,140,72,186,206,211,212,46,246,204,19,84,79,242,154,113,177,28,85,219,172,33,65,
+	145,94,116,25,177,10,139,225,81,231,182,106,60,1,248,209,2,48,78,182,71,247,25,211,
+	198,212,206,209,20,32,65,160,4,160,251,254,80,8,124,113,21,229,21,132,56,27,109,177,
+	7,91,105,122,39,122,186,143,34,40,34,49,54,93,33,40,98,33,107,20,4,171,220,79,
+	0,22,58,193,51,155,30,52,63,134,193,207,227,228,164,227,244,85,231,217,34,127,31,197,
+	160,36,175,88,204,113,108,142,97,52,205,70,18,95,95,248,143,204,152,5,198,171,137,28,
+	6,112,44,113,27,97,209,107,165,129,126,158,13,126,174,41,64,130,224,15,133,192,117,234,
+	102,237,135,170,156,167,32,196,91,158,229,78,192,9,71,1,236,157,116,46,60,17,145,232,
+	90,169,121,128,139,152,166,16,88,231,126,2,112,211,174,127,154,101,94,182,197,50,252,107,
+	56,190,104,114,42,129,163,57,125,231,191,115,120,58,201,218,6,131,89,20,203,88,154,181,
+	0,92,95,66,141,140,5,239,38,114,120,138,170,106,1,232,170,108,114,120,38,130,53,71,
+	74,246,187,166,1,113,221,247,10,129,15,46,45,60,64,140,196,147,213,78,192,71,38,186,
+	88,201,165,155,34,40,34,49,54,89,33,40,100,138,66,96,157,251,9,192,13,187,254,105,
+	214,159,172,66,76,55,192,68,11,55,193,119,12,175,6,247,154,206,164,12,240,48,95,196,
+	52,146,102,227,65,23,185,130,142,219,160,169,222,165,113,106,243,176,90,0,186,170,52,143,
+	37,253,9,8,99,205,145,146,109,97,180,130,224,114,132,149,0,244,94,133,88,142,84,34,
+	197,140,178,216,99,171,70,226,92,159,58,1,139,72,156,169,167,142,174,90,82,228,126,2,
+	176,80,227,171,229,38,171,85,143,237,38,120,51,105,147,158,92,238,5,96,79,206,77,178,
+	230,120,110,138,109,28,91,152,44,43,210,70,58,110,211,166,123,53,13,8,192,96,250,233,
+	71,213,69,135,115,154,103,159,181,146,127,21,240,64,248,74,33,112,213,24,181,177,244,193,
+	249,49,62,233,75,69,68,71,201,217,202,40,139,107,38,236,4,124,152,42,134,136,196,152,
+	82,94,133,41,29,106,131,167,9,64,179,174,234,113,62,23,188,130,241,73,214,24,204,62,
+	192,35,73,134,175,91,195,137,108,137,109,20,205,18,128,69,198,73,141,91,15,105,131,223,
+	61,252,180,91,245,163,234,162,255,243,112,10,27,77,1,18,20,95,42,4,174,82,130,213,
+	123,101,184,82,65,176,97,43,115,162,250,213,172,246,89,73,152,0,236,66,77,85,14,17,
+	137,45,165,188,118,217,204,68,5,193,186,192,36,0,107,197,186,206,158,152,100,36,192,12,
+	158,164,63,135,36,121,159,107,99,60,255,117,22,205,76,150,206,40,252,71,252,134,72,244,
+	242,14,81,25,253,168,70,36,186,58,173,8,138,105,106,139,233,42,37,0,189,55,152,186,
+	10,130,101,249,133,6,130,142,28,171,9,192,246,137,154,9,148,162,151,170,135,136,196,248,
+	252,112,169,130,80,96,124,140,219,64,165,192,253,4,224,252,93,255,52,75,0,54,137,117,
+	230,96,38,215,38,89,163,51,111,38,89,99,52,67,98,28,193,142,148,53,89,90,164,5,
+	224,194,216,5,71,77,196,69,181,38,204,62,83,8,92,60,67,249,67,65,240,88,38,87,
+	43,8,54,92,205,219,209,189,71,254,31,83,45,94,172,28,144,232,105,141,2,40,34,241,
+	101,88,30,69,33,250,190,81,8,236,112,63,1,88,168,237,194,2,147,213,178,104,29,235,
+	13,241,12,95,39,89,163,188,233,210,13,156,19,235,30,123,7,152,46,45,146,0,252,43,
+	118,193,81,42,71,84,107,194,236,117,133,192,197,216,170,171,187,215,78,160,185,130,96,217,
+	109,60,66,14,229,162,251,5,173,182,1,236,153,232,201,67,61,28,22,67,68,36,104,148,
+	246,218,97,164,66,96,135,251,9,192,66,189,82,39,153,158,105,183,139,245,134,48,56,139,
+	213,105,188,254,214,162,221,92,99,199,44,1,184,140,197,187,254,216,198,63,177,11,142,151,
+	211,128,72,52,104,10,144,32,249,153,201,10,130,75,94,83,8,60,150,145,180,195,131,236,
+	114,7,119,18,241,49,114,172,14,114,154,48,1,88,155,189,84,73,68,36,182,148,0,220,
+	110,45,63,43,8,118,184,159,0,156,181,235,159,171,11,247,7,222,77,183,152,111,138,185,
+	92,158,242,107,199,243,104,172,99,87,154,253,77,150,254,80,248,143,169,108,140,93,120,188,
+	157,6,68,162,96,130,218,69,5,138,210,84,238,248,69,169,85,207,245,82,202,198,178,7,
+	184,29,128,218,81,254,146,163,45,158,148,181,77,28,134,30,170,38,34,18,91,255,198,176,
+	89,75,34,159,177,85,65,176,195,253,4,224,127,228,239,250,195,108,130,150,67,98,191,49,
+	94,73,177,43,191,193,197,228,197,58,114,135,82,197,100,233,247,133,255,136,103,42,76,221,
+	57,69,53,38,204,94,143,249,79,188,123,7,93,241,218,21,10,129,69,15,114,93,193,191,
+	34,157,0,220,88,244,38,109,137,50,56,40,209,211,251,171,162,136,72,140,189,167,16,0,
+	239,43,4,246,184,159,0,220,92,120,132,95,179,4,96,187,104,159,227,88,114,73,74,9,
+	236,55,248,37,230,113,27,96,186,180,72,2,240,143,88,6,72,233,28,81,141,9,179,249,
+	73,7,137,21,251,54,242,174,130,224,177,86,154,182,193,162,135,10,117,149,174,25,237,175,
+	106,181,19,240,193,137,158,84,2,80,68,226,108,184,66,192,70,77,150,103,87,41,15,62,
+	99,220,174,127,154,117,208,206,160,87,236,55,199,68,158,182,253,154,13,220,24,243,168,101,
+	115,180,201,210,53,252,89,248,207,239,98,25,34,165,115,68,53,38,236,233,0,113,218,11,
+	26,29,213,115,87,122,114,214,25,126,15,115,77,161,191,34,126,119,220,234,105,89,194,81,
+	0,235,210,84,213,69,68,98,235,31,13,101,194,231,172,83,69,176,199,139,83,177,31,119,
+	253,115,148,233,192,82,3,181,61,184,189,240,132,21,150,60,192,188,152,199,236,56,114,77,
+	150,126,91,184,239,220,18,126,139,101,136,52,13,136,216,161,41,64,130,103,36,63,41,8,
+	142,218,202,195,10,130,199,170,115,138,130,96,193,189,92,93,228,239,90,209,254,186,127,176,
+	214,210,122,205,105,148,232,105,181,1,20,145,56,123,73,17,80,37,176,203,227,4,224,82,
+	254,50,89,177,143,233,72,110,241,176,138,27,108,173,63,143,7,99,31,179,75,77,151,22,
+	25,28,225,203,194,35,82,198,136,166,1,17,59,52,5,72,48,147,2,226,164,55,153,173,
+	32,120,236,60,202,43,8,73,143,214,215,237,214,173,163,73,180,191,114,94,225,203,4,83,
+	7,38,122,82,211,128,136,72,156,189,22,243,9,48,230,243,133,42,129,93,94,36,0,39,
+	179,114,215,31,223,154,172,152,205,113,218,34,188,106,58,82,98,113,119,179,33,230,241,234,
+	198,62,38,75,55,241,113,225,63,63,143,109,152,212,165,83,84,91,194,237,19,211,251,103,
+	98,79,190,58,85,123,46,155,139,20,132,36,242,56,143,7,118,123,182,117,212,191,246,15,
+	22,215,59,40,209,147,106,1,40,34,113,182,164,232,165,110,236,188,172,105,242,236,243,34,
+	1,104,240,205,174,63,204,71,50,191,64,91,132,124,110,183,188,238,92,94,142,125,188,46,
+	55,93,250,69,225,174,37,121,124,21,219,48,41,165,35,170,45,225,102,112,143,130,224,152,
+	225,182,238,180,137,19,6,81,71,65,48,181,133,19,121,126,183,103,43,81,55,234,95,124,
+	140,197,245,246,77,244,100,203,168,79,146,34,34,98,234,169,24,127,247,173,9,142,154,146,
+	148,55,195,49,127,184,235,159,223,176,220,100,197,78,28,160,109,194,112,203,83,213,222,199,
+	230,152,199,170,29,131,76,151,23,153,228,113,180,105,229,139,54,165,116,68,181,37,236,134,
+	198,116,18,35,231,109,228,58,5,193,115,231,42,4,166,54,112,52,195,18,60,223,138,140,
+	168,127,245,159,217,98,105,189,86,137,6,10,202,160,187,42,143,136,196,216,40,211,89,86,
+	163,237,29,230,168,2,216,231,77,2,240,211,93,199,246,173,124,96,186,234,229,218,38,24,
+	22,219,0,206,227,197,216,199,234,255,76,171,240,138,162,173,162,227,220,92,82,211,128,136,
+	85,154,2,36,184,135,134,139,217,166,48,56,224,94,213,113,207,181,84,154,198,212,42,14,
+	45,97,28,163,214,209,255,242,27,45,222,117,202,160,91,162,167,213,9,88,68,226,237,145,
+	216,126,243,255,105,227,167,194,155,4,224,106,70,239,250,227,109,211,85,143,162,157,182,10,
+	31,243,171,133,181,238,143,125,251,191,46,244,55,93,254,66,225,17,18,87,243,126,172,83,
+	7,154,6,68,172,249,77,83,128,4,214,63,60,163,32,164,109,166,230,206,242,193,217,209,
+	111,199,150,134,5,28,200,216,18,150,181,138,67,0,172,118,2,78,56,230,179,18,128,34,
+	18,111,195,153,25,203,239,253,165,229,78,147,82,68,41,143,62,231,195,93,255,252,142,133,
+	38,43,102,242,127,218,42,24,220,159,116,157,21,177,159,245,58,131,135,77,175,40,182,241,
+	116,225,63,223,101,99,172,195,165,110,157,162,154,18,126,55,155,30,64,197,138,203,217,164,
+	32,120,44,139,83,83,121,89,54,125,184,149,39,121,131,135,185,140,246,81,141,206,68,246,
+	53,153,226,39,22,9,64,171,211,128,236,157,232,201,14,84,208,46,38,34,49,182,205,198,
+	4,2,209,97,112,139,54,125,106,188,74,0,190,189,171,41,86,94,146,158,152,253,233,170,
+	237,194,135,204,75,178,198,203,177,159,255,247,180,36,35,70,126,196,236,194,127,198,61,95,
+	170,180,142,168,166,132,223,26,174,86,16,210,242,30,35,20,4,207,29,69,109,187,47,105,
+	192,243,44,229,11,238,224,34,78,230,74,30,229,15,254,229,18,178,163,22,155,111,233,97,
+	58,134,81,235,56,84,144,177,22,27,158,119,75,116,219,55,139,14,218,197,68,36,214,222,
+	226,207,216,125,231,247,25,175,13,159,26,175,18,128,171,24,190,235,143,167,216,106,178,106,
+	6,15,169,167,8,219,146,244,244,202,143,125,79,176,170,60,144,100,141,199,10,255,49,33,
+	198,3,164,238,136,128,136,106,74,20,78,242,94,85,16,82,54,91,83,81,248,226,76,123,
+	171,103,112,61,211,56,155,202,197,158,111,204,227,76,102,191,40,69,230,117,14,103,149,201,
+	242,242,180,137,67,5,89,193,12,75,235,85,163,69,162,167,59,107,23,19,145,88,203,231,
+	182,152,125,227,60,110,213,102,79,85,41,207,62,105,200,174,127,46,96,168,233,170,7,164,
+	214,87,36,98,158,55,237,165,244,121,76,59,251,239,114,63,53,77,151,143,44,218,165,228,
+	254,216,87,168,89,172,212,94,37,73,173,100,150,130,16,112,23,49,69,65,72,201,54,78,
+	214,239,160,15,234,113,152,157,213,203,240,22,247,82,182,132,165,77,249,54,58,231,136,143,
+	115,122,146,9,112,187,146,21,143,74,98,245,206,83,194,78,192,74,0,138,72,220,125,196,
+	200,88,125,223,103,153,164,141,158,42,239,18,128,99,10,111,166,199,146,172,252,32,85,98,
+	191,105,150,242,155,201,210,209,49,143,206,145,156,149,100,141,155,10,255,49,173,112,11,212,
+	152,50,76,43,148,200,118,154,2,36,248,214,51,48,230,35,154,166,234,150,18,39,90,16,
+	55,157,66,166,157,213,159,228,4,211,229,101,120,133,126,225,143,202,54,206,225,178,164,191,
+	183,251,198,231,208,99,141,18,128,34,34,9,93,98,218,197,50,90,150,199,174,197,163,163,
+	74,121,248,89,133,102,100,24,207,40,211,85,107,242,144,182,13,249,10,65,9,170,243,66,
+	146,110,226,31,23,237,241,251,160,130,137,186,118,138,106,73,84,252,173,145,0,83,240,85,
+	210,113,35,196,29,3,236,93,193,156,109,225,212,245,13,154,133,59,38,171,233,203,11,22,
+	214,219,47,46,149,196,106,2,48,225,60,192,173,53,13,136,136,196,222,228,164,45,172,162,
+	227,58,150,107,131,167,206,203,4,224,75,44,218,245,199,77,73,86,62,147,163,99,191,113,
+	204,110,12,199,123,148,196,33,73,198,19,207,47,58,45,208,124,94,215,174,142,82,59,162,
+	90,18,29,79,243,168,130,96,203,68,78,208,141,32,95,52,161,147,245,149,171,88,156,202,
+	176,50,247,133,57,38,51,217,143,47,45,172,151,145,56,223,21,69,86,27,159,239,69,249,
+	221,159,204,140,238,20,209,34,34,150,221,17,147,97,124,70,39,153,81,86,146,240,50,1,
+	184,145,135,119,253,241,35,159,36,89,125,8,181,98,190,113,242,3,178,225,130,230,82,142,
+	73,178,198,43,252,85,248,207,219,217,172,93,29,165,118,68,181,36,74,174,212,141,13,27,
+	230,113,184,70,255,243,201,0,59,119,44,175,165,170,197,53,143,163,99,88,35,50,146,110,
+	22,199,46,106,78,141,184,84,147,149,252,107,105,189,210,236,153,232,105,117,2,22,17,89,
+	199,25,49,184,213,185,150,51,117,67,55,61,222,230,145,158,97,233,174,63,110,78,178,237,
+	106,242,74,172,211,92,106,1,152,88,143,164,221,195,151,115,93,225,63,39,241,138,118,116,
+	64,211,128,136,149,107,48,77,1,18,158,3,196,57,73,198,210,144,93,7,133,67,153,171,
+	48,248,196,214,4,32,39,88,94,51,131,65,225,140,199,211,28,198,10,139,235,238,23,167,
+	138,98,181,19,112,194,198,126,74,0,138,136,192,247,60,30,249,239,120,181,197,251,69,82,
+	34,111,103,23,91,207,227,252,223,142,63,254,226,53,6,39,57,107,188,61,214,51,60,43,
+	1,184,187,58,12,165,116,146,117,110,96,89,225,63,175,100,155,118,244,130,10,245,27,135,
+	40,12,98,122,5,166,41,64,194,99,51,199,240,157,189,174,111,165,104,100,185,133,85,16,
+	109,98,35,11,216,100,239,69,27,232,199,100,85,23,159,84,176,147,196,106,79,99,27,111,
+	125,52,215,135,45,26,219,184,202,214,197,217,1,241,58,252,28,111,105,189,189,18,61,169,
+	4,160,136,8,192,141,28,146,184,161,116,68,124,194,243,218,200,233,202,242,248,243,254,199,
+	185,52,216,241,199,181,28,149,228,82,228,38,126,97,68,108,55,142,18,128,197,149,227,125,
+	234,36,89,231,39,94,44,252,231,183,150,198,217,137,139,9,74,0,74,146,26,34,97,178,
+	154,67,24,97,117,148,176,198,220,200,0,114,67,255,165,243,24,197,67,214,127,216,87,210,
+	143,31,85,85,124,115,16,101,172,175,220,206,214,91,183,34,155,45,97,138,197,10,6,50,
+	210,198,250,165,56,34,78,85,37,173,22,128,109,168,192,122,237,110,34,18,123,27,25,192,
+	120,42,69,244,219,205,102,176,154,42,164,207,235,62,182,27,10,207,206,176,148,27,147,22,
+	239,13,155,39,132,81,162,49,0,139,127,231,215,146,94,233,110,230,188,194,113,219,202,101,
+	218,201,11,81,122,71,84,67,162,101,57,135,240,153,149,21,7,242,15,231,68,32,253,7,
+	153,244,226,11,94,176,118,255,114,62,7,48,86,213,196,71,251,218,89,185,142,173,183,206,
+	8,215,72,209,127,210,213,86,250,15,186,38,153,239,44,166,135,159,189,18,221,2,215,52,
+	32,34,34,219,77,229,188,136,126,179,45,12,180,60,132,134,152,240,62,143,244,26,191,236,
+	250,227,249,164,55,230,115,248,146,122,218,78,2,220,111,161,123,200,45,69,167,255,184,159,
+	127,20,183,20,206,175,69,53,68,194,98,3,253,121,45,217,74,71,240,22,21,34,245,181,
+	207,226,89,43,39,193,221,117,12,240,153,173,174,153,101,109,190,121,185,240,196,225,109,186,
+	219,30,97,245,136,120,85,149,101,22,7,234,172,156,184,163,184,58,1,139,136,236,56,226,
+	60,26,201,239,117,105,225,44,146,164,206,251,4,160,193,85,187,154,110,230,115,78,210,209,
+	124,234,241,65,196,46,92,172,82,11,192,194,46,225,234,164,235,124,95,120,162,105,152,202,
+	221,218,197,139,208,52,32,98,70,83,128,132,211,86,6,115,159,89,151,136,10,188,64,102,
+	228,190,246,89,244,49,95,97,44,251,51,91,213,195,103,29,236,172,188,216,230,155,47,12,
+	71,12,182,113,5,39,165,208,65,181,111,220,42,203,36,139,235,237,149,118,77,19,17,137,
+	180,171,35,56,134,218,35,60,167,13,235,12,63,242,72,99,10,207,202,58,49,105,55,96,
+	232,202,71,182,239,11,71,129,198,0,220,229,84,11,183,50,86,115,90,225,164,169,193,185,
+	118,199,138,143,65,149,250,77,65,144,18,105,10,144,240,238,217,55,208,175,232,236,71,133,
+	157,98,179,107,101,88,92,83,242,162,124,238,225,32,150,170,106,248,172,156,189,78,172,246,
+	242,181,203,89,27,134,24,44,161,87,74,109,49,234,210,49,110,213,197,234,92,61,9,123,
+	251,182,213,238,38,34,82,32,143,19,249,51,82,223,232,115,179,147,62,177,199,159,134,100,
+	87,21,190,109,251,24,223,38,125,193,33,188,227,249,124,37,254,83,11,192,29,142,231,101,
+	11,223,248,194,162,23,15,207,241,189,118,240,221,40,1,40,170,29,209,244,41,29,24,157,
+	120,209,225,17,253,202,7,80,62,241,130,69,244,225,38,205,255,30,0,213,236,173,254,189,
+	173,148,222,23,97,136,192,47,116,225,187,148,94,217,55,126,179,189,89,77,0,38,108,1,
+	216,38,166,179,227,137,136,36,210,137,173,17,251,70,109,180,81,157,226,79,30,105,37,23,
+	238,250,35,159,193,22,250,37,30,205,235,177,75,1,170,5,224,118,253,120,211,66,247,181,
+	39,120,171,240,159,83,117,159,32,161,169,10,129,168,118,68,212,124,122,113,123,162,180,87,
+	227,136,126,225,210,212,79,244,244,23,180,231,27,85,135,64,176,153,0,220,204,87,54,214,
+	254,40,248,223,255,73,14,176,56,176,221,238,78,136,95,117,73,171,5,96,14,117,181,195,
+	137,136,0,77,248,148,239,232,18,169,239,116,56,127,242,162,221,179,10,73,204,175,134,100,
+	31,50,116,215,31,115,25,68,158,133,115,161,247,41,19,171,141,163,222,120,0,125,25,70,
+	118,210,181,126,42,58,66,224,102,78,100,157,98,151,192,95,10,129,168,118,68,86,30,119,
+	208,97,247,153,70,243,34,251,133,119,203,118,206,97,32,135,179,68,85,33,32,108,159,180,
+	221,111,249,204,103,26,31,6,251,187,175,225,4,46,97,115,138,175,110,204,129,241,171,46,
+	86,199,0,108,74,197,68,79,171,19,176,136,72,38,151,243,119,36,39,145,42,197,153,76,
+	100,160,54,177,19,161,244,203,69,204,223,245,199,215,220,101,225,37,253,24,26,171,20,160,
+	17,200,13,231,173,1,150,210,190,139,56,142,45,133,159,184,158,223,181,115,39,52,81,33,
+	144,18,253,173,16,68,98,31,239,197,113,44,40,252,212,180,136,126,213,13,204,43,252,103,
+	62,119,210,134,97,170,2,1,98,187,3,210,120,222,181,184,230,117,193,238,221,52,129,78,
+	150,191,74,34,131,99,56,215,27,203,75,30,200,180,216,25,240,158,137,158,86,2,80,68,
+	226,174,29,99,120,36,194,179,167,214,226,93,70,208,64,27,58,61,254,157,96,44,227,228,
+	194,205,18,238,228,115,11,47,58,138,207,201,137,205,198,209,24,128,167,243,22,165,147,174,
+	181,137,227,139,94,237,126,202,99,218,181,75,188,98,206,143,119,0,42,82,133,42,212,161,
+	41,77,105,73,75,154,210,148,58,84,161,74,76,231,26,47,242,131,163,73,115,162,179,159,
+	87,41,252,231,71,17,253,154,95,20,189,241,83,138,28,54,106,227,7,74,10,227,48,94,
+	196,116,11,107,61,30,228,246,127,6,143,179,31,51,211,120,135,12,78,141,103,133,177,218,
+	6,112,143,68,79,106,124,40,17,137,179,108,110,231,55,246,137,252,247,60,146,191,57,71,
+	163,190,166,195,207,97,245,190,227,46,110,219,117,237,121,50,99,45,28,189,123,242,29,135,
+	23,158,67,36,194,226,62,6,224,117,220,107,225,123,26,12,102,108,225,39,102,51,88,189,
+	167,77,172,163,114,244,190,84,5,114,201,37,135,220,34,143,42,228,146,75,86,193,77,131,
+	28,75,105,243,124,86,3,176,154,173,172,42,241,177,33,138,53,99,173,118,142,136,232,201,
+	251,148,43,252,196,112,38,71,240,218,56,143,123,139,63,117,25,91,53,250,107,160,164,208,
+	72,111,5,71,51,50,201,188,213,35,184,42,184,223,121,5,103,240,113,218,251,112,211,120,
+	86,152,41,28,96,105,189,230,137,158,108,167,29,78,68,98,171,61,111,198,230,87,48,135,
+	33,156,200,105,69,187,129,136,117,254,206,171,241,127,28,180,107,148,147,149,28,201,143,212,
+	178,80,191,127,164,63,127,196,96,227,196,57,1,88,138,255,113,153,165,53,111,44,218,203,
+	102,61,71,91,236,67,18,87,115,195,126,120,40,67,53,234,80,151,58,52,165,46,117,168,
+	75,125,7,115,154,165,10,154,78,85,49,93,107,51,43,88,192,66,22,48,139,133,44,96,
+	33,115,194,159,63,155,171,157,35,18,246,229,227,162,233,63,216,202,169,140,78,60,106,86,
+	136,221,198,175,187,63,121,53,27,118,221,88,20,223,109,73,229,69,147,233,198,7,38,163,
+	151,63,194,53,193,29,215,114,28,39,50,39,237,119,57,35,174,21,198,234,52,32,45,19,
+	61,169,22,128,34,18,87,167,242,44,229,99,245,141,123,242,59,167,240,165,54,125,42,252,
+	77,0,230,49,136,241,187,250,113,255,203,81,140,178,80,123,27,49,150,51,10,207,34,18,
+	81,102,39,184,209,110,226,86,158,87,57,222,210,154,207,115,95,209,176,156,197,159,218,173,
+	147,156,95,135,44,1,152,75,11,90,208,146,134,212,161,62,117,2,49,1,84,25,234,236,
+	214,66,101,25,11,153,203,34,102,51,157,233,76,47,104,73,24,193,43,47,9,178,182,124,
+	150,40,211,55,129,94,12,139,208,160,41,91,185,129,135,19,47,186,149,229,60,174,138,16,
+	16,107,82,123,217,60,246,227,12,238,76,112,75,120,60,215,240,93,80,191,173,193,19,92,
+	147,90,210,179,136,154,28,23,223,19,20,107,18,38,0,171,81,139,197,218,233,68,36,102,
+	202,241,4,103,197,240,123,87,231,83,238,224,238,184,15,110,149,138,44,159,63,127,49,71,
+	49,118,87,206,239,23,78,100,184,133,66,149,231,29,246,226,214,136,111,241,21,38,203,86,
+	70,248,123,215,225,35,186,90,90,115,56,23,20,125,226,190,180,6,221,142,135,41,193,47,
+	98,54,245,105,74,59,218,210,148,166,52,9,73,123,215,234,84,47,50,48,249,74,102,49,
+	139,73,76,100,22,83,195,48,41,245,20,237,28,161,87,139,79,201,77,188,232,103,218,112,
+	30,131,216,139,178,161,254,138,249,252,203,231,60,198,140,146,87,249,31,255,242,137,42,67,
+	32,172,74,245,133,91,25,194,91,28,193,209,116,164,62,21,89,204,124,70,242,49,227,130,
+	123,251,115,25,167,243,153,35,239,116,73,241,54,188,241,97,53,1,216,156,204,68,55,201,
+	219,40,1,40,34,49,211,136,161,116,139,233,119,207,228,78,14,226,36,253,242,219,21,132,
+	43,235,147,121,163,232,159,175,89,156,226,226,19,78,73,245,246,114,40,156,199,179,37,46,
+	235,197,200,136,126,235,14,124,108,177,157,202,23,28,93,244,86,251,112,6,234,46,64,82,
+	39,241,102,16,139,85,153,246,116,160,13,45,104,65,195,200,117,113,55,152,195,116,166,51,
+	153,63,248,51,168,191,90,39,242,142,118,143,80,43,199,72,246,85,24,128,13,28,196,120,
+	133,33,16,214,197,100,126,165,239,57,137,249,142,188,83,121,230,4,162,161,187,79,23,37,
+	27,44,222,162,104,198,172,221,159,188,136,167,181,203,249,102,4,71,42,8,174,249,148,190,
+	10,130,36,112,52,175,148,116,227,55,54,230,48,128,95,84,21,236,200,10,64,25,222,100,
+	15,174,47,252,103,69,158,177,148,0,232,199,79,12,96,98,100,55,206,112,30,41,225,54,
+	240,156,224,118,129,73,211,233,60,99,241,214,247,247,28,87,52,253,55,134,83,148,254,179,
+	96,20,70,112,242,107,85,104,71,103,58,211,153,214,145,158,217,58,131,70,52,162,87,193,
+	95,11,153,192,4,38,48,49,209,5,140,95,12,190,215,206,17,114,67,148,254,43,80,158,
+	225,116,100,185,2,17,0,171,99,144,0,220,202,93,220,237,216,176,132,231,196,55,253,183,
+	253,102,89,75,75,107,182,72,116,252,212,40,128,34,18,31,25,220,197,13,154,13,151,134,
+	252,192,69,188,160,10,97,93,86,32,74,113,35,13,56,121,215,159,207,81,158,135,45,213,
+	231,54,140,231,42,158,9,105,240,203,144,67,46,57,228,80,129,108,42,145,69,206,206,41,
+	8,160,60,101,152,88,194,48,216,95,113,12,121,172,97,29,171,88,205,234,136,204,73,90,
+	134,199,56,207,226,186,227,232,87,244,91,79,230,104,54,105,135,182,96,33,127,179,151,191,
+	69,168,91,144,244,235,156,100,166,199,168,170,67,223,130,91,185,171,152,88,144,12,156,226,
+	247,160,246,127,176,64,59,71,168,157,195,41,10,194,78,13,120,157,35,53,31,124,0,44,
+	162,110,196,191,225,100,78,75,52,31,77,202,103,229,151,199,187,194,252,103,49,1,216,50,
+	209,216,239,154,7,88,68,226,162,12,47,113,146,194,0,64,54,207,179,39,87,168,33,144,
+	245,83,141,32,48,56,147,218,28,178,235,137,71,216,202,227,150,82,128,229,120,154,67,57,
+	59,208,183,250,179,169,71,125,106,82,155,26,212,40,248,111,46,185,105,140,196,116,54,103,
+	23,249,123,11,171,89,197,82,150,178,132,197,44,101,41,11,89,200,28,54,134,168,42,54,
+	98,152,197,145,255,224,7,142,44,58,231,234,2,14,55,29,50,81,10,251,220,159,4,96,
+	21,246,163,7,221,233,20,147,30,97,86,228,210,157,238,0,172,227,119,198,48,150,113,126,
+	141,239,249,185,182,70,168,237,197,99,10,66,17,135,115,13,15,40,12,190,155,79,167,8,
+	127,59,131,39,184,222,209,83,173,129,52,142,119,133,249,215,226,122,45,18,61,217,76,59,
+	156,136,196,66,53,62,96,127,133,161,144,75,169,199,169,161,74,125,248,40,43,32,229,216,
+	194,177,124,71,135,93,79,60,201,22,158,177,216,41,176,63,93,56,149,209,129,9,106,69,
+	154,209,140,102,52,160,33,245,168,79,109,215,63,49,155,26,212,72,112,58,180,156,249,204,
+	97,30,115,153,197,76,102,6,56,71,214,135,55,45,247,122,25,69,63,214,23,126,98,25,
+	135,50,91,59,179,101,239,113,157,151,31,87,151,238,244,160,59,29,35,221,201,55,253,95,
+	141,253,11,142,228,179,24,203,24,198,122,61,184,193,123,218,6,33,86,150,119,226,59,109,
+	64,137,238,102,148,70,2,244,221,188,72,127,183,51,248,198,209,119,44,205,109,113,175,48,
+	86,79,230,18,182,19,172,71,182,3,179,48,139,136,4,91,19,190,162,185,194,80,204,113,
+	212,164,31,171,21,136,228,178,2,83,146,53,28,198,104,90,239,122,98,8,27,120,137,210,
+	150,94,92,159,145,60,206,205,69,211,66,158,134,177,57,237,104,77,75,154,211,140,90,129,
+	9,106,53,170,21,105,236,181,130,153,204,100,6,19,153,194,100,54,7,166,18,222,204,45,
+	150,147,67,95,114,76,209,244,254,42,14,141,240,64,144,110,248,149,159,216,199,237,15,201,
+	164,53,221,233,193,254,113,111,206,96,91,83,154,114,42,219,71,10,28,195,88,126,102,171,
+	251,31,58,142,223,21,249,16,187,69,99,95,37,60,180,188,64,23,47,118,31,49,49,63,
+	178,223,236,45,46,74,125,150,227,18,156,111,177,255,107,132,253,103,113,189,150,137,79,60,
+	26,49,93,59,157,136,68,90,27,190,162,190,194,144,192,254,124,203,225,44,81,32,146,9,
+	214,192,145,117,249,174,104,62,251,16,222,167,178,141,211,134,115,249,218,195,226,54,166,35,
+	123,209,150,182,180,36,59,116,155,62,143,89,76,100,50,127,243,59,211,124,236,52,223,132,
+	87,109,180,97,30,206,201,69,19,151,235,232,205,79,218,145,109,42,54,243,182,179,63,41,
+	29,232,195,65,236,71,37,197,217,17,107,248,145,81,124,201,159,110,14,104,166,25,128,195,
+	108,47,126,181,120,175,44,126,110,230,110,5,193,87,3,121,55,130,223,106,5,23,48,212,
+	241,119,173,196,244,0,221,65,246,201,190,140,179,180,94,62,21,18,13,252,124,88,162,161,
+	1,197,19,154,5,216,77,154,5,88,118,232,204,231,212,80,24,74,52,139,222,65,154,99,
+	49,152,130,54,115,76,67,190,167,81,225,39,186,240,41,53,45,191,220,224,37,174,118,252,
+	150,108,209,128,181,160,19,29,233,68,39,170,70,166,26,172,227,79,126,227,119,126,99,34,
+	219,60,253,228,115,121,152,138,150,215,126,132,171,138,38,65,214,209,55,178,19,34,187,41,
+	155,169,206,55,204,171,78,79,122,113,36,245,20,95,87,44,101,52,223,48,194,141,185,58,
+	102,209,90,237,164,66,43,147,159,74,152,45,74,96,19,29,152,170,48,248,104,47,254,140,
+	220,119,250,130,179,92,153,52,233,110,110,84,133,169,99,57,180,237,152,180,251,147,23,240,
+	172,98,232,19,37,0,221,164,4,160,108,183,47,95,216,104,27,21,79,179,57,200,114,99,
+	242,152,10,222,212,209,77,24,73,147,194,79,52,226,195,194,131,3,38,181,136,107,121,195,
+	241,182,50,21,232,72,103,186,115,80,196,147,238,235,249,131,9,140,97,52,75,93,255,172,
+	90,188,96,227,120,102,112,125,241,17,221,87,115,132,197,91,197,82,220,0,231,90,47,100,
+	210,129,94,244,99,95,141,241,231,137,73,124,194,55,124,239,228,64,71,199,242,129,226,26,
+	90,231,48,68,65,208,101,83,96,149,101,29,153,17,250,62,27,185,134,167,93,105,142,93,
+	151,233,148,87,133,201,96,157,197,48,28,197,39,187,63,249,128,183,99,28,75,33,74,0,
+	234,72,38,110,83,250,207,154,255,232,169,20,160,249,145,54,120,234,243,13,173,10,63,81,
+	129,151,25,96,235,45,198,114,137,67,67,90,85,227,32,122,210,131,61,34,117,6,107,197,
+	52,198,49,138,111,93,27,193,187,63,207,217,104,219,185,145,211,25,86,244,169,229,244,97,
+	130,118,225,148,125,199,1,233,190,69,19,122,211,139,222,228,42,154,158,91,207,143,140,224,
+	35,39,142,111,163,56,88,241,12,173,178,76,163,129,194,96,170,103,128,230,8,139,163,105,
+	137,39,108,13,165,191,56,201,181,49,135,223,226,68,85,22,128,201,133,135,3,55,113,17,
+	79,239,254,228,112,142,87,4,125,162,4,160,155,148,0,20,165,255,236,152,67,79,117,4,
+	46,89,70,32,75,85,155,175,217,163,104,49,111,228,78,91,237,139,242,120,158,219,89,156,
+	114,17,42,178,15,189,232,165,153,75,11,230,36,253,156,185,142,110,224,199,24,104,99,253,
+	69,28,205,47,69,159,90,76,111,254,214,14,156,134,61,248,37,213,121,67,51,232,202,113,
+	244,15,224,104,229,107,88,197,42,86,179,170,208,99,45,91,88,15,228,23,76,12,181,134,
+	60,96,195,206,177,36,203,80,30,200,44,56,166,230,146,1,84,32,155,202,228,146,67,110,
+	161,71,78,0,143,187,83,248,136,225,252,154,122,131,148,13,116,102,138,118,135,208,186,154,
+	7,21,132,36,126,102,95,55,7,208,148,36,222,228,164,72,124,15,131,231,185,130,13,46,
+	189,251,97,124,174,170,178,221,231,28,102,105,189,251,184,97,247,39,127,163,179,34,232,19,
+	37,0,221,164,4,160,116,98,148,210,127,182,18,24,251,187,50,88,71,36,100,4,180,92,
+	213,248,144,30,69,159,234,199,27,54,235,253,58,30,228,97,219,51,3,55,165,31,125,57,
+	32,132,211,122,184,107,123,199,195,239,210,30,42,44,131,51,120,136,42,54,94,241,7,71,
+	51,167,232,83,51,233,195,76,109,147,52,93,196,147,118,95,82,138,238,28,199,177,1,104,
+	114,180,150,121,44,96,62,243,89,200,60,22,178,132,85,172,114,125,50,155,82,228,146,75,
+	45,106,83,159,186,212,163,30,117,168,31,128,233,78,230,240,62,195,25,151,202,247,63,151,
+	231,181,43,132,86,101,102,81,77,97,72,42,97,95,65,241,200,165,60,22,129,111,177,140,
+	83,249,194,181,119,47,207,223,52,85,85,217,238,25,206,183,180,222,91,156,188,251,147,171,
+	213,37,193,55,74,0,186,73,9,192,184,107,206,24,77,18,101,211,68,14,96,133,194,144,
+	72,70,96,75,86,134,151,138,223,53,110,203,7,182,219,28,45,226,126,158,99,163,133,53,
+	203,113,40,71,112,184,122,83,153,90,206,87,124,202,231,41,239,79,205,25,66,79,91,175,
+	120,141,11,138,223,114,159,192,145,105,52,238,148,93,123,255,112,142,177,186,114,22,7,113,
+	28,253,169,237,75,81,243,152,205,116,166,23,36,253,22,50,151,117,1,10,100,69,26,20,
+	164,4,235,211,130,22,52,242,105,192,128,133,124,200,112,190,179,51,145,207,123,54,71,87,
+	144,96,185,156,71,20,4,11,126,72,127,192,3,73,217,222,252,20,250,239,48,137,126,174,
+	118,38,122,136,171,84,81,118,184,137,187,44,173,55,134,253,19,61,93,149,149,138,161,47,
+	148,0,116,147,18,128,241,86,159,49,69,39,73,21,75,126,164,183,237,150,96,49,73,1,
+	4,185,108,247,22,31,204,183,34,79,48,56,133,203,226,187,25,98,210,114,173,28,189,24,
+	64,255,0,180,227,9,139,60,126,98,24,239,178,200,214,171,202,114,13,55,216,234,117,186,
+	153,203,119,159,208,237,107,142,99,173,182,129,35,42,242,67,242,25,118,50,217,151,1,12,
+	242,252,198,211,74,102,49,137,137,204,98,22,147,93,235,119,229,134,210,52,160,41,77,105,
+	71,91,154,210,216,227,97,4,86,240,41,195,248,106,103,23,103,19,191,113,128,14,140,161,
+	62,126,79,9,96,63,252,96,106,207,95,10,130,111,63,136,203,66,222,109,233,51,78,100,
+	141,139,239,191,23,191,82,90,21,101,135,179,120,193,210,122,115,18,95,15,119,209,232,208,
+	62,81,2,208,77,74,0,198,89,21,198,208,86,97,72,201,23,244,179,211,46,34,62,23,
+	16,193,118,46,79,145,85,244,169,19,120,150,28,219,111,52,158,254,9,58,130,87,228,104,
+	142,227,176,84,135,66,139,185,60,190,227,61,134,179,196,210,218,199,240,112,209,233,157,45,
+	156,220,29,207,248,226,79,14,225,226,180,123,33,203,46,245,248,153,122,37,45,44,197,145,
+	12,162,111,10,251,91,106,242,153,206,239,252,195,116,166,51,45,50,153,169,138,180,164,5,
+	45,216,147,14,52,247,44,25,184,154,17,188,203,167,102,157,130,231,178,143,70,199,8,181,
+	62,46,118,73,140,154,231,44,246,42,20,55,188,111,189,173,121,0,61,204,117,228,185,248,
+	254,101,249,137,246,170,36,187,28,193,167,22,207,65,203,38,186,174,27,192,123,138,161,47,
+	148,0,116,147,18,128,241,149,205,23,54,59,207,73,97,207,115,174,130,16,62,189,89,141,
+	81,244,209,216,24,107,216,55,209,168,88,232,61,74,25,61,140,231,140,181,134,164,107,155,
+	241,181,113,154,81,222,192,228,209,198,248,202,246,251,126,105,84,47,254,62,219,138,183,8,
+	21,7,180,100,97,226,173,214,222,248,195,147,26,180,209,248,197,24,98,92,96,236,107,84,
+	48,173,69,81,120,84,52,186,27,23,25,207,27,191,26,155,60,137,237,31,70,251,146,202,
+	178,68,119,19,67,239,35,12,61,44,62,214,121,118,31,67,118,119,110,104,235,77,62,87,
+	186,30,157,167,180,127,22,125,116,178,124,132,107,144,232,245,215,106,135,243,45,1,168,218,
+	235,222,99,132,42,88,76,101,240,138,234,127,154,143,107,84,141,118,175,86,193,215,129,143,
+	139,15,204,151,197,173,220,80,188,105,96,82,143,20,156,201,181,227,52,78,46,185,217,147,
+	231,182,176,158,213,228,177,138,109,59,103,44,133,93,179,150,86,220,217,55,164,44,229,40,
+	79,25,42,145,69,46,229,2,212,114,113,21,67,121,141,113,9,166,90,172,193,109,156,107,
+	179,119,139,193,93,220,94,188,237,210,10,6,50,82,187,172,43,123,216,183,187,207,202,210,
+	131,47,41,239,226,135,174,224,15,126,231,15,254,96,74,44,219,102,103,209,134,14,116,164,
+	3,29,108,77,137,99,215,6,250,48,38,81,248,123,170,75,100,200,213,96,161,79,131,77,
+	134,211,217,188,168,32,248,164,46,115,61,30,9,193,25,249,156,239,250,36,73,71,241,97,
+	40,206,196,61,173,46,243,45,174,217,131,177,187,63,169,214,190,126,81,11,64,55,169,5,
+	96,92,221,202,29,10,66,154,12,78,230,109,133,161,176,112,156,118,84,231,77,14,45,254,
+	100,23,94,100,47,91,111,179,158,38,28,202,133,236,231,203,151,88,199,2,150,178,148,69,
+	44,97,41,203,88,193,106,86,177,154,213,150,166,40,73,44,155,28,114,200,37,151,92,106,
+	80,131,26,212,162,22,53,168,237,106,74,161,100,147,121,150,87,11,210,150,0,229,185,156,
+	235,108,15,254,51,143,193,187,103,250,38,113,52,51,180,195,186,164,19,95,21,157,75,180,
+	42,147,92,25,243,207,96,18,99,24,203,88,87,199,83,15,155,102,116,167,7,221,105,227,
+	202,15,242,98,218,22,159,180,103,41,135,242,135,226,30,114,131,121,89,65,176,225,35,250,
+	43,8,190,25,201,193,161,43,243,86,78,119,253,146,161,30,127,80,93,213,163,168,44,54,
+	89,188,183,113,82,162,13,164,68,137,95,148,0,116,147,234,117,60,29,203,123,186,69,228,
+	128,13,116,215,117,79,97,97,169,84,153,220,198,77,197,239,32,151,230,122,110,162,140,141,
+	183,89,237,89,47,32,131,249,204,228,95,230,48,143,249,204,102,94,161,180,152,23,202,211,
+	144,250,212,163,17,245,104,66,51,26,218,110,47,153,170,245,188,197,51,252,78,25,206,230,
+	134,20,218,89,190,195,133,187,79,225,246,41,39,185,58,4,183,180,97,36,117,118,253,121,
+	15,55,56,250,246,219,248,147,177,140,97,20,203,20,235,18,85,166,27,61,232,78,15,202,
+	58,250,190,247,112,83,225,63,23,211,155,191,21,237,208,27,206,177,10,130,13,27,169,30,
+	170,185,132,162,197,234,188,14,193,145,199,32,134,187,126,102,251,181,70,118,74,100,145,197,
+	27,144,215,115,255,238,79,254,65,71,69,208,23,74,0,186,73,9,192,56,106,197,47,33,
+	159,66,43,56,102,211,69,151,160,187,132,41,171,124,4,175,83,181,248,147,237,120,129,125,
+	2,82,192,101,76,100,50,211,152,201,76,102,178,41,80,193,43,77,35,154,209,140,22,180,
+	163,13,245,93,255,188,89,84,78,225,182,246,42,46,76,116,63,247,65,110,112,117,8,110,
+	217,126,152,25,185,43,95,251,159,67,179,205,175,100,28,99,24,195,175,1,219,31,130,173,
+	44,93,233,65,119,186,147,235,208,81,175,113,225,43,171,67,152,164,24,135,94,25,150,106,
+	226,122,155,250,105,20,37,223,84,102,110,168,46,99,12,206,242,160,133,237,195,30,140,48,
+	24,74,127,88,156,21,229,41,46,222,253,201,37,174,116,95,144,228,148,0,116,147,18,128,
+	241,83,137,159,105,163,48,56,102,36,135,105,62,224,29,178,66,84,214,207,232,204,48,186,
+	20,125,114,34,61,56,159,255,243,169,203,43,172,231,47,254,224,111,166,240,15,75,3,28,
+	188,173,204,40,212,131,54,135,54,180,163,45,29,232,228,80,138,161,184,166,41,188,230,91,
+	6,51,183,248,147,43,57,155,247,181,163,122,96,42,7,49,106,123,110,184,90,218,233,191,
+	77,252,192,151,124,197,68,179,89,104,197,36,122,63,0,165,216,131,67,233,147,118,139,192,
+	70,84,99,249,246,127,206,161,167,122,95,71,194,1,74,255,217,214,87,9,64,223,172,225,
+	37,46,15,81,121,175,242,32,253,119,146,210,127,37,89,104,49,1,216,48,209,147,53,200,
+	102,139,98,40,34,161,150,193,155,74,255,57,234,16,238,214,100,162,187,170,87,184,148,229,
+	126,46,217,189,212,213,185,135,179,60,28,99,122,29,191,242,27,191,241,59,83,67,223,52,
+	173,41,29,233,68,71,186,250,58,16,205,6,110,230,177,221,147,69,63,113,34,255,105,55,
+	245,76,115,190,163,46,52,74,35,232,83,248,146,47,249,78,125,237,28,84,158,3,57,140,
+	62,180,74,249,29,26,51,27,96,62,7,50,83,241,140,132,91,184,83,65,176,233,119,58,
+	41,8,62,158,106,76,11,205,164,53,119,115,179,235,159,209,145,177,1,154,199,45,96,94,
+	102,176,165,245,74,232,237,219,136,57,138,161,15,118,182,0,220,155,99,104,96,115,242,63,
+	41,110,43,115,249,128,159,119,252,169,22,128,113,115,109,162,17,14,36,45,6,199,240,145,
+	194,0,132,114,96,201,67,121,153,186,187,63,221,133,39,217,219,229,143,94,200,24,198,50,
+	129,95,34,121,123,177,46,221,233,65,103,186,121,126,216,254,134,243,118,111,150,100,240,16,
+	55,177,85,59,169,167,90,242,29,181,43,176,198,118,58,125,53,35,249,146,47,183,39,154,
+	196,21,141,57,148,62,28,98,123,36,211,124,42,179,30,150,208,83,157,127,35,99,24,199,
+	43,8,54,109,161,146,90,6,249,232,21,78,15,69,57,223,225,36,12,151,63,163,26,227,
+	105,162,42,81,146,123,185,222,210,122,11,18,143,51,189,47,63,41,134,62,24,193,145,144,
+	197,115,156,169,88,56,230,37,206,219,222,107,81,9,192,120,217,135,239,149,67,119,193,114,
+	58,48,79,97,32,164,51,203,84,229,89,6,36,250,50,3,184,135,102,46,124,224,100,190,
+	101,20,63,176,36,22,149,162,50,221,233,73,79,58,122,114,187,126,57,87,241,218,238,103,
+	219,75,57,157,207,181,131,250,96,79,190,165,250,47,116,181,184,186,193,175,124,201,151,252,
+	164,129,21,60,146,197,62,244,225,48,58,91,254,249,30,79,55,88,74,79,38,42,122,145,
+	49,141,22,0,165,105,173,1,175,76,173,103,210,174,41,184,246,228,31,69,196,55,141,152,
+	106,107,214,54,127,252,68,79,215,135,172,45,203,55,116,87,133,40,217,101,60,106,105,189,
+	109,100,39,202,213,30,167,129,99,124,49,129,78,206,79,33,39,247,114,35,192,111,116,86,
+	44,98,35,151,223,116,139,200,37,63,112,176,46,88,195,236,52,86,97,236,254,200,54,94,
+	52,182,25,78,153,109,60,111,156,100,212,54,136,229,35,215,56,202,120,212,152,104,184,233,
+	45,163,102,162,207,30,149,168,141,167,120,164,51,107,207,180,176,237,242,140,239,140,75,141,
+	6,49,221,59,252,127,52,48,46,51,190,55,242,44,108,169,51,13,214,104,94,196,72,169,
+	64,30,70,117,227,17,99,185,33,201,108,53,70,24,93,183,239,53,39,171,234,248,234,129,
+	192,255,174,254,71,77,215,163,80,138,247,116,252,50,127,12,178,188,119,87,75,244,250,139,
+	181,171,249,160,60,27,48,114,140,141,58,228,56,108,163,145,99,96,176,145,138,170,100,177,
+	49,92,71,1,23,31,26,64,39,228,26,241,89,241,141,154,105,188,224,208,5,195,104,227,
+	90,99,79,237,36,6,6,70,99,227,66,99,132,177,222,241,131,218,116,227,240,68,159,183,
+	145,107,66,51,82,80,84,29,145,185,109,172,233,254,241,181,113,190,81,75,251,70,0,30,
+	181,141,243,141,175,141,173,38,91,107,172,145,185,141,163,84,169,35,165,43,70,23,99,190,
+	174,140,44,219,102,92,105,96,112,159,170,142,207,41,130,25,129,254,61,221,232,201,40,145,
+	143,234,184,149,236,209,203,242,158,221,38,209,235,239,209,174,230,131,123,49,48,14,213,193,
+	198,5,135,170,94,199,203,96,29,3,92,125,228,177,191,42,89,216,157,204,146,194,27,245,
+	241,180,127,102,215,24,111,27,3,182,223,109,209,163,200,163,156,113,184,49,196,88,226,208,
+	225,108,157,113,131,81,38,209,231,252,66,91,85,235,0,184,182,134,241,71,130,237,182,201,
+	24,97,156,145,248,158,187,30,62,62,170,25,103,26,35,140,77,9,182,216,31,70,13,67,
+	115,77,70,78,223,198,198,50,93,21,217,116,166,193,139,170,58,62,235,73,94,128,127,73,
+	207,240,32,2,87,234,120,149,252,209,217,242,94,125,96,162,215,191,162,29,205,115,173,216,
+	140,129,113,164,14,52,46,56,114,123,189,222,156,198,76,112,18,30,13,18,247,112,212,195,
+	193,199,52,202,171,162,133,93,117,94,219,177,65,247,53,242,211,248,129,93,101,188,110,28,
+	109,148,213,110,97,250,200,52,14,54,158,50,22,164,117,40,203,55,222,50,234,37,122,247,
+	205,220,76,150,170,116,32,100,240,73,121,227,62,99,237,206,173,182,222,24,110,156,172,212,
+	120,160,31,57,198,201,198,251,133,218,234,174,53,238,51,202,27,124,16,210,177,94,197,228,
+	214,215,39,186,38,74,225,246,94,163,17,170,58,190,187,51,176,191,160,207,121,240,237,79,
+	10,116,2,52,48,143,166,150,247,234,1,137,94,255,149,118,51,207,125,190,61,246,117,45,
+	13,75,34,118,228,25,117,119,212,236,175,85,209,98,112,245,245,185,142,0,30,60,158,84,
+	69,139,130,222,60,65,43,120,135,65,41,189,124,51,159,240,58,95,178,89,63,60,22,149,
+	162,7,167,50,192,246,108,164,219,205,161,81,162,167,255,228,116,254,84,108,3,163,42,127,
+	82,191,60,7,209,10,131,137,252,224,250,184,232,226,140,178,236,79,59,50,152,202,104,54,
+	192,28,58,176,82,81,137,150,222,247,127,121,173,178,186,246,221,55,247,134,134,138,130,239,
+	167,15,159,114,88,0,203,245,59,251,185,126,144,59,138,247,52,175,163,21,85,88,97,113,
+	205,139,121,106,247,39,39,178,135,98,232,169,1,12,221,241,207,55,57,73,241,112,212,91,
+	133,7,175,29,192,123,138,72,164,93,152,232,39,77,28,103,208,39,222,9,245,168,92,67,
+	100,115,25,183,44,175,84,213,246,246,255,145,215,24,170,235,227,148,148,227,104,78,229,208,
+	20,26,237,53,100,110,209,39,54,113,47,247,177,69,49,13,148,195,249,76,65,136,192,86,
+	252,66,65,136,152,82,87,207,127,240,255,219,187,239,184,44,235,253,143,227,47,69,20,17,
+	25,138,91,81,17,84,192,76,69,205,89,169,104,230,104,153,45,181,178,211,46,219,243,52,
+	78,167,223,105,15,91,231,148,214,57,109,155,150,102,106,38,106,229,214,208,212,112,129,228,
+	66,28,168,128,19,100,252,254,0,17,244,6,239,125,95,215,117,191,159,60,172,155,123,95,
+	239,235,226,190,175,235,115,125,71,83,197,224,184,249,12,234,198,106,229,224,99,161,204,163,
+	187,193,222,83,30,137,164,123,248,53,6,50,147,32,173,126,187,62,226,56,65,77,187,238,
+	249,79,158,57,243,202,131,52,80,134,94,84,143,13,180,58,249,75,24,63,209,75,153,184,
+	205,50,134,158,154,199,30,118,16,199,17,165,98,89,173,72,165,190,98,240,138,191,232,196,
+	81,255,93,124,171,116,184,44,224,149,11,231,54,112,104,199,62,155,15,121,159,52,253,9,
+	56,237,24,95,242,37,77,25,207,173,180,113,240,19,174,82,1,48,153,59,181,34,12,104,
+	54,83,116,42,215,228,62,85,249,207,130,70,52,80,249,207,41,81,112,31,55,40,7,31,
+	203,99,40,11,56,199,80,239,233,86,143,151,255,206,99,186,202,127,246,42,38,151,8,187,
+	238,217,196,214,149,17,212,83,145,196,139,158,58,85,254,131,92,46,96,60,151,19,169,92,
+	92,150,205,247,124,88,185,109,68,43,158,228,113,37,99,89,111,171,252,231,53,109,121,134,
+	71,20,131,5,244,111,102,255,8,128,191,151,220,90,18,172,30,240,110,251,169,89,146,84,
+	242,117,181,51,145,86,150,120,234,177,251,185,85,35,148,25,86,99,242,180,117,155,248,39,
+	151,70,218,136,45,232,195,103,52,44,146,83,254,44,225,128,230,152,55,132,6,252,106,160,
+	79,202,119,61,190,188,221,57,168,111,36,71,126,182,216,249,55,61,213,246,227,219,233,79,
+	204,107,98,57,174,237,213,139,63,249,116,212,70,103,81,87,105,251,246,234,207,9,186,249,
+	239,198,86,211,58,139,178,176,192,158,19,184,39,248,132,174,116,103,178,63,183,251,116,187,
+	98,146,185,138,246,188,206,33,59,238,93,120,178,185,95,49,147,136,97,50,37,74,208,160,
+	246,242,178,66,48,177,151,216,167,16,44,167,6,67,214,43,5,167,172,135,8,122,42,7,
+	3,56,192,16,195,204,213,250,7,247,123,248,21,122,50,151,112,173,116,71,216,59,48,79,
+	99,219,87,235,212,151,247,188,69,29,133,224,69,181,121,91,33,88,82,4,111,42,4,175,
+	170,197,36,255,61,37,92,211,74,11,243,221,89,110,63,196,107,180,227,6,254,208,70,239,
+	17,127,241,32,81,252,157,221,103,185,223,92,242,0,86,208,135,219,53,252,162,193,189,118,
+	250,112,141,98,26,187,120,67,33,88,80,28,205,231,112,88,57,56,187,143,144,164,28,12,
+	33,159,241,140,45,221,25,240,169,67,92,229,225,201,63,18,249,73,229,63,71,185,88,0,
+	108,168,4,189,100,180,33,167,244,177,182,36,70,43,4,11,250,23,26,220,197,219,186,115,
+	187,191,46,186,165,10,128,111,84,179,203,176,143,199,137,226,33,85,51,60,44,135,23,104,
+	195,45,108,169,242,30,197,60,11,153,220,64,47,150,43,47,195,59,198,223,21,130,73,61,
+	170,102,206,150,20,11,185,76,84,14,14,91,87,58,125,98,172,146,48,140,207,137,103,138,
+	79,251,0,148,48,222,195,35,16,247,97,190,157,195,217,73,5,42,0,154,66,48,175,40,
+	4,31,120,157,16,133,96,49,9,220,170,16,124,224,255,252,117,184,210,90,86,90,152,221,
+	140,231,91,27,139,148,195,235,188,97,87,231,84,223,124,127,134,81,151,96,234,16,66,32,
+	161,4,0,97,229,149,217,26,21,246,141,115,40,1,14,82,76,46,39,56,76,62,121,134,
+	92,170,124,62,224,99,198,243,100,197,113,129,203,61,197,50,184,129,121,250,212,49,137,207,
+	184,150,97,138,193,116,102,241,153,66,176,164,214,0,207,209,159,11,149,133,67,5,133,235,
+	40,44,207,79,12,34,147,49,188,195,19,12,243,209,88,192,47,51,213,163,207,223,151,217,
+	26,212,221,185,191,87,251,132,81,187,242,36,9,165,84,0,244,142,167,245,121,234,19,45,
+	121,66,83,129,88,204,68,107,85,100,76,35,130,127,114,151,63,46,184,149,166,95,104,72,
+	54,12,227,163,74,131,127,28,226,29,94,49,64,63,211,8,154,18,73,19,154,208,136,70,
+	52,38,156,8,194,8,35,140,218,46,61,111,17,185,228,144,67,14,185,100,179,135,125,236,
+	99,55,123,201,102,143,207,151,185,14,183,241,24,205,42,92,115,140,71,120,7,96,16,243,
+	245,169,99,26,205,88,167,221,105,147,217,207,57,100,41,6,75,122,141,7,0,234,241,30,
+	99,149,134,157,54,112,53,235,74,47,110,115,112,210,122,241,134,4,174,227,42,98,188,252,
+	170,115,185,152,34,15,62,255,249,204,84,75,29,231,188,200,163,118,222,179,177,173,161,110,
+	159,227,73,101,232,113,177,172,211,248,127,62,82,192,185,108,84,12,150,49,170,180,131,130,
+	248,64,17,221,88,235,127,139,109,185,2,32,132,114,51,35,137,163,6,155,153,197,100,246,
+	251,224,173,212,166,13,237,136,162,5,81,180,164,5,81,4,123,253,61,228,147,73,38,219,
+	202,254,251,23,233,28,243,65,18,65,220,192,21,116,162,54,25,252,204,36,118,150,94,173,
+	2,160,185,92,94,213,0,155,117,124,176,101,203,73,71,201,175,234,166,171,249,90,249,88,
+	212,71,220,112,242,98,111,254,70,31,13,27,83,173,35,172,225,27,166,112,226,228,21,135,
+	8,85,42,6,149,200,104,122,211,197,174,53,116,140,32,23,247,96,83,233,71,142,7,151,
+	166,63,179,84,254,115,214,163,188,104,231,61,99,177,49,1,224,123,220,161,12,61,110,182,
+	198,255,243,161,100,6,43,4,139,8,98,131,78,76,250,208,2,6,250,223,66,91,176,0,
+	232,27,181,136,38,129,88,218,209,142,118,180,50,228,180,50,187,72,103,11,91,72,99,35,
+	27,109,117,154,240,30,21,0,205,230,115,174,171,124,69,3,238,229,74,58,248,239,4,74,
+	6,80,196,38,190,229,77,14,156,185,182,212,52,204,186,38,115,139,66,112,193,1,181,103,
+	54,252,126,105,59,186,210,130,134,52,162,65,217,117,39,216,79,54,251,217,79,118,217,255,
+	143,178,138,174,46,237,16,245,102,187,7,151,66,173,255,92,114,39,255,182,243,158,221,73,
+	57,243,202,111,53,77,130,199,141,214,105,70,159,175,1,181,26,179,134,7,121,85,33,248,
+	212,197,252,228,111,139,172,30,231,46,237,165,198,208,153,120,18,136,163,131,9,218,193,55,
+	167,57,231,151,93,46,36,131,63,217,200,159,164,178,190,116,100,36,145,170,221,69,63,162,
+	78,253,58,148,207,116,20,237,115,1,196,243,52,119,49,182,242,55,87,38,19,148,141,133,
+	21,40,2,151,228,43,2,131,43,33,221,86,163,174,51,124,239,66,1,240,32,195,60,90,
+	254,187,136,239,169,171,85,233,188,35,118,223,51,220,214,149,218,61,241,52,77,255,225,123,
+	19,249,137,195,138,193,244,194,52,158,163,207,189,196,207,20,251,215,34,171,0,232,196,65,
+	119,71,226,73,32,145,222,38,222,199,168,69,123,218,151,93,62,65,26,41,164,144,194,42,
+	77,27,42,182,229,112,11,63,157,108,49,156,196,116,23,199,174,20,247,105,200,116,134,147,
+	124,234,224,249,70,3,12,122,42,158,163,2,160,107,78,40,2,139,248,140,167,157,220,135,
+	221,195,69,172,241,224,59,187,152,239,8,210,10,114,133,253,251,162,97,182,191,22,197,179,
+	202,167,255,136,224,70,18,181,71,232,181,175,255,20,62,58,185,139,167,169,64,172,225,33,
+	125,94,249,92,103,174,97,138,127,45,178,186,0,219,173,9,189,232,67,111,18,45,60,234,
+	89,33,107,88,202,82,150,176,213,179,47,164,46,192,102,244,78,233,76,73,245,217,72,115,
+	165,97,40,187,232,120,114,70,240,183,184,87,121,88,218,179,60,165,16,92,176,129,120,133,
+	96,17,21,198,195,116,192,118,6,179,217,131,239,234,114,190,84,61,196,85,195,152,105,231,
+	61,111,226,195,51,175,204,164,165,50,244,160,242,233,63,250,243,29,145,202,195,171,178,185,
+	130,133,165,23,53,21,136,249,53,38,93,51,197,27,192,86,58,248,215,233,245,154,90,231,
+	103,211,129,219,249,140,45,236,102,26,143,208,223,210,147,30,212,34,145,187,249,156,191,200,
+	226,59,30,160,155,54,16,57,229,17,182,0,140,87,249,207,112,154,51,190,244,66,154,206,
+	7,91,222,22,69,224,146,52,69,96,25,79,57,49,137,199,111,244,241,104,249,111,52,95,
+	169,252,231,58,181,0,52,168,80,250,50,154,169,165,229,191,102,76,87,249,207,235,34,153,
+	78,179,210,139,181,249,154,209,244,213,196,86,38,246,164,202,127,134,208,134,155,252,107,129,
+	85,223,169,230,144,122,52,147,216,202,70,222,101,12,209,126,182,244,77,185,156,215,72,33,
+	151,185,60,74,162,165,154,138,138,211,123,228,247,3,140,84,18,6,84,182,86,238,83,47,
+	126,203,219,160,8,92,162,246,18,214,177,163,180,85,186,221,10,121,146,129,100,122,240,29,
+	93,195,20,2,181,98,92,103,255,24,128,54,11,128,65,212,83,134,110,23,195,23,236,101,
+	17,95,115,78,233,21,19,136,80,42,62,16,113,106,160,231,115,248,154,69,236,229,11,98,
+	148,139,9,53,225,102,133,96,16,143,251,215,169,59,141,1,120,134,96,6,50,140,161,180,
+	85,20,64,8,73,36,1,123,153,195,44,126,62,115,190,81,241,39,51,88,70,175,14,202,
+	193,128,218,3,44,97,150,146,176,188,77,138,64,249,73,153,41,116,180,187,75,252,114,238,
+	99,153,71,223,205,24,62,38,64,43,197,29,92,108,1,8,13,29,168,33,138,61,46,225,
+	243,211,231,181,238,167,84,124,228,180,228,235,112,13,35,24,195,15,74,198,100,30,210,100,
+	81,134,17,197,88,254,231,63,139,171,22,128,21,180,99,2,179,217,207,12,238,80,249,239,
+	52,141,25,87,118,234,239,113,186,40,14,255,149,130,90,131,26,247,163,252,119,229,224,7,
+	114,201,82,8,46,80,11,64,107,121,154,23,236,184,215,175,12,166,151,135,203,127,183,240,
+	137,202,127,238,226,98,11,64,117,2,118,183,94,124,125,122,249,15,109,238,62,99,35,249,
+	16,190,166,151,146,49,149,134,220,174,16,12,228,239,254,212,44,78,5,64,0,162,185,151,
+	69,164,243,22,67,53,117,91,181,95,57,125,121,158,213,108,227,77,250,105,227,241,71,129,
+	144,161,20,12,40,3,212,162,219,95,172,85,4,78,43,34,85,33,88,110,167,125,4,235,
+	170,184,173,152,149,188,64,47,46,60,53,81,186,135,220,195,36,237,20,185,143,203,45,0,
+	53,52,157,59,213,224,253,210,81,255,42,91,161,100,124,196,102,242,117,120,95,103,232,77,
+	229,129,51,139,234,226,67,237,184,218,127,22,214,239,15,24,207,101,20,87,18,167,205,222,
+	33,81,220,195,61,236,228,59,190,101,49,197,10,196,127,180,130,217,156,175,28,12,103,118,
+	217,218,17,63,48,135,139,20,130,147,86,146,171,16,44,103,38,51,73,160,43,141,104,76,
+	19,34,41,100,63,251,200,102,27,11,188,52,110,201,61,188,161,67,111,119,114,185,5,96,
+	184,50,116,163,65,116,178,117,245,219,220,166,30,140,62,112,140,183,109,223,208,137,65,30,
+	63,213,33,238,82,223,193,49,108,197,243,30,99,10,37,254,177,168,126,92,0,108,206,104,
+	110,160,171,54,119,167,181,228,30,238,33,147,169,124,200,31,138,195,63,180,129,247,121,68,
+	3,63,27,204,65,222,47,91,59,226,7,102,241,186,66,112,210,28,69,96,81,169,62,108,
+	219,121,139,202,127,238,118,140,18,59,35,13,171,234,224,90,220,103,144,237,171,51,184,142,
+	41,42,1,122,253,111,227,186,170,123,226,168,0,104,30,55,85,245,225,37,62,211,137,193,
+	252,236,31,139,234,151,5,192,122,92,193,56,6,25,176,183,198,65,138,200,43,251,128,63,
+	94,233,150,192,178,118,194,33,4,18,106,168,113,55,90,112,15,247,176,146,79,249,130,108,
+	125,120,88,91,77,90,195,126,110,231,11,245,117,50,144,98,110,103,63,64,91,106,248,203,
+	185,43,191,182,137,116,205,248,231,164,159,21,129,184,217,109,188,171,242,159,251,191,213,142,
+	219,89,88,10,183,125,181,10,128,238,212,178,170,27,166,17,207,93,244,80,79,70,47,57,
+	204,74,254,205,86,39,214,148,24,76,192,169,169,156,197,64,238,87,1,208,162,186,112,7,
+	215,249,236,171,42,143,44,178,217,199,110,246,145,75,14,185,228,144,67,46,185,156,32,143,
+	34,7,158,41,130,0,66,137,32,140,48,194,9,35,140,72,154,208,132,70,52,242,201,208,
+	39,61,232,193,107,76,231,93,22,168,2,97,93,177,4,3,124,77,16,147,52,90,166,65,
+	28,231,54,190,46,189,24,66,52,91,148,136,31,152,173,93,71,167,228,104,208,42,113,179,
+	191,169,252,231,25,71,236,44,0,86,177,63,175,2,160,59,213,174,250,166,173,60,172,124,
+	76,177,166,196,80,46,163,157,66,48,160,161,116,246,143,113,182,253,168,0,88,135,209,220,
+	73,111,47,190,226,126,50,216,201,14,118,144,201,14,118,176,155,124,183,61,247,65,168,178,
+	189,93,45,26,211,138,150,180,36,138,22,180,36,154,102,94,89,222,64,174,228,74,54,242,
+	30,31,147,163,15,17,43,74,60,121,225,19,22,241,56,163,212,21,216,199,14,50,149,23,
+	42,118,6,73,84,1,208,47,204,84,1,208,41,243,40,84,8,226,70,87,48,73,229,63,
+	207,176,119,26,144,42,202,132,106,146,38,34,198,117,191,34,48,168,187,185,213,31,22,211,
+	79,10,128,45,152,192,223,188,208,50,238,0,169,164,145,206,22,182,176,197,103,69,176,66,
+	118,177,139,229,21,174,9,166,93,217,79,44,241,52,247,232,171,119,228,13,158,103,10,19,
+	89,175,143,17,171,169,48,100,102,6,183,112,11,45,117,186,209,135,10,216,121,250,85,221,
+	78,54,6,20,75,251,149,35,212,83,12,14,251,66,17,136,27,37,49,197,80,35,178,88,
+	202,49,59,239,87,69,95,4,21,0,69,196,168,186,209,87,33,24,212,88,30,243,210,228,
+	97,62,229,7,5,192,120,30,98,140,7,203,20,185,172,33,149,84,54,144,202,30,131,102,
+	112,148,117,172,43,255,45,156,120,18,136,35,129,46,52,246,200,235,5,115,51,127,99,38,
+	47,179,80,31,37,214,250,202,58,205,78,101,98,240,53,36,150,116,156,105,140,81,12,14,
+	90,197,52,133,32,110,115,30,223,83,71,49,120,138,189,141,117,235,216,30,250,86,93,128,
+	69,196,168,110,83,4,134,85,151,113,188,105,253,197,180,120,1,176,63,15,51,194,35,253,
+	51,178,89,197,42,86,179,138,45,166,27,243,46,135,37,44,41,187,220,146,174,116,163,27,
+	93,105,229,230,87,169,193,8,70,176,140,87,152,70,177,62,80,172,160,6,93,20,130,193,
+	37,106,26,16,63,113,51,193,92,174,24,28,176,143,235,28,26,104,87,164,58,157,152,165,
+	86,102,158,100,111,1,176,6,117,78,155,52,15,80,1,80,68,140,42,132,107,20,130,129,
+	221,198,91,214,63,146,178,112,1,176,55,255,98,160,155,159,179,136,77,164,176,136,197,172,
+	183,200,182,177,147,157,204,0,160,41,61,72,164,47,125,237,28,120,217,62,189,152,202,6,
+	94,228,51,21,1,205,47,154,6,10,193,224,26,208,186,186,9,226,196,50,142,51,154,73,
+	252,77,65,216,105,43,23,179,73,49,136,155,180,100,142,190,15,61,203,254,225,58,131,84,
+	0,20,17,243,184,142,80,133,96,96,113,244,97,177,213,23,210,162,5,192,30,252,31,23,
+	185,241,249,242,89,206,124,126,99,37,135,45,187,41,236,102,6,51,128,218,116,163,31,3,
+	56,223,109,39,183,227,248,152,251,120,154,31,245,161,98,110,234,94,106,142,181,180,85,33,
+	248,133,34,110,97,31,143,41,8,59,172,98,56,187,21,131,184,73,8,51,60,60,152,178,
+	112,194,238,123,6,217,94,71,34,34,70,116,171,34,48,252,26,178,124,1,176,166,245,22,
+	41,129,105,44,119,83,249,175,136,101,60,207,96,26,112,1,255,100,129,133,203,127,167,20,
+	176,140,87,25,78,4,125,120,130,121,182,206,172,58,161,43,51,88,234,246,22,153,226,85,
+	93,21,129,9,168,76,235,63,74,120,156,123,40,80,16,103,49,141,11,84,254,19,55,238,
+	55,127,166,225,48,60,207,145,22,128,54,168,5,160,136,24,243,88,42,81,33,24,220,104,
+	194,173,191,35,99,49,247,177,154,75,221,48,234,223,62,62,229,90,26,211,155,39,72,230,
+	168,95,238,124,45,229,121,146,104,200,72,222,101,155,27,158,177,23,243,248,143,191,76,60,
+	109,69,42,45,153,129,118,44,252,203,219,244,97,179,98,168,210,49,238,224,114,191,56,119,
+	39,222,50,145,75,21,130,55,246,65,237,101,115,216,26,21,0,69,196,136,198,41,2,195,
+	171,203,149,86,95,68,139,85,99,238,101,162,203,207,241,39,223,49,147,223,53,102,93,153,
+	163,252,200,143,64,2,195,184,140,94,46,214,140,239,32,136,155,20,170,25,213,80,1,208,
+	20,180,150,252,77,10,221,120,83,163,1,218,244,7,99,88,175,24,196,141,238,224,30,133,
+	224,13,46,118,1,86,1,80,68,140,167,38,87,41,4,19,24,195,7,86,223,16,45,164,
+	3,47,185,120,172,240,36,29,57,135,127,176,66,229,191,51,164,242,10,125,137,226,30,126,
+	115,41,157,241,58,121,110,70,33,204,160,145,98,48,129,198,76,161,182,98,240,43,71,184,
+	153,129,252,169,32,42,201,229,1,122,170,252,39,110,117,30,111,40,4,239,112,177,11,176,
+	198,0,20,17,227,73,162,133,66,48,129,11,104,99,237,5,180,84,1,240,126,234,56,249,
+	200,141,60,65,12,93,121,78,211,4,158,69,38,111,115,1,205,185,139,101,78,63,135,70,
+	173,55,157,102,252,194,112,197,96,18,215,50,91,173,31,252,206,2,186,114,27,217,10,2,
+	128,18,62,165,3,19,29,104,68,36,114,118,13,248,82,167,87,188,197,197,22,128,129,78,
+	31,16,136,136,120,202,24,69,96,10,53,184,218,218,11,104,169,2,224,8,39,30,147,205,
+	59,156,71,28,207,179,69,155,187,221,246,240,31,122,211,129,127,57,53,54,224,121,12,8,
+	87,134,38,210,145,101,26,89,206,84,6,50,155,48,197,224,103,10,153,76,28,47,112,200,
+	207,115,40,225,123,186,113,61,123,180,73,136,155,247,151,63,179,122,155,0,99,125,160,217,
+	43,200,246,213,58,13,38,34,198,18,204,229,10,193,36,198,90,125,135,198,50,70,7,57,
+	214,170,182,152,217,92,78,11,38,176,66,155,185,83,54,243,20,209,12,96,10,249,14,61,
+	174,6,3,155,41,61,211,136,97,30,81,138,193,100,250,50,149,64,197,224,119,178,249,59,
+	45,121,140,131,126,186,252,37,252,72,15,174,224,15,109,10,226,118,127,231,98,133,224,61,
+	46,23,0,213,9,88,68,140,101,152,78,76,152,70,39,226,172,188,120,22,42,0,230,151,
+	216,127,223,28,222,34,150,97,76,163,64,155,184,75,138,249,133,49,52,229,62,50,20,134,
+	21,181,98,46,205,21,131,9,13,226,61,133,224,151,242,120,137,54,76,96,131,159,45,119,
+	14,19,233,200,72,82,180,9,136,7,244,227,25,133,224,77,246,119,1,174,107,251,106,117,
+	1,22,17,99,81,251,63,51,185,194,202,11,103,161,2,224,15,249,153,118,221,111,21,227,
+	104,202,189,42,88,185,245,200,235,77,98,25,206,207,118,221,187,132,249,89,202,204,20,66,
+	153,163,46,79,166,117,19,119,41,4,63,149,199,59,36,48,136,111,253,228,28,215,239,220,
+	76,11,30,96,179,86,189,120,68,48,255,35,64,49,120,147,203,45,0,53,90,163,136,24,
+	73,160,90,145,155,138,165,203,181,181,172,180,48,51,185,181,218,219,75,152,203,203,204,211,
+	38,237,17,197,204,98,22,93,120,136,171,207,178,89,173,96,65,142,242,50,129,154,124,126,
+	178,1,116,77,250,115,33,205,57,202,90,126,66,245,91,227,105,198,80,58,19,204,46,126,
+	97,225,201,121,186,95,102,14,233,202,198,79,149,48,159,249,132,115,9,227,24,104,173,241,
+	126,43,216,206,52,62,84,151,95,241,176,151,136,85,8,222,101,127,11,192,42,42,179,106,
+	1,40,34,70,50,128,8,133,96,34,137,180,229,47,171,46,156,165,10,128,175,115,99,149,
+	167,252,138,248,146,87,88,163,205,217,195,254,96,44,79,112,63,183,16,92,229,125,94,84,
+	76,230,240,143,147,243,234,244,227,93,58,149,95,93,204,74,166,51,157,245,74,200,16,18,
+	184,132,75,233,81,161,194,243,39,119,176,8,32,152,255,50,224,100,53,80,252,82,14,159,
+	240,9,81,140,102,36,125,45,245,141,191,137,25,124,199,50,74,180,146,197,227,135,109,106,
+	77,109,96,85,156,221,80,1,80,68,140,228,50,69,96,50,35,121,203,170,139,86,195,66,
+	203,210,144,236,251,152,104,227,134,98,190,225,31,108,50,248,219,175,77,61,130,168,75,112,
+	249,94,75,157,178,34,90,62,71,203,174,41,228,16,5,28,225,56,199,12,190,52,77,121,
+	156,219,108,238,127,125,196,120,24,196,124,125,174,24,92,111,22,150,158,88,191,134,79,109,
+	214,13,210,153,206,116,150,80,164,172,124,34,128,190,92,194,165,196,216,184,173,144,113,124,
+	89,122,241,6,62,81,86,2,64,3,134,50,146,36,34,77,189,20,249,44,97,38,63,144,
+	166,21,42,94,17,194,90,218,42,6,111,251,128,191,217,121,207,59,121,215,214,213,218,207,
+	116,159,175,184,74,33,152,194,215,92,173,16,12,170,6,59,53,166,186,201,252,194,0,171,
+	46,90,45,107,45,206,27,212,224,229,211,22,106,6,79,25,164,229,95,4,77,104,68,35,
+	154,17,73,24,225,132,17,70,56,17,132,81,219,137,105,129,142,146,79,14,57,228,146,91,
+	246,223,125,236,99,55,251,216,199,62,159,55,138,216,205,189,188,198,147,220,120,218,84,164,
+	239,113,143,62,80,204,160,30,159,148,150,255,58,243,113,21,31,19,49,60,200,131,100,243,
+	35,211,249,185,188,72,45,222,88,57,67,184,132,17,213,212,113,106,241,49,235,89,11,240,
+	52,95,56,208,151,74,172,236,0,83,152,2,68,147,68,18,73,38,235,140,82,196,31,36,
+	179,152,95,201,211,170,20,47,122,86,229,63,223,28,45,219,75,45,0,69,196,240,206,85,
+	249,207,116,250,17,106,213,61,206,90,86,91,160,137,252,196,195,140,36,18,200,97,22,175,
+	177,202,71,187,46,45,104,77,11,90,18,69,75,90,16,69,164,155,71,36,14,38,184,202,
+	227,183,34,246,177,139,157,108,39,147,157,108,103,7,59,28,24,80,217,93,182,115,43,207,
+	241,16,87,208,28,56,194,92,38,242,155,62,78,204,225,169,147,13,203,94,57,203,118,27,
+	201,141,220,200,49,146,153,193,92,182,42,57,143,106,203,96,70,144,84,213,172,135,21,212,
+	230,21,46,2,104,199,245,252,87,201,73,5,25,76,102,50,1,36,112,30,189,232,73,188,
+	161,71,8,220,197,114,150,179,156,223,57,172,85,39,94,215,129,187,21,130,111,246,162,93,
+	188,167,38,1,17,17,227,184,72,17,152,78,45,46,228,7,171,46,154,229,108,224,38,32,
+	140,26,228,120,245,117,3,104,67,123,218,209,142,118,196,16,237,211,147,143,1,52,165,41,
+	221,42,92,115,130,109,108,97,11,91,72,39,141,116,175,53,9,218,198,4,38,80,159,90,
+	228,104,168,38,243,136,225,190,210,11,45,24,108,215,3,234,50,146,145,192,22,146,153,199,
+	124,246,43,67,183,138,100,0,73,12,162,157,3,143,25,76,11,50,1,238,86,1,80,108,
+	40,98,45,107,121,31,168,79,23,206,225,92,58,211,137,16,67,188,183,66,54,179,142,53,
+	172,101,13,59,181,170,196,135,94,63,173,27,131,120,137,90,0,138,136,133,168,0,104,70,
+	67,84,0,52,153,92,175,188,74,0,209,116,34,142,4,226,136,35,200,192,121,4,18,83,
+	97,172,176,19,164,177,158,13,164,178,129,141,20,120,252,213,15,233,35,196,92,158,63,185,
+	235,220,211,193,97,66,219,209,142,219,40,102,53,243,72,102,145,225,199,170,52,186,186,244,
+	103,16,73,116,113,162,137,86,13,122,242,61,64,23,186,178,90,89,74,53,31,208,11,89,
+	88,118,36,221,154,88,98,233,192,57,116,164,81,85,211,107,122,232,75,123,11,107,216,68,
+	26,105,108,38,95,171,69,12,113,200,54,76,33,248,134,10,128,34,98,25,33,244,85,8,
+	166,220,7,176,168,90,90,183,206,132,214,129,68,18,73,164,11,245,76,185,4,129,196,19,
+	95,118,185,144,205,164,144,66,10,171,57,162,149,43,16,205,21,39,47,58,55,72,88,77,
+	18,73,228,17,142,179,132,100,230,145,162,137,66,28,254,140,233,70,18,73,244,113,233,24,
+	166,124,237,141,83,1,80,236,16,73,60,113,196,17,79,39,154,121,253,213,195,232,70,7,
+	254,36,149,141,68,177,129,173,154,191,90,124,254,65,252,170,66,240,21,151,11,128,234,2,
+	44,34,70,113,161,62,145,76,41,134,118,108,177,230,238,141,216,173,29,189,233,69,47,206,
+	177,212,95,113,45,226,137,103,28,80,196,102,150,179,148,165,164,234,200,203,159,221,119,170,
+	221,207,1,151,158,40,136,129,12,4,14,179,146,37,44,99,25,217,74,183,90,145,244,166,
+	23,125,232,238,150,158,152,229,107,111,40,15,40,91,57,67,48,173,104,78,43,90,18,69,
+	28,241,6,152,29,184,30,231,113,94,217,229,99,108,100,35,105,100,146,201,14,50,53,174,
+	128,120,221,45,116,82,8,190,226,114,1,48,72,25,138,136,65,12,81,4,38,53,88,5,
+	64,63,21,200,121,244,165,55,189,105,108,241,37,13,32,142,56,110,4,242,88,206,82,22,
+	179,88,109,2,253,79,3,110,58,245,203,114,74,28,236,4,108,75,8,3,202,102,82,223,
+	204,50,150,178,148,63,213,38,176,210,95,94,39,250,208,139,222,196,186,241,89,75,88,126,
+	242,98,220,201,225,0,197,47,191,194,234,211,128,136,178,127,165,255,109,76,20,45,12,62,
+	11,112,93,186,210,181,194,239,199,216,201,46,118,114,128,131,149,254,229,105,10,114,241,208,
+	95,206,163,10,193,119,212,2,80,68,44,227,124,69,96,218,53,247,158,21,23,75,5,192,
+	106,14,202,187,208,143,190,12,33,204,239,150,61,148,193,12,6,10,89,67,50,201,44,226,
+	184,54,8,127,113,91,197,126,237,89,204,118,235,16,72,237,105,207,245,192,33,86,178,132,
+	229,172,246,235,186,84,11,186,210,139,62,244,240,200,204,11,179,201,58,245,75,31,190,209,
+	166,109,2,181,169,7,4,18,2,4,16,10,212,32,28,128,112,106,0,161,4,0,181,168,
+	15,64,80,217,116,208,245,203,190,201,75,11,122,117,8,38,148,218,132,82,151,32,194,12,
+	61,195,175,35,234,18,91,101,133,252,16,5,228,114,140,227,228,82,80,54,232,236,145,178,
+	225,109,75,231,159,42,34,15,128,227,101,3,147,230,81,4,28,230,68,249,61,143,113,28,
+	200,231,40,112,66,51,14,11,99,104,173,16,124,71,99,0,138,136,69,132,169,53,185,105,
+	89,180,116,171,2,160,13,173,25,198,80,46,240,195,194,223,153,155,71,34,137,60,202,113,
+	150,48,135,153,164,106,227,176,190,235,43,255,250,48,3,61,208,147,166,126,89,231,96,216,
+	207,26,214,178,150,53,164,250,197,184,255,65,36,208,153,206,116,166,11,13,60,248,58,199,
+	121,184,226,175,9,42,0,26,68,99,26,209,132,102,52,162,41,13,8,39,132,122,132,148,
+	253,191,158,226,113,250,3,5,26,186,249,57,79,112,152,131,28,225,48,71,56,200,97,114,
+	217,195,110,246,178,135,221,236,243,194,220,89,226,91,53,121,72,33,248,82,13,87,239,169,
+	2,160,136,24,67,95,175,78,169,38,238,212,130,54,108,181,222,98,169,0,88,65,0,93,
+	24,201,8,186,185,161,211,163,181,148,142,229,246,18,123,248,153,25,204,41,107,74,33,22,
+	212,145,142,149,175,88,207,24,190,240,96,95,154,134,229,165,192,66,54,179,182,172,28,184,
+	211,98,177,182,164,51,157,57,151,206,180,247,202,135,110,1,99,88,95,241,138,56,109,218,
+	62,251,240,140,165,61,177,196,210,158,118,52,210,119,174,105,4,18,81,77,39,233,3,108,
+	47,155,175,120,19,105,26,159,208,130,46,39,65,33,248,146,186,0,27,79,77,70,49,138,
+	40,69,107,32,5,108,103,42,83,53,114,187,177,245,83,4,38,214,95,5,64,203,170,203,
+	80,174,100,184,218,252,157,69,19,198,49,142,227,36,243,45,63,112,80,129,88,207,101,103,
+	94,245,29,253,249,15,137,94,248,48,138,39,158,107,0,56,72,26,91,72,103,11,105,108,
+	97,143,41,255,86,218,17,67,76,217,127,27,120,245,181,83,184,147,21,149,175,10,215,166,
+	237,85,205,233,78,15,186,19,71,148,206,39,89,82,3,26,208,165,252,183,3,108,34,133,
+	223,249,157,13,58,14,179,136,199,20,129,111,169,11,176,209,4,49,213,173,67,194,136,123,
+	244,230,106,102,49,74,67,53,25,153,70,0,52,179,254,124,106,189,133,242,251,2,96,93,
+	146,24,205,101,101,67,42,137,125,59,1,35,24,65,17,203,248,134,175,216,173,64,172,228,
+	50,91,87,174,160,7,231,49,154,75,105,231,165,183,17,65,79,122,150,255,118,168,172,24,
+	152,78,58,127,145,101,200,222,119,181,105,70,52,237,202,74,126,237,124,244,137,146,206,116,
+	190,101,57,37,167,223,160,15,56,111,8,166,35,241,244,103,32,49,10,195,175,52,160,55,
+	189,1,56,200,175,204,39,153,13,10,197,212,46,160,187,66,240,45,181,0,244,232,177,95,
+	79,58,16,104,247,253,163,1,94,86,249,207,176,134,241,50,247,148,174,169,91,237,126,208,
+	9,54,177,130,66,165,231,113,117,244,125,98,106,150,108,191,105,165,182,9,13,201,118,236,
+	251,111,8,227,184,180,108,20,117,113,78,17,115,249,148,105,142,78,195,56,136,249,202,206,
+	128,66,200,169,126,156,138,104,70,50,154,222,62,158,87,224,56,187,200,170,244,111,155,87,
+	199,236,175,77,36,205,104,94,233,95,19,31,103,178,158,111,152,65,74,85,55,175,163,179,
+	54,111,143,105,194,0,6,114,33,49,106,237,39,101,214,242,63,62,119,108,159,68,12,228,
+	35,110,80,8,190,245,37,87,219,121,207,103,249,135,173,171,223,97,130,82,180,121,240,115,
+	63,15,209,216,209,135,133,177,87,53,85,3,43,160,49,185,142,63,108,47,175,50,81,69,
+	64,15,235,113,122,167,28,49,149,98,34,172,55,246,153,159,182,0,236,194,245,92,75,83,
+	19,188,211,92,66,13,125,76,25,192,80,134,146,199,84,62,225,55,245,125,50,255,31,198,
+	89,134,169,205,224,77,222,164,25,35,185,212,35,147,131,216,39,136,232,210,19,210,149,246,
+	98,246,145,91,246,147,67,14,185,228,148,255,126,152,147,211,125,218,163,116,34,214,16,194,
+	8,35,156,176,178,255,159,188,20,70,35,199,247,156,61,232,56,243,248,129,25,21,103,252,
+	181,37,68,27,183,71,132,113,53,55,210,75,133,63,57,77,103,222,224,101,190,229,245,170,
+	171,242,98,88,245,24,165,16,124,205,254,83,106,85,236,121,234,83,217,150,250,204,224,2,
+	103,30,216,85,229,63,67,171,77,87,126,113,252,97,141,121,153,225,140,228,144,18,244,160,
+	68,69,96,242,47,163,46,252,102,181,133,242,187,2,96,24,227,184,149,115,124,248,14,14,
+	145,197,62,246,157,86,162,56,198,113,142,80,64,30,69,28,169,162,139,99,0,161,64,4,
+	1,132,82,155,122,149,74,20,17,68,210,136,198,110,159,8,209,62,161,140,103,60,219,248,
+	31,31,176,75,31,21,230,101,103,35,245,44,38,51,153,16,46,226,82,134,123,121,124,187,
+	170,247,98,236,41,203,21,112,4,160,108,252,202,35,80,54,241,106,68,217,81,159,153,118,
+	112,247,51,147,31,248,169,108,137,206,226,152,54,110,183,27,200,120,70,169,9,185,84,115,
+	68,118,29,215,241,43,175,48,83,97,152,202,104,157,50,49,194,159,143,189,170,56,185,167,
+	2,160,45,95,56,87,254,131,34,101,103,112,78,175,161,11,248,130,17,202,207,131,186,41,
+	2,147,75,84,1,208,212,186,112,7,215,121,117,191,238,56,59,216,201,14,118,144,201,14,
+	118,179,135,125,46,12,211,90,196,65,56,203,212,27,129,52,34,146,22,52,167,21,173,104,
+	65,43,162,188,182,196,173,249,39,79,50,157,119,89,112,230,24,100,98,6,93,29,185,243,
+	97,166,50,149,90,244,101,48,131,232,97,138,57,238,107,151,29,84,68,152,120,37,21,178,
+	146,121,204,101,177,35,187,123,123,181,113,187,81,13,70,240,100,133,65,42,69,170,59,184,
+	186,128,229,60,199,12,69,97,26,234,254,107,136,111,107,251,191,19,109,170,169,12,207,48,
+	138,225,206,62,116,53,199,116,190,203,192,142,177,218,249,7,15,103,20,83,149,161,199,104,
+	4,64,179,179,96,27,78,63,41,0,6,114,21,119,149,141,209,237,89,57,229,179,151,110,
+	97,139,15,90,195,157,96,23,187,88,91,233,186,72,218,149,255,180,247,112,247,197,64,174,
+	228,74,54,242,46,31,170,69,185,217,92,194,24,199,31,84,200,175,252,202,147,132,208,139,
+	36,146,232,166,211,238,30,147,65,50,201,36,59,51,255,182,86,138,251,92,200,107,58,159,
+	43,14,57,143,31,88,200,19,44,84,20,38,208,214,217,54,82,226,78,42,0,122,192,157,
+	206,63,244,48,19,249,187,18,52,172,137,174,141,132,125,167,10,128,30,252,40,75,80,8,
+	38,103,193,2,160,31,76,2,82,159,155,185,159,86,30,124,225,131,252,201,6,214,147,202,
+	6,50,77,16,83,124,217,79,2,205,60,154,202,123,188,85,213,28,193,154,4,196,120,90,
+	146,74,168,235,79,211,132,243,73,226,98,143,254,197,249,155,189,252,74,50,63,177,221,149,
+	39,185,145,143,149,164,203,90,243,38,151,42,6,113,210,215,60,196,14,197,96,112,79,242,
+	127,10,193,247,22,218,61,245,226,189,188,101,235,234,247,29,152,15,213,63,212,226,48,117,
+	92,121,248,135,140,85,138,134,244,25,227,93,155,201,35,159,16,77,5,226,33,137,252,174,
+	16,76,174,152,112,171,181,106,178,120,1,176,49,119,50,193,67,99,148,29,100,61,41,164,
+	144,194,122,211,118,120,13,167,19,137,36,146,72,71,143,156,44,45,224,43,94,96,195,153,
+	55,168,0,104,60,211,220,91,216,72,32,137,65,244,241,209,168,148,214,144,205,18,230,145,
+	204,122,119,60,89,30,231,178,85,153,186,160,38,119,240,2,245,21,132,184,224,8,47,240,
+	154,11,35,129,136,231,45,227,60,133,224,123,203,237,30,101,225,78,222,181,117,245,7,220,
+	162,20,43,105,82,213,57,121,251,93,200,149,134,154,6,77,96,47,223,58,51,253,199,233,
+	154,178,71,89,122,196,141,124,168,16,76,175,23,203,173,181,64,22,238,2,220,140,191,115,
+	139,43,39,187,108,58,198,239,44,101,9,43,206,54,235,166,41,228,176,136,69,0,132,211,
+	147,222,244,162,55,97,110,124,254,218,140,99,12,83,121,198,61,37,12,241,156,81,238,110,
+	215,148,74,42,111,2,205,233,75,63,18,233,73,160,82,182,75,17,155,72,97,17,139,221,
+	123,106,33,148,143,25,160,137,186,157,214,130,207,213,49,80,92,86,143,127,113,19,119,51,
+	91,81,24,84,3,141,215,100,12,46,119,1,214,192,23,167,115,195,78,216,47,238,40,53,
+	137,69,183,14,177,41,78,17,88,98,45,170,0,104,6,145,60,202,157,4,187,241,25,247,
+	243,11,191,177,148,63,170,154,111,204,228,114,248,153,159,129,154,196,209,155,254,12,164,165,
+	155,158,185,38,163,25,197,20,254,73,186,62,64,140,170,174,237,30,52,238,176,139,111,248,
+	6,8,161,11,137,244,101,0,145,202,219,166,60,86,176,152,20,22,57,51,198,159,61,206,
+	231,38,62,80,206,78,25,194,103,52,82,12,226,22,209,204,228,125,30,116,109,200,38,241,
+	144,139,76,49,159,149,31,80,1,80,68,44,64,5,64,43,136,183,218,2,89,176,0,24,
+	206,3,220,231,182,126,90,185,252,198,2,230,179,206,79,154,206,20,147,74,42,31,0,177,
+	12,96,0,3,104,226,134,103,173,201,88,174,230,99,254,207,181,81,204,196,83,174,162,185,
+	167,95,226,48,139,88,196,155,212,160,3,189,232,77,34,9,4,41,121,142,145,74,10,75,
+	89,198,102,207,15,37,240,20,159,80,160,204,29,84,131,167,248,135,6,148,23,183,110,83,
+	183,146,196,13,101,13,240,197,72,46,82,4,198,160,73,64,68,196,2,226,21,129,5,88,
+	174,140,107,185,2,224,69,124,226,150,241,41,74,88,195,44,102,177,140,34,63,221,214,211,
+	72,99,50,112,46,195,24,70,111,151,79,138,7,114,51,99,120,208,246,88,45,226,91,183,
+	123,239,165,74,216,200,70,62,2,2,104,77,2,137,196,147,64,156,159,157,172,207,34,149,
+	245,164,144,202,58,111,86,228,162,24,207,36,109,238,14,30,133,190,207,245,138,65,220,46,
+	154,95,121,141,167,200,87,20,6,82,131,33,10,193,24,236,31,192,231,68,85,235,82,68,
+	196,183,130,104,163,16,44,64,5,64,99,27,201,119,46,47,210,81,230,48,139,89,236,210,
+	230,14,192,26,214,240,2,17,92,196,48,134,187,56,161,74,93,254,67,40,47,41,84,99,
+	233,66,47,95,188,108,17,25,100,48,3,128,48,206,33,158,4,18,233,66,61,139,198,92,
+	64,58,41,164,178,158,229,236,245,213,155,120,140,201,166,157,179,200,23,194,249,142,1,138,
+	65,60,162,38,15,51,152,203,53,57,143,129,116,165,153,66,48,6,117,1,22,17,211,235,
+	160,65,37,44,161,45,193,28,181,210,2,89,170,0,216,132,143,92,90,160,195,204,228,91,
+	102,89,107,13,187,201,65,190,228,75,2,25,200,40,46,115,105,48,172,231,248,197,106,35,
+	105,154,221,149,190,127,11,185,229,211,209,4,16,77,12,237,136,33,134,24,218,58,112,16,
+	96,60,249,252,69,58,233,164,179,133,116,254,50,66,107,226,54,244,98,169,54,121,59,69,
+	48,151,68,197,32,30,212,133,21,92,165,113,245,13,67,19,253,24,134,186,0,139,136,233,
+	181,87,4,150,80,147,24,214,90,105,129,44,85,0,188,215,233,246,105,199,152,198,215,204,
+	225,152,54,241,106,157,96,14,115,184,131,11,24,205,85,78,166,29,192,211,12,87,148,198,
+	58,4,181,177,150,218,18,66,6,121,94,127,51,69,164,145,86,225,247,8,18,136,39,154,
+	104,162,105,239,182,177,61,61,37,159,76,50,200,96,61,169,100,176,205,231,37,191,80,162,
+	57,92,185,244,120,185,10,128,118,82,249,79,188,161,17,63,115,63,255,86,16,134,208,77,
+	17,24,133,90,0,138,136,233,181,85,4,22,209,70,5,64,195,114,174,33,83,10,159,242,
+	25,251,181,105,219,173,136,249,204,231,62,134,48,142,75,157,104,161,53,132,115,131,215,40,
+	70,227,232,92,249,215,24,158,224,10,66,1,88,201,183,124,233,211,169,91,14,150,183,13,
+	4,168,75,51,154,87,250,215,178,236,157,122,95,62,7,216,69,86,165,127,89,134,233,95,
+	27,197,53,92,73,15,0,242,248,142,231,78,206,194,125,57,143,104,147,183,67,184,202,127,
+	226,37,129,188,67,23,238,214,104,128,6,160,2,160,97,216,63,6,160,90,0,138,136,65,
+	181,86,4,22,209,198,90,139,99,161,2,96,255,218,49,14,62,98,27,255,229,83,13,191,
+	227,164,124,102,48,131,72,174,229,22,206,113,112,163,187,180,149,10,128,134,17,65,171,138,
+	191,94,207,164,10,179,243,246,160,7,47,176,152,41,124,99,136,34,249,49,50,200,56,99,
+	1,154,211,140,72,194,8,39,156,176,211,126,92,147,123,218,79,14,57,228,146,205,46,178,
+	56,104,208,21,218,144,171,184,150,126,21,154,63,132,114,35,215,112,27,159,0,196,16,70,
+	174,54,251,179,168,205,84,149,255,196,139,110,38,158,75,201,86,16,62,85,87,221,181,140,
+	162,166,3,135,39,154,4,68,68,12,170,141,34,176,8,139,149,114,45,84,0,140,11,180,
+	255,219,190,152,57,188,203,44,191,157,225,215,125,178,121,155,183,233,203,29,92,233,192,249,
+	218,134,154,134,192,56,66,42,254,50,138,15,207,56,109,94,147,254,244,231,45,126,230,11,
+	102,248,160,83,240,217,28,228,32,169,84,117,4,16,78,56,53,8,162,46,16,80,214,90,
+	48,140,154,64,48,117,128,124,142,2,69,101,203,149,75,49,112,148,124,138,201,53,108,137,
+	175,42,97,140,228,26,134,16,104,227,182,32,62,228,8,83,1,98,72,209,102,95,173,26,
+	76,102,160,98,16,175,234,195,111,12,97,167,130,240,161,206,86,155,24,207,188,28,233,91,
+	162,22,128,34,98,80,109,20,129,69,168,0,104,84,147,143,188,72,132,93,229,130,247,153,
+	116,70,43,34,113,197,98,22,115,63,55,113,39,81,118,221,255,200,106,101,102,24,5,167,
+	46,134,243,94,149,251,204,129,12,103,56,249,252,204,84,126,48,77,105,172,132,131,166,43,
+	227,57,35,130,75,184,146,193,213,22,225,107,242,30,243,200,81,1,240,236,158,230,6,133,
+	32,94,23,199,34,134,176,89,65,248,140,58,0,27,134,27,10,128,197,74,81,68,124,76,
+	93,128,173,162,141,181,22,199,82,103,200,230,158,245,30,219,185,159,40,30,85,249,207,3,
+	246,241,18,49,140,179,99,140,204,140,130,191,107,26,96,227,168,80,0,28,79,228,89,238,
+	92,135,145,124,196,30,102,243,183,179,222,87,188,161,17,55,51,155,61,124,196,136,179,182,
+	193,141,100,124,233,255,164,58,35,249,135,66,16,31,29,42,252,74,7,197,224,51,93,21,
+	129,81,212,117,224,190,85,76,223,87,168,20,69,196,199,187,232,245,20,130,69,88,108,58,
+	23,75,21,0,223,170,118,0,254,53,140,35,134,55,56,172,141,216,99,78,240,25,93,24,
+	202,252,106,239,181,240,59,37,101,32,71,78,237,38,15,181,243,33,129,12,229,3,118,179,
+	144,71,232,168,4,125,36,142,71,89,68,22,239,51,212,102,167,95,91,134,2,154,106,160,
+	90,81,124,164,177,163,196,103,154,50,143,24,197,224,35,9,138,192,40,130,29,184,239,81,
+	219,87,107,140,31,17,241,173,22,138,192,50,26,84,24,32,223,2,172,84,0,60,184,248,
+	190,201,5,182,111,250,147,43,232,202,103,85,13,21,44,110,84,194,28,6,209,143,5,85,
+	220,190,42,103,171,186,215,25,73,1,229,29,178,219,56,244,192,0,250,241,18,27,216,204,
+	171,92,160,161,147,188,166,22,3,120,141,52,214,243,34,125,9,112,232,177,109,64,5,192,
+	234,4,242,37,13,20,131,248,244,128,97,158,70,13,242,17,117,214,50,12,71,154,205,84,
+	81,0,84,11,64,17,241,173,198,138,64,107,211,152,172,84,0,44,230,205,103,99,102,253,
+	117,250,213,105,140,229,92,190,71,243,78,120,211,98,6,146,196,210,51,174,95,149,51,187,
+	203,51,5,202,199,80,22,157,188,224,220,9,243,88,30,228,23,114,152,203,189,58,126,242,
+	168,166,92,207,215,236,99,62,15,56,217,72,168,16,208,76,163,213,120,150,222,10,65,124,
+	44,138,31,28,152,83,75,220,165,22,77,21,130,81,184,161,0,168,22,128,34,226,91,77,
+	20,129,214,166,49,89,108,150,172,93,59,134,71,127,252,236,154,242,22,46,235,184,145,120,
+	62,215,88,192,62,49,143,62,92,204,47,229,233,103,20,255,239,251,25,205,158,220,166,100,
+	12,230,183,147,23,54,185,180,187,158,196,27,108,37,149,215,185,200,161,238,59,114,54,193,
+	12,101,34,27,200,226,99,70,19,238,194,51,109,6,88,163,68,171,16,195,67,10,65,12,
+	224,28,38,40,4,175,107,230,96,131,106,241,232,183,158,253,212,2,80,68,12,73,5,64,
+	43,177,84,11,64,11,246,219,187,241,31,60,215,229,233,6,15,151,212,78,103,135,54,87,
+	31,251,137,159,136,36,158,64,178,231,175,25,207,118,37,98,64,179,216,93,218,242,225,7,
+	46,115,249,201,226,137,231,126,242,89,206,124,22,176,12,53,247,116,94,29,122,49,128,129,
+	156,231,208,140,136,213,249,1,246,176,75,201,86,225,102,245,100,23,131,184,157,87,21,130,
+	151,181,82,4,198,97,127,11,192,18,77,2,34,34,198,164,46,192,86,98,169,114,174,53,
+	15,119,10,254,120,146,79,248,55,73,218,90,141,32,155,223,82,153,80,229,160,128,226,243,
+	191,23,38,149,206,123,250,5,79,208,206,45,79,89,135,243,57,159,103,56,202,98,22,240,
+	27,191,107,224,57,7,4,209,157,243,25,64,95,135,102,66,60,187,45,124,1,191,40,223,
+	42,245,87,4,98,16,237,104,65,166,98,240,170,150,138,192,56,236,111,1,120,188,170,1,
+	126,84,0,20,17,223,82,11,64,173,77,131,178,110,123,135,205,12,230,106,158,39,90,91,
+	172,143,101,243,47,254,163,249,87,12,237,61,30,38,24,142,51,150,121,110,237,190,27,204,
+	96,6,3,249,172,100,49,139,89,204,1,165,93,165,134,244,161,31,125,233,238,145,1,192,
+	142,50,150,227,240,165,114,174,146,70,0,19,35,237,106,170,0,232,93,106,1,104,32,246,
+	183,0,60,90,213,13,26,3,80,68,124,171,145,34,176,16,117,1,54,141,175,248,158,91,
+	121,74,77,112,125,230,8,19,121,133,60,5,97,112,187,249,39,47,1,44,227,34,190,162,
+	185,219,95,160,14,253,232,7,148,176,129,229,172,96,5,235,84,19,46,19,72,103,122,210,
+	147,158,196,81,195,99,175,178,139,171,89,6,7,152,173,196,171,116,72,17,136,97,28,86,
+	4,94,214,66,17,24,135,10,128,34,98,122,97,138,64,107,211,152,172,62,226,81,1,239,
+	240,17,15,242,32,245,181,229,122,217,9,254,203,179,100,41,8,83,152,200,88,206,1,88,
+	68,7,238,230,6,58,122,228,101,106,16,79,60,227,129,227,172,102,37,43,88,205,38,191,
+	220,79,175,69,7,186,210,147,30,116,33,200,195,175,181,145,143,121,167,180,158,240,186,250,
+	98,87,99,53,231,42,4,49,132,92,182,40,4,47,139,80,4,198,97,127,79,132,42,11,
+	128,234,2,44,34,190,21,170,8,44,196,82,149,36,127,24,242,252,48,255,228,93,30,225,
+	54,66,180,245,122,73,33,83,248,23,105,10,194,52,78,48,134,165,165,39,221,15,243,34,
+	47,146,192,104,174,167,173,199,94,48,136,222,244,46,123,233,52,82,72,33,133,63,44,223,
+	232,37,132,14,36,144,72,34,93,189,50,83,114,38,83,249,134,69,39,127,221,207,91,218,
+	212,171,241,57,55,42,4,23,229,49,139,238,196,40,8,23,125,165,246,75,94,167,201,235,
+	77,185,50,212,2,80,68,12,74,5,64,173,77,131,242,151,57,15,247,242,16,47,112,47,
+	19,8,215,22,236,97,249,124,200,203,252,165,32,76,102,29,227,249,234,84,31,212,84,82,
+	121,150,62,140,230,90,15,15,98,17,72,60,241,140,3,32,139,84,214,147,202,122,214,90,
+	166,231,120,40,177,68,147,64,60,9,116,164,166,151,94,53,135,25,124,195,236,202,141,32,
+	30,85,39,215,106,205,99,62,3,21,131,147,14,48,157,169,36,147,15,116,101,20,163,60,
+	212,140,216,31,28,230,121,133,224,117,65,138,192,56,220,208,5,88,45,0,69,196,183,212,
+	251,80,107,211,160,106,249,209,138,219,207,211,188,202,93,220,167,49,1,61,230,8,147,120,
+	141,93,10,194,148,190,161,53,175,84,188,162,152,69,44,226,17,6,51,138,75,104,224,133,
+	183,208,140,102,229,147,119,239,32,141,52,210,73,35,157,116,83,245,92,13,34,134,24,98,
+	136,37,134,88,175,143,44,127,128,233,124,75,50,5,167,223,144,204,255,180,145,87,171,132,
+	235,89,165,239,7,7,21,178,140,185,36,179,162,194,1,247,106,86,243,36,49,36,49,152,
+	129,58,237,230,176,91,217,166,16,188,174,174,34,48,14,21,0,69,196,244,84,0,180,18,
+	181,0,52,177,60,94,224,77,198,50,129,78,218,146,221,108,7,255,225,125,246,43,8,19,
+	123,149,192,51,91,158,228,243,35,63,18,200,64,174,228,50,34,189,246,102,90,209,170,188,
+	57,86,49,59,217,198,86,182,177,157,237,108,103,43,199,12,117,220,216,134,214,68,17,69,
+	20,109,104,67,75,15,78,230,81,157,125,124,207,84,22,216,158,94,37,131,235,40,209,38,
+	126,22,153,140,225,39,2,20,132,29,118,179,130,101,44,229,247,42,123,238,167,147,206,123,
+	4,144,64,111,122,209,139,88,37,107,151,183,249,66,33,248,228,131,92,12,67,93,128,69,
+	196,244,223,41,181,20,130,133,88,170,156,91,195,111,87,227,64,38,48,82,135,35,110,178,
+	144,183,152,166,243,173,150,112,45,255,173,250,64,40,128,11,185,140,145,180,246,249,219,60,
+	72,22,89,236,98,15,153,236,101,55,251,217,207,126,143,151,5,235,210,144,134,68,210,132,
+	198,180,160,41,205,105,74,115,3,52,112,218,202,12,166,241,107,213,71,60,121,244,229,79,
+	109,220,118,185,158,143,252,248,155,177,122,89,164,146,193,122,82,249,147,221,14,63,58,144,
+	86,101,125,225,227,137,211,136,107,85,248,129,81,250,46,245,137,223,73,84,8,70,241,13,
+	87,218,121,207,47,185,214,246,13,15,48,81,57,86,210,146,29,10,65,170,208,138,157,10,
+	193,205,26,179,71,33,88,200,65,175,116,133,243,18,255,173,77,207,103,62,109,184,139,27,
+	60,60,192,153,213,29,230,107,222,230,15,5,97,25,95,176,133,239,105,110,251,198,34,230,
+	49,143,9,156,203,72,70,210,195,135,117,146,8,34,136,63,227,218,163,236,103,63,7,56,
+	68,30,135,200,35,135,60,142,115,152,66,14,81,68,30,69,21,70,22,60,193,97,32,132,
+	192,242,107,194,168,73,40,1,212,167,22,33,4,17,74,4,245,9,165,62,161,68,208,144,
+	134,134,171,89,20,179,146,31,152,193,186,234,239,118,156,43,84,254,179,219,39,52,229,37,
+	197,64,33,123,200,100,119,249,191,157,164,85,221,216,198,46,39,200,32,131,25,0,4,208,
+	150,86,180,160,105,217,191,102,52,87,73,16,152,207,213,42,255,249,136,90,0,26,136,90,
+	0,138,136,201,5,42,2,173,79,163,242,239,198,169,91,121,152,199,24,192,173,92,166,63,
+	83,39,164,48,153,47,52,173,128,229,172,160,59,159,50,168,186,187,172,97,13,255,162,25,
+	35,24,198,32,3,181,138,14,38,216,235,99,238,249,70,30,243,152,201,143,246,156,94,204,
+	225,82,126,211,102,237,128,151,201,229,223,30,105,31,94,66,54,251,200,38,155,221,100,147,
+	205,65,242,201,165,144,92,10,56,194,209,10,67,93,230,151,31,215,134,86,120,39,65,212,
+	5,234,16,124,218,127,75,175,175,248,223,147,234,81,187,194,111,21,159,171,244,21,78,214,
+	196,115,56,198,97,242,200,225,80,217,79,142,71,187,140,23,145,78,250,105,215,133,80,159,
+	250,212,39,162,252,82,125,106,1,117,9,2,2,9,169,112,223,92,138,43,164,154,83,233,
+	153,243,128,66,14,217,252,111,105,221,191,176,210,247,86,94,89,169,160,86,133,143,178,26,
+	132,19,72,8,193,212,33,148,90,68,208,136,72,34,105,68,19,34,137,164,142,71,82,249,
+	150,113,28,215,31,160,143,104,18,16,3,209,24,128,34,98,114,53,21,129,214,167,81,169,
+	119,122,17,201,36,211,148,171,185,137,206,218,186,237,148,197,55,124,112,182,102,71,98,226,
+	245,59,152,155,120,245,108,125,91,179,120,159,247,9,160,11,35,25,65,87,125,215,121,197,
+	122,102,144,204,111,103,78,242,97,91,6,151,170,245,159,195,38,177,147,143,105,232,150,231,
+	218,201,230,178,185,108,210,156,154,205,38,207,111,82,63,204,97,178,124,248,250,133,28,172,
+	240,219,129,106,119,3,91,149,207,242,19,75,140,91,78,32,22,243,18,79,86,40,107,138,
+	247,247,6,197,48,194,237,190,103,110,85,55,168,148,174,68,68,91,135,47,105,152,49,107,
+	177,212,65,174,70,58,170,40,129,209,92,71,172,130,168,198,1,102,242,13,179,117,110,213,
+	15,52,229,25,198,87,106,63,84,173,38,92,196,96,6,86,213,123,88,92,148,201,2,126,
+	230,103,71,134,20,41,96,18,79,85,125,124,36,213,106,193,71,229,83,82,59,179,51,189,
+	132,95,89,201,239,236,83,148,22,23,68,23,186,211,143,1,46,204,32,189,147,235,89,160,
+	40,125,42,185,250,118,239,226,77,123,237,30,157,231,46,254,99,251,134,129,250,139,58,227,
+	240,53,71,179,146,138,77,135,8,215,233,39,183,139,102,139,66,176,144,2,15,245,253,240,
+	9,21,0,207,148,192,104,198,210,78,65,156,230,32,63,242,13,63,217,158,98,84,44,42,
+	138,199,73,34,218,145,243,30,209,36,209,143,129,180,80,122,110,177,143,229,44,34,153,85,
+	142,244,200,44,38,131,100,94,96,187,242,115,233,251,113,52,207,59,252,93,144,197,52,190,
+	103,161,206,167,251,225,246,210,137,75,184,130,110,14,62,238,8,175,241,74,149,115,41,139,
+	183,60,204,203,10,193,24,2,57,110,247,78,199,229,76,179,117,117,30,77,61,62,43,152,
+	249,124,199,229,10,65,108,248,158,43,20,130,219,197,144,166,16,44,164,200,74,253,102,85,
+	0,172,42,151,30,140,100,56,93,21,5,144,206,143,252,200,111,42,253,249,173,112,6,51,
+	146,203,43,141,193,101,199,177,240,0,250,210,79,45,2,157,148,201,34,22,179,128,84,199,
+	134,98,59,78,50,51,248,94,237,206,220,164,54,215,114,23,61,236,184,103,9,27,249,137,
+	239,88,162,243,232,126,174,45,163,184,132,158,118,157,43,206,100,50,147,52,83,160,33,52,
+	36,221,0,83,186,11,16,197,54,187,239,219,139,229,182,174,126,137,199,148,227,25,250,243,
+	171,142,251,196,198,222,203,5,44,84,12,110,215,158,77,10,193,82,127,39,22,234,4,172,
+	47,130,234,53,102,40,35,24,234,167,141,230,139,248,131,31,153,65,138,54,4,1,234,49,
+	140,81,12,115,244,175,161,57,125,233,71,95,141,17,104,167,12,22,179,136,197,164,58,250,
+	192,67,204,98,42,179,56,162,12,221,238,28,134,115,49,137,54,71,166,63,194,26,22,179,
+	136,37,100,43,40,41,23,68,119,250,209,151,30,52,177,113,107,33,27,153,203,44,126,209,
+	112,26,6,50,150,79,180,87,108,4,157,249,222,238,251,94,192,206,51,175,92,79,79,125,
+	19,218,244,14,119,41,4,57,205,191,185,91,33,120,64,71,54,40,4,75,9,176,206,9,
+	126,237,234,216,163,46,137,244,37,137,11,252,102,174,224,12,146,73,38,185,210,144,232,34,
+	165,135,181,67,184,130,75,136,112,244,129,13,232,73,15,122,86,113,60,236,239,118,179,146,
+	149,172,96,133,51,127,116,7,152,193,84,230,170,211,169,135,213,164,29,237,137,36,146,90,
+	64,14,59,217,70,166,62,37,229,172,159,153,173,104,73,43,154,82,3,56,192,62,118,144,
+	170,191,86,67,186,131,55,253,102,63,207,186,86,51,146,76,197,80,197,1,236,187,220,162,
+	24,164,130,247,185,67,83,32,121,68,188,227,103,242,197,208,106,89,231,47,69,5,64,71,
+	68,112,33,131,184,144,56,203,54,101,202,96,33,243,152,199,46,173,108,169,86,32,3,184,
+	140,139,136,118,230,193,173,233,65,79,186,209,149,6,126,30,227,126,86,179,138,21,172,116,
+	118,176,190,45,204,97,58,11,212,61,95,68,196,13,58,243,52,35,172,52,212,183,159,217,
+	194,187,188,227,196,108,235,254,100,24,143,209,87,93,50,132,98,22,243,34,179,20,132,135,
+	156,195,90,133,96,41,117,40,176,202,162,168,0,232,140,250,156,75,95,250,209,199,34,245,
+	139,19,172,101,49,41,252,234,192,176,43,34,80,58,227,71,18,67,8,115,238,225,205,137,
+	39,129,68,18,233,232,71,123,163,89,164,144,66,42,235,89,239,216,248,126,167,28,101,9,
+	201,36,171,123,190,136,136,155,213,37,70,13,213,77,232,56,219,53,241,149,157,34,136,113,
+	118,191,77,44,161,144,92,182,170,7,131,71,157,203,31,10,193,98,251,6,150,233,187,161,
+	2,160,43,2,136,167,59,221,232,202,185,142,76,143,96,16,5,172,99,53,171,73,97,181,
+	117,42,218,226,19,181,56,151,145,140,160,155,243,159,40,117,136,33,158,4,226,73,160,3,
+	1,150,139,40,139,84,214,147,202,122,214,112,200,149,39,202,224,71,102,176,80,45,28,68,
+	68,68,68,68,12,168,43,171,20,130,165,212,227,168,85,22,69,5,64,247,168,73,44,93,
+	233,74,60,113,180,49,116,245,98,39,27,216,192,31,172,38,85,221,6,197,205,26,113,33,
+	73,140,164,153,107,79,19,76,7,98,137,33,134,88,98,77,219,16,99,55,105,164,151,253,
+	219,196,49,87,159,46,155,5,36,51,203,214,120,231,34,34,34,34,34,98,16,137,252,174,
+	16,44,37,212,181,22,28,70,162,2,160,251,5,209,145,14,196,211,145,104,218,210,208,231,
+	239,231,16,25,100,176,153,13,172,103,19,121,90,65,226,97,53,73,100,0,253,232,227,158,
+	173,191,62,49,180,33,138,182,68,17,69,107,34,13,186,216,251,216,206,54,182,179,149,237,
+	108,37,141,195,238,121,218,108,150,176,136,5,172,178,206,220,83,34,34,34,34,34,150,213,
+	131,21,10,193,82,194,201,181,202,162,168,0,232,105,161,180,37,154,182,180,161,57,205,104,
+	78,83,130,60,250,122,39,216,75,38,187,201,100,59,127,145,193,95,100,107,37,136,143,68,
+	211,143,190,244,35,206,157,159,52,193,68,209,132,150,52,166,37,77,104,65,19,34,105,232,
+	213,17,4,139,217,79,54,187,201,100,47,59,217,203,78,246,176,205,245,54,126,149,101,177,
+	136,197,44,98,181,10,127,34,34,34,34,34,166,113,30,203,20,130,165,52,176,206,168,153,
+	42,0,122,95,67,154,210,132,70,52,168,240,83,151,48,130,168,71,125,106,157,245,241,37,
+	228,112,140,227,228,144,207,129,242,159,253,28,32,139,61,236,117,118,86,1,17,143,105,66,
+	79,250,210,143,30,212,246,220,159,213,201,159,8,234,19,74,40,225,212,39,148,32,34,128,
+	112,106,16,102,87,145,176,136,60,74,200,1,14,114,156,60,14,145,67,46,135,200,35,135,
+	253,236,103,63,217,28,240,92,82,69,108,98,17,139,249,69,67,153,139,136,136,136,136,136,
+	136,251,168,0,104,52,1,132,2,16,81,254,123,81,217,165,60,138,128,35,154,176,67,76,
+	43,132,243,232,71,119,186,208,210,55,111,32,180,124,128,206,83,151,138,202,251,197,23,250,
+	110,112,135,29,252,193,239,44,98,57,71,180,153,136,136,136,136,136,136,136,187,169,0,40,
+	34,222,23,78,39,18,73,36,209,146,83,254,218,167,136,109,172,39,133,20,86,176,71,155,
+	132,136,136,136,136,136,136,120,142,10,128,34,226,75,181,137,45,43,5,118,37,216,15,150,
+	247,4,105,164,144,66,10,171,213,218,79,68,68,68,68,68,68,188,67,5,64,17,49,134,
+	90,116,164,35,177,180,167,61,177,52,178,208,146,237,101,51,105,108,38,141,141,108,162,80,
+	171,90,68,68,68,68,68,68,188,75,5,64,17,49,162,112,218,17,77,52,209,36,208,137,
+	48,147,189,251,227,100,144,74,6,25,172,103,157,117,166,141,23,17,17,17,17,17,17,115,
+	82,1,80,68,140,175,9,177,180,166,41,45,105,78,11,90,208,140,58,6,122,119,249,236,
+	34,147,76,178,216,73,22,219,72,99,175,86,153,136,136,136,136,136,136,24,135,10,128,34,
+	98,70,141,105,74,43,154,209,130,230,52,39,146,112,194,9,39,200,195,175,122,140,92,114,
+	200,33,155,93,236,98,39,89,236,96,55,251,180,58,68,68,68,68,68,68,196,200,84,0,
+	20,17,235,8,34,156,112,194,202,202,129,225,68,16,78,29,234,1,181,168,15,212,44,235,
+	76,28,1,64,40,144,7,148,144,3,64,46,197,192,33,10,129,35,228,147,195,65,114,42,
+	253,228,43,98,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,
+	17,17,17,17,17,17,17,17,87,253,63,108,61,94,185,18,158,57,104,0,0,0,37,116,
+	69,88,116,100,97,116,101,58,99,114,101,97,116,101,0,50,48,49,56,45,48,53,45,48,
+	53,84,49,53,58,49,53,58,53,49,43,48,48,58,48,48,206,249,106,82,0,0,0,37,
+	116,69,88,116,100,97,116,101,58,109,111,100,105,102,121,0,50,48,49,56,45,48,53,45,
+	48,53,84,49,53,58,49,53,58,53,49,43,48,48,58,48,48,191,164,210,238,0,0,0,
+	0,73,69,78,68,174,66,96,130,
+};
+const EmbeddedAsset piecesTextureAsset = { piecesTextureAssetData, sizeof(piecesTextureAssetData) };
+
+// Fonts/Pixel NES.otf
+static const unsigned char fontAssetData[] = {
+	0,1,0,0,0,15,0,128,0,3,0,112,68,83,73,71,0,0,0,1,0,0,81,68,
+	0,0,0,8,71,68,69,70,0,1,0,0,0,0,81,76,0,0,0,12,71,80,79,83,
+	0,25,0,12,0,0,81,88,0,0,0,18,71,83,85,66,62,230,64,31,0,0,81,108,
+	0,0,0,190,79,83,47,50,118,168,96,1,0,0,1,120,0,0,0,96,99,109,97,112,
+	189,79,187,225,0,0,5,136,0,0,3,102,103,97,115,112,255,255,0,3,0,0,81,60,
+	0,0,0,8,103,108,121,102,207,166,17,196,0,0,10,204,0,0,65,52,104,101,97,100,
+	2,139,229,21,0,0,0,252,0,0,0,54,104,104,101,97,14,18,5,207,0,0,1,52,
+	0,0,0,36,104,109,116,120,10,121,3,48,0,0,1,216,0,0,3,176,108,111,99,97,
+	90,43,73,234,0,0,8,240,0,0,1,218,109,97,120,112,0,241,0,92,0,0,1,88,
+	0,0,0,32,110,97,109,101,113,181,8,207,0,0,76,0,0,0,2,247,112,111,115,116,
+	178,79,55,144,0,0,78,248,0,0,2,67,0,1,0,0,0,1,0,0,106,74,150,101,
+	95,15,60,245,0,11,8,0,0,0,0,0,206,150,204,210,0,0,0,0,206,150,205,8,
+	0,0,254,112,6,64,7,208,0,0,0,6,0,1,0,0,0,0,0,0,0,1,0,0,
+	7,208,254,112,0,0,6,114,0,0,0,0,6,64,0,1,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,236,0,1,0,0,0,236,0,92,0,4,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,5,125,1,144,0,5,
+	0,8,5,154,5,51,0,0,1,27,5,154,5,51,0,0,3,209,0,102,2,18,0,0,
+	2,0,5,0,0,0,0,0,0,0,128,0,0,167,80,0,0,74,0,0,0,0,0,0,
+	0,0,80,88,83,71,1,64,0,0,251,2,5,120,0,0,0,205,7,208,1,144,32,0,
+	0,1,0,0,0,0,5,120,5,120,0,0,0,32,0,3,6,114,0,0,0,0,0,0,
+	1,252,0,0,6,74,0,0,5,120,0,0,3,32,0,0,4,176,0,0,6,64,0,0,
+	6,64,0,0,6,64,0,0,1,144,0,0,5,120,0,0,5,120,0,0,4,176,0,0,
+	4,176,0,0,1,144,0,0,4,176,0,0,1,144,0,0,6,64,0,0,6,64,0,0,
+	5,120,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,1,144,0,0,1,144,0,0,5,120,0,0,
+	4,176,0,0,5,120,0,0,6,64,0,0,6,75,0,0,6,64,0,0,6,64,0,0,
+	6,64,0,0,6,64,0,0,5,120,0,0,5,120,0,0,6,64,0,0,6,64,0,0,
+	5,120,0,0,6,64,0,0,6,64,0,0,5,120,0,0,6,64,0,0,6,64,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,5,120,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,5,120,0,0,6,64,0,0,
+	5,120,0,0,6,64,0,0,5,120,0,0,3,232,0,0,6,64,0,0,3,232,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,5,120,0,0,5,120,0,0,
+	6,64,0,0,6,64,0,0,5,120,0,0,6,64,0,0,6,64,0,0,5,120,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,
+	6,64,0,0,5,120,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,
+	5,120,0,0,6,64,0,0,5,120,0,0,1,144,0,0,5,120,0,0,5,120,0,0,
+	5,120,0,0,6,64,0,0,6,64,0,0,6,64,0,0,5,120,0,0,1,144,0,0,
+	6,64,0,0,3,232,0,0,6,64,0,0,6,114,0,0,5,120,0,0,3,246,0,87,
+	6,64,0,0,6,64,0,0,2,162,0,60,6,114,0,0,6,114,0,0,6,114,0,0,
+	3,232,0,0,6,64,0,0,4,0,0,93,1,144,0,0,3,32,0,0,6,114,0,0,
+	6,114,0,0,5,120,0,0,6,114,0,0,6,114,0,0,6,114,0,0,6,64,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,
+	6,64,0,0,6,64,0,0,5,120,0,0,5,120,0,0,5,120,0,0,5,120,0,0,
+	5,120,0,0,5,120,0,0,5,120,0,0,5,120,0,0,6,64,0,0,6,64,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,200,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,5,120,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,5,120,0,0,5,120,0,0,
+	5,120,0,0,5,120,0,0,5,120,0,0,5,120,0,0,5,120,0,0,5,120,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,
+	6,64,0,0,4,176,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,
+	6,64,0,0,5,120,0,0,6,64,0,0,5,120,0,0,2,2,0,19,3,232,0,0,
+	3,232,0,0,3,232,0,0,3,232,0,0,1,144,0,0,1,144,0,0,3,32,0,0,
+	5,120,0,0,4,176,0,0,4,176,0,0,4,176,0,0,1,144,0,0,1,144,0,0,
+	1,144,0,0,3,32,0,0,3,32,0,0,3,32,0,0,3,246,0,71,3,246,0,70,
+	4,0,0,216,4,176,0,0,5,120,0,0,5,120,0,0,6,64,0,0,5,120,0,0,
+	6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,64,0,0,6,114,0,0,
+	6,114,0,0,6,114,0,0,6,114,0,0,4,176,0,0,6,114,0,0,6,114,0,0,
+	6,114,0,0,6,114,0,0,6,114,0,0,6,114,0,0,4,49,0,0,4,57,0,0,
+	0,0,0,3,0,0,0,3,0,0,0,28,0,1,0,0,0,0,1,92,0,3,0,1,
+	0,0,0,28,0,4,1,64,0,0,0,74,0,64,0,5,0,10,0,0,0,29,0,126,
+	0,160,0,172,0,173,0,255,1,49,2,199,2,201,2,221,3,126,32,20,32,26,32,30,
+	32,34,32,38,32,58,32,68,32,164,32,167,32,172,33,22,33,34,34,2,34,6,34,15,
+	34,18,34,21,34,26,34,30,34,43,34,72,34,101,240,2,251,2,255,255,0,0,0,0,
+	0,29,0,32,0,160,0,161,0,173,0,174,1,49,2,198,2,201,2,216,3,126,32,19,
+	32,24,32,28,32,32,32,38,32,57,32,68,32,163,32,167,32,172,33,22,33,34,34,2,
+	34,6,34,15,34,17,34,21,34,25,34,30,34,43,34,72,34,100,240,1,251,1,255,255,
+	0,1,255,228,255,227,0,0,255,193,0,0,255,192,255,143,253,251,253,250,253,236,252,160,
+	224,183,224,180,224,179,224,178,224,175,224,157,224,148,224,54,224,52,224,48,223,199,223,188,
+	222,221,222,218,222,210,222,209,222,195,0,0,222,199,222,187,222,159,222,132,16,233,5,233,
+	0,1,0,0,0,0,0,0,0,68,0,0,0,66,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,3,0,16,0,119,0,228,0,6,2,10,0,0,0,0,1,0,0,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,2,0,0,0,0,0,0,
+	0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,3,0,4,0,5,0,6,0,7,
+	0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,
+	0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,
+	0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,
+	0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,
+	0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,
+	0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,
+	0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,
+	0,92,0,93,0,94,0,95,0,96,0,97,0,0,0,132,0,133,0,135,0,137,0,145,
+	0,150,0,156,0,161,0,160,0,162,0,164,0,163,0,165,0,167,0,169,0,168,0,170,
+	0,171,0,173,0,172,0,174,0,175,0,177,0,179,0,178,0,180,0,182,0,181,0,186,
+	0,185,0,187,0,188,0,210,0,112,0,99,0,100,0,104,0,212,0,118,0,159,0,110,
+	0,106,0,222,0,116,0,105,0,0,0,134,0,152,0,229,0,113,0,232,0,233,0,102,
+	0,117,0,223,0,226,0,225,0,0,0,230,0,107,0,122,0,0,0,166,0,184,0,127,
+	0,98,0,109,0,228,0,0,0,231,0,224,0,108,0,123,0,213,0,3,0,128,0,131,
+	0,149,0,0,0,0,0,202,0,203,0,207,0,208,0,204,0,205,0,183,0,0,0,191,
+	0,0,0,216,0,220,0,214,0,215,0,234,0,235,0,211,0,119,0,206,0,209,0,0,
+	0,130,0,138,0,129,0,139,0,136,0,141,0,142,0,143,0,140,0,147,0,148,0,0,
+	0,146,0,154,0,155,0,153,0,192,0,193,0,200,0,111,0,196,0,197,0,198,0,120,
+	0,201,0,199,0,194,0,0,0,0,0,38,0,38,0,38,0,38,0,68,0,88,0,130,
+	0,184,0,236,1,44,1,58,1,82,1,106,1,164,1,190,1,204,1,218,1,230,2,10,
+	2,60,2,84,2,124,2,164,2,202,2,236,3,18,3,50,3,114,3,154,3,172,3,192,
+	3,228,3,248,4,28,4,68,4,104,4,144,4,184,4,224,5,4,5,30,5,54,5,90,
+	5,116,5,140,5,164,5,206,5,222,5,254,6,30,6,60,6,90,6,134,6,176,6,220,
+	6,240,7,8,7,44,7,76,7,126,7,154,7,190,7,208,7,244,8,6,8,34,8,46,
+	8,64,8,104,8,144,8,184,8,220,8,246,9,14,9,50,9,76,9,100,9,124,9,166,
+	9,182,9,214,9,246,10,20,10,50,10,94,10,136,10,180,10,200,10,224,11,4,11,36,
+	11,86,11,114,11,150,11,182,11,194,11,228,12,8,12,40,12,86,12,126,12,168,12,204,
+	12,224,13,20,13,38,13,92,13,130,13,204,13,222,14,16,14,30,14,68,14,106,14,144,
+	14,182,14,200,14,224,14,252,15,8,15,28,15,66,15,104,15,178,15,216,15,254,16,36,
+	16,76,16,128,16,180,16,240,17,52,17,104,17,150,17,192,17,244,18,26,18,64,18,110,
+	18,148,18,184,18,220,19,10,19,46,19,90,19,150,19,192,19,234,20,28,20,86,20,128,
+	20,160,20,212,20,248,21,28,21,74,21,110,21,150,21,182,21,220,22,16,22,68,22,128,
+	22,196,22,248,23,38,23,80,23,132,23,170,23,208,23,254,24,36,24,72,24,108,24,154,
+	24,190,24,234,25,38,25,80,25,122,25,172,25,230,26,16,26,42,26,94,26,130,26,166,
+	26,212,26,248,27,32,27,64,27,104,27,132,27,160,27,188,27,202,27,220,27,232,27,244,
+	28,8,28,44,28,76,28,90,28,104,28,118,28,132,28,146,28,166,28,186,28,206,29,28,
+	29,156,29,178,29,202,29,238,30,18,30,54,30,84,30,124,30,162,30,202,30,236,31,16,
+	31,54,31,92,31,130,31,168,31,182,31,220,32,2,32,40,32,78,32,116,32,154,32,154,
+	32,154,0,0,0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,
+	51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,
+	200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,
+	4,75,175,175,251,180,175,0,0,2,0,0,0,0,4,176,5,120,0,3,0,17,0,0,
+	55,21,35,53,1,35,21,35,17,51,17,51,53,33,17,35,21,35,202,202,3,32,200,200,
+	200,200,1,144,200,200,202,202,202,1,142,200,1,144,1,144,200,254,112,200,0,2,0,0,
+	3,232,2,88,5,123,0,3,0,7,0,0,19,17,35,17,33,17,35,17,202,202,2,88,
+	201,5,123,254,109,1,147,254,109,1,147,0,0,2,0,0,0,200,3,238,4,176,0,3,
+	0,31,0,0,1,21,51,53,51,21,51,21,35,21,35,53,35,21,35,53,35,53,51,53,
+	35,53,51,53,51,21,51,53,51,21,51,21,1,144,200,200,206,202,201,202,199,202,202,202,
+	200,200,200,200,200,3,32,200,200,200,199,201,201,201,201,199,202,198,200,200,200,200,200,0,
+	0,3,0,0,0,0,5,120,5,120,0,3,0,31,0,35,0,0,1,21,51,53,39,33,
+	21,51,21,35,21,37,21,35,53,37,39,33,53,33,53,35,53,51,39,33,53,51,21,33,
+	21,33,7,53,35,21,3,32,200,200,1,144,200,200,254,116,204,254,114,2,1,144,254,112,
+	200,202,2,1,144,200,1,144,254,112,200,200,2,88,200,200,200,200,200,200,2,202,200,2,
+	198,200,200,206,194,200,200,200,200,200,200,0,0,3,0,0,0,0,5,120,5,120,0,23,
+	0,27,0,31,0,0,1,35,21,35,21,35,21,33,17,51,53,51,53,51,53,51,53,51,
+	53,33,17,35,21,35,1,17,33,17,1,17,33,17,3,232,200,200,200,254,112,200,200,200,
+	200,200,1,144,200,200,253,168,254,112,5,120,254,112,2,88,200,200,200,1,144,200,200,200,
+	200,200,254,112,200,2,88,254,112,1,144,252,24,254,112,1,144,0,0,0,0,3,0,0,
+	0,0,5,120,5,120,0,5,0,13,0,43,0,0,37,33,53,35,53,35,37,17,39,33,
+	21,51,21,51,19,51,17,35,7,21,51,21,51,55,17,51,17,35,7,21,51,21,33,53,
+	35,17,51,53,35,17,51,53,33,21,1,144,1,144,200,200,1,144,25,254,137,200,175,50,
+	175,175,25,200,175,25,200,175,25,200,251,82,202,202,202,200,2,88,200,200,200,225,1,94,
+	25,200,200,1,144,254,112,25,175,200,25,1,119,254,112,25,175,200,202,1,145,201,1,140,
+	200,175,0,0,0,1,0,0,3,232,0,202,5,123,0,3,0,0,19,17,35,17,202,202,
+	5,123,254,109,1,147,0,0,0,1,0,0,0,0,4,176,5,120,0,11,0,0,55,35,
+	17,51,53,33,21,33,17,33,21,33,200,200,200,3,232,252,224,3,32,252,26,200,3,232,
+	200,200,252,24,200,0,0,0,0,1,0,0,0,0,4,176,5,120,0,11,0,0,41,1,
+	53,33,17,33,53,33,21,51,17,35,3,230,252,26,3,32,252,224,3,232,200,200,200,3,
+	232,200,200,252,24,0,0,0,0,1,0,0,0,200,3,238,4,178,0,44,0,0,19,21,
+	35,53,23,55,51,53,35,53,23,53,39,35,53,51,21,23,51,21,51,53,51,55,53,51,
+	21,35,7,21,55,21,35,21,23,51,21,35,53,39,35,53,35,21,35,200,200,175,25,2,
+	202,200,25,175,200,25,175,200,175,25,202,177,25,206,202,20,178,202,25,175,199,176,1,119,
+	175,201,1,25,175,201,1,175,25,200,175,25,200,200,25,177,202,25,175,1,201,179,20,201,
+	175,25,200,200,0,1,0,0,0,200,3,232,4,176,0,11,0,0,1,3,51,17,33,21,
+	33,17,35,17,33,53,1,145,1,200,1,144,254,112,200,254,112,3,34,1,142,254,112,200,
+	254,112,1,144,202,0,0,0,0,1,0,0,255,56,0,200,0,200,0,3,0,0,55,17,
+	35,17,200,200,200,254,112,1,144,0,0,0,0,1,0,0,2,88,3,232,3,32,0,3,
+	0,0,17,33,21,33,3,232,252,24,3,32,200,0,0,0,0,1,0,0,0,0,0,200,
+	0,200,0,3,0,0,55,21,35,53,200,200,200,200,200,0,0,1,0,0,0,0,5,120,
+	5,120,0,23,0,0,1,35,21,35,21,35,21,33,17,51,53,51,53,51,53,51,53,51,
+	53,33,17,35,21,35,3,232,200,200,200,254,112,200,200,200,200,200,1,144,200,200,2,88,
+	200,200,200,1,144,200,200,200,200,200,254,112,200,0,0,0,0,2,0,0,0,0,5,120,
+	5,120,0,21,0,31,0,0,37,21,33,39,35,53,39,17,51,53,51,55,53,33,21,51,
+	21,51,17,35,21,35,1,17,51,21,33,55,17,35,53,33,3,232,253,171,3,200,200,200,
+	175,25,2,88,200,200,200,175,253,143,200,1,119,25,200,254,137,175,175,200,200,3,2,85,
+	200,25,175,200,200,253,168,200,3,207,252,249,200,25,3,7,200,0,0,0,0,1,0,0,
+	0,0,4,176,5,120,0,11,0,0,1,17,33,21,33,53,33,17,35,53,51,53,3,32,
+	1,144,251,80,1,144,200,200,5,120,251,80,200,200,3,32,200,200,0,0,0,1,0,0,
+	0,0,5,120,5,120,0,25,0,0,41,1,17,51,53,51,53,33,3,33,21,33,53,51,
+	53,33,21,51,17,35,21,33,21,35,21,33,5,120,250,136,202,201,2,91,6,253,168,254,
+	112,200,3,232,200,200,254,112,200,3,32,1,147,200,201,1,140,200,200,200,200,254,112,200,
+	200,200,0,0,0,1,0,0,0,0,5,120,5,120,0,27,0,0,51,53,35,53,33,21,
+	5,17,33,53,51,53,51,53,33,53,33,21,35,21,35,21,51,21,51,17,39,21,202,202,
+	1,147,2,85,253,168,200,200,253,168,4,176,200,200,200,200,192,202,201,201,2,1,144,200,
+	200,200,200,200,200,200,200,254,112,2,202,0,0,2,0,0,0,0,5,120,5,120,0,5,
+	0,21,0,0,1,35,21,35,21,33,3,33,17,51,21,35,17,33,17,33,17,51,39,51,
+	53,51,3,32,200,200,1,144,200,2,88,200,200,254,112,252,224,202,2,200,200,3,232,200,
+	200,3,32,252,224,200,254,112,1,144,1,148,196,200,0,0,0,1,0,0,0,0,5,120,
+	5,120,0,19,0,0,1,21,33,21,51,17,35,21,33,53,35,53,33,21,5,17,33,17,
+	33,21,1,144,3,32,200,200,252,26,202,1,147,2,85,252,24,4,176,4,176,200,200,253,
+	168,200,202,201,201,2,2,88,2,88,200,0,0,2,0,0,0,0,5,120,5,120,0,19,
+	0,23,0,0,51,53,35,17,51,53,51,53,33,21,33,21,35,21,33,21,51,17,35,21,
+	37,33,17,33,200,200,200,200,3,32,253,168,200,3,32,200,200,252,224,2,88,253,168,200,
+	3,32,200,200,200,200,200,200,254,112,200,200,1,144,0,0,0,1,0,0,0,0,5,120,
+	5,120,0,19,0,0,19,21,35,17,33,17,35,21,35,21,35,17,33,17,51,53,51,53,
+	51,53,200,200,5,120,200,200,200,254,112,200,200,200,4,176,200,1,144,254,112,200,200,253,
+	168,2,88,200,200,200,0,0,0,3,0,0,0,0,5,120,5,120,0,7,0,32,0,40,
+	0,0,27,1,23,33,53,33,53,33,37,7,21,33,17,35,21,33,53,39,53,35,17,51,
+	55,53,35,17,51,53,33,21,23,51,17,35,55,17,39,33,21,51,21,200,2,23,3,7,
+	254,112,254,137,3,32,25,1,144,200,252,24,25,175,175,25,200,200,3,32,25,175,225,25,
+	25,253,193,200,2,63,254,160,23,200,200,200,25,175,254,112,200,175,25,2,1,142,25,175,
+	1,144,200,175,25,254,112,25,1,94,25,200,200,0,0,0,0,2,0,0,0,0,5,120,
+	5,120,0,19,0,23,0,0,1,21,51,17,35,21,35,21,33,53,33,53,51,53,33,53,
+	35,17,51,53,5,33,17,33,4,176,200,200,200,252,224,2,88,200,252,224,200,200,3,32,
+	253,168,2,88,5,120,200,252,224,200,200,200,200,200,200,1,144,200,200,254,112,0,0,0,
+	0,2,0,0,0,0,0,200,3,32,0,3,0,7,0,0,55,21,35,53,19,21,35,53,
+	200,200,200,200,200,200,200,2,88,200,200,0,0,2,0,0,255,56,0,200,3,32,0,3,
+	0,7,0,0,55,17,35,17,19,21,35,53,200,200,200,200,200,254,112,1,144,2,88,200,
+	200,0,0,0,0,1,0,0,0,199,4,184,4,176,0,19,0,0,37,5,53,7,55,37,
+	53,5,39,51,53,37,21,5,21,35,21,55,21,37,4,184,253,159,203,1,254,115,1,141,
+	1,200,2,92,254,108,200,204,1,152,200,1,201,1,201,1,201,1,198,200,1,200,1,200,
+	200,1,200,1,0,2,0,0,1,144,3,232,3,232,0,3,0,7,0,0,17,33,21,33,
+	17,33,21,33,3,232,252,24,3,232,252,24,2,88,200,2,88,200,0,0,0,1,0,0,
+	0,199,4,184,4,176,0,19,0,0,17,5,53,23,53,35,53,37,53,5,21,51,7,37,
+	21,5,23,39,21,37,1,152,204,200,254,108,2,92,200,1,1,141,254,115,1,203,253,159,
+	1,145,1,200,1,200,200,1,200,1,200,198,1,201,1,201,1,201,1,0,0,2,0,0,
+	0,0,5,120,5,120,0,19,0,23,0,0,1,33,17,33,21,33,53,51,53,33,21,51,
+	17,35,21,33,21,37,39,51,19,35,53,51,2,88,1,144,253,168,254,112,200,3,232,200,
+	200,254,112,254,115,3,200,3,200,200,3,32,1,144,200,200,200,200,254,112,200,200,3,197,
+	253,168,202,0,0,1,0,0,0,0,5,129,5,129,0,21,0,0,37,21,33,53,35,17,
+	51,53,33,21,51,17,35,21,33,17,51,17,51,17,33,17,4,184,252,18,202,202,3,238,
+	201,201,253,163,201,202,253,165,202,202,202,3,238,201,201,253,163,200,2,91,254,109,2,93,
+	252,18,0,0,0,2,0,0,0,0,5,120,5,120,0,15,0,23,0,0,17,51,53,51,
+	53,33,21,51,21,51,17,33,17,33,17,33,1,21,35,17,33,17,35,53,200,200,2,88,
+	200,200,254,112,253,168,254,112,2,88,200,2,88,200,3,232,200,200,200,200,252,24,1,144,
+	254,112,4,176,200,254,112,1,144,200,0,0,0,3,0,0,0,0,5,120,5,120,0,11,
+	0,15,0,19,0,0,1,51,17,35,21,33,17,33,21,51,17,35,5,17,33,17,1,17,
+	33,17,4,176,200,200,251,80,4,176,200,200,252,224,2,88,253,168,2,88,2,88,254,112,
+	200,5,120,200,254,112,200,254,112,1,144,2,88,254,112,1,144,0,0,0,0,1,0,0,
+	0,0,5,120,5,120,0,27,0,0,37,53,33,21,35,21,33,53,35,53,35,17,51,53,
+	51,53,33,21,51,21,33,53,33,21,35,17,51,21,3,232,1,144,200,252,224,200,200,200,
+	200,3,32,200,254,112,254,112,200,200,200,200,200,200,200,200,2,88,200,200,200,200,200,200,
+	253,168,200,0,0,2,0,0,0,0,5,120,5,120,0,11,0,19,0,0,1,35,21,35,
+	21,33,17,33,21,51,21,51,1,17,35,53,33,17,33,53,5,120,200,200,252,24,3,232,
+	200,200,254,112,200,254,112,1,144,1,144,200,200,5,120,200,200,253,168,2,88,200,252,24,
+	200,0,0,0,0,1,0,0,0,0,4,176,5,120,0,11,0,0,1,33,17,33,21,33,
+	17,33,21,33,17,33,4,176,252,224,3,32,251,80,4,176,252,224,3,32,2,88,254,112,
+	200,5,120,200,254,112,0,0,0,1,0,0,0,0,4,176,5,120,0,9,0,0,1,33,
+	17,33,17,33,21,33,17,33,4,176,252,224,254,112,4,176,252,224,3,32,2,88,253,168,
+	5,120,200,254,112,0,0,0,0,1,0,0,0,0,5,120,5,120,0,23,0,0,41,1,
+	53,35,53,35,17,51,53,51,53,33,21,33,21,35,17,51,21,33,17,35,53,33,5,120,
+	252,24,200,200,200,200,3,232,252,224,200,200,1,144,200,2,88,200,200,2,88,200,200,200,
+	200,253,168,200,1,144,200,0,0,1,0,0,0,0,5,120,5,120,0,11,0,0,17,33,
+	17,33,17,33,17,33,17,33,17,33,1,144,2,88,1,144,254,112,253,168,254,112,5,120,
+	253,168,2,88,250,136,2,88,253,168,0,0,0,1,0,0,0,0,4,176,5,120,0,11,
+	0,0,1,17,33,21,33,53,33,17,33,53,33,21,3,32,1,144,251,80,1,144,254,112,
+	4,176,4,176,252,24,200,200,3,232,200,200,0,1,0,0,0,0,5,120,5,120,0,11,
+	0,0,37,17,33,17,35,21,33,39,35,53,33,21,3,232,1,144,200,252,26,2,200,1,
+	144,200,4,176,251,80,200,200,200,200,0,0,0,1,0,0,0,0,5,120,5,120,0,29,
+	0,0,17,33,17,51,53,51,53,51,53,33,21,35,21,35,21,35,21,51,21,51,21,51,
+	21,33,53,35,53,35,17,33,1,144,200,200,200,1,144,200,200,200,200,200,200,253,168,200,
+	200,254,112,5,120,253,168,200,200,200,200,200,200,200,200,200,200,200,200,254,112,0,0,0,
+	0,1,0,0,0,0,4,176,5,120,0,5,0,0,37,33,21,33,17,33,1,144,3,32,
+	251,80,1,144,200,200,5,120,0,1,0,0,0,0,5,120,5,120,0,19,0,0,17,33,
+	21,51,21,51,53,51,53,33,17,33,17,35,21,35,53,35,17,33,1,144,200,200,200,1,
+	144,254,112,200,200,200,254,112,5,120,200,200,200,200,250,136,3,32,200,200,252,224,0,0,
+	0,1,0,0,0,0,5,120,5,120,0,19,0,0,17,33,21,51,21,51,21,51,17,33,
+	17,33,53,35,53,35,53,35,17,33,1,144,200,200,200,1,144,254,112,200,200,200,254,112,
+	5,120,200,200,200,2,88,250,136,200,200,200,253,168,0,0,0,2,0,0,0,0,5,120,
+	5,120,0,11,0,15,0,0,41,1,53,35,17,51,53,33,21,51,17,35,3,33,17,33,
+	4,176,252,24,200,200,3,232,200,200,200,253,168,2,88,200,3,232,200,200,252,24,3,232,
+	252,24,0,0,0,2,0,0,0,0,5,120,5,120,0,3,0,13,0,0,1,17,33,17,
+	1,17,33,17,33,21,51,17,35,21,1,144,2,88,253,168,254,112,4,176,200,200,4,176,
+	253,168,2,88,252,224,254,112,5,120,200,253,168,200,0,0,0,2,0,0,0,0,5,120,
+	5,120,0,7,0,27,0,0,1,33,17,33,53,35,53,33,19,35,21,33,39,35,17,51,
+	53,33,21,51,17,35,21,23,51,21,35,53,3,232,253,168,1,144,200,1,144,175,175,252,
+	226,2,200,200,3,232,200,200,25,175,200,4,176,252,24,200,200,254,112,200,200,3,232,200,
+	200,252,224,175,25,200,175,0,0,2,0,0,0,0,5,129,5,120,0,5,0,23,0,0,
+	1,17,33,53,51,17,1,17,33,17,33,21,51,17,33,21,51,21,55,21,33,53,35,53,
+	1,144,1,144,200,253,168,254,112,4,176,200,254,112,200,209,253,159,200,4,176,253,168,200,
+	1,144,252,224,254,112,5,120,200,253,168,200,200,2,202,200,200,0,0,0,0,1,0,0,
+	0,0,5,120,5,120,0,27,0,0,1,33,53,33,17,33,21,51,17,35,21,33,53,35,
+	53,33,7,33,17,33,53,35,17,51,53,33,21,51,4,176,254,112,254,112,3,32,200,200,
+	252,24,200,1,147,3,2,88,252,224,200,200,3,32,200,3,232,200,254,112,200,254,112,200,
+	200,203,203,1,144,200,1,144,200,200,0,0,0,1,0,0,0,0,4,176,5,120,0,7,
+	0,0,33,3,33,53,33,21,33,17,1,145,1,254,112,4,176,254,112,4,176,200,200,251,
+	80,0,0,0,0,1,0,0,0,0,5,120,5,120,0,11,0,0,1,17,33,17,33,17,
+	35,21,33,53,35,17,1,144,2,88,1,144,200,252,24,200,5,120,251,80,4,176,251,80,
+	200,200,4,176,0,1,0,0,0,0,5,120,5,120,0,23,0,0,17,33,17,51,21,51,
+	53,51,17,33,17,35,21,35,21,35,21,35,39,35,53,35,53,39,1,144,200,200,200,1,
+	144,200,200,200,197,3,200,200,200,5,120,253,168,200,200,2,88,252,224,200,200,200,200,200,
+	200,3,0,0,0,1,0,0,0,0,5,120,5,120,0,19,0,0,49,17,33,17,51,55,
+	51,21,23,17,33,17,33,53,35,53,35,21,35,21,1,144,200,3,201,196,1,144,254,112,
+	200,200,200,5,120,252,224,204,201,3,3,32,250,136,200,200,200,200,0,0,0,1,0,0,
+	0,0,5,120,5,120,0,35,0,0,1,21,35,21,51,21,51,17,33,53,35,53,35,21,
+	35,21,33,17,51,53,51,53,35,53,35,17,33,21,51,21,51,53,51,53,33,17,4,176,
+	200,200,200,254,112,200,200,200,254,112,200,200,200,200,1,144,200,200,200,1,144,3,232,200,
+	200,200,254,112,200,200,200,200,1,144,200,200,200,1,144,200,200,200,200,254,112,0,0,0,
+	0,1,0,0,0,0,4,176,5,120,0,15,0,0,33,17,35,53,35,17,33,17,33,17,
+	33,17,35,21,35,17,1,144,200,200,1,144,1,144,1,144,200,200,2,88,200,2,88,253,
+	168,2,88,253,168,200,253,168,0,1,0,0,0,0,5,129,5,120,0,23,0,0,1,33,
+	53,33,17,35,21,35,21,35,21,35,21,37,21,33,17,51,53,51,53,51,53,51,3,32,
+	252,224,5,120,200,200,200,200,3,41,250,127,200,200,200,200,4,176,200,254,112,200,200,200,
+	200,2,202,1,144,200,200,200,0,1,0,0,0,0,4,176,5,120,0,7,0,0,49,17,
+	33,21,33,17,33,21,4,176,252,224,3,32,5,120,200,252,24,200,0,0,0,1,0,0,
+	0,0,5,120,5,120,0,23,0,0,1,35,53,35,17,33,21,51,21,51,21,51,21,51,
+	21,51,17,33,53,35,53,35,53,35,1,144,200,200,1,144,200,200,200,200,200,254,112,200,
+	200,200,3,32,200,1,144,200,200,200,200,200,254,112,200,200,200,0,0,0,0,1,0,0,
+	0,0,4,176,5,120,0,7,0,0,49,53,33,17,33,53,33,17,3,32,252,224,4,176,
+	200,3,232,200,250,136,0,0,0,1,0,0,6,64,3,32,7,208,0,15,0,0,19,21,
+	35,53,51,55,53,33,21,23,51,21,35,53,39,33,200,200,175,25,1,144,25,175,200,25,
+	254,162,6,239,175,200,25,175,175,25,200,175,25,0,0,0,0,1,0,0,255,56,6,64,
+	0,0,0,3,0,0,49,33,21,33,6,64,249,192,200,0,0,1,0,0,6,64,3,33,
+	7,208,0,7,0,0,19,53,35,53,33,21,33,23,200,200,1,144,1,144,1,6,64,200,
+	200,200,200,0,0,2,0,0,0,0,5,120,5,120,0,15,0,23,0,0,17,51,53,51,
+	53,33,21,51,21,51,17,33,17,33,17,33,1,21,35,17,33,17,35,53,200,200,2,88,
+	200,200,254,112,253,168,254,112,2,88,200,2,88,200,3,232,200,200,200,200,252,24,1,144,
+	254,112,4,176,200,254,112,1,144,200,0,0,0,3,0,0,0,0,5,120,5,120,0,11,
+	0,15,0,19,0,0,1,51,17,35,21,33,17,33,21,51,17,35,5,17,33,17,1,17,
+	33,17,4,176,200,200,251,80,4,176,200,200,252,224,2,88,253,168,2,88,2,88,254,112,
+	200,5,120,200,254,112,200,254,112,1,144,2,88,254,112,1,144,0,0,0,0,1,0,0,
+	0,0,5,120,5,120,0,27,0,0,37,53,33,21,35,21,33,53,35,53,35,17,51,53,
+	51,53,33,21,51,21,33,53,33,21,35,17,51,21,3,232,1,144,200,252,224,200,200,200,
+	200,3,32,200,254,112,254,112,200,200,200,200,200,200,200,200,2,88,200,200,200,200,200,200,
+	253,168,200,0,0,2,0,0,0,0,5,120,5,120,0,11,0,19,0,0,1,35,21,35,
+	21,33,17,33,21,51,21,51,1,17,35,53,33,17,33,53,5,120,200,200,252,24,3,232,
+	200,200,254,112,200,254,112,1,144,1,144,200,200,5,120,200,200,253,168,2,88,200,252,24,
+	200,0,0,0,0,1,0,0,0,0,4,176,5,120,0,11,0,0,1,33,17,33,21,33,
+	17,33,21,33,17,33,4,176,252,224,3,32,251,80,4,176,252,224,3,32,2,88,254,112,
+	200,5,120,200,254,112,0,0,0,1,0,0,0,0,4,176,5,120,0,9,0,0,1,33,
+	17,33,17,33,21,33,17,33,4,176,252,224,254,112,4,176,252,224,3,32,2,88,253,168,
+	5,120,200,254,112,0,0,0,0,1,0,0,0,0,5,120,5,120,0,23,0,0,41,1,
+	53,35,53,35,17,51,53,51,53,33,21,33,21,35,17,51,21,33,17,35,53,33,5,120,
+	252,24,200,200,200,200,3,232,252,224,200,200,1,144,200,2,88,200,200,2,88,200,200,200,
+	200,253,168,200,1,144,200,0,0,1,0,0,0,0,5,120,5,120,0,11,0,0,17,33,
+	17,33,17,33,17,33,17,33,17,33,1,144,2,88,1,144,254,112,253,168,254,112,5,120,
+	253,168,2,88,250,136,2,88,253,168,0,0,0,1,0,0,0,0,4,176,5,120,0,11,
+	0,0,1,17,33,21,33,53,33,17,33,53,33,21,3,32,1,144,251,80,1,144,254,112,
+	4,176,4,176,252,24,200,200,3,232,200,200,0,1,0,0,0,0,5,120,5,120,0,11,
+	0,0,37,17,33,17,35,21,33,39,35,53,33,21,3,232,1,144,200,252,26,2,200,1,
+	144,200,4,176,251,80,200,200,200,200,0,0,0,1,0,0,0,0,5,120,5,120,0,29,
+	0,0,17,33,17,51,53,51,53,51,53,33,21,35,21,35,21,35,21,51,21,51,21,51,
+	21,33,53,35,53,35,17,33,1,144,200,200,200,1,144,200,200,200,200,200,200,253,168,200,
+	200,254,112,5,120,253,168,200,200,200,200,200,200,200,200,200,200,200,200,254,112,0,0,0,
+	0,1,0,0,0,0,4,176,5,120,0,5,0,0,37,33,21,33,17,33,1,144,3,32,
+	251,80,1,144,200,200,5,120,0,1,0,0,0,0,5,120,5,120,0,19,0,0,17,33,
+	21,51,21,51,53,51,53,33,17,33,17,35,21,35,53,35,17,33,1,144,200,200,200,1,
+	144,254,112,200,200,200,254,112,5,120,200,200,200,200,250,136,3,32,200,200,252,224,0,0,
+	0,1,0,0,0,0,5,120,5,120,0,19,0,0,17,33,21,51,21,51,21,51,17,33,
+	17,33,53,35,53,35,53,35,17,33,1,144,200,200,200,1,144,254,112,200,200,200,254,112,
+	5,120,200,200,200,2,88,250,136,200,200,200,253,168,0,0,0,2,0,0,0,0,5,120,
+	5,120,0,11,0,15,0,0,41,1,53,35,17,51,53,33,21,51,17,35,3,33,17,33,
+	4,176,252,24,200,200,3,232,200,200,200,253,168,2,88,200,3,232,200,200,252,24,3,232,
+	252,24,0,0,0,2,0,0,0,0,5,120,5,120,0,3,0,13,0,0,1,17,33,17,
+	1,17,33,17,33,21,51,17,35,21,1,144,2,88,253,168,254,112,4,176,200,200,4,176,
+	253,168,2,88,252,224,254,112,5,120,200,253,168,200,0,0,0,2,0,0,0,0,5,120,
+	5,120,0,7,0,27,0,0,1,33,17,33,53,35,53,33,19,35,21,33,39,35,17,51,
+	53,33,21,51,17,35,21,23,51,21,35,53,3,232,253,168,1,144,200,1,144,175,175,252,
+	226,2,200,200,3,232,200,200,25,175,200,4,176,252,24,200,200,254,112,200,200,3,232,200,
+	200,252,224,175,25,200,175,0,0,2,0,0,0,0,5,129,5,120,0,5,0,23,0,0,
+	1,17,33,53,51,17,1,17,33,17,33,21,51,17,33,21,51,21,55,21,33,53,35,53,
+	1,144,1,144,200,253,168,254,112,4,176,200,254,112,200,209,253,159,200,4,176,253,168,200,
+	1,144,252,224,254,112,5,120,200,253,168,200,200,2,202,200,200,0,0,0,0,1,0,0,
+	0,0,5,120,5,120,0,27,0,0,1,33,53,33,17,33,21,51,17,35,21,33,53,35,
+	53,33,7,33,17,33,53,35,17,51,53,33,21,51,4,176,254,112,254,112,3,32,200,200,
+	252,24,200,1,147,3,2,88,252,224,200,200,3,32,200,3,232,200,254,112,200,254,112,200,
+	200,203,203,1,144,200,1,144,200,200,0,0,0,1,0,0,0,0,4,176,5,120,0,7,
+	0,0,33,3,33,53,33,21,33,17,1,145,1,254,112,4,176,254,112,4,176,200,200,251,
+	80,0,0,0,0,1,0,0,0,0,5,120,5,120,0,11,0,0,1,17,33,17,33,17,
+	35,21,33,53,35,17,1,144,2,88,1,144,200,252,24,200,5,120,251,80,4,176,251,80,
+	200,200,4,176,0,1,0,0,0,0,5,120,5,120,0,23,0,0,17,33,17,51,21,51,
+	53,51,17,33,17,35,21,35,21,35,21,35,39,35,53,35,53,39,1,144,200,200,200,1,
+	144,200,200,200,197,3,200,200,200,5,120,253,168,200,200,2,88,252,224,200,200,200,200,200,
+	200,3,0,0,0,1,0,0,0,0,5,120,5,120,0,19,0,0,49,17,33,17,51,55,
+	51,21,23,17,33,17,33,53,35,53,35,21,35,21,1,144,200,3,201,196,1,144,254,112,
+	200,200,200,5,120,252,224,204,201,3,3,32,250,136,200,200,200,200,0,0,0,1,0,0,
+	0,0,5,120,5,120,0,35,0,0,1,21,35,21,51,21,51,17,33,53,35,53,35,21,
+	35,21,33,17,51,53,51,53,35,53,35,17,33,21,51,21,51,53,51,53,33,17,4,176,
+	200,200,200,254,112,200,200,200,254,112,200,200,200,200,1,144,200,200,200,1,144,3,232,200,
+	200,200,254,112,200,200,200,200,1,144,200,200,200,1,144,200,200,200,200,254,112,0,0,0,
+	0,1,0,0,0,0,4,176,5,120,0,15,0,0,33,17,35,53,35,17,33,17,33,17,
+	33,17,35,21,35,17,1,144,200,200,1,144,1,144,1,144,200,200,2,88,200,2,88,253,
+	168,2,88,253,168,200,253,168,0,1,0,0,0,0,5,129,5,120,0,23,0,0,1,33,
+	53,33,17,35,21,35,21,35,21,35,21,37,21,33,17,51,53,51,53,51,53,51,3,32,
+	252,224,5,120,200,200,200,200,3,41,250,127,200,200,200,200,4,176,200,254,112,200,200,200,
+	200,2,202,1,144,200,200,200,0,1,0,0,0,0,4,176,5,120,0,19,0,0,37,33,
+	21,33,53,35,17,35,53,23,17,51,53,33,21,33,17,35,21,51,2,88,2,88,252,224,
+	200,200,200,200,3,32,253,168,200,200,200,200,200,1,144,201,1,1,144,200,200,254,112,200,
+	0,1,0,0,0,0,0,200,5,120,0,3,0,0,49,17,51,17,200,5,120,250,136,0,
+	0,1,0,0,0,0,4,176,5,120,0,19,0,0,1,51,53,35,17,33,53,33,21,51,
+	17,55,21,35,17,35,21,33,53,33,2,88,200,200,253,168,3,32,200,200,200,200,252,224,
+	2,88,2,88,200,1,144,200,200,254,112,1,201,254,112,200,200,0,0,0,0,1,0,0,
+	6,64,4,176,7,208,0,21,0,0,1,53,51,21,35,7,21,33,53,39,33,7,21,35,
+	53,51,55,53,33,21,23,33,3,232,200,175,25,254,112,25,254,162,25,200,175,25,1,144,
+	25,1,94,7,33,175,200,25,175,175,25,25,175,200,25,175,175,25,0,0,0,2,0,0,
+	0,0,4,176,5,120,0,3,0,17,0,0,1,53,51,21,1,51,53,51,17,35,17,35,
+	21,33,17,51,53,51,3,230,202,252,224,200,200,200,200,254,112,200,200,4,174,202,202,254,
+	114,200,254,112,254,112,200,1,144,200,0,0,0,2,0,0,0,0,5,120,5,120,0,23,
+	0,31,0,0,1,33,21,33,21,35,53,33,53,35,53,35,53,51,53,51,53,33,53,51,
+	21,33,21,33,43,1,21,35,21,51,21,51,3,232,1,144,254,112,200,254,112,200,200,200,
+	200,1,144,200,1,144,254,112,200,200,200,200,200,1,144,200,200,200,200,200,200,200,200,200,
+	200,200,200,200,200,0,0,0,0,1,0,0,0,0,5,120,5,120,0,27,0,0,1,17,
+	33,21,33,53,51,17,35,53,51,53,51,53,51,53,33,21,51,21,33,53,35,21,35,21,
+	33,21,2,88,3,32,250,136,200,200,200,200,200,2,88,200,254,112,200,200,1,144,2,88,
+	254,112,200,200,1,144,200,200,200,200,200,200,200,200,200,200,0,2,0,0,0,0,5,120,
+	5,120,0,19,0,23,0,0,1,17,51,17,33,53,33,21,33,17,51,17,35,17,33,21,
+	33,53,33,17,33,17,33,17,4,176,200,254,112,253,168,254,112,200,200,1,144,2,88,1,
+	144,252,24,2,88,3,232,253,168,254,112,200,200,1,144,2,88,1,144,200,200,254,112,253,
+	168,2,88,0,0,1,0,0,0,0,4,176,5,120,0,23,0,0,37,21,33,53,35,53,
+	51,53,35,53,35,17,33,17,33,17,33,17,35,21,35,21,51,21,3,32,254,112,200,200,
+	200,200,1,144,1,144,1,144,200,200,200,200,200,200,200,200,200,2,88,253,168,2,88,253,
+	168,200,200,200,0,2,0,0,0,0,0,200,5,120,0,3,0,7,0,0,25,1,51,17,
+	21,17,35,17,200,200,3,32,2,88,253,168,200,253,168,2,88,0,0,0,0,2,0,0,
+	255,53,5,120,6,64,0,29,0,33,0,0,19,35,17,51,53,33,21,51,21,33,53,33,
+	17,33,21,51,21,51,17,35,21,33,53,35,53,33,7,33,17,33,55,33,53,33,200,200,
+	200,3,32,200,254,112,254,112,2,88,200,200,200,252,24,200,1,147,3,2,88,252,224,200,
+	1,144,254,112,3,32,2,88,200,200,200,200,254,112,200,200,253,165,200,200,203,203,1,147,
+	200,200,0,0,0,2,0,0,6,64,3,32,7,8,0,3,0,7,0,0,19,21,35,53,
+	33,21,35,53,200,200,3,32,200,7,8,200,200,200,200,0,0,3,0,0,0,0,5,120,
+	5,120,0,7,0,23,0,31,0,0,55,23,33,55,17,39,33,7,3,35,17,51,55,53,
+	33,21,23,51,17,35,7,21,33,53,19,33,21,33,21,33,21,33,200,25,3,182,25,25,
+	252,74,25,25,175,175,25,3,232,25,175,175,25,252,24,200,2,88,254,112,1,144,253,168,
+	225,25,25,3,182,25,25,252,49,3,232,25,175,175,25,252,24,25,175,175,3,57,200,200,
+	200,0,0,0,0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,
+	51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,
+	200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,
+	4,75,175,175,251,180,175,0,0,2,0,0,0,200,4,176,4,176,0,27,0,55,0,0,
+	1,53,51,21,35,7,21,35,7,21,23,51,21,23,51,21,35,53,39,35,53,39,35,53,
+	51,55,53,51,37,53,51,21,35,7,21,35,7,21,23,51,21,23,51,21,35,53,39,35,
+	53,39,35,53,51,55,53,51,1,144,200,175,25,175,25,25,175,25,175,200,25,175,25,175,
+	175,25,175,2,113,200,175,25,175,25,25,175,25,175,200,25,175,25,175,175,25,175,4,1,
+	175,200,25,175,25,150,25,175,25,200,175,25,175,25,200,25,175,25,175,200,25,175,25,150,
+	25,175,25,200,175,25,175,25,200,25,175,0,0,1,0,87,1,19,3,159,2,255,0,6,
+	0,0,19,33,17,7,35,17,33,87,3,72,1,98,253,27,2,255,254,21,1,1,136,0,
+	0,3,0,0,0,0,5,120,5,120,0,7,0,23,0,29,0,0,55,23,33,55,17,39,
+	33,7,3,35,17,51,55,53,33,21,23,51,17,35,7,21,33,53,19,33,21,33,17,35,
+	200,25,3,182,25,25,252,74,25,25,175,175,25,3,232,25,175,175,25,252,24,200,2,88,
+	254,112,200,225,25,25,3,182,25,25,252,49,3,232,25,175,175,25,252,24,25,175,175,3,
+	57,200,254,112,0,1,0,0,6,64,6,64,7,8,0,3,0,0,17,33,21,33,6,64,
+	249,192,7,8,200,0,0,0,0,2,0,60,3,118,2,104,5,162,0,11,0,23,0,0,
+	1,34,6,21,20,22,51,50,54,53,52,38,39,50,22,21,20,6,35,34,38,53,52,54,
+	1,83,86,123,122,87,87,120,121,86,115,162,164,115,117,160,163,5,92,122,87,87,120,120,
+	87,87,122,70,163,115,114,164,162,116,116,162,0,2,0,0,0,0,5,220,5,220,0,11,
+	0,23,0,0,48,53,17,52,51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,
+	17,22,51,33,200,4,76,200,200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,
+	76,200,200,251,180,200,25,176,4,75,175,175,251,180,175,0,0,2,0,0,0,0,5,220,
+	5,220,0,11,0,23,0,0,48,53,17,52,51,33,50,21,17,20,35,33,36,53,17,52,
+	35,33,34,7,17,22,51,33,200,4,76,200,200,251,180,4,251,175,251,180,174,1,1,174,
+	4,77,200,4,76,200,200,251,180,200,25,176,4,75,175,175,251,180,175,0,0,2,0,0,
+	0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,51,33,50,21,17,20,35,33,
+	36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,200,251,180,4,251,175,251,180,
+	174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,4,75,175,175,251,180,175,0,
+	0,1,0,0,6,64,3,33,7,208,0,7,0,0,17,55,33,53,33,21,35,21,1,1,
+	144,1,144,200,6,64,200,200,200,200,0,0,0,1,0,0,255,56,5,120,5,120,0,11,
+	0,0,17,33,17,33,17,33,17,35,21,33,21,33,1,144,2,88,1,144,200,252,224,254,
+	112,5,120,251,80,4,176,251,80,200,200,0,0,1,0,93,0,0,3,161,5,155,0,15,
+	0,0,1,21,35,17,35,17,35,17,35,17,46,1,53,52,54,51,3,161,127,82,166,84,
+	174,203,215,178,5,155,70,250,171,5,85,250,171,2,226,8,189,151,157,192,0,1,0,0,
+	2,88,0,200,3,32,0,3,0,0,19,21,35,53,200,200,3,32,200,200,0,1,0,0,
+	254,112,2,88,0,0,0,9,0,0,5,53,51,21,35,7,21,33,53,33,1,144,200,175,
+	25,254,112,1,119,175,175,200,25,175,200,0,0,2,0,0,0,0,5,220,5,220,0,11,
+	0,23,0,0,48,53,17,52,51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,
+	17,22,51,33,200,4,76,200,200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,
+	76,200,200,251,180,200,25,176,4,75,175,175,251,180,175,0,0,2,0,0,0,0,5,220,
+	5,220,0,11,0,23,0,0,48,53,17,52,51,33,50,21,17,20,35,33,36,53,17,52,
+	35,33,34,7,17,22,51,33,200,4,76,200,200,251,180,4,251,175,251,180,174,1,1,174,
+	4,77,200,4,76,200,200,251,180,200,25,176,4,75,175,175,251,180,175,0,0,2,0,0,
+	0,200,4,176,4,176,0,27,0,55,0,0,1,51,21,23,51,21,35,7,21,35,7,21,
+	35,53,51,55,53,51,55,53,39,35,53,39,35,53,51,21,5,51,21,23,51,21,35,7,
+	21,35,7,21,35,53,51,55,53,51,55,53,39,35,53,39,35,53,51,21,3,57,175,25,
+	175,175,25,175,25,200,175,25,175,25,25,175,25,175,200,253,193,175,25,175,175,25,175,25,
+	200,175,25,175,25,25,175,25,175,200,3,232,175,25,200,25,175,25,175,200,25,175,25,150,
+	25,175,25,200,175,25,175,25,200,25,175,25,175,200,25,175,25,150,25,175,25,200,175,0,
+	0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,51,33,50,21,
+	17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,200,251,180,4,
+	251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,4,75,175,175,
+	251,180,175,0,0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,
+	51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,
+	200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,
+	4,75,175,175,251,180,175,0,0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,
+	48,53,17,52,51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,
+	200,4,76,200,200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,
+	180,200,25,176,4,75,175,175,251,180,175,0,0,2,0,0,0,0,5,120,5,120,0,19,
+	0,23,0,0,1,33,17,33,53,33,21,35,21,33,53,35,17,51,53,33,53,5,23,35,
+	3,51,21,35,3,32,254,112,2,88,1,144,200,252,24,200,200,1,144,1,141,3,200,3,
+	200,200,2,88,254,112,200,200,200,200,1,144,200,200,3,197,2,88,202,0,0,3,0,0,
+	0,0,5,120,7,208,0,15,0,23,0,31,0,0,17,51,53,51,53,33,21,51,21,51,
+	17,33,17,33,17,33,1,21,35,17,33,17,35,53,1,53,35,53,33,21,33,23,200,200,
+	2,88,200,200,254,112,253,168,254,112,2,88,200,2,88,200,254,112,200,1,144,1,144,1,
+	3,232,200,200,200,200,252,24,1,144,254,112,4,176,200,254,112,1,144,200,1,144,200,200,
+	200,200,0,0,0,3,0,0,0,0,5,120,7,208,0,15,0,23,0,31,0,0,17,51,
+	53,51,53,33,21,51,21,51,17,33,17,33,17,33,1,21,35,17,33,17,35,53,1,55,
+	33,53,33,21,35,21,200,200,2,88,200,200,254,112,253,168,254,112,2,88,200,2,88,200,
+	254,111,1,1,144,1,144,200,3,232,200,200,200,200,252,24,1,144,254,112,4,176,200,254,
+	112,1,144,200,1,144,200,200,200,200,0,0,0,3,0,0,0,0,5,120,7,208,0,15,
+	0,23,0,39,0,0,17,51,53,51,53,33,21,51,21,51,17,33,17,33,17,33,1,21,
+	35,17,33,17,35,53,1,21,35,53,51,55,53,33,21,23,51,21,35,53,39,33,200,200,
+	2,88,200,200,254,112,253,168,254,112,2,88,200,2,88,200,254,112,200,175,25,2,88,25,
+	175,200,25,253,218,3,232,200,200,200,200,252,24,1,144,254,112,4,176,200,254,112,1,144,
+	200,2,63,175,200,25,175,175,25,200,175,25,0,3,0,0,0,0,5,120,7,208,0,15,
+	0,23,0,45,0,0,17,51,53,51,53,33,21,51,21,51,17,33,17,33,17,33,1,21,
+	35,17,33,17,35,53,1,53,51,21,35,7,21,33,53,39,33,7,21,35,53,51,55,53,
+	33,21,23,33,200,200,2,88,200,200,254,112,253,168,254,112,2,88,200,2,88,200,1,144,
+	200,175,25,254,112,25,254,162,25,200,175,25,1,144,25,1,94,3,232,200,200,200,200,252,
+	24,1,144,254,112,4,176,200,254,112,1,144,200,2,113,175,200,25,175,175,25,25,175,200,
+	25,175,175,25,0,4,0,0,0,0,5,120,7,8,0,15,0,23,0,27,0,31,0,0,
+	17,51,53,51,53,33,21,51,21,51,17,33,17,33,17,33,1,21,35,17,33,17,35,53,
+	1,21,35,53,33,21,35,53,200,200,2,88,200,200,254,112,253,168,254,112,2,88,200,2,
+	88,200,254,112,200,3,232,200,3,232,200,200,200,200,252,24,1,144,254,112,4,176,200,254,
+	112,1,144,200,2,88,200,200,200,200,0,0,0,3,0,0,0,0,5,120,7,8,0,15,
+	0,23,0,27,0,0,17,51,53,51,53,33,21,51,21,51,17,33,17,33,17,33,1,21,
+	35,17,33,17,35,53,17,21,35,53,200,200,2,88,200,200,254,112,253,168,254,112,2,88,
+	200,2,88,200,200,3,232,200,200,200,200,252,24,1,144,254,112,4,176,200,254,112,1,144,
+	200,2,88,200,200,0,0,0,0,2,0,0,0,0,5,120,5,120,0,5,0,25,0,0,
+	1,21,35,17,33,17,37,21,35,17,51,21,35,17,51,21,33,17,33,17,33,17,51,53,
+	51,53,2,88,200,1,144,2,88,200,200,200,200,253,168,254,112,254,112,200,200,4,176,200,
+	254,112,2,88,200,200,254,112,200,254,112,200,1,144,254,112,3,232,200,200,0,1,0,0,
+	254,112,5,120,5,120,0,37,0,0,41,1,53,35,53,35,17,51,53,51,53,33,21,51,
+	21,33,53,33,21,35,17,51,21,33,53,33,21,35,21,35,21,35,7,21,33,53,33,55,
+	3,32,254,112,200,200,200,200,3,32,200,254,112,254,112,200,200,1,144,1,144,200,200,175,
+	25,254,112,1,119,25,200,200,2,88,200,200,200,200,200,200,253,168,200,200,200,200,200,25,
+	175,200,25,0,0,2,0,0,0,0,4,176,7,208,0,11,0,19,0,0,1,33,17,33,
+	21,33,17,33,21,33,17,33,1,53,35,53,33,21,33,23,4,176,252,224,3,32,251,80,
+	4,176,252,224,3,32,252,224,200,1,144,1,144,1,2,88,254,112,200,5,120,200,254,112,
+	3,32,200,200,200,200,0,0,0,2,0,0,0,0,4,176,7,208,0,11,0,19,0,0,
+	1,33,17,33,21,33,17,33,21,33,17,33,1,55,33,53,33,21,35,21,4,176,252,224,
+	3,32,251,80,4,176,252,224,3,32,252,23,1,1,144,1,144,200,2,88,254,112,200,5,
+	120,200,254,112,3,32,200,200,200,200,0,0,0,2,0,0,0,0,4,176,7,208,0,11,
+	0,27,0,0,1,33,17,33,21,33,17,33,21,33,17,33,1,21,35,53,51,55,53,33,
+	21,23,51,21,35,53,39,33,4,176,252,224,3,32,251,80,4,176,252,224,3,32,252,224,
+	200,175,25,1,144,25,175,200,25,254,162,2,88,254,112,200,5,120,200,254,112,3,207,175,
+	200,25,175,175,25,200,175,25,0,3,0,0,0,0,4,176,7,8,0,11,0,15,0,19,
+	0,0,1,33,17,33,21,33,17,33,21,33,17,33,1,21,35,53,33,21,35,53,4,176,
+	252,224,3,32,251,80,4,176,252,224,3,32,252,224,200,3,32,200,2,88,254,112,200,5,
+	120,200,254,112,3,232,200,200,200,200,0,0,0,2,0,0,0,0,4,176,7,208,0,11,
+	0,19,0,0,1,17,33,21,33,53,33,17,33,53,33,21,1,53,35,53,33,21,33,23,
+	3,32,1,144,251,80,1,144,254,112,4,176,252,224,200,1,144,1,144,1,4,176,252,24,
+	200,200,3,232,200,200,1,144,200,200,200,200,0,2,0,0,0,0,4,176,7,208,0,11,
+	0,19,0,0,1,17,33,21,33,53,33,17,33,53,33,21,1,55,33,53,33,21,35,21,
+	3,32,1,144,251,80,1,144,254,112,4,176,252,23,1,1,144,1,144,200,4,176,252,24,
+	200,200,3,232,200,200,1,144,200,200,200,200,0,2,0,0,0,0,4,176,7,208,0,11,
+	0,27,0,0,1,17,33,21,33,53,33,17,33,53,33,21,1,21,35,53,51,55,53,33,
+	21,23,51,21,35,53,39,33,3,32,1,144,251,80,1,144,254,112,4,176,252,224,200,175,
+	25,1,144,25,175,200,25,254,162,4,176,252,24,200,200,3,232,200,200,2,63,175,200,25,
+	175,175,25,200,175,25,0,0,0,3,0,0,0,0,4,176,7,8,0,11,0,15,0,19,
+	0,0,1,17,33,21,33,53,33,17,33,53,33,21,1,21,35,53,33,21,35,53,3,32,
+	1,144,251,80,1,144,254,112,4,176,252,224,200,3,32,200,4,176,252,24,200,200,3,232,
+	200,200,2,88,200,200,200,200,0,2,0,0,0,0,5,120,5,120,0,11,0,27,0,0,
+	1,17,51,53,51,17,35,53,35,17,51,21,37,17,33,21,51,21,51,17,35,21,35,21,
+	33,17,35,53,2,88,200,200,200,200,200,253,168,3,32,200,200,200,200,252,224,200,2,88,
+	254,112,200,2,88,200,254,112,200,200,2,88,200,200,253,168,200,200,2,88,200,0,0,0,
+	0,2,0,0,0,0,5,120,7,208,0,19,0,41,0,0,17,33,21,51,21,51,21,51,
+	17,33,17,33,53,35,53,35,53,35,17,33,1,53,51,21,35,7,21,33,53,39,33,7,
+	21,35,53,51,55,53,33,21,23,33,1,144,200,200,200,1,144,254,112,200,200,200,254,112,
+	4,176,200,175,25,254,112,25,254,162,25,200,175,25,1,144,25,1,94,5,120,200,200,200,
+	2,88,250,136,200,200,200,253,168,7,33,175,200,25,175,175,25,25,175,200,25,175,175,25,
+	0,3,0,0,0,0,5,120,7,208,0,11,0,15,0,23,0,0,41,1,53,35,17,51,
+	53,33,21,51,17,35,3,33,17,33,1,53,35,53,33,21,33,23,4,176,252,24,200,200,
+	3,232,200,200,200,253,168,2,88,253,168,200,1,144,1,144,1,200,3,232,200,200,252,24,
+	3,232,252,24,5,120,200,200,200,200,0,0,0,3,0,0,0,0,5,120,7,208,0,11,
+	0,15,0,23,0,0,41,1,53,35,17,51,53,33,21,51,17,35,3,33,17,33,1,55,
+	33,53,33,21,35,21,4,176,252,24,200,200,3,232,200,200,200,253,168,2,88,253,167,1,
+	1,144,1,144,200,200,3,232,200,200,252,24,3,232,252,24,5,120,200,200,200,200,0,0,
+	0,3,0,0,0,0,5,120,7,208,0,11,0,15,0,31,0,0,41,1,53,35,17,51,
+	53,33,21,51,17,35,3,33,17,33,1,21,35,53,51,55,53,33,21,23,51,21,35,53,
+	39,33,4,176,252,24,200,200,3,232,200,200,200,253,168,2,88,253,168,200,175,25,2,88,
+	25,175,200,25,253,218,200,3,232,200,200,252,24,3,232,252,24,6,39,175,200,25,175,175,
+	25,200,175,25,0,3,0,0,0,0,5,120,7,208,0,11,0,15,0,37,0,0,41,1,
+	53,35,17,51,53,33,21,51,17,35,3,33,17,33,19,53,51,21,35,7,21,33,53,39,
+	33,7,21,35,53,51,55,53,33,21,23,33,4,176,252,24,200,200,3,232,200,200,200,253,
+	168,2,88,200,200,175,25,254,112,25,254,162,25,200,175,25,1,144,25,1,94,200,3,232,
+	200,200,252,24,3,232,252,24,6,89,175,200,25,175,175,25,25,175,200,25,175,175,25,0,
+	0,4,0,0,0,0,5,120,7,8,0,11,0,15,0,19,0,23,0,0,41,1,53,35,
+	17,51,53,33,21,51,17,35,3,33,17,33,1,21,35,53,33,21,35,53,4,176,252,24,
+	200,200,3,232,200,200,200,253,168,2,88,253,168,200,3,232,200,200,3,232,200,200,252,24,
+	3,232,252,24,6,64,200,200,200,200,0,0,0,1,0,200,0,200,4,176,4,176,0,19,
+	0,0,1,17,35,21,51,17,33,53,35,21,33,17,51,53,35,17,33,21,51,53,4,176,
+	200,200,254,112,200,254,112,200,200,1,144,200,4,176,254,112,200,254,112,200,200,1,144,200,
+	1,144,200,200,0,3,0,0,0,0,5,120,5,120,0,9,0,19,0,31,0,0,1,33,
+	17,51,55,53,51,55,53,51,1,33,17,35,7,21,35,7,21,35,1,33,53,35,17,51,
+	53,33,21,51,17,35,3,232,253,168,175,25,175,25,200,253,168,2,88,175,25,175,25,200,
+	3,32,252,24,200,200,3,232,200,200,4,176,253,168,25,175,25,175,252,224,2,88,25,175,
+	25,175,254,112,200,3,232,200,200,252,24,0,0,2,0,0,0,0,5,120,7,208,0,11,
+	0,19,0,0,1,17,33,17,33,17,35,21,33,53,35,17,37,53,35,53,33,21,33,23,
+	1,144,2,88,1,144,200,252,24,200,1,144,200,1,144,1,144,1,5,120,251,80,4,176,
+	251,80,200,200,4,176,200,200,200,200,200,0,0,2,0,0,0,0,5,120,7,208,0,11,
+	0,19,0,0,1,17,33,17,33,17,35,21,33,53,35,17,37,55,33,53,33,21,35,21,
+	1,144,2,88,1,144,200,252,24,200,1,143,1,1,144,1,144,200,5,120,251,80,4,176,
+	251,80,200,200,4,176,200,200,200,200,200,0,0,2,0,0,0,0,5,120,7,208,0,11,
+	0,27,0,0,1,17,33,17,33,17,35,21,33,53,35,17,1,21,35,53,51,55,53,33,
+	21,23,51,21,35,53,39,33,1,144,2,88,1,144,200,252,24,200,1,144,200,175,25,2,
+	88,25,175,200,25,253,218,5,120,251,80,4,176,251,80,200,200,4,176,1,119,175,200,25,
+	175,175,25,200,175,25,0,0,0,3,0,0,0,0,5,120,7,8,0,11,0,15,0,19,
+	0,0,1,17,33,17,33,17,35,21,33,53,35,17,1,21,35,53,33,21,35,53,1,144,
+	2,88,1,144,200,252,24,200,1,144,200,3,232,200,5,120,251,80,4,176,251,80,200,200,
+	4,176,1,144,200,200,200,200,0,2,0,0,0,0,4,176,7,208,0,15,0,23,0,0,
+	33,17,35,53,35,17,33,17,33,17,33,17,35,21,35,17,1,55,33,53,33,21,35,21,
+	1,144,200,200,1,144,1,144,1,144,200,200,253,167,1,1,144,1,144,200,2,88,200,2,
+	88,253,168,2,88,253,168,200,253,168,6,64,200,200,200,200,0,2,0,0,0,0,5,120,
+	5,120,0,3,0,15,0,0,1,17,33,17,37,33,21,51,17,35,21,33,21,33,17,33,
+	1,144,2,88,253,168,3,32,200,200,252,224,254,112,1,144,3,232,253,168,2,88,200,200,
+	253,168,200,200,5,120,0,0,0,1,0,0,0,0,5,120,5,120,0,23,0,0,41,1,
+	17,51,53,33,21,51,17,35,21,51,17,35,21,33,53,33,17,33,53,33,17,33,1,144,
+	254,112,200,3,232,200,200,200,200,253,168,1,144,254,112,1,144,253,168,4,176,200,200,254,
+	112,200,254,112,200,200,1,144,200,1,144,0,0,3,0,0,0,0,5,120,7,208,0,15,
+	0,23,0,31,0,0,17,51,53,51,53,33,21,51,21,51,17,33,17,33,17,33,1,21,
+	35,17,33,17,35,53,1,53,35,53,33,21,33,23,200,200,2,88,200,200,254,112,253,168,
+	254,112,2,88,200,2,88,200,254,112,200,1,144,1,144,1,3,232,200,200,200,200,252,24,
+	1,144,254,112,4,176,200,254,112,1,144,200,1,144,200,200,200,200,0,0,0,3,0,0,
+	0,0,5,120,7,208,0,15,0,23,0,31,0,0,17,51,53,51,53,33,21,51,21,51,
+	17,33,17,33,17,33,1,21,35,17,33,17,35,53,1,55,33,53,33,21,35,21,200,200,
+	2,88,200,200,254,112,253,168,254,112,2,88,200,2,88,200,254,111,1,1,144,1,144,200,
+	3,232,200,200,200,200,252,24,1,144,254,112,4,176,200,254,112,1,144,200,1,144,200,200,
+	200,200,0,0,0,3,0,0,0,0,5,120,7,208,0,15,0,23,0,39,0,0,17,51,
+	53,51,53,33,21,51,21,51,17,33,17,33,17,33,1,21,35,17,33,17,35,53,1,21,
+	35,53,51,55,53,33,21,23,51,21,35,53,39,33,200,200,2,88,200,200,254,112,253,168,
+	254,112,2,88,200,2,88,200,254,112,200,175,25,2,88,25,175,200,25,253,218,3,232,200,
+	200,200,200,252,24,1,144,254,112,4,176,200,254,112,1,144,200,2,63,175,200,25,175,175,
+	25,200,175,25,0,3,0,0,0,0,5,120,7,208,0,15,0,23,0,45,0,0,17,51,
+	53,51,53,33,21,51,21,51,17,33,17,33,17,33,1,21,35,17,33,17,35,53,1,53,
+	51,21,35,7,21,33,53,39,33,7,21,35,53,51,55,53,33,21,23,33,200,200,2,88,
+	200,200,254,112,253,168,254,112,2,88,200,2,88,200,1,144,200,175,25,254,112,25,254,162,
+	25,200,175,25,1,144,25,1,94,3,232,200,200,200,200,252,24,1,144,254,112,4,176,200,
+	254,112,1,144,200,2,113,175,200,25,175,175,25,25,175,200,25,175,175,25,0,4,0,0,
+	0,0,5,120,7,8,0,15,0,23,0,27,0,31,0,0,17,51,53,51,53,33,21,51,
+	21,51,17,33,17,33,17,33,1,21,35,17,33,17,35,53,1,21,35,53,33,21,35,53,
+	200,200,2,88,200,200,254,112,253,168,254,112,2,88,200,2,88,200,254,112,200,3,232,200,
+	3,232,200,200,200,200,252,24,1,144,254,112,4,176,200,254,112,1,144,200,2,88,200,200,
+	200,200,0,0,0,3,0,0,0,0,5,120,7,8,0,15,0,23,0,27,0,0,17,51,
+	53,51,53,33,21,51,21,51,17,33,17,33,17,33,1,21,35,17,33,17,35,53,17,21,
+	35,53,200,200,2,88,200,200,254,112,253,168,254,112,2,88,200,2,88,200,200,3,232,200,
+	200,200,200,252,24,1,144,254,112,4,176,200,254,112,1,144,200,2,88,200,200,0,0,0,
+	0,2,0,0,0,0,5,120,5,120,0,5,0,25,0,0,1,21,35,17,33,17,37,21,
+	35,17,51,21,35,17,51,21,33,17,33,17,33,17,51,53,51,53,2,88,200,1,144,2,
+	88,200,200,200,200,253,168,254,112,254,112,200,200,4,176,200,254,112,2,88,200,200,254,112,
+	200,254,112,200,1,144,254,112,3,232,200,200,0,1,0,0,254,112,5,120,5,120,0,37,
+	0,0,41,1,53,35,53,35,17,51,53,51,53,33,21,51,21,33,53,33,21,35,17,51,
+	21,33,53,33,21,35,21,35,21,35,7,21,33,53,33,55,3,32,254,112,200,200,200,200,
+	3,32,200,254,112,254,112,200,200,1,144,1,144,200,200,175,25,254,112,1,119,25,200,200,
+	2,88,200,200,200,200,200,200,253,168,200,200,200,200,200,25,175,200,25,0,0,2,0,0,
+	0,0,4,176,7,208,0,11,0,19,0,0,1,33,17,33,21,33,17,33,21,33,17,33,
+	1,53,35,53,33,21,33,23,4,176,252,224,3,32,251,80,4,176,252,224,3,32,252,224,
+	200,1,144,1,144,1,2,88,254,112,200,5,120,200,254,112,3,32,200,200,200,200,0,0,
+	0,2,0,0,0,0,4,176,7,208,0,11,0,19,0,0,1,33,17,33,21,33,17,33,
+	21,33,17,33,1,55,33,53,33,21,35,21,4,176,252,224,3,32,251,80,4,176,252,224,
+	3,32,252,23,1,1,144,1,144,200,2,88,254,112,200,5,120,200,254,112,3,32,200,200,
+	200,200,0,0,0,2,0,0,0,0,4,176,7,208,0,11,0,27,0,0,1,33,17,33,
+	21,33,17,33,21,33,17,33,1,21,35,53,51,55,53,33,21,23,51,21,35,53,39,33,
+	4,176,252,224,3,32,251,80,4,176,252,224,3,32,252,224,200,175,25,1,144,25,175,200,
+	25,254,162,2,88,254,112,200,5,120,200,254,112,3,207,175,200,25,175,175,25,200,175,25,
+	0,3,0,0,0,0,4,176,7,8,0,11,0,15,0,19,0,0,1,33,17,33,21,33,
+	17,33,21,33,17,33,1,21,35,53,33,21,35,53,4,176,252,224,3,32,251,80,4,176,
+	252,224,3,32,252,224,200,3,32,200,2,88,254,112,200,5,120,200,254,112,3,232,200,200,
+	200,200,0,0,0,2,0,0,0,0,4,176,7,208,0,11,0,19,0,0,1,17,33,21,
+	33,53,33,17,33,53,33,21,1,53,35,53,33,21,33,23,3,32,1,144,251,80,1,144,
+	254,112,4,176,252,224,200,1,144,1,144,1,4,176,252,24,200,200,3,232,200,200,1,144,
+	200,200,200,200,0,2,0,0,0,0,4,176,7,208,0,11,0,19,0,0,1,17,33,21,
+	33,53,33,17,33,53,33,21,1,55,33,53,33,21,35,21,3,32,1,144,251,80,1,144,
+	254,112,4,176,252,23,1,1,144,1,144,200,4,176,252,24,200,200,3,232,200,200,1,144,
+	200,200,200,200,0,2,0,0,0,0,4,176,7,208,0,11,0,27,0,0,1,17,33,21,
+	33,53,33,17,33,53,33,21,1,21,35,53,51,55,53,33,21,23,51,21,35,53,39,33,
+	3,32,1,144,251,80,1,144,254,112,4,176,252,224,200,175,25,1,144,25,175,200,25,254,
+	162,4,176,252,24,200,200,3,232,200,200,2,63,175,200,25,175,175,25,200,175,25,0,0,
+	0,3,0,0,0,0,4,176,7,8,0,11,0,15,0,19,0,0,1,17,33,21,33,53,
+	33,17,33,53,33,21,1,21,35,53,33,21,35,53,3,32,1,144,251,80,1,144,254,112,
+	4,176,252,224,200,3,32,200,4,176,252,24,200,200,3,232,200,200,2,88,200,200,200,200,
+	0,2,0,0,0,0,5,120,5,120,0,11,0,27,0,0,1,17,51,53,51,17,35,53,
+	35,17,51,21,37,17,33,21,51,21,51,17,35,21,35,21,33,17,35,53,2,88,200,200,
+	200,200,200,253,168,3,32,200,200,200,200,252,224,200,2,88,254,112,200,2,88,200,254,112,
+	200,200,2,88,200,200,253,168,200,200,2,88,200,0,0,0,0,2,0,0,0,0,5,120,
+	7,208,0,19,0,41,0,0,17,33,21,51,21,51,21,51,17,33,17,33,53,35,53,35,
+	53,35,17,33,1,53,51,21,35,7,21,33,53,39,33,7,21,35,53,51,55,53,33,21,
+	23,33,1,144,200,200,200,1,144,254,112,200,200,200,254,112,4,176,200,175,25,254,112,25,
+	254,162,25,200,175,25,1,144,25,1,94,5,120,200,200,200,2,88,250,136,200,200,200,253,
+	168,7,33,175,200,25,175,175,25,25,175,200,25,175,175,25,0,3,0,0,0,0,5,120,
+	7,208,0,11,0,15,0,23,0,0,41,1,53,35,17,51,53,33,21,51,17,35,3,33,
+	17,33,1,53,35,53,33,21,33,23,4,176,252,24,200,200,3,232,200,200,200,253,168,2,
+	88,253,168,200,1,144,1,144,1,200,3,232,200,200,252,24,3,232,252,24,5,120,200,200,
+	200,200,0,0,0,3,0,0,0,0,5,120,7,208,0,11,0,15,0,23,0,0,41,1,
+	53,35,17,51,53,33,21,51,17,35,3,33,17,33,1,55,33,53,33,21,35,21,4,176,
+	252,24,200,200,3,232,200,200,200,253,168,2,88,253,167,1,1,144,1,144,200,200,3,232,
+	200,200,252,24,3,232,252,24,5,120,200,200,200,200,0,0,0,3,0,0,0,0,5,120,
+	7,208,0,11,0,15,0,31,0,0,41,1,53,35,17,51,53,33,21,51,17,35,3,33,
+	17,33,1,21,35,53,51,55,53,33,21,23,51,21,35,53,39,33,4,176,252,24,200,200,
+	3,232,200,200,200,253,168,2,88,253,168,200,175,25,2,88,25,175,200,25,253,218,200,3,
+	232,200,200,252,24,3,232,252,24,6,39,175,200,25,175,175,25,200,175,25,0,3,0,0,
+	0,0,5,120,7,208,0,11,0,15,0,37,0,0,41,1,53,35,17,51,53,33,21,51,
+	17,35,3,33,17,33,19,53,51,21,35,7,21,33,53,39,33,7,21,35,53,51,55,53,
+	33,21,23,33,4,176,252,24,200,200,3,232,200,200,200,253,168,2,88,200,200,175,25,254,
+	112,25,254,162,25,200,175,25,1,144,25,1,94,200,3,232,200,200,252,24,3,232,252,24,
+	6,89,175,200,25,175,175,25,25,175,200,25,175,175,25,0,0,4,0,0,0,0,5,120,
+	7,8,0,11,0,15,0,19,0,23,0,0,41,1,53,35,17,51,53,33,21,51,17,35,
+	3,33,17,33,1,21,35,53,33,21,35,53,4,176,252,24,200,200,3,232,200,200,200,253,
+	168,2,88,253,168,200,3,232,200,200,3,232,200,200,252,24,3,232,252,24,6,64,200,200,
+	200,200,0,0,0,3,0,0,0,200,3,232,4,176,0,3,0,7,0,11,0,0,17,33,
+	21,33,1,51,21,35,17,51,21,35,3,232,252,24,1,144,200,200,200,200,3,32,200,2,
+	88,200,253,168,200,0,0,0,0,3,0,0,0,0,5,120,5,120,0,9,0,19,0,31,
+	0,0,1,33,17,51,55,53,51,55,53,51,1,33,17,35,7,21,35,7,21,35,1,33,
+	53,35,17,51,53,33,21,51,17,35,3,232,253,168,175,25,175,25,200,253,168,2,88,175,
+	25,175,25,200,3,32,252,24,200,200,3,232,200,200,4,176,253,168,25,175,25,175,252,224,
+	2,88,25,175,25,175,254,112,200,3,232,200,200,252,24,0,0,2,0,0,0,0,5,120,
+	7,208,0,11,0,19,0,0,1,17,33,17,33,17,35,21,33,53,35,17,37,53,35,53,
+	33,21,33,23,1,144,2,88,1,144,200,252,24,200,1,144,200,1,144,1,144,1,5,120,
+	251,80,4,176,251,80,200,200,4,176,200,200,200,200,200,0,0,2,0,0,0,0,5,120,
+	7,208,0,11,0,19,0,0,1,17,33,17,33,17,35,21,33,53,35,17,37,55,33,53,
+	33,21,35,21,1,144,2,88,1,144,200,252,24,200,1,143,1,1,144,1,144,200,5,120,
+	251,80,4,176,251,80,200,200,4,176,200,200,200,200,200,0,0,2,0,0,0,0,5,120,
+	7,208,0,11,0,27,0,0,1,17,33,17,33,17,35,21,33,53,35,17,1,21,35,53,
+	51,55,53,33,21,23,51,21,35,53,39,33,1,144,2,88,1,144,200,252,24,200,1,144,
+	200,175,25,2,88,25,175,200,25,253,218,5,120,251,80,4,176,251,80,200,200,4,176,1,
+	119,175,200,25,175,175,25,200,175,25,0,0,0,3,0,0,0,0,5,120,7,8,0,11,
+	0,15,0,19,0,0,1,17,33,17,33,17,35,21,33,53,35,17,1,21,35,53,33,21,
+	35,53,1,144,2,88,1,144,200,252,24,200,1,144,200,3,232,200,5,120,251,80,4,176,
+	251,80,200,200,4,176,1,144,200,200,200,200,0,2,0,0,0,0,4,176,7,208,0,15,
+	0,23,0,0,33,17,35,53,35,17,33,17,33,17,33,17,35,21,35,17,1,55,33,53,
+	33,21,35,21,1,144,200,200,1,144,1,144,1,144,200,200,253,167,1,1,144,1,144,200,
+	2,88,200,2,88,253,168,2,88,253,168,200,253,168,6,64,200,200,200,200,0,2,0,0,
+	0,0,5,120,5,120,0,3,0,15,0,0,1,17,33,17,37,33,21,51,17,35,21,33,
+	21,33,17,33,1,144,2,88,253,168,3,32,200,200,252,224,254,112,1,144,3,232,253,168,
+	2,88,200,200,253,168,200,200,5,120,0,0,0,3,0,0,0,0,4,176,7,8,0,15,
+	0,19,0,23,0,0,33,17,35,53,35,17,33,17,33,17,33,17,35,21,35,17,1,21,
+	35,53,33,21,35,53,1,144,200,200,1,144,1,144,1,144,200,200,254,112,200,3,32,200,
+	2,88,200,2,88,253,168,2,88,253,168,200,253,168,7,8,200,200,200,200,0,1,0,19,
+	0,0,1,218,3,190,0,17,0,0,37,20,59,1,21,33,53,51,50,53,17,52,43,1,
+	53,54,55,51,1,72,100,46,254,70,46,100,111,48,222,39,48,223,173,50,50,173,1,176,
+	77,44,69,113,0,1,0,0,6,64,3,32,7,208,0,15,0,0,19,21,35,53,51,55,
+	53,33,21,23,51,21,35,53,39,33,200,200,175,25,1,144,25,175,200,25,254,162,6,239,
+	175,200,25,175,175,25,200,175,25,0,0,0,0,1,0,0,6,64,3,32,7,208,0,15,
+	0,0,19,33,55,53,51,21,35,7,21,33,53,39,35,53,51,21,225,1,94,25,200,175,
+	25,254,112,25,175,200,7,8,25,175,200,25,175,175,25,200,175,0,0,0,0,1,0,0,
+	6,64,3,32,7,8,0,3,0,0,1,21,33,53,3,32,252,224,7,8,200,200,0,0,
+	0,1,0,0,6,64,3,32,7,208,0,7,0,0,19,33,53,51,17,33,17,51,200,1,
+	144,200,252,224,200,7,8,200,254,112,1,144,0,1,0,0,6,64,0,200,7,8,0,3,
+	0,0,19,21,35,53,200,200,7,8,200,200,0,1,0,0,6,64,0,200,7,8,0,3,
+	0,0,19,21,35,53,200,200,7,8,200,200,0,1,0,0,254,112,2,88,0,0,0,9,
+	0,0,23,33,21,33,53,39,35,53,51,21,225,1,119,254,112,25,175,200,200,200,175,25,
+	200,175,0,0,0,1,0,0,6,64,4,176,7,208,0,21,0,0,1,53,33,21,33,7,
+	21,35,53,39,33,7,21,35,53,51,55,53,33,21,23,51,3,32,1,144,254,137,25,200,
+	25,254,162,25,200,175,25,1,144,25,150,7,33,175,200,25,175,175,25,25,175,200,25,175,
+	175,25,0,0,0,2,0,0,6,64,3,232,7,208,0,9,0,19,0,0,19,21,35,53,
+	51,55,53,51,21,35,5,21,35,53,51,55,53,51,21,35,200,200,175,25,200,175,2,63,
+	200,175,25,200,175,6,239,175,200,25,175,200,25,175,200,25,175,200,0,0,0,1,0,0,
+	2,88,3,232,3,32,0,3,0,0,17,33,21,33,3,232,252,24,3,32,200,0,0,0,
+	0,1,0,0,2,88,3,232,3,32,0,3,0,0,17,33,21,33,3,232,252,24,3,32,
+	200,0,0,0,0,1,0,0,3,232,0,202,5,123,0,3,0,0,19,17,35,17,202,202,
+	5,123,254,109,1,147,0,0,0,1,0,0,3,232,0,202,5,123,0,3,0,0,19,17,
+	35,17,202,202,5,123,254,109,1,147,0,0,0,1,0,0,255,56,0,200,0,200,0,3,
+	0,0,55,17,35,17,200,200,200,254,112,1,144,0,0,0,0,2,0,0,3,232,2,88,
+	5,123,0,3,0,7,0,0,19,17,35,17,33,17,35,17,202,202,2,88,201,5,123,254,
+	109,1,147,254,109,1,147,0,0,2,0,0,3,232,2,88,5,123,0,3,0,7,0,0,
+	19,17,35,17,33,17,35,17,202,202,2,88,201,5,123,254,109,1,147,254,109,1,147,0,
+	0,2,0,0,255,56,2,88,0,203,0,3,0,7,0,0,55,17,35,17,33,17,35,17,
+	202,202,2,88,201,203,254,109,1,147,254,109,1,147,0,0,0,1,0,71,254,242,3,176,
+	5,157,0,50,0,0,1,38,39,38,53,52,54,51,50,22,21,20,7,6,7,54,55,54,
+	51,50,22,21,20,6,35,34,39,38,39,22,23,2,3,35,2,3,54,55,6,7,6,35,
+	34,38,53,52,54,51,50,23,22,1,230,8,46,57,72,60,57,75,55,46,9,96,81,101,
+	28,49,60,55,45,32,104,85,94,8,102,106,6,38,6,108,102,9,96,82,101,28,49,59,
+	55,44,32,105,85,3,254,97,81,101,28,49,59,55,44,32,105,85,94,8,46,57,72,60,
+	57,75,55,46,11,176,101,254,52,253,254,2,2,1,204,101,176,10,45,57,72,60,57,75,
+	56,46,0,0,0,1,0,70,254,242,3,175,5,157,0,91,0,0,37,54,55,54,51,50,
+	22,21,20,6,35,34,39,38,39,22,23,22,21,20,6,35,34,38,53,52,55,54,55,6,
+	7,6,35,34,38,53,52,54,51,50,23,22,23,38,39,54,55,6,7,6,35,34,38,53,
+	52,54,51,50,23,22,23,38,39,38,53,52,54,51,50,22,21,20,7,6,7,54,55,54,
+	51,50,22,21,20,6,35,34,39,38,39,22,23,6,2,16,94,85,104,32,45,55,60,49,
+	28,101,81,96,9,46,55,75,57,60,72,57,46,8,94,85,105,32,44,55,59,49,28,101,
+	82,96,9,102,102,9,96,82,101,28,49,59,55,44,32,105,85,94,8,46,57,72,60,57,
+	75,55,46,9,96,81,101,28,49,60,55,45,32,104,85,94,8,102,102,186,11,46,55,75,
+	57,60,72,57,46,8,94,85,105,32,44,55,59,49,28,101,81,97,9,46,56,75,57,60,
+	72,57,45,10,226,172,171,226,10,45,57,72,60,57,75,56,46,9,97,81,101,28,49,59,
+	55,44,32,105,85,94,8,46,57,72,60,57,75,55,46,11,226,171,172,0,0,1,0,216,
+	1,165,3,40,3,245,0,11,0,0,19,52,54,51,50,22,21,20,6,35,34,38,216,174,
+	123,122,173,175,122,123,172,2,206,123,172,173,122,122,175,174,0,3,0,0,0,0,3,232,
+	0,200,0,3,0,7,0,11,0,0,55,21,35,53,33,21,35,53,33,21,35,53,200,200,
+	2,88,200,2,88,200,200,200,200,200,200,200,200,0,0,0,0,1,0,0,0,199,4,184,
+	4,176,0,19,0,0,37,5,53,7,55,37,53,5,39,51,53,37,21,5,21,35,21,55,
+	21,37,4,184,253,159,203,1,254,115,1,141,1,200,2,92,254,108,200,204,1,152,200,1,
+	201,1,201,1,201,1,198,200,1,200,1,200,200,1,200,1,0,1,0,0,0,199,4,184,
+	4,176,0,19,0,0,17,5,53,23,53,35,53,37,53,5,21,51,7,37,21,5,23,39,
+	21,37,1,152,204,200,254,108,2,92,200,1,1,141,254,115,1,203,253,159,1,145,1,200,
+	1,200,200,1,200,1,200,198,1,201,1,201,1,201,1,0,0,1,0,0,0,0,5,120,
+	5,120,0,23,0,0,1,35,21,35,21,35,21,33,17,51,53,51,53,51,53,51,53,51,
+	53,33,17,35,21,35,3,232,200,200,200,254,112,200,200,200,200,200,1,144,200,200,2,88,
+	200,200,200,1,144,200,200,200,200,200,254,112,200,0,0,0,0,1,0,0,0,0,4,176,
+	5,120,0,17,0,0,19,17,33,21,33,17,33,21,33,21,51,21,35,21,33,53,35,53,
+	200,3,232,253,168,2,88,253,168,200,200,254,112,200,1,144,3,232,200,254,112,200,200,200,
+	200,200,200,0,0,1,0,0,0,0,5,120,5,120,0,27,0,0,1,17,33,21,33,53,
+	51,17,35,53,51,53,51,53,51,53,33,21,51,21,33,53,35,21,35,21,33,21,2,88,
+	3,32,250,136,200,200,200,200,200,2,88,200,254,112,200,200,1,144,2,88,254,112,200,200,
+	1,144,200,200,200,200,200,200,200,200,200,200,0,2,0,0,0,0,5,120,5,120,0,3,
+	0,21,0,0,1,17,33,17,1,17,33,21,51,17,35,21,33,21,51,21,35,21,33,53,
+	35,53,2,88,1,144,252,224,3,232,200,200,253,168,200,200,254,112,200,4,176,254,112,1,
+	144,252,224,3,232,200,254,112,200,200,200,200,200,200,0,0,0,1,0,0,0,0,5,120,
+	5,120,0,27,0,0,1,53,51,53,33,21,33,21,51,21,33,21,33,21,35,21,33,21,
+	33,53,35,53,33,53,51,53,35,53,1,144,200,3,32,253,168,200,254,112,1,144,200,2,
+	88,252,224,200,254,112,200,200,3,232,200,200,200,200,200,200,200,200,200,200,200,200,200,200,
+	0,3,0,0,3,32,5,120,5,120,0,3,0,7,0,15,0,0,1,17,33,17,37,51,
+	53,35,1,17,35,17,35,17,33,17,3,32,2,88,254,112,200,200,253,168,200,200,2,88,
+	3,32,2,88,253,168,200,200,254,112,1,144,254,112,2,88,253,168,0,0,0,1,0,0,
+	3,32,6,64,5,120,0,21,0,0,1,35,21,35,53,35,17,35,17,35,17,35,17,35,
+	53,33,21,23,51,17,35,17,5,95,175,200,200,200,200,200,200,5,120,25,175,200,4,176,
+	200,200,254,112,1,144,254,112,1,144,200,175,25,254,112,1,119,0,0,0,0,2,0,0,
+	0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,51,33,50,21,17,20,35,33,
+	36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,200,251,180,4,251,175,251,180,
+	174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,4,75,175,175,251,180,175,0,
+	0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,51,33,50,21,
+	17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,200,251,180,4,
+	251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,4,75,175,175,
+	251,180,175,0,0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,
+	51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,
+	200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,
+	4,75,175,175,251,180,175,0,0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,
+	48,53,17,52,51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,
+	200,4,76,200,200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,
+	180,200,25,176,4,75,175,175,251,180,175,0,0,1,0,0,2,88,3,232,3,32,0,3,
+	0,0,17,33,21,33,3,232,252,24,3,32,200,0,0,0,0,2,0,0,0,0,5,220,
+	5,220,0,11,0,23,0,0,48,53,17,52,51,33,50,21,17,20,35,33,36,53,17,52,
+	35,33,34,7,17,22,51,33,200,4,76,200,200,251,180,4,251,175,251,180,174,1,1,174,
+	4,77,200,4,76,200,200,251,180,200,25,176,4,75,175,175,251,180,175,0,0,2,0,0,
+	0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,51,33,50,21,17,20,35,33,
+	36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,200,251,180,4,251,175,251,180,
+	174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,4,75,175,175,251,180,175,0,
+	0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,51,33,50,21,
+	17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,200,251,180,4,
+	251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,4,75,175,175,
+	251,180,175,0,0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,48,53,17,52,
+	51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,200,4,76,200,
+	200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,180,200,25,176,
+	4,75,175,175,251,180,175,0,0,2,0,0,0,0,5,220,5,220,0,11,0,23,0,0,
+	48,53,17,52,51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,17,22,51,33,
+	200,4,76,200,200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,76,200,200,251,
+	180,200,25,176,4,75,175,175,251,180,175,0,0,2,0,0,0,0,5,220,5,220,0,11,
+	0,23,0,0,48,53,17,52,51,33,50,21,17,20,35,33,36,53,17,52,35,33,34,7,
+	17,22,51,33,200,4,76,200,200,251,180,4,251,175,251,180,174,1,1,174,4,77,200,4,
+	76,200,200,251,180,200,25,176,4,75,175,175,251,180,175,0,0,0,0,22,1,14,0,1,
+	0,0,0,0,0,0,0,55,0,0,0,1,0,0,0,0,0,1,0,9,0,0,0,1,
+	0,0,0,0,0,2,0,7,0,55,0,1,0,0,0,0,0,3,0,22,0,62,0,1,
+	0,0,0,0,0,4,0,9,0,0,0,1,0,0,0,0,0,5,0,46,0,84,0,1,
+	0,0,0,0,0,6,0,8,0,130,0,1,0,0,0,0,0,8,0,14,0,13,0,1,
+	0,0,0,0,0,9,0,14,0,13,0,1,0,0,0,0,0,11,0,25,0,138,0,1,
+	0,0,0,0,0,12,0,25,0,138,0,3,0,1,4,9,0,0,0,110,0,163,0,3,
+	0,1,4,9,0,1,0,18,0,163,0,3,0,1,4,9,0,2,0,14,1,17,0,3,
+	0,1,4,9,0,3,0,44,1,31,0,3,0,1,4,9,0,4,0,18,0,163,0,3,
+	0,1,4,9,0,5,0,92,1,75,0,3,0,1,4,9,0,6,0,16,1,167,0,3,
+	0,1,4,9,0,8,0,28,0,189,0,3,0,1,4,9,0,9,0,28,0,189,0,3,
+	0,1,4,9,0,11,0,50,1,183,0,3,0,1,4,9,0,12,0,50,1,183,80,105,
+	120,101,108,32,78,69,83,32,169,32,40,78,101,97,108,101,32,68,97,118,105,100,115,111,
+	110,41,46,32,50,48,49,49,46,32,65,108,108,32,82,105,103,104,116,115,32,82,101,115,
+	101,114,118,101,100,82,101,103,117,108,97,114,80,105,120,101,108,32,78,69,83,58,86,101,
+	114,115,105,111,110,32,49,46,48,48,86,101,114,115,105,111,110,32,49,46,48,48,32,79,
+	99,116,111,98,101,114,32,51,48,44,32,50,48,49,51,44,32,105,110,105,116,105,97,108,
+	32,114,101,108,101,97,115,101,80,105,120,101,108,78,69,83,104,116,116,112,58,92,92,119,
+	119,119,46,112,105,120,101,108,115,97,103,97,115,46,99,111,109,0,80,0,105,0,120,0,
+	101,0,108,0,32,0,78,0,69,0,83,0,32,0,169,0,32,0,40,0,78,0,101,0,
+	97,0,108,0,101,0,32,0,68,0,97,0,118,0,105,0,100,0,115,0,111,0,110,0,
+	41,0,46,0,32,0,50,0,48,0,49,0,49,0,46,0,32,0,65,0,108,0,108,0,
+	32,0,82,0,105,0,103,0,104,0,116,0,115,0,32,0,82,0,101,0,115,0,101,0,
+	114,0,118,0,101,0,100,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,80,0,
+	105,0,120,0,101,0,108,0,32,0,78,0,69,0,83,0,58,0,86,0,101,0,114,0,
+	115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,48,0,86,0,101,0,114,0,
+	115,0,105,0,111,0,110,0,32,0,49,0,46,0,48,0,48,0,32,0,79,0,99,0,
+	116,0,111,0,98,0,101,0,114,0,32,0,51,0,48,0,44,0,32,0,50,0,48,0,
+	49,0,51,0,44,0,32,0,105,0,110,0,105,0,116,0,105,0,97,0,108,0,32,0,
+	114,0,101,0,108,0,101,0,97,0,115,0,101,0,80,0,105,0,120,0,101,0,108,0,
+	78,0,69,0,83,0,104,0,116,0,116,0,112,0,58,0,92,0,92,0,119,0,119,0,
+	119,0,46,0,112,0,105,0,120,0,101,0,108,0,115,0,97,0,103,0,97,0,115,0,
+	46,0,99,0,111,0,109,0,0,2,0,0,0,0,0,0,255,39,0,150,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,236,0,0,0,1,0,2,
+	0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,
+	0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,
+	0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,
+	0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,
+	0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,
+	0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,
+	0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,
+	0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,0,163,
+	0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,0,138,
+	0,218,0,131,0,147,1,2,1,3,0,141,0,151,0,136,0,195,0,222,1,4,0,158,
+	0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,
+	0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,
+	0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,212,0,213,0,104,0,235,0,237,
+	0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,
+	0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,
+	0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,0,215,0,216,0,225,
+	1,5,0,219,0,220,0,221,0,224,0,217,0,223,0,178,0,179,0,182,0,183,0,196,
+	0,180,0,181,0,197,0,130,0,194,0,135,0,171,0,190,0,191,0,188,0,247,1,6,
+	1,7,1,8,1,9,0,140,0,152,0,168,0,154,0,153,0,239,0,165,0,146,0,156,
+	0,167,0,148,0,149,1,10,1,11,7,117,110,105,48,48,66,50,7,117,110,105,48,48,
+	66,51,7,117,110,105,48,48,66,57,7,117,110,105,48,50,67,57,4,108,105,114,97,6,
+	112,101,115,101,116,97,4,69,117,114,111,7,117,110,105,50,49,49,54,7,117,110,105,70,
+	48,48,49,7,117,110,105,70,48,48,50,0,0,0,0,1,255,255,0,2,0,0,0,1,
+	0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,10,0,12,
+	0,14,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,10,0,32,0,60,0,1,
+	108,97,116,110,0,8,0,4,0,0,0,0,255,255,0,2,0,1,0,0,0,2,99,108,
+	105,103,0,14,102,114,97,99,0,20,0,0,0,1,0,2,0,0,0,2,0,0,0,1,
+	0,3,0,8,0,30,0,90,0,1,0,0,0,1,0,8,0,2,0,8,0,1,0,216,
+	0,1,0,1,0,18,0,4,0,0,0,1,0,8,0,1,0,44,0,2,0,10,0,32,
+	0,2,0,6,0,14,0,125,0,3,0,216,0,21,0,124,0,3,0,216,0,23,0,1,
+	0,4,0,126,0,3,0,216,0,23,0,1,0,2,0,20,0,22,0,4,0,0,0,1,
+	0,8,0,1,0,26,0,1,0,8,0,2,0,6,0,12,0,145,0,2,0,49,0,177,
+	0,2,0,81,0,1,0,1,0,97,0,0,
+};
+const EmbeddedAsset fontAsset = { fontAssetData, sizeof(fontAssetData) };
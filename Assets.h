@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+/*
+	Files of Textures/ and Fonts/ compiled into the executable.
+	Assets.cpp is generated by Tools/EmbedAssets.cpp, regenerate it after changing an asset.
+*/
+
+struct EmbeddedAsset
+{
+	const unsigned char* data;
+	std::size_t size;
+};
+
+extern const EmbeddedAsset piecesTextureAsset;	// Textures/pieces.png
+extern const EmbeddedAsset fontAsset;			// Fonts/Pixel NES.otf
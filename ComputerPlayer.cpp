@@ -0,0 +1,101 @@
+#include "ComputerPlayer.h"
+
+#include <algorithm>
+
+ComputerPlayer::ComputerPlayer(PieceColor color, std::int64_t timeMs, std::int64_t incrementMs)
+	: color{ color }, timeLeftMs{ timeMs }, incrementMs{ incrementMs }, thinking{ false }, pondering{ false }, ponderMove{ nullMove } {}
+
+ComputerPlayer::~ComputerPlayer() {
+	cancel();
+}
+
+PieceColor ComputerPlayer::getColor() const {
+	return color;
+}
+
+bool ComputerPlayer::isThinking() const {
+	return thinking;
+}
+
+std::int64_t ComputerPlayer::getTimeLeftMs() const {
+	return timeLeftMs;
+}
+
+void ComputerPlayer::startSearch(const Position& position, bool ponder) {
+	SearchLimits limits;
+	limits.timeLeftMs = timeLeftMs;
+	limits.incrementMs = incrementMs;
+	limits.ponder = ponder;
+
+	searchPosition = position;
+	if (ponder) engine.beginPonder();
+	search = std::async(std::launch::async, [this, root = position, limits]() mutable {
+		return engine.search(root, limits);
+	});
+}
+
+void ComputerPlayer::startThinking(const Position& position) {
+	cancel();
+
+	turnStart = std::chrono::steady_clock::now();
+	thinking = true;
+	startSearch(position, false);
+}
+
+bool ComputerPlayer::poll(Move& move) {
+	if (!thinking || !search.valid()) return false;
+	if (search.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+
+	SearchResult result = search.get();
+	thinking = false;
+
+	// humans don't lose on time here, the computer just keeps a minimal budget
+	auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - turnStart).count();
+	timeLeftMs = std::max<std::int64_t>(1000, timeLeftMs - elapsed) + incrementMs;
+
+	move = result.bestMove;
+	if (!move.isNull())
+		startPondering(result);
+
+	return true;
+}
+
+void ComputerPlayer::startPondering(const SearchResult& result) {
+	// the expected reply is the second move of the principal variation
+	if (result.pv.size() < 2 || result.pv[0] != result.bestMove) return;
+
+	Position position = searchPosition;
+	position.makeMove(result.pv[0]);
+	if (!position.isLegal(result.pv[1])) return;
+	position.makeMove(result.pv[1]);
+
+	ponderMove = result.pv[1];
+	pondering = true;
+	startSearch(position, true);
+}
+
+void ComputerPlayer::opponentMoved(Move move) {
+	if (!pondering) return;
+
+	if (move == ponderMove) {
+		// ponder hit, the clock starts now but the time already spent pondering is kept
+		pondering = false;
+		thinking = true;
+		turnStart = std::chrono::steady_clock::now();
+		engine.ponderHit();
+	}
+	else
+		cancel();
+}
+
+void ComputerPlayer::cancel() {
+	if (search.valid()) {
+		// keep signalling, a stop sent before the search thread got to start its search would be lost
+		do engine.stop();
+		while (search.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready);
+		search = std::future<SearchResult>();
+	}
+
+	thinking = false;
+	pondering = false;
+}
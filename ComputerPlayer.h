@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <future>
+
+#include "Engine.h"
+
+/*
+	Computer opponent of the interactive game.
+	Searches run on a background thread so the window keeps responding. After playing its move
+	the computer ponders on the reply it expects, if the human plays that reply (a ponder hit)
+	the search simply continues on the computer's clock and usually answers right away.
+*/
+
+class ComputerPlayer
+{
+private:
+	Engine engine;
+	PieceColor color;
+
+	std::int64_t timeLeftMs;
+	std::int64_t incrementMs;
+
+	std::future<SearchResult> search;
+	Position searchPosition;
+	bool thinking;
+	bool pondering;
+	Move ponderMove;
+	std::chrono::steady_clock::time_point turnStart;
+
+	void startSearch(const Position& position, bool ponder);
+	void startPondering(const SearchResult& result);
+public:
+	ComputerPlayer(PieceColor color, std::int64_t timeMs, std::int64_t incrementMs);
+	~ComputerPlayer();
+
+	PieceColor getColor() const;
+	bool isThinking() const;
+	std::int64_t getTimeLeftMs() const;
+
+	void startThinking(const Position& position);
+	// Returns true once the move is ready, a null move means there are no legal moves
+	bool poll(Move& move);
+	// Called when the opponent made a move, turns pondering into thinking on a ponder hit
+	void opponentMoved(Move move);
+	void cancel();
+};
@@ -0,0 +1,1042 @@
+#include "Engine.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static const int knightDx[8] = { 1, 2, 2, 1, -1, -2, -2, -1 };
+static const int knightDy[8] = { -2, -1, 1, 2, 2, 1, -1, -2 };
+static const int kingDx[8] = { -1, 0, 1, -1, 1, -1, 0, 1 };
+static const int kingDy[8] = { -1, -1, -1, 0, 0, 1, 1, 1 };
+static const int rookDx[4] = { -1, 0, 1, 0 };
+static const int rookDy[4] = { 0, -1, 0, 1 };
+static const int bishopDx[4] = { -1, 1, 1, -1 };
+static const int bishopDy[4] = { -1, -1, 1, 1 };
+
+// KING, QUEEN, BISHOP, KNIGHT, ROOK, PAWN
+static const int pieceValues[6] = { 0, 900, 330, 320, 500, 100 };
+
+static inline bool onBoard(int x, int y) {
+	return x >= 0 && x < 8 && y >= 0 && y < 8;
+}
+
+static inline int pawnDirection(PieceColor color) {
+	return color == PieceColor::WHITE ? -1 : 1;
+}
+
+static inline int pawnStartRow(PieceColor color) {
+	return color == PieceColor::WHITE ? 6 : 1;
+}
+
+std::string Move::toString() const {
+	if (isNull()) return "0000";
+
+	std::string s;
+	s += char('a' + from % 8);
+	s += char('8' - from / 8);
+	s += char('a' + to % 8);
+	s += char('8' - to / 8);
+	return s;
+}
+
+/*
+	POSITION
+*/
+
+Position::Position() : turn{ PieceColor::WHITE }, hash{ 0 }, halfmoveClock{ 0 } {
+	squares.fill(0);
+	kings.fill(-1);
+}
+
+Position Position::fromBoard(const std::array<std::array<Piece*, 8>, 8>& board, PieceColor turn) {
+	Position position;
+	position.turn = turn;
+
+	for (int i = 0; i < 8; ++i) {
+		for (int j = 0; j < 8; ++j) {
+			Piece* p = board[i][j];
+			if (!p) continue;
+
+			position.squares[i * 8 + j] = std::int8_t(pieceCode(p->color, p->type));
+			if (p->type == PieceType::KING) position.kings[p->color] = i * 8 + j;
+		}
+	}
+
+	position.recomputeHash();
+	return position;
+}
+
+bool Position::loadFen(const std::string& fen) {
+	*this = Position();
+
+	const std::string pieceChars = "kqbnrp";
+
+	std::size_t pos = 0;
+	int i = 0, j = 0;
+	for (; pos < fen.size() && fen[pos] != ' '; ++pos) {
+		char c = fen[pos];
+		if (c == '/') {
+			++i;
+			j = 0;
+		}
+		else if (c >= '1' && c <= '8')
+			j += c - '0';
+		else {
+			std::size_t type = pieceChars.find(char(std::tolower(c)));
+			if (type == std::string::npos || i > 7 || j > 7) return false;
+
+			PieceColor color = std::isupper(c) ? PieceColor::WHITE : PieceColor::BLACK;
+			squares[i * 8 + j] = std::int8_t(pieceCode(color, PieceType(type)));
+			if (type == PieceType::KING) kings[color] = i * 8 + j;
+			++j;
+		}
+	}
+
+	if (pos + 1 < fen.size() && fen[pos + 1] == 'b')
+		turn = PieceColor::BLACK;
+
+	recomputeHash();
+	return i == 7;
+}
+
+std::string Position::toFen() const {
+	const char pieceChars[] = "kqbnrp";
+
+	std::string fen;
+	for (int i = 0; i < 8; ++i) {
+		int empty = 0;
+		for (int j = 0; j < 8; ++j) {
+			int code = squares[i * 8 + j];
+			if (!code) {
+				++empty;
+				continue;
+			}
+
+			if (empty) fen += char('0' + empty);
+			empty = 0;
+
+			char c = pieceChars[codeType(code)];
+			fen += codeColor(code) == PieceColor::WHITE ? char(std::toupper(c)) : c;
+		}
+		if (empty) fen += char('0' + empty);
+		if (i < 7) fen += '/';
+	}
+
+	fen += turn == PieceColor::WHITE ? " w - - " : " b - - ";
+	fen += std::to_string(halfmoveClock) + " 1";
+	return fen;
+}
+
+void Position::recomputeHash() {
+	hash = turn == PieceColor::BLACK ? zobristTurnKey() : 0;
+
+	for (int sq = 0; sq < 64; ++sq) {
+		int code = squares[sq];
+		if (code) hash ^= zobristPieceKey(codeColor(code), codeType(code), tileOf(sq));
+	}
+}
+
+bool Position::isAttacked(int square, PieceColor by) const {
+	int x = square % 8, y = square / 8;
+
+	// pawns of the attacking side stand one row behind the square, from their point of view
+	int py = y - pawnDirection(by);
+	int pawn = pieceCode(by, PieceType::PAWN);
+	if (onBoard(x - 1, py) && squares[py * 8 + x - 1] == pawn) return true;
+	if (onBoard(x + 1, py) && squares[py * 8 + x + 1] == pawn) return true;
+
+	int knight = pieceCode(by, PieceType::KNIGHT);
+	int king = pieceCode(by, PieceType::KING);
+	for (int i = 0; i < 8; ++i) {
+		int nx = x + knightDx[i], ny = y + knightDy[i];
+		if (onBoard(nx, ny) && squares[ny * 8 + nx] == knight) return true;
+
+		int kx = x + kingDx[i], ky = y + kingDy[i];
+		if (onBoard(kx, ky) && squares[ky * 8 + kx] == king) return true;
+	}
+
+	int queen = pieceCode(by, PieceType::QUEEN);
+	int rook = pieceCode(by, PieceType::ROOK);
+	int bishop = pieceCode(by, PieceType::BISHOP);
+	for (int d = 0; d < 4; ++d) {
+		for (int sx = x + rookDx[d], sy = y + rookDy[d]; onBoard(sx, sy); sx += rookDx[d], sy += rookDy[d]) {
+			int code = squares[sy * 8 + sx];
+			if (!code) continue;
+			if (code == rook || code == queen) return true;
+			break;
+		}
+		for (int sx = x + bishopDx[d], sy = y + bishopDy[d]; onBoard(sx, sy); sx += bishopDx[d], sy += bishopDy[d]) {
+			int code = squares[sy * 8 + sx];
+			if (!code) continue;
+			if (code == bishop || code == queen) return true;
+			break;
+		}
+	}
+
+	return false;
+}
+
+/*
+	STATIC EXCHANGE EVALUATION
+*/
+
+struct SeeTables
+{
+	// squares in every direction of kingDx/kingDy from every square, and the ones next to every square
+	std::uint64_t rays[64][8];
+	std::uint64_t neighbours[64];
+	std::uint64_t knights[64];
+	// by piece code + 6 and direction seen from the target: bit 0 captures from the next square, bit 1 from further away
+	std::uint8_t attacks[13][8];
+	// by piece code + 6, the king only captures last
+	int values[13];
+};
+
+static SeeTables initSeeTables() {
+	SeeTables tables{};
+	const int values[6] = { 20000, 900, 330, 320, 500, 100 };
+
+	for (int sq = 0; sq < 64; ++sq) {
+		int x = sq % 8, y = sq / 8;
+		for (int d = 0; d < 8; ++d) {
+			for (int sx = x + kingDx[d], sy = y + kingDy[d]; onBoard(sx, sy); sx += kingDx[d], sy += kingDy[d])
+				tables.rays[sq][d] |= std::uint64_t(1) << (sy * 8 + sx);
+
+			if (onBoard(x + kingDx[d], y + kingDy[d])) tables.neighbours[sq] |= std::uint64_t(1) << (sq + kingDy[d] * 8 + kingDx[d]);
+			if (onBoard(x + knightDx[d], y + knightDy[d])) tables.knights[sq] |= std::uint64_t(1) << (sq + knightDy[d] * 8 + knightDx[d]);
+		}
+	}
+
+	for (int code = -6; code <= 6; ++code) {
+		if (!code) continue;
+		PieceType type = codeType(code);
+		tables.values[code + 6] = values[type];
+
+		for (int d = 0; d < 8; ++d) {
+			bool diagonal = kingDx[d] != 0 && kingDy[d] != 0;
+			bool slides = type == PieceType::QUEEN || (type == PieceType::ROOK && !diagonal) || (type == PieceType::BISHOP && diagonal);
+			// a pawn captures towards its own direction, so it stands on the opposite side of the target
+			bool adjacent = slides || type == PieceType::KING || (type == PieceType::PAWN && diagonal && kingDy[d] == -pawnDirection(codeColor(code)));
+			tables.attacks[code + 6][d] = std::uint8_t((adjacent ? 1 : 0) | (slides ? 2 : 0));
+		}
+	}
+	return tables;
+}
+
+static const SeeTables seeTables = initSeeTables();
+
+static inline int lowestSquare(std::uint64_t bits) {
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward64(&index, bits);
+	return int(index);
+#else
+	return __builtin_ctzll(bits);
+#endif
+}
+
+static inline int highestSquare(std::uint64_t bits) {
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanReverse64(&index, bits);
+	return int(index);
+#else
+	return 63 - __builtin_clzll(bits);
+#endif
+}
+
+// One bit per non-empty square, eight squares at a time
+static inline std::uint64_t occupancy(const std::array<std::int8_t, 64>& squares) {
+	const std::uint64_t low7 = 0x7f7f7f7f7f7f7f7fULL;
+	std::uint64_t occupied = 0;
+	for (int row = 0; row < 8; ++row) {
+		std::uint64_t bytes;
+		std::memcpy(&bytes, &squares[row * 8], 8);
+		// high bit of every non-zero byte, then gathered into the top byte
+		std::uint64_t nonZero = (bytes | ((bytes & low7) + low7)) & ~low7;
+		occupied |= (((nonZero >> 7) * 0x0102040810204080ULL) >> 56) << (row * 8);
+	}
+	return occupied;
+}
+
+// Nearest piece of a ray that can capture on the target, -1 when there is none
+static inline int rayAttacker(const std::array<std::int8_t, 64>& squares, int target, int d, std::uint64_t bits) {
+	if (!bits) return -1;
+
+	// directions 4 to 7 go towards higher squares
+	int sq = d >= 4 ? lowestSquare(bits) : highestSquare(bits);
+	int step = (seeTables.neighbours[target] >> sq) & 1 ? 1 : 2;
+	return seeTables.attacks[squares[sq] + 6][d] & step ? sq : -1;
+}
+
+int Position::see(Move move) const {
+	const int target = move.to;
+	const std::uint64_t occupied = occupancy(squares) & ~(std::uint64_t(1) << move.from);
+
+	// only the nearest piece of every ray can capture, the ones behind it join the exchange once it has captured
+	std::uint64_t rayBits[8];
+	int front[8];
+	for (int d = 0; d < 8; ++d) {
+		rayBits[d] = seeTables.rays[target][d] & occupied;
+		front[d] = rayAttacker(squares, target, d, rayBits[d]);
+	}
+
+	std::uint64_t knights = 0;
+	for (std::uint64_t bits = seeTables.knights[target] & occupied; bits; bits &= bits - 1) {
+		int sq = lowestSquare(bits);
+		if (codeType(squares[sq]) == PieceType::KNIGHT) knights |= std::uint64_t(1) << sq;
+	}
+
+	int gain[32];
+	int depth = 0;
+	gain[0] = seeTables.values[squares[target] + 6];
+	int attackerValue = seeTables.values[squares[move.from] + 6];
+	bool white = turn == PieceColor::BLACK;	// side of the next capture
+	const int knightValue = seeTables.values[pieceCode(PieceColor::WHITE, PieceType::KNIGHT) + 6];
+
+	while (true) {
+		++depth;
+		// what the other side makes if it recaptures the last attacker
+		gain[depth] = attackerValue - gain[depth - 1];
+		if (depth == 31) break;
+
+		// least valuable attacker of the side to capture
+		int knight = -1, ray = -1, bestValue = 1 << 30;
+		for (std::uint64_t bits = knights; bits; bits &= bits - 1) {
+			int sq = lowestSquare(bits);
+			if ((squares[sq] > 0) == white) {
+				knight = sq;
+				bestValue = knightValue;
+				break;
+			}
+		}
+		for (int d = 0; d < 8; ++d) {
+			if (front[d] < 0) continue;
+			int code = squares[front[d]];
+			if ((code > 0) == white && seeTables.values[code + 6] < bestValue) {
+				ray = d;
+				bestValue = seeTables.values[code + 6];
+			}
+		}
+
+		if (ray >= 0) {
+			rayBits[ray] ^= std::uint64_t(1) << front[ray];
+			front[ray] = rayAttacker(squares, target, ray, rayBits[ray]);
+		}
+		else if (knight >= 0) knights ^= std::uint64_t(1) << knight;
+		else break;
+
+		attackerValue = bestValue;
+		white = !white;
+	}
+
+	while (--depth)
+		gain[depth - 1] = -std::max(-gain[depth - 1], gain[depth]);
+	return gain[0];
+}
+
+bool Position::inCheck() const {
+	return kings[turn] >= 0 && isAttacked(kings[turn], oppositeColor(turn));
+}
+
+void Position::generate(MoveList& list, bool capturesOnly) const {
+	for (int sq = 0; sq < 64; ++sq) {
+		int code = squares[sq];
+		if (!code || codeColor(code) != turn) continue;
+
+		generatePiece(list, sq, capturesOnly);
+	}
+}
+
+void Position::generatePiece(MoveList& list, int sq, bool capturesOnly) const {
+	int code = squares[sq];
+	int x = sq % 8, y = sq / 8;
+
+	// adds the move to (tx, ty) and returns whether a slider can continue past it
+	auto add = [&](int tx, int ty) {
+		int target = squares[ty * 8 + tx];
+		if (!target) {
+			if (!capturesOnly) list.push(sq, ty * 8 + tx);
+			return true;
+		}
+		if (codeColor(target) != turn) list.push(sq, ty * 8 + tx);
+		return false;
+	};
+
+	switch (codeType(code)) {
+	case PieceType::PAWN:
+	{
+		int dir = pawnDirection(turn);
+		int ny = y + dir;
+		if (!onBoard(x, ny)) break;
+
+		if (!capturesOnly && !squares[ny * 8 + x]) {
+			list.push(sq, ny * 8 + x);
+			if (y == pawnStartRow(turn) && !squares[(ny + dir) * 8 + x])
+				list.push(sq, (ny + dir) * 8 + x);
+		}
+		for (int dx = -1; dx <= 1; dx += 2) {
+			if (!onBoard(x + dx, ny)) continue;
+			int target = squares[ny * 8 + x + dx];
+			if (target && codeColor(target) != turn) list.push(sq, ny * 8 + x + dx);
+		}
+		break;
+	}
+	case PieceType::KNIGHT:
+		for (int i = 0; i < 8; ++i) {
+			if (onBoard(x + knightDx[i], y + knightDy[i])) add(x + knightDx[i], y + knightDy[i]);
+		}
+		break;
+	case PieceType::KING:
+		for (int i = 0; i < 8; ++i) {
+			if (onBoard(x + kingDx[i], y + kingDy[i])) add(x + kingDx[i], y + kingDy[i]);
+		}
+		break;
+	default:
+	{
+		PieceType type = codeType(code);
+		for (int d = 0; d < 4; ++d) {
+			if (type != PieceType::BISHOP) {
+				for (int tx = x + rookDx[d], ty = y + rookDy[d]; onBoard(tx, ty) && add(tx, ty); tx += rookDx[d], ty += rookDy[d]);
+			}
+			if (type != PieceType::ROOK) {
+				for (int tx = x + bishopDx[d], ty = y + bishopDy[d]; onBoard(tx, ty) && add(tx, ty); tx += bishopDx[d], ty += bishopDy[d]);
+			}
+		}
+		break;
+	}
+	}
+}
+
+void Position::generateMoves(MoveList& list) const {
+	list.size = 0;
+	generate(list, false);
+}
+
+void Position::generateCaptures(MoveList& list) const {
+	list.size = 0;
+	generate(list, true);
+}
+
+void Position::generateLegalMoves(MoveList& list) {
+	generateMoves(list);
+
+	int n = 0;
+	for (int i = 0; i < list.size; ++i) {
+		if (isLegal(list.moves[i])) list.moves[n++] = list.moves[i];
+	}
+	list.size = n;
+}
+
+UndoInfo Position::makeMove(Move move) {
+	UndoInfo undo{ squares[move.to], hash, halfmoveClock };
+
+	int code = squares[move.from];
+	PieceColor color = codeColor(code);
+	PieceType type = codeType(code);
+
+	hash ^= zobristPieceKey(color, type, tileOf(move.from));
+	hash ^= zobristPieceKey(color, type, tileOf(move.to));
+	if (undo.captured)
+		hash ^= zobristPieceKey(codeColor(undo.captured), codeType(undo.captured), tileOf(move.to));
+	hash ^= zobristTurnKey();
+
+	squares[move.to] = std::int8_t(code);
+	squares[move.from] = 0;
+	if (type == PieceType::KING) kings[color] = move.to;
+
+	halfmoveClock = (type == PieceType::PAWN || undo.captured) ? 0 : halfmoveClock + 1;
+	turn = oppositeColor(turn);
+
+	return undo;
+}
+
+void Position::unmakeMove(Move move, const UndoInfo& undo) {
+	int code = squares[move.to];
+
+	squares[move.from] = std::int8_t(code);
+	squares[move.to] = undo.captured;
+	if (codeType(code) == PieceType::KING) kings[codeColor(code)] = move.from;
+
+	turn = oppositeColor(turn);
+	hash = undo.hash;
+	halfmoveClock = undo.halfmoveClock;
+}
+
+bool Position::isLegal(Move move) {
+	PieceColor mover = turn;
+
+	UndoInfo undo = makeMove(move);
+	bool legal = kings[mover] < 0 || !isAttacked(kings[mover], turn);
+	unmakeMove(move, undo);
+
+	return legal;
+}
+
+/*
+	GAME STATE
+*/
+
+// Squares a piece other than the king can move to to answer the checks on king, capture or interposition.
+// Counts the checkers, in double check only the king can move.
+static std::uint64_t evasionSquares(const Position& position, int king, int& checkers) {
+	PieceColor by = oppositeColor(codeColor(position.squares[king]));
+	int x = king % 8, y = king / 8;
+	std::uint64_t squares = 0;
+	checkers = 0;
+
+	auto addChecker = [&](int square) {
+		squares |= std::uint64_t(1) << square;
+		++checkers;
+	};
+
+	int py = y - pawnDirection(by);
+	for (int dx = -1; dx <= 1; dx += 2) {
+		if (onBoard(x + dx, py) && position.squares[py * 8 + x + dx] == pieceCode(by, PieceType::PAWN)) addChecker(py * 8 + x + dx);
+	}
+	for (int i = 0; i < 8; ++i) {
+		int nx = x + knightDx[i], ny = y + knightDy[i];
+		if (onBoard(nx, ny) && position.squares[ny * 8 + nx] == pieceCode(by, PieceType::KNIGHT)) addChecker(ny * 8 + nx);
+	}
+
+	int queen = pieceCode(by, PieceType::QUEEN);
+	for (int d = 0; d < 8; ++d) {
+		int dx = d < 4 ? rookDx[d] : bishopDx[d - 4];
+		int dy = d < 4 ? rookDy[d] : bishopDy[d - 4];
+		int slider = pieceCode(by, d < 4 ? PieceType::ROOK : PieceType::BISHOP);
+
+		std::uint64_t ray = 0;
+		for (int sx = x + dx, sy = y + dy; onBoard(sx, sy); sx += dx, sy += dy) {
+			int code = position.squares[sy * 8 + sx];
+			ray |= std::uint64_t(1) << (sy * 8 + sx);
+			if (!code) continue;
+			if (code == slider || code == queen) {
+				squares |= ray;
+				++checkers;
+			}
+			break;
+		}
+	}
+
+	return squares;
+}
+
+bool Position::hasLegalMove() {
+	MoveList list;
+	int king = kings[turn];
+
+	// the king first, its moves are the only ones left in double check and the usual escape from a single one
+	std::uint64_t targets = ~std::uint64_t(0);
+	if (king >= 0) {
+		generatePiece(list, king, false);
+		for (Move m : list) {
+			if (isLegal(m)) return true;
+		}
+
+		if (isAttacked(king, oppositeColor(turn))) {
+			int checkers;
+			targets = evasionSquares(*this, king, checkers);
+			if (checkers > 1) return false;
+		}
+	}
+
+	// then the other pieces one at a time, only their evasions when in check
+	for (int sq = 0; sq < 64; ++sq) {
+		int code = squares[sq];
+		if (!code || codeColor(code) != turn || sq == king) continue;
+
+		list.size = 0;
+		generatePiece(list, sq, false);
+		for (Move m : list) {
+			if ((targets >> m.to & 1) && isLegal(m)) return true;
+		}
+	}
+
+	return false;
+}
+
+bool Position::isInsufficientMaterial() const {
+	// pawns never promote, but they can still help to mate, so only bare kings, a single minor piece
+	// or bishops that all stand on squares of the same color are a dead draw
+	int minors = 0, knights = 0;
+	int bishopColors = 0;
+	for (int sq = 0; sq < 64; ++sq) {
+		int code = squares[sq];
+		if (!code) continue;
+
+		switch (codeType(code)) {
+		case PieceType::KING:
+			break;
+		case PieceType::KNIGHT:
+			++minors;
+			++knights;
+			break;
+		case PieceType::BISHOP:
+			++minors;
+			bishopColors |= 1 << ((sq % 8 + sq / 8) % 2);
+			break;
+		default:
+			return false;
+		}
+	}
+
+	return minors <= 1 || (knights == 0 && bishopColors != 3);
+}
+
+GameState Position::classify() {
+	if (!hasLegalMove()) return inCheck() ? GameState::CHECKMATE : GameState::STALEMATE;
+	if (isInsufficientMaterial()) return GameState::INSUFFICIENT_MATERIAL;
+	return GameState::ONGOING;
+}
+
+std::uint64_t Position::perft(int depth) {
+	MoveList list;
+	generateLegalMoves(list);
+	if (depth <= 1) return depth == 1 ? list.size : 1;
+
+	std::uint64_t count = 0;
+	for (Move m : list) {
+		UndoInfo undo = makeMove(m);
+		count += perft(depth - 1);
+		unmakeMove(m, undo);
+	}
+	return count;
+}
+
+/*
+	EVALUATION
+*/
+
+int evaluate(const Position& position) {
+	int nonPawnMaterial = 0;
+	for (int code : position.squares) {
+		if (code && codeType(code) != PieceType::PAWN) nonPawnMaterial += pieceValues[codeType(code)];
+	}
+	bool endgame = nonPawnMaterial <= 2600;
+
+	int score = 0;
+	for (int sq = 0; sq < 64; ++sq) {
+		int code = position.squares[sq];
+		if (!code) continue;
+
+		PieceColor color = codeColor(code);
+		PieceType type = codeType(code);
+		int x = sq % 8, y = sq / 8;
+
+		// 0 in the corners, 12 in the four center squares
+		int center = 14 - std::abs(2 * x - 7) - std::abs(2 * y - 7);
+
+		int value = pieceValues[type];
+		switch (type) {
+		case PieceType::KNIGHT: value += center * 3; break;
+		case PieceType::BISHOP: value += center * 2; break;
+		case PieceType::QUEEN: value += center; break;
+		case PieceType::KING: value += endgame ? center * 2 : -center * 2; break;
+		case PieceType::PAWN:
+		{
+			int advance = color == PieceColor::WHITE ? 6 - y : y - 1;
+			// there is no promotion, a pawn on the last row can never move or capture again
+			if (advance == 6) value = 20;
+			else value += advance * (endgame ? 10 : 4) + (center > 8 ? 10 : 0);
+			break;
+		}
+		default: break;
+		}
+
+		score += color == PieceColor::WHITE ? value : -value;
+	}
+
+	return position.turn == PieceColor::WHITE ? score : -score;
+}
+
+/*
+	TIME MANAGEMENT
+*/
+
+TimeBudget allocateTime(std::int64_t timeLeftMs, std::int64_t incrementMs, int movesToGo) {
+	// keep a reserve for move overhead, so the clock never runs out between searches
+	const std::int64_t overheadMs = 30;
+	std::int64_t available = std::max<std::int64_t>(1, timeLeftMs - overheadMs);
+
+	// in sudden death assume the game lasts about 30 more moves
+	int moves = movesToGo > 0 ? std::min(movesToGo, 40) : 30;
+
+	TimeBudget budget;
+	budget.maximumMs = std::max<std::int64_t>(1, std::min(available / 2, available / moves * 5 + incrementMs));
+	budget.optimumMs = std::max<std::int64_t>(1, std::min(budget.maximumMs, available / moves + incrementMs * 3 / 4));
+	return budget;
+}
+
+/*
+	SEARCH
+*/
+
+enum Bound : std::uint8_t {
+	BOUND_NONE = 0,
+	BOUND_UPPER,
+	BOUND_LOWER,
+	BOUND_EXACT
+};
+
+static const int INFINITE_SCORE = MATE_SCORE + 1;
+
+Engine::Engine(const EngineOptions& options) : options{ options }, stopFlag{ false }, pondering{ false }, ponderHitPending{ false }, nodes{ 0 }, nodeLimit{ 0 }, hasDeadline{ false }, optimumMs{ 0 } {
+	std::size_t entries = 1;
+	while (entries * 2 * sizeof(TableEntry) <= std::size_t(options.hashSizeMb) * 1024 * 1024) entries *= 2;
+	table.resize(entries);
+	clear();
+}
+
+void Engine::clear() {
+	std::fill(table.begin(), table.end(), TableEntry{ 0, nullMove, 0, 0, BOUND_NONE });
+	for (auto& k : killers) k.fill(nullMove);
+}
+
+void Engine::stop() {
+	stopFlag = true;
+}
+
+void Engine::beginPonder() {
+	ponderHitPending = false;
+	pondering = true;
+}
+
+void Engine::ponderHit() {
+	// the clock is checked by the search thread, which may not even have started its search yet
+	pondering = false;
+	ponderHitPending = true;
+}
+
+void Engine::setIterationCallback(std::function<void(const Position&, const SearchResult&)> callback) {
+	iterationCallback = callback;
+}
+
+std::int64_t Engine::elapsedMs() const {
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+bool Engine::shouldStop() {
+	if (stopFlag.load(std::memory_order_relaxed)) return true;
+
+	if ((nodes & 1023) == 0) {
+		// Time spent pondering counts as thinking time, so when the opponent took
+		// longer than the budget of this move there is nothing left to search for.
+		if (ponderHitPending.load(std::memory_order_relaxed) && ponderHitPending.exchange(false) && optimumMs > 0 && elapsedMs() >= optimumMs)
+			stopFlag = true;
+
+		bool timeUp = hasDeadline && !pondering.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() >= deadline;
+		if ((nodeLimit && nodes >= nodeLimit) || timeUp)
+			stopFlag = true;
+	}
+
+	return stopFlag.load(std::memory_order_relaxed);
+}
+
+bool Engine::shouldStopIteration(int stableIterations, int scoreDrop, bool bestMoveChanged) {
+	if (pondering || optimumMs <= 0) return false;
+
+	// spend less time when the best move keeps being the same, more when it changes or the score drops
+	double scale = 1.0;
+	if (stableIterations >= 4) scale *= 0.5;
+	else if (stableIterations >= 2) scale *= 0.75;
+	if (bestMoveChanged) scale *= 1.4;
+	if (scoreDrop > 75) scale *= 1.8;
+	else if (scoreDrop > 25) scale *= 1.3;
+
+	// the next iteration takes a few times longer than this one, don't start it if it can't finish
+	return double(elapsedMs()) >= double(optimumMs) * scale * 0.6;
+}
+
+Engine::TableEntry* Engine::probe(std::uint64_t key) {
+	TableEntry* entry = &table[key & (table.size() - 1)];
+	return entry->key == key && entry->bound != BOUND_NONE ? entry : nullptr;
+}
+
+void Engine::store(std::uint64_t key, Move move, int score, int depth, int bound, int ply) {
+	TableEntry& entry = table[key & (table.size() - 1)];
+	if (entry.key == key && entry.depth > depth && bound != BOUND_EXACT) return;
+
+	// mate scores are stored relative to the node, not to the root
+	if (score > MATE_SCORE - MAX_PLY) score += ply;
+	else if (score < -MATE_SCORE + MAX_PLY) score -= ply;
+
+	if (move.isNull() && entry.key == key) move = entry.move;
+	entry = TableEntry{ key, move, std::int16_t(score), std::int8_t(depth), std::uint8_t(bound) };
+}
+
+// Taking a piece worth at least the capturing one can't lose material, only the other captures need the exchange
+static inline bool isLosingCapture(const Position& position, Move m) {
+	int victim = position.squares[m.to];
+	if (!victim || pieceValues[codeType(victim)] >= pieceValues[codeType(position.squares[m.from])]) return false;
+	return position.see(m) < 0;
+}
+
+void Engine::orderMoves(Position& position, MoveList& list, Move best, int ply) {
+	std::array<int, 256> scores;
+
+	for (int i = 0; i < list.size; ++i) {
+		Move m = list.moves[i];
+		int victim = position.squares[m.to];
+
+		if (m == best) scores[i] = 1000000;
+		// captures that lose material go after the quiet moves
+		else if (victim && isLosingCapture(position, m)) scores[i] = -100000 + position.see(m);
+		else if (victim) scores[i] = 100000 + pieceValues[codeType(victim)] * 10 - pieceValues[codeType(position.squares[m.from])] / 10;
+		else if (m == killers[ply][0]) scores[i] = 90000;
+		else if (m == killers[ply][1]) scores[i] = 80000;
+		else scores[i] = 0;
+	}
+
+	// lists are short, insertion sort beats std::sort here
+	for (int i = 1; i < list.size; ++i) {
+		Move m = list.moves[i];
+		int s = scores[i];
+		int j = i - 1;
+		for (; j >= 0 && scores[j] < s; --j) {
+			list.moves[j + 1] = list.moves[j];
+			scores[j + 1] = scores[j];
+		}
+		list.moves[j + 1] = m;
+		scores[j + 1] = s;
+	}
+}
+
+int Engine::quiesce(Position& position, int alpha, int beta, int ply) {
+	++nodes;
+	if (shouldStop()) return 0;
+
+	int standPat = evaluate(position);
+	if (!options.quiescence || ply >= MAX_PLY || standPat >= beta) return standPat;
+	if (standPat > alpha) alpha = standPat;
+
+	MoveList list;
+	position.generateCaptures(list);
+	orderMoves(position, list, nullMove, ply);
+
+	PieceColor mover = position.turn;
+	for (Move m : list) {
+		// losing captures are ordered last, nothing worth searching follows
+		if (isLosingCapture(position, m)) break;
+
+		UndoInfo undo = position.makeMove(m);
+		if (position.kings[mover] >= 0 && position.isAttacked(position.kings[mover], position.turn)) {
+			position.unmakeMove(m, undo);
+			continue;
+		}
+
+		int score = -quiesce(position, -beta, -alpha, ply + 1);
+		position.unmakeMove(m, undo);
+
+		if (stopFlag.load(std::memory_order_relaxed)) return 0;
+		if (score >= beta) return score;
+		if (score > alpha) alpha = score;
+	}
+
+	return alpha;
+}
+
+int Engine::negamax(Position& position, int depth, int alpha, int beta, int ply) {
+	if (shouldStop()) return 0;
+
+	// draws by the 50-move rule, by lack of mating material and by repeating a position of the current line
+	if (position.halfmoveClock >= 100 || position.isInsufficientMaterial()) return 0;
+	for (int i = ply - 2; i >= 0 && i >= ply - position.halfmoveClock; i -= 2) {
+		if (pathHashes[i] == position.hash) return 0;
+	}
+
+	if (ply >= MAX_PLY) return evaluate(position);
+
+	bool inCheck = position.inCheck();
+	if (inCheck) ++depth;
+	if (depth <= 0) return quiesce(position, alpha, beta, ply);
+
+	++nodes;
+
+	Move ttMove = nullMove;
+	if (TableEntry* entry = probe(position.hash)) {
+		ttMove = entry->move;
+
+		int score = entry->score;
+		if (score > MATE_SCORE - MAX_PLY) score -= ply;
+		else if (score < -MATE_SCORE + MAX_PLY) score += ply;
+
+		if (entry->depth >= depth) {
+			if (entry->bound == BOUND_EXACT) return score;
+			if (entry->bound == BOUND_LOWER && score >= beta) return score;
+			if (entry->bound == BOUND_UPPER && score <= alpha) return score;
+		}
+	}
+
+	MoveList list;
+	position.generateMoves(list);
+	orderMoves(position, list, ttMove, ply);
+
+	int originalAlpha = alpha;
+	int bestScore = -INFINITE_SCORE;
+	Move bestMove = nullMove;
+	int legalMoves = 0;
+
+	PieceColor mover = position.turn;
+	for (Move m : list) {
+		UndoInfo undo = position.makeMove(m);
+		if (position.kings[mover] >= 0 && position.isAttacked(position.kings[mover], position.turn)) {
+			position.unmakeMove(m, undo);
+			continue;
+		}
+		++legalMoves;
+
+		pathHashes[ply + 1] = position.hash;
+		int score = -negamax(position, depth - 1, -beta, -alpha, ply + 1);
+		position.unmakeMove(m, undo);
+
+		if (stopFlag.load(std::memory_order_relaxed)) return 0;
+
+		if (score > bestScore) {
+			bestScore = score;
+			bestMove = m;
+		}
+		if (score > alpha) alpha = score;
+		if (alpha >= beta) {
+			if (!undo.captured && m != killers[ply][0]) {
+				killers[ply][1] = killers[ply][0];
+				killers[ply][0] = m;
+			}
+			break;
+		}
+	}
+
+	if (!legalMoves) return inCheck ? -MATE_SCORE + ply : 0;
+
+	int bound = bestScore >= beta ? BOUND_LOWER : bestScore > originalAlpha ? BOUND_EXACT : BOUND_UPPER;
+	store(position.hash, bestMove, bestScore, depth, bound, ply);
+
+	return bestScore;
+}
+
+std::vector<Move> Engine::extractPv(Position& position, Move first) {
+	std::vector<Move> pv;
+	std::vector<UndoInfo> undos;
+
+	Move m = first;
+	while (!m.isNull() && pv.size() < 32) {
+		MoveList list;
+		position.generateLegalMoves(list);
+		if (std::find(list.begin(), list.end(), m) == list.end()) break;
+
+		pv.push_back(m);
+		undos.push_back(position.makeMove(m));
+
+		// stop at repetitions, the table can hold a cycle
+		bool repeated = false;
+		for (std::size_t i = 0; i + 1 < pv.size(); ++i) {
+			if (undos[i].hash == position.hash) repeated = true;
+		}
+		if (repeated) break;
+
+		TableEntry* entry = probe(position.hash);
+		m = entry ? entry->move : nullMove;
+	}
+
+	for (std::size_t i = pv.size(); i-- > 0;)
+		position.unmakeMove(pv[i], undos[i]);
+
+	return pv;
+}
+
+SearchResult Engine::search(Position& position, const SearchLimits& limits) {
+	stopFlag = false;
+	// a ponder search was put in that state by beginPonder, ponderHit may already have ended it
+	if (!limits.ponder) {
+		pondering = false;
+		ponderHitPending = false;
+	}
+	nodes = 0;
+	nodeLimit = limits.nodes;
+	startTime = std::chrono::steady_clock::now();
+
+	std::int64_t maximumMs = limits.moveTimeMs;
+	optimumMs = 0;
+	if (limits.timeLeftMs > 0) {
+		TimeBudget budget = allocateTime(limits.timeLeftMs, limits.incrementMs, limits.movesToGo);
+		optimumMs = budget.optimumMs;
+		maximumMs = maximumMs > 0 ? std::min(maximumMs, budget.maximumMs) : budget.maximumMs;
+	}
+	hasDeadline = maximumMs > 0;
+	deadline = startTime + std::chrono::milliseconds(maximumMs);
+	for (auto& k : killers) k.fill(nullMove);
+
+	SearchResult result;
+
+	MoveList rootMoves;
+	position.generateLegalMoves(rootMoves);
+	if (!rootMoves.size) {
+		result.score = position.inCheck() ? -MATE_SCORE : 0;
+		return result;
+	}
+	result.bestMove = rootMoves.moves[0];
+
+	int maxDepth = limits.depth > 0 ? std::min(limits.depth, MAX_PLY - 1) : std::min(options.maxDepth, MAX_PLY - 1);
+	pathHashes[0] = position.hash;
+
+	int stableIterations = 0;
+
+	for (int depth = 1; depth <= maxDepth; ++depth) {
+		orderMoves(position, rootMoves, result.bestMove, 0);
+
+		int alpha = -INFINITE_SCORE;
+		int bestScore = -INFINITE_SCORE;
+		Move bestMove = nullMove;
+
+		for (Move m : rootMoves) {
+			UndoInfo undo = position.makeMove(m);
+			pathHashes[1] = position.hash;
+			int score = -negamax(position, depth - 1, -INFINITE_SCORE, -alpha, 1);
+			position.unmakeMove(m, undo);
+
+			if (stopFlag.load(std::memory_order_relaxed)) break;
+
+			if (score > bestScore) {
+				bestScore = score;
+				bestMove = m;
+			}
+			if (score > alpha) alpha = score;
+		}
+
+		// an interrupted iteration is only trusted if it already found a better move than the last one
+		if (stopFlag.load(std::memory_order_relaxed)) {
+			if (!bestMove.isNull() && depth > 1 && bestScore > result.score && bestMove != result.bestMove) {
+				result.bestMove = bestMove;
+				result.score = bestScore;
+			}
+			break;
+		}
+
+		bool bestMoveChanged = depth > 1 && bestMove != result.bestMove;
+		int scoreDrop = depth > 1 ? result.score - bestScore : 0;
+		stableIterations = bestMoveChanged ? 0 : stableIterations + 1;
+
+		result.bestMove = bestMove;
+		result.score = bestScore;
+		result.depth = depth;
+		store(position.hash, bestMove, bestScore, depth, BOUND_EXACT, 0);
+
+		if (iterationCallback) {
+			result.nodes = nodes;
+			result.pv = extractPv(position, result.bestMove);
+			iterationCallback(position, result);
+		}
+
+		// a forced mate will not get any shorter
+		if (isMateScore(bestScore) && MATE_SCORE - std::abs(bestScore) <= depth) break;
+
+		if (shouldStopIteration(stableIterations, scoreDrop, bestMoveChanged)) break;
+	}
+
+	result.nodes = nodes;
+	result.pv = extractPv(position, result.bestMove);
+	return result;
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Pieces.h"
+#include "History.h"
+
+/*
+	Compact position and alpha-beta search used by the computer player and the command line tools.
+	The rules are the same as the ones of Game (no castling, en passant or promotion),
+	and positions hash to the same Zobrist keys, so hashes can be shared with MoveHistory.
+*/
+
+// Squares are indexed y * 8 + x, with y = 0 being the top (black) row of the board
+inline int squareOf(sf::Vector2i tile) { return tile.y * 8 + tile.x; }
+inline sf::Vector2i tileOf(int square) { return sf::Vector2i(square % 8, square / 8); }
+
+// Piece codes are the ones of Game::initBoard, type + 1 for whites and -(type + 1) for blacks, 0 for an empty square
+inline int pieceCode(PieceColor color, PieceType type) { return color == PieceColor::WHITE ? type + 1 : -(type + 1); }
+inline PieceType codeType(int code) { return PieceType((code < 0 ? -code : code) - 1); }
+inline PieceColor codeColor(int code) { return code < 0 ? PieceColor::BLACK : PieceColor::WHITE; }
+
+struct Move
+{
+	std::int8_t from;
+	std::int8_t to;
+
+	bool isNull() const { return from == to; }
+	std::string toString() const;
+};
+
+inline bool operator==(Move a, Move b) { return a.from == b.from && a.to == b.to; }
+inline bool operator!=(Move a, Move b) { return !(a == b); }
+
+const Move nullMove = { 0, 0 };
+
+struct MoveList
+{
+	std::array<Move, 256> moves;
+	int size = 0;
+
+	void push(int from, int to) { moves[size++] = Move{ std::int8_t(from), std::int8_t(to) }; }
+	Move* begin() { return moves.data(); }
+	Move* end() { return moves.data() + size; }
+};
+
+struct UndoInfo
+{
+	std::int8_t captured;
+	std::uint64_t hash;
+	int halfmoveClock;
+};
+
+enum class GameState {
+	ONGOING = 0,
+	CHECKMATE,				// the side to move is mated
+	STALEMATE,				// the side to move has no legal move but is not in check
+	INSUFFICIENT_MATERIAL	// neither side can mate any more
+};
+
+class Position
+{
+public:
+	std::array<std::int8_t, 64> squares;
+	PieceColor turn;
+	std::uint64_t hash;
+	int halfmoveClock;
+	std::array<int, 2> kings;
+
+	Position();
+	static Position fromBoard(const std::array<std::array<Piece*, 8>, 8>& board, PieceColor turn);
+	// Piece placement and side to move, the rest of the FEN is ignored like in Game::loadFen
+	bool loadFen(const std::string& fen);
+	std::string toFen() const;
+
+	bool isAttacked(int square, PieceColor by) const;
+	bool inCheck() const;
+
+	// Static exchange evaluation: material won by the side to move when both sides keep capturing on the target
+	// square of move with their least valuable attacker, x-rays included. Pins are ignored.
+	int see(Move move) const;
+
+	// Pseudo-legal moves of the side to move, they can still leave the own king in check
+	void generateMoves(MoveList& list) const;
+	void generateCaptures(MoveList& list) const;
+	void generateLegalMoves(MoveList& list);
+
+	UndoInfo makeMove(Move move);
+	void unmakeMove(Move move, const UndoInfo& undo);
+	bool isLegal(Move move);
+
+	// Stops at the first legal move, trying the king and the check evasions before anything else
+	bool hasLegalMove();
+	bool isInsufficientMaterial() const;
+	GameState classify();
+
+	std::uint64_t perft(int depth);
+private:
+	void generate(MoveList& list, bool capturesOnly) const;
+	void generatePiece(MoveList& list, int square, bool capturesOnly) const;
+	void recomputeHash();
+};
+
+// Static evaluation in centipawns from the point of view of the side to move
+int evaluate(const Position& position);
+
+const int MATE_SCORE = 30000;
+const int MAX_PLY = 128;
+
+inline bool isMateScore(int score) { return score > MATE_SCORE - MAX_PLY || score < -MATE_SCORE + MAX_PLY; }
+
+struct EngineOptions
+{
+	int maxDepth = 64;
+	int hashSizeMb = 16;
+	bool quiescence = true;
+};
+
+struct SearchLimits
+{
+	int depth = 0;				// 0 = EngineOptions::maxDepth
+	std::int64_t nodes = 0;		// 0 = unlimited
+	std::int64_t moveTimeMs = 0;	// 0 = unlimited
+
+	// Clock of the side to move, the engine budgets its own time when timeLeftMs is set
+	std::int64_t timeLeftMs = 0;
+	std::int64_t incrementMs = 0;
+	int movesToGo = 0;			// 0 = the rest of the game
+
+	// Think on the opponent's time, time limits only apply after Engine::ponderHit. The caller starts pondering with
+	// Engine::beginPonder before handing the search to another thread, so an early ponder hit is not lost.
+	bool ponder = false;
+};
+
+/*
+	Time budget of one move: the search aims for optimum and never goes beyond maximum.
+*/
+
+struct TimeBudget
+{
+	std::int64_t optimumMs;
+	std::int64_t maximumMs;
+};
+
+TimeBudget allocateTime(std::int64_t timeLeftMs, std::int64_t incrementMs, int movesToGo);
+
+struct SearchResult
+{
+	Move bestMove = nullMove;
+	int score = 0;
+	int depth = 0;
+	std::int64_t nodes = 0;
+	std::vector<Move> pv;
+};
+
+class Engine
+{
+private:
+	struct TableEntry
+	{
+		std::uint64_t key;
+		Move move;
+		std::int16_t score;
+		std::int8_t depth;
+		std::uint8_t bound;
+	};
+
+	EngineOptions options;
+	std::vector<TableEntry> table;
+
+	std::atomic<bool> stopFlag;
+	std::atomic<bool> pondering;
+	std::atomic<bool> ponderHitPending;	// the search thread still has to check its time after a ponder hit
+	std::int64_t nodes;
+	std::int64_t nodeLimit;
+	std::chrono::steady_clock::time_point startTime;
+	std::chrono::steady_clock::time_point deadline;
+	bool hasDeadline;
+	std::atomic<std::int64_t> optimumMs;	// 0 = no soft limit
+
+	std::int64_t elapsedMs() const;
+	bool shouldStopIteration(int stableIterations, int scoreDrop, bool bestMoveChanged);
+
+	std::function<void(const Position&, const SearchResult&)> iterationCallback;
+
+	std::array<std::uint64_t, MAX_PLY + 1> pathHashes;
+	std::array<std::array<Move, 2>, MAX_PLY + 1> killers;
+
+	bool shouldStop();
+	int negamax(Position& position, int depth, int alpha, int beta, int ply);
+	int quiesce(Position& position, int alpha, int beta, int ply);
+	void orderMoves(Position& position, MoveList& list, Move best, int ply);
+	TableEntry* probe(std::uint64_t key);
+	void store(std::uint64_t key, Move move, int score, int depth, int bound, int ply);
+	std::vector<Move> extractPv(Position& position, Move first);
+public:
+	explicit Engine(const EngineOptions& options = EngineOptions());
+
+	SearchResult search(Position& position, const SearchLimits& limits);
+	// Can be called from another thread, search returns the best move found so far
+	void stop();
+	// Called before a search with SearchLimits::ponder is started
+	void beginPonder();
+	// Can be called from another thread, the opponent played the pondered move, so the clock is now running
+	void ponderHit();
+	// Called on the searching thread after every completed iteration, with the root position
+	void setIterationCallback(std::function<void(const Position&, const SearchResult&)> callback);
+	void clear();
+};
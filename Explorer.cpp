@@ -0,0 +1,48 @@
+#include "Explorer.h"
+
+#include <algorithm>
+#include <cstring>
+
+OpeningExplorer::OpeningExplorer() : entries{ nullptr }, entryCount{ 0 } {}
+
+bool OpeningExplorer::open(const std::string& path) {
+	entries = nullptr;
+	entryCount = 0;
+	if (!file.open(path)) return false;
+
+	ExplorerHeader header;
+	if (file.getSize() < sizeof(header)) {
+		file.close();
+		return false;
+	}
+	std::memcpy(&header, file.getData(), sizeof(header));
+
+	if (std::memcmp(header.magic, "CHXI", 4) != 0 || header.version != EXPLORER_VERSION
+		|| file.getSize() != sizeof(header) + header.entryCount * sizeof(ExplorerEntry)) {
+		file.close();
+		return false;
+	}
+
+	// the header keeps the entries 8 byte aligned, the mapping itself is page aligned
+	entries = reinterpret_cast<const ExplorerEntry*>(file.getData() + sizeof(header));
+	entryCount = std::size_t(header.entryCount);
+	return true;
+}
+
+std::vector<ExplorerMove> OpeningExplorer::query(std::uint64_t hash) const {
+	std::vector<ExplorerMove> moves;
+	if (!entries) return moves;
+
+	const ExplorerEntry* end = entries + entryCount;
+	const ExplorerEntry* it = std::lower_bound(entries, end, hash, [](const ExplorerEntry& entry, std::uint64_t h) {
+		return entry.hash < h;
+	});
+
+	for (; it != end && it->hash == hash; ++it)
+		moves.push_back(ExplorerMove{ Move{ it->from, it->to }, it->whiteWins, it->draws, it->blackWins });
+
+	std::sort(moves.begin(), moves.end(), [](const ExplorerMove& a, const ExplorerMove& b) {
+		return a.getGames() > b.getGames();
+	});
+	return moves;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine.h"
+#include "MappedFile.h"
+
+/*
+	Opening explorer: which moves were played from a position, how often and with what results.
+
+	The index is a file of ExplorerEntry sorted by position hash then move, written by Tools/ExplorerBuilder.cpp.
+	It is queried straight from the memory mapped file, there is nothing to load or parse.
+*/
+
+struct ExplorerHeader
+{
+	char magic[4];			// "CHXI"
+	std::uint32_t version;
+	std::uint64_t entryCount;
+};
+
+struct ExplorerEntry
+{
+	std::uint64_t hash;		// Zobrist hash of the position before the move, as in Game and Position
+	std::int8_t from;
+	std::int8_t to;
+	std::uint16_t reserved;
+	std::uint32_t whiteWins;
+	std::uint32_t draws;
+	std::uint32_t blackWins;
+};
+
+static_assert(sizeof(ExplorerHeader) == 16, "the index layout is part of the file format");
+static_assert(sizeof(ExplorerEntry) == 24, "the index layout is part of the file format");
+
+const std::uint32_t EXPLORER_VERSION = 1;
+
+struct ExplorerMove
+{
+	Move move;
+	std::uint32_t whiteWins;
+	std::uint32_t draws;
+	std::uint32_t blackWins;
+
+	std::uint32_t getGames() const { return whiteWins + draws + blackWins; }
+};
+
+class OpeningExplorer
+{
+private:
+	MappedFile file;
+	const ExplorerEntry* entries;
+	std::size_t entryCount;
+public:
+	OpeningExplorer();
+
+	// Maps the index, false when the file is missing or not an index of this version
+	bool open(const std::string& path);
+
+	// Moves played from the position, most played first
+	std::vector<ExplorerMove> query(std::uint64_t hash) const;
+
+	// Getters
+	bool isOpen() const { return entries != nullptr; }
+	std::size_t getEntryCount() const { return entryCount; }
+};
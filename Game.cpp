@@ -1,27 +1,52 @@
 #include "Game.h"
 
 #include <cmath>
+#include <cctype>
+#include <cstdio>
 
 
 
-Game::Game()
+Game::Game() : Game(GameMode::WINDOW) {}
+
+Game::Game(GameMode mode)
 {
+	this->mode = mode;
+	this->window = nullptr;
+	this->computer = nullptr;
+	this->analyzer = nullptr;
+	this->hasAnalysis = false;
+	this->mateSolver = nullptr;
+	this->texturesLoaded = false;
+	this->mousePressed = false;
+
 	this->initVariables();
-	this->initWindow();
-	this->initUI();
+	if (mode == GameMode::WINDOW)
+		this->initWindow();
+	if (mode != GameMode::RULES)
+		this->initUI();
 	this->initBoard();
 }
 
 Game::~Game()
 {
+	delete this->computer;
+	delete this->analyzer;
+	this->cancelMate();
+	delete this->mateSolver;
 	this->cleanup();
 	delete this->window;
 }
 
 void Game::run()
 {
+#if CHESS_PROFILE
+	Profiler::get().setTracing(true);
+#endif
+
 	while (this->getWindowIsOpen())
 	{
+		PROFILE_FRAME();
+
 		// Update
 		this->update();
 
@@ -29,9 +54,17 @@ void Game::run()
 		this->render();
 
 	}
+
+#if CHESS_PROFILE
+	if (!Profiler::get().writeChromeTrace("trace.json"))
+		std::cout << "Failed to write trace.json\n";
+#endif
 }
 
 void Game::cleanup() {
+	if (computer) computer->cancel();
+	history.deleteCapturedPieces();
+
 	for (auto row : board) {
 		for (auto p : row) {
 			if (!p) continue;
@@ -62,7 +95,39 @@ void Game::restart()
 
 const bool Game::getWindowIsOpen() const
 {
-	return this->window->isOpen();
+	return this->window != nullptr && this->window->isOpen();
+}
+
+const std::array<std::array<Piece*, 8>, 8>& Game::getBoard() const
+{
+	return this->board;
+}
+
+PieceColor Game::getTurn() const
+{
+	return this->turn;
+}
+
+bool Game::getIsCheckmate() const
+{
+	return this->isCheckmate;
+}
+
+bool Game::getIsDraw() const
+{
+	return this->isDraw;
+}
+
+const MoveHistory& Game::getHistory() const
+{
+	return this->history;
+}
+
+Position Game::getPosition() const
+{
+	Position position = Position::fromBoard(this->board, this->turn);
+	position.halfmoveClock = this->history.getHalfmoveClock();
+	return position;
 }
 
 /*
@@ -78,11 +143,13 @@ void Game::initVariables()
 
 	this->pickedPiece = nullptr;
 	this->possibleMoves = new std::vector<sf::Vector2i>;
+	this->losingCaptures = 0;
 	this->turn = PieceColor::WHITE;
 
 	this->isWhiteCheck = false;
 	this->isBlackCheck = false;
 	this->isCheckmate = false;
+	this->isDraw = false;
 }
 
 void Game::initWindow()
@@ -100,7 +167,8 @@ void Game::initUI()
 {
 	this->initTextures();
 
-	if (!font.loadFromFile("Fonts/Pixel NES.otf"))
+	// the font only parses its tables here, glyphs are rasterized when first drawn
+	if (!font.loadFromMemory(fontAsset.data, fontAsset.size))
 		std::cout << "Failed to load font\n";
 
 	boardView.setSize(tileSizef * 8.f + margin.x * 2, tileSizef * 8.f + margin.y * 2);
@@ -135,10 +203,36 @@ void Game::initUI()
 	this->tooltipText.setFont(this->font);
 	this->tooltipText.setCharacterSize(48);
 	this->tooltipText.setFillColor(sf::Color::White);
-	this->tooltipText.setString("[esc] to quit\t[r] to restart");
+	this->tooltipText.setString("[esc] to quit\t[r] to restart\n[z] to undo\t[c] computer");
 	this->tooltipText.setOrigin(this->tooltipText.getGlobalBounds().width / 2.f, 0.f);
 	this->tooltipText.setPosition(boardSize.x / 2.f, boardSize.y / 2.f + 40.f);
 
+	// profiler overlay
+	this->showProfiler = false;
+	this->profilerText.setFont(this->font);
+	this->profilerText.setCharacterSize(12);
+	this->profilerText.setFillColor(sf::Color::White);
+	this->profilerText.setPosition(5.f, 5.f);
+	this->profilerBackground.setFillColor(sf::Color(0, 0, 0, 200));
+
+	// opening explorer panel
+	this->showExplorer = false;
+	this->explorerText.setFont(this->font);
+	this->explorerText.setCharacterSize(12);
+	this->explorerText.setFillColor(sf::Color::White);
+	this->explorerBackground.setFillColor(sf::Color(0, 0, 0, 200));
+
+	// forced mate line above the board
+	this->mateText.setFont(this->font);
+	this->mateText.setCharacterSize(24);
+	this->mateText.setFillColor(sf::Color(255, 110, 110));
+
+	// analysis line below the board
+	this->analysisText.setFont(this->font);
+	this->analysisText.setCharacterSize(24);
+	this->analysisText.setFillColor(sf::Color::White);
+	this->analysisText.setPosition(0.f, boardSize.y + 10.f);
+
 	// cursor
 	cursor.setSize(sf::Vector2f(tileSizef, tileSizef));
 	cursor.setFillColor(sf::Color::Transparent);
@@ -167,9 +261,63 @@ void Game::initUI()
 
 void Game::initTextures()
 {
-	this->textures["pieces"] = new sf::Texture();
-	if (!this->textures["pieces"]->loadFromFile("Textures/pieces.png"))
-		std::cout << "Failed to load pieces texture";
+	// decoding the png is the slow part of startup, the window shows its first frame meanwhile
+	this->piecesImage = std::async(mode == GameMode::WINDOW ? std::launch::async : std::launch::deferred, [] {
+		PROFILE_SCOPE("decodePiecesTexture");
+		sf::Image image;
+		if (!image.loadFromMemory(piecesTextureAsset.data, piecesTextureAsset.size))
+			std::cout << "Failed to load pieces texture\n";
+		return image;
+	});
+
+	this->piecePlaceholder.setRadius(tileSizef * 0.3f);
+	this->piecePlaceholder.setOrigin(-tileSizef * 0.2f, -tileSizef * 0.2f);
+	this->piecePlaceholder.setOutlineThickness(-3.f);
+
+	// offscreen games are rendered right away, they wait for the texture
+	if (mode != GameMode::WINDOW)
+		this->updateTextures();
+}
+
+void Game::updateTextures()
+{
+	if (texturesLoaded || !piecesImage.valid()) return;
+	if (mode == GameMode::WINDOW && piecesImage.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return;
+
+	// the upload needs the GL context of this thread
+	PROFILE_SCOPE("uploadPiecesTexture");
+	piecesTexture.loadFromImage(piecesImage.get());
+	texturesLoaded = true;
+}
+
+Piece* Game::createPiece(PieceType type, PieceColor color)
+{
+	sf::Texture* texture = &piecesTexture;
+
+	switch (type)
+	{
+	case PieceType::KING:
+	{
+		King* king = new King(color, texture, tileSizef);
+
+		if (color == PieceColor::WHITE) whiteKing = king;
+		else blackKing = king;
+
+		return king;
+	}
+	case PieceType::QUEEN:
+		return new Queen(color, texture, tileSizef);
+	case PieceType::BISHOP:
+		return new Bishop(color, texture, tileSizef);
+	case PieceType::KNIGHT:
+		return new Knight(color, texture, tileSizef);
+	case PieceType::ROOK:
+		return new Rook(color, texture, tileSizef);
+	case PieceType::PAWN:
+		return new Pawn(color, texture, tileSizef);
+	}
+
+	return nullptr;
 }
 
 void Game::initBoard()
@@ -185,7 +333,6 @@ void Game::initBoard()
 		{ 5, 4, 3, 2, 1, 3, 4, 5},
 	};
 
-	int k = 0;
 	for (int i = 0; i < 8; ++i) {
 		for (int j = 0; j < 8; ++j) {
 			int n = boardTemplate[i][j];
@@ -195,38 +342,65 @@ void Game::initBoard()
 			}
 
 			PieceColor color = n < 0 ? PieceColor::BLACK : PieceColor::WHITE;
-			switch (abs(n))
-			{
-			case 1:
-			{
-				King* king = new King(color, textures["pieces"], tileSizef);
+			board[i][j] = createPiece(PieceType(abs(n) - 1), color);
+			board[i][j]->moveToTile(sf::Vector2i(j, i));
+		}
+	}
 
-				if (color == PieceColor::WHITE) whiteKing = king;
-				else blackKing = king;
+	hash = hashBoard(board, turn);
+	history.reset(hash);
+	startLegalMovesPrecompute();
+}
 
-				board[i][j] = king;
-				break;
-			}
-			case 2:
-				board[i][j] = new Queen(color, textures["pieces"], tileSizef);
-				break;
-			case 3:
-				board[i][j] = new Bishop(color, textures["pieces"], tileSizef);
-				break;
-			case 4:
-				board[i][j] = new Knight(color, textures["pieces"], tileSizef);
-				break;
-			case 5:
-				board[i][j] = new Rook(color, textures["pieces"], tileSizef);
-				break;
-			case 6:
-				board[i][j] = new Pawn(color, textures["pieces"], tileSizef);;
-				break;
-			}
+void Game::loadFen(const std::string& fen)
+{
+	// Only the piece placement and the side to move are used,
+	// castling, en passant and move counters are not part of the rules yet.
+	this->cleanup();
+	this->initVariables();
 
-			board[i][j]->moveToTile(sf::Vector2i(j, i));
+	for (auto& row : board)
+		row.fill(nullptr);
+
+	const std::string pieceChars = "kqbnrp";
+
+	std::size_t pos = 0;
+	int i = 0, j = 0;
+	for (; pos < fen.size() && fen[pos] != ' '; ++pos) {
+		char c = fen[pos];
+		if (c == '/') {
+			++i;
+			j = 0;
+		}
+		else if (c >= '1' && c <= '8')
+			j += c - '0';
+		else {
+			std::size_t type = pieceChars.find(char(std::tolower(c)));
+			if (type == std::string::npos || i > 7 || j > 7) continue;
+
+			PieceColor color = std::isupper(c) ? PieceColor::WHITE : PieceColor::BLACK;
+			Piece* piece = createPiece(PieceType(type), color);
+			piece->moveToTile(sf::Vector2i(j, i));
+
+			// a pawn off its starting row can no longer make a double step
+			if (piece->type == PieceType::PAWN && i != (color == PieceColor::WHITE ? 6 : 1))
+				static_cast<Pawn*>(piece)->setMoveState(true, false);
+
+			board[i][j] = piece;
+			++j;
 		}
 	}
+
+	if (pos + 1 < fen.size() && fen[pos + 1] == 'b')
+		turn = PieceColor::BLACK;
+	turnText.setString(turn == PieceColor::WHITE ? "Whites' turn" : "Blacks' turn");
+
+	hash = hashBoard(board, turn);
+	history.reset(hash);
+	startLegalMovesPrecompute();
+
+	updateIsCheck();
+	updateIsCheckmate();
 }
 
 /*
@@ -235,28 +409,92 @@ void Game::initBoard()
 
 void Game::pollEvents()
 {
+	input.keys.clear();
+	input.closed = false;
+
 	// Event Polling
 	while (this->window->pollEvent(this->ev))
 	{
 		switch (this->ev.type) {
 		case sf::Event::Closed:
-			this->window->close();
+			input.closed = true;
 			break;
 		case sf::Event::Resized:
 			boardView = getLetterboxView(boardView, ev.size.width, ev.size.height);
 			break;
 		case sf::Event::KeyPressed:
-			switch (this->ev.key.code) {
-			case sf::Keyboard::Escape:
-				this->window->close();
-				break;
-			case sf::Keyboard::R:
-				this->restart();
-				break;
-			}
+			// kept out of the frames, a replay must not start recording over its own file
+			if (this->ev.key.code == sf::Keyboard::F9)
+				this->toggleRecording();
+			else
+				input.keys.push_back(this->ev.key.code);
+			break;
 		}
 	}
 
+	input.mouseBoard = window->mapPixelToCoords(sf::Mouse::getPosition(*window), boardView);
+	input.mouseLeft = sf::Mouse::isButtonPressed(sf::Mouse::Left);
+
+	recorder.write(input);
+}
+
+void Game::handleKeys(const InputFrame& frame)
+{
+	if (frame.closed)
+		this->close();
+
+	for (sf::Keyboard::Key key : frame.keys) {
+		switch (key) {
+		case sf::Keyboard::Escape:
+			this->close();
+			break;
+		case sf::Keyboard::R:
+			this->restart();
+			break;
+		case sf::Keyboard::Z:
+		case sf::Keyboard::Left:
+			this->undoMove();
+			break;
+		case sf::Keyboard::Y:
+		case sf::Keyboard::Right:
+			this->redoMove();
+			break;
+		case sf::Keyboard::F3:
+			this->showProfiler = !this->showProfiler;
+			break;
+		case sf::Keyboard::E:
+			this->toggleExplorer();
+			break;
+		case sf::Keyboard::C:
+			this->toggleComputer();
+			break;
+		case sf::Keyboard::A:
+			this->toggleAnalysis();
+			break;
+		case sf::Keyboard::M:
+			this->toggleMate();
+			break;
+		}
+	}
+}
+
+void Game::close()
+{
+	recorder.close();
+	if (window) window->close();
+}
+
+void Game::toggleRecording()
+{
+	if (recorder.isOpen()) {
+		recorder.close();
+		return;
+	}
+
+	// the undo history starts over with the recording, a replay starts from the same FEN without it
+	loadFen(getPosition().toFen());
+	if (!recorder.open("input.rec", getPosition().toFen()))
+		std::cout << "Failed to open input.rec\n";
 }
 
 void Game::handleTurnChange() {
@@ -265,6 +503,58 @@ void Game::handleTurnChange() {
 		turnText.setString("Whites' turn");
 	else
 		turnText.setString("Blacks' turn");
+
+	startLegalMovesPrecompute();
+}
+
+static LegalMoveCache computeLegalMoves(Position position) {
+	LegalMoveCache cache;
+
+	MoveList list;
+	position.generateLegalMoves(list);
+	for (Move m : list)
+		cache.moves[m.from].push_back(tileOf(m.to));
+	cache.count = list.size;
+
+	return cache;
+}
+
+void Game::startLegalMovesPrecompute() {
+	// The worker gets a snapshot of the board, the live board is modified by isMoveInvalid on this thread.
+	// Without a window nobody waits for input, so the moves are only computed when first needed.
+	// The destructor of an async future waits for its thread, so an unfinished one is kept until it is done.
+	staleLegalMoves.erase(std::remove_if(staleLegalMoves.begin(), staleLegalMoves.end(), [](const std::future<LegalMoveCache>& f) {
+		return f.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	}), staleLegalMoves.end());
+	if (legalMovesFuture.valid() && legalMovesFuture.wait_for(std::chrono::seconds(0)) == std::future_status::timeout)
+		staleLegalMoves.push_back(std::move(legalMovesFuture));
+
+	legalMovesReady = false;
+	legalMovesFuture = std::async(
+		mode == GameMode::WINDOW ? std::launch::async : std::launch::deferred,
+		computeLegalMoves, Position::fromBoard(board, turn)
+	);
+}
+
+const LegalMoveCache& Game::getLegalMoves() {
+	if (!legalMovesReady) {
+		legalMoves = legalMovesFuture.get();
+		legalMovesReady = true;
+	}
+	return legalMoves;
+}
+
+bool Game::getCachedPossibleMoves(Piece* piece, std::vector<sf::Vector2i>* moves) {
+	if (piece == nullptr || piece->color != turn) return false;
+
+	// Don't wait for the worker, it's as quick to compute the moves of one piece here
+	if (!legalMovesReady) {
+		if (legalMovesFuture.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return false;
+		getLegalMoves();
+	}
+
+	*moves = legalMoves.moves[squareOf(piece->getTile())];
+	return true;
 }
 
 bool Game::isTileKing(sf::Vector2i tile) {
@@ -297,7 +587,8 @@ bool Game::isMoveInvalid(Piece* piece, sf::Vector2i move) {
 }
 
 void Game::getPiecePossibleMoves(Piece* piece, std::vector<sf::Vector2i>* moves) {
-	if (pickedPiece == nullptr) return;
+	PROFILE_SCOPE("getPiecePossibleMoves");
+	if (piece == nullptr) return;
 
 	moves->clear();
 
@@ -312,15 +603,44 @@ void Game::getPiecePossibleMoves(Piece* piece, std::vector<sf::Vector2i>* moves)
 	);
 }
 
+bool Game::playMove(sf::Vector2i from, sf::Vector2i to) {
+	if (isCheckmate || isDraw) return false;
+	if (from.x < 0 || from.x > 7 || from.y < 0 || from.y > 7) return false;
+
+	Piece* piece = board[from.y][from.x];
+	if (!piece || piece->color != turn) return false;
+
+	std::vector<sf::Vector2i> moves;
+	getPiecePossibleMoves(piece, &moves);
+	if (std::find(moves.begin(), moves.end(), to) == moves.end() || isTileKing(to)) return false;
+
+	pickedPiece = nullptr;
+	makeMove(piece, to);
+	return true;
+}
+
 void Game::setPossibleMoves() {
 	if (pickedPiece == nullptr) return;
 
-	getPiecePossibleMoves(pickedPiece, possibleMoves);
+	if (!getCachedPossibleMoves(pickedPiece, possibleMoves))
+		getPiecePossibleMoves(pickedPiece, possibleMoves);
+
+	losingCaptures = 0;
+	Position position = getPosition();
+	int from = squareOf(pickedPiece->getTile());
+	for (auto move : *possibleMoves) {
+		int to = squareOf(move);
+		if (position.squares[to] && position.see(Move{ std::int8_t(from), std::int8_t(to) }) < 0)
+			losingCaptures |= std::uint64_t(1) << to;
+	}
 }
 
-void Game::updateInput()
+void Game::updateInput(const InputFrame& frame)
 {
-	if (sf::Mouse::isButtonPressed(sf::Mouse::Left)) {
+	PROFILE_SCOPE("updateInput");
+	if (computer && turn == computer->getColor()) return;
+
+	if (frame.mouseLeft) {
 		if (!mousePressed) {
 			mousePressed = true;
 			Piece* newPiece = board[mousePosTile.y][mousePosTile.x];
@@ -337,12 +657,7 @@ void Game::updateInput()
 				for (auto move : *possibleMoves) {
 					if (isTileKing(move)) continue;
 					if (move == mousePosTile) {
-						board[pickedPiece->getTile().y][pickedPiece->getTile().x] = nullptr;
-						pickedPiece->moveToTile(move);
-						board[move.y][move.x] = pickedPiece;
-						handleTurnChange();
-						updateIsCheck();
-						updateIsCheckmate();
+						makeMove(pickedPiece, move);
 						break;
 					}
 				}
@@ -353,11 +668,191 @@ void Game::updateInput()
 	else mousePressed = false;
 }
 
-void Game::updateMousePos()
-{
-	mousePosWindow = sf::Mouse::getPosition(*window);
+void Game::makeMove(Piece* piece, sf::Vector2i move) {
+	MoveRecord record{};
+	record.piece = piece;
+	record.captured = board[move.y][move.x];
+	record.from = piece->getTile();
+	record.to = move;
+
+	bool isPawn = piece->type == PieceType::PAWN;
+	if (isPawn) {
+		record.pawnHasMoved = static_cast<Pawn*>(piece)->getHasMoved();
+		record.pawnInitialMove = static_cast<Pawn*>(piece)->getInitialMove();
+	}
+
+	// update the hash incrementally instead of rehashing the whole board
+	hash ^= zobristPieceKey(piece->color, piece->type, record.from);
+	hash ^= zobristPieceKey(piece->color, piece->type, record.to);
+	if (record.captured)
+		hash ^= zobristPieceKey(record.captured->color, record.captured->type, record.to);
+	hash ^= zobristTurnKey();
+
+	board[record.from.y][record.from.x] = nullptr;
+	piece->moveToTile(move);
+	board[move.y][move.x] = piece;
+	handleTurnChange();
+	updateIsCheck();
 
-	mousePosBoard = window->mapPixelToCoords(mousePosWindow, boardView);
+	record.hash = hash;
+	record.halfmoveClock = (isPawn || record.captured) ? 0 : history.getHalfmoveClock() + 1;
+	record.isWhiteCheck = isWhiteCheck;
+	record.isBlackCheck = isBlackCheck;
+	history.push(record);
+
+	if (computer && piece->color != computer->getColor())
+		computer->opponentMoved(Move{ std::int8_t(squareOf(record.from)), std::int8_t(squareOf(record.to)) });
+
+	updateIsCheckmate();
+	updateIsDraw();
+}
+
+void Game::undoMove() {
+	if (!history.canUndo()) return;
+	if (computer) computer->cancel();
+
+	const MoveRecord& record = history.undo();
+
+	board[record.to.y][record.to.x] = record.captured;
+	record.piece->moveToTile(record.from);
+	board[record.from.y][record.from.x] = record.piece;
+
+	if (record.piece->type == PieceType::PAWN) {
+		static_cast<Pawn*>(record.piece)->setMoveState(record.pawnHasMoved, record.pawnInitialMove);
+	}
+
+	handleTurnChange();
+
+	// the position before the move was neither won nor drawn, otherwise the move could not have been played
+	const MoveRecord* prev = history.last();
+	hash = history.getHash();
+	isWhiteCheck = prev ? prev->isWhiteCheck : false;
+	isBlackCheck = prev ? prev->isBlackCheck : false;
+	isCheckmate = false;
+	isDraw = false;
+	pickedPiece = nullptr;
+}
+
+void Game::redoMove() {
+	if (!history.canRedo()) return;
+	if (computer) computer->cancel();
+
+	const MoveRecord& record = history.redo();
+
+	board[record.from.y][record.from.x] = nullptr;
+	record.piece->moveToTile(record.to);
+	board[record.to.y][record.to.x] = record.piece;
+
+	handleTurnChange();
+
+	hash = record.hash;
+	isWhiteCheck = record.isWhiteCheck;
+	isBlackCheck = record.isBlackCheck;
+	pickedPiece = nullptr;
+
+	updateIsCheckmate();
+	updateIsDraw();
+}
+
+void Game::toggleComputer() {
+	if (computer) {
+		delete computer;
+		computer = nullptr;
+		return;
+	}
+
+	// the computer takes the side that is not to move, 5 minutes + 3 seconds
+	computer = new ComputerPlayer(oppositeColor(turn), 5 * 60 * 1000, 3000);
+}
+
+void Game::updateComputer() {
+	if (!computer || turn != computer->getColor()) return;
+
+	if (!computer->isThinking())
+		computer->startThinking(getPosition());
+
+	Move move;
+	if (!computer->poll(move)) return;
+
+	// no legal move, updateIsCheckmate has already ended the game
+	if (move.isNull()) return;
+
+	pickedPiece = nullptr;
+	makeMove(board[move.from / 8][move.from % 8], tileOf(move.to));
+}
+
+void Game::toggleAnalysis() {
+	if (analyzer) {
+		delete analyzer;
+		analyzer = nullptr;
+		return;
+	}
+
+	analyzer = new Analyzer();
+	analyzedHash = ~hash;
+	hasAnalysis = false;
+}
+
+void Game::updateAnalysis() {
+	if (!analyzer) return;
+
+	// retried every frame until the request fits in the queue
+	if (analyzedHash != hash && analyzer->analyze(getPosition())) {
+		analyzedHash = hash;
+		hasAnalysis = false;
+	}
+
+	AnalysisInfo info;
+	if (analyzer->poll(info) && info.hash == hash) {
+		analysis = info;
+		hasAnalysis = true;
+	}
+}
+
+void Game::toggleMate() {
+	if (mateSolver) {
+		cancelMate();
+		delete mateSolver;
+		mateSolver = nullptr;
+		return;
+	}
+
+	MateSolverOptions options;
+	options.threads = std::max(1, int(std::thread::hardware_concurrency()) - 1);
+	mateSolver = new MateSolver(options);
+	mateHash = ~hash;
+}
+
+void Game::updateMate() {
+	if (!mateSolver) return;
+
+	if (mateHash != hash) {
+		cancelMate();
+		mateHash = hash;
+		mate = MateResult();
+		if (isCheckmate || isDraw) return;
+
+		mateFuture = std::async(std::launch::async, [solver = mateSolver, position = getPosition()] {
+			return solver->solve(position, 5);
+		});
+	}
+
+	if (mateFuture.valid() && mateFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+		mate = mateFuture.get();
+}
+
+void Game::cancelMate() {
+	if (!mateFuture.valid()) return;
+
+	// keep signalling, a stop sent before the worker got to start solving would be lost
+	do mateSolver->stop();
+	while (mateFuture.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready);
+	mateFuture = std::future<MateResult>();
+}
+
+void Game::updateMousePos(const InputFrame& frame)
+{
+	mousePosBoard = frame.mouseBoard;
 	if (mousePosBoard.x < 0) mousePosBoard.x = 0;
 	if (mousePosBoard.y < 0) mousePosBoard.y = 0;
 	if (mousePosBoard.x > boardSize.x) mousePosBoard.x = boardSize.x - tileSizef;
@@ -369,6 +864,7 @@ void Game::updateMousePos()
 }
 
 void Game::updateIsCheck() {
+	PROFILE_SCOPE("updateIsCheck");
 	isWhiteCheck = false;
 	isBlackCheck = false;
 
@@ -391,98 +887,298 @@ void Game::updateIsCheck() {
 }
 
 void Game::updateIsCheckmate() {
-	if (!isWhiteCheck && !isBlackCheck) return;
+	PROFILE_SCOPE("updateIsCheckmate");
+	Position position = getPosition();
+	GameState state = position.classify();
+	if (state == GameState::ONGOING) return;
 
-	if (isWhiteCheck && !anyPossibleMoves(PieceColor::WHITE)) {
+	if (state == GameState::CHECKMATE) {
 		isCheckmate = true;
-		this->winnerText.setString("blacks win");
+		this->winnerText.setString(turn == PieceColor::WHITE ? "blacks win" : "whites win");
+		this->checkmateText.setString("CHECKMATE!");
 	}
-	else if (isBlackCheck && !anyPossibleMoves(PieceColor::BLACK)) {
-		isCheckmate = true;
-		this->winnerText.setString("whites win");
+	else {
+		isDraw = true;
+		this->winnerText.setString(state == GameState::STALEMATE ? "stalemate" : "insufficient material");
+		this->checkmateText.setString("DRAW!");
 	}
-}
 
-bool Game::anyPossibleMoves(PieceColor color) {
+	this->checkmateText.setOrigin(this->checkmateText.getGlobalBounds().width / 2.f, this->checkmateText.getGlobalBounds().height);
+	this->winnerText.setOrigin(this->winnerText.getGlobalBounds().width / 2.f, this->winnerText.getGlobalBounds().height);
+}
 
-	std::vector<sf::Vector2i>* moves = new std::vector<sf::Vector2i>;
-	for (auto row : board) {
-		for (auto p : row) {
-			if (!p || p->color != color) continue;
+void Game::updateIsDraw() {
+	if (isCheckmate || isDraw) return;
 
-			getPiecePossibleMoves(p, moves);
-			if (!!moves->size()) 
-				return true;
-		}
-	}
+	if (history.isThreefoldRepetition())
+		this->winnerText.setString("threefold repetition");
+	else if (history.isFiftyMoveRule())
+		this->winnerText.setString("50-move rule");
+	else
+		return;
 
-	delete moves;
+	isDraw = true;
+	this->checkmateText.setString("DRAW!");
+	this->checkmateText.setOrigin(this->checkmateText.getGlobalBounds().width / 2.f, this->checkmateText.getGlobalBounds().height);
+	this->winnerText.setOrigin(this->winnerText.getGlobalBounds().width / 2.f, this->winnerText.getGlobalBounds().height);
+}
 
-	return false;
+bool Game::anyPossibleMoves(PieceColor color) {
+	// stops at the first legal move instead of filtering every piece's moves
+	Position position = Position::fromBoard(board, color);
+	return position.hasLegalMove();
 }
 
 void Game::update()
 {
 	this->pollEvents();
-	if (isCheckmate) return;
+	this->update(this->input);
+}
 
-	this->updateMousePos();
-	this->updateInput();
+void Game::update(const InputFrame& frame)
+{
+	PROFILE_SCOPE("update");
+	this->updateTextures();
+	this->handleKeys(frame);
+	this->updateAnalysis();
+	this->updateMate();
+	if (isCheckmate || isDraw) return;
+
+	this->updateMousePos(frame);
+	this->updateComputer();
+	this->updateInput(frame);
 }
 
 /// RENDER
 
 void Game::render()
 {
+	this->render(*window);
+
+	window->display();
+}
+
+void Game::render(sf::RenderTarget& target)
+{
+	PROFILE_SCOPE("render");
 	//window->clear(sf::Color(25, 25, 25, 1)); // Clear previous frame
-	window->clear(sf::Color::Black); // Clear previous frame
+	target.clear(sf::Color::Black); // Clear previous frame
 
-	window->setView(boardView);
+	target.setView(boardView);
 
 	// Draw tiles
 	for (int i = 0; i < 8; i++) {
 		for (int j = 0; j < 8; j++) {
-			window->draw(*tiles[i][j]);
+			target.draw(*tiles[i][j]);
 		}
 	}
 
-	renderPossibleMoves();
+	renderPossibleMoves(target);
 
-	renderChecks();
+	renderChecks(target);
 
 	if (pickedPiece != nullptr) {
-		window->draw(pickedPieceCursor);
+		target.draw(pickedPieceCursor);
 	}
 
 	// render pieces
 	for (int i = 0; i < 8; ++i) {
 		for (int j = 0; j < 8; j++) {
 			if (board[i][j] == nullptr) continue;
-			window->draw(*board[i][j]);
+			if (texturesLoaded) {
+				target.draw(*board[i][j]);
+				continue;
+			}
+
+			bool white = board[i][j]->color == PieceColor::WHITE;
+			piecePlaceholder.setFillColor(white ? sf::Color(240, 240, 240) : sf::Color(20, 20, 20));
+			piecePlaceholder.setOutlineColor(white ? sf::Color(20, 20, 20) : sf::Color(240, 240, 240));
+			piecePlaceholder.setPosition(tileSizef * j, tileSizef * i);
+			target.draw(piecePlaceholder);
 		}
 	}
 
-	window->draw(cursor);
+	if (analyzer && hasAnalysis)
+		renderAnalysis(target);
+
+	if (mateSolver)
+		renderMate(target);
+
+	target.draw(cursor);
 
 	// window->setView(window->getDefaultView());
 
-	renderText();
+	renderText(target);
 
-	window->display();
+	if (showExplorer)
+		renderExplorer(target);
+
+	if (showProfiler)
+		renderProfiler(target);
 }
 
-void Game::renderText() {
-	window->draw(turnText);
+void Game::renderText(sf::RenderTarget& target) {
+	target.draw(turnText);
 
-	if (isCheckmate) {
-		window->draw(overlay);
-		window->draw(checkmateText);
-		window->draw(winnerText);
-		window->draw(tooltipText);
+	if (isCheckmate || isDraw) {
+		target.draw(overlay);
+		target.draw(checkmateText);
+		target.draw(winnerText);
+		target.draw(tooltipText);
 	}
 }
 
-void Game::renderPossibleMoves() {
+void Game::renderProfiler(sf::RenderTarget& target) {
+#if CHESS_PROFILE
+	profilerText.setString(Profiler::get().summary());
+
+	// drawn in window pixels, so it stays readable whatever the board scale is
+	target.setView(target.getDefaultView());
+
+	sf::FloatRect bounds = profilerText.getGlobalBounds();
+	profilerBackground.setSize(sf::Vector2f(bounds.left + bounds.width + 10.f, bounds.top + bounds.height + 10.f));
+	target.draw(profilerBackground);
+	target.draw(profilerText);
+
+	target.setView(boardView);
+#endif
+}
+
+void Game::toggleExplorer() {
+	showExplorer = !showExplorer;
+	if (showExplorer && !explorer.isOpen())
+		explorer.open("explorer.idx");
+	explorerHash = ~hash;
+}
+
+void Game::renderExplorer(sf::RenderTarget& target) {
+	// queries are cheap, but the text only changes with the position
+	if (explorerHash != hash) {
+		explorerHash = hash;
+
+		std::string text = "OPENING EXPLORER\n";
+		std::vector<ExplorerMove> moves = explorer.query(hash);
+		if (!explorer.isOpen())
+			text += "no explorer.idx, build it with\nTools/ExplorerBuilder";
+		else if (moves.empty())
+			text += "no games from this position";
+		else {
+			text += "move    games   white  draw  black";
+			char line[64];
+			for (std::size_t i = 0; i < moves.size() && i < 12; ++i) {
+				const ExplorerMove& m = moves[i];
+				double games = m.getGames();
+				std::snprintf(line, sizeof(line), "\n%s  %7u   %3.0f%%  %3.0f%%  %3.0f%%", m.move.toString().c_str(), m.getGames(),
+					100.0 * m.whiteWins / games, 100.0 * m.draws / games, 100.0 * m.blackWins / games);
+				text += line;
+			}
+		}
+		explorerText.setString(text);
+	}
+
+	// drawn in window pixels in the top right corner, like the profiler overlay
+	target.setView(target.getDefaultView());
+
+	sf::FloatRect bounds = explorerText.getLocalBounds();
+	float x = target.getSize().x - bounds.width - 15.f;
+	explorerText.setPosition(x + 5.f, 5.f);
+	explorerBackground.setPosition(x, 0.f);
+	explorerBackground.setSize(sf::Vector2f(bounds.width + 15.f, bounds.top + bounds.height + 15.f));
+	target.draw(explorerBackground);
+	target.draw(explorerText);
+
+	target.setView(boardView);
+}
+
+static std::string formatScore(int score) {
+	char buffer[32];
+	if (isMateScore(score)) {
+		int moves = (MATE_SCORE - std::abs(score) + 1) / 2;
+		std::snprintf(buffer, sizeof(buffer), "%s#%d", score > 0 ? "" : "-", moves);
+	}
+	else
+		std::snprintf(buffer, sizeof(buffer), "%+.2f", score / 100.f);
+	return buffer;
+}
+
+void Game::renderAnalysis(sf::RenderTarget& target) {
+	// scores are from the side to move, the bar and the text show them for whites
+	int score = turn == PieceColor::WHITE ? analysis.score : -analysis.score;
+
+	// eval bar in the left margin, the white part grows from the bottom
+	float whiteShare = isMateScore(score) ? (score > 0 ? 1.f : 0.f) : 1.f / (1.f + std::pow(10.f, -score / 400.f));
+	sf::RectangleShape bar(sf::Vector2f(margin.x * 0.6f, boardSize.y));
+	bar.setPosition(-margin.x * 0.8f, 0.f);
+	bar.setFillColor(sf::Color(40, 40, 40));
+	target.draw(bar);
+	bar.setSize(sf::Vector2f(margin.x * 0.6f, boardSize.y * whiteShare));
+	bar.setPosition(-margin.x * 0.8f, boardSize.y * (1.f - whiteShare));
+	bar.setFillColor(sf::Color(230, 230, 230));
+	target.draw(bar);
+
+	// best move arrow
+	if (analysis.pvLength > 0) {
+		Move best = analysis.pv[0];
+		sf::Vector2f from((best.from % 8 + 0.5f) * tileSizef, (best.from / 8 + 0.5f) * tileSizef);
+		sf::Vector2f to((best.to % 8 + 0.5f) * tileSizef, (best.to / 8 + 0.5f) * tileSizef);
+		sf::Vector2f d = to - from;
+		float length = std::sqrt(d.x * d.x + d.y * d.y);
+		float angle = std::atan2(d.y, d.x) * 180.f / 3.14159265f;
+		float head = tileSizef * 0.3f;
+		sf::Color color(255, 170, 0, 180);
+
+		sf::RectangleShape shaft(sf::Vector2f(length - head, tileSizef * 0.12f));
+		shaft.setOrigin(0.f, tileSizef * 0.06f);
+		shaft.setPosition(from);
+		shaft.setRotation(angle);
+		shaft.setFillColor(color);
+		target.draw(shaft);
+
+		sf::ConvexShape tip(3);
+		tip.setPoint(0, sf::Vector2f(0.f, -head * 0.6f));
+		tip.setPoint(1, sf::Vector2f(head, 0.f));
+		tip.setPoint(2, sf::Vector2f(0.f, head * 0.6f));
+		tip.setOrigin(head, 0.f);
+		tip.setPosition(to);
+		tip.setRotation(angle);
+		tip.setFillColor(color);
+		target.draw(tip);
+	}
+
+	std::string line = "depth " + std::to_string(analysis.depth) + "  " + formatScore(score) + " ";
+	for (int i = 0; i < analysis.pvLength && i < 8; ++i)
+		line += " " + analysis.pv[i].toString();
+	analysisText.setString(line);
+	target.draw(analysisText);
+}
+
+void Game::renderMate(sf::RenderTarget& target) {
+	std::string line;
+	if (mateFuture.valid())
+		line = "looking for mate...";
+	else if (mate.status == MateResult::MATE && !mate.pv.empty()) {
+		// the start of the line, the rest would run into the turn text
+		line = "mate in " + std::to_string(mate.moves);
+		for (std::size_t i = 0; i < mate.pv.size() && i < 5; ++i)
+			line += " " + mate.pv[i].toString();
+
+		// tiles of the first mating move
+		sf::RectangleShape tile(sf::Vector2f(tileSizef, tileSizef));
+		tile.setFillColor(sf::Color(220, 40, 40, 110));
+		for (int square : { int(mate.pv[0].from), int(mate.pv[0].to) }) {
+			tile.setPosition((square % 8) * tileSizef, (square / 8) * tileSizef);
+			target.draw(tile);
+		}
+	}
+	else if (mate.status == MateResult::NO_MATE)
+		line = "no mate in 5";
+
+	mateText.setString(line);
+	mateText.setPosition(0.f, -margin.y / 2.f - mateText.getLocalBounds().height / 2.f - mateText.getLocalBounds().top);
+	target.draw(mateText);
+}
+
+void Game::renderPossibleMoves(sf::RenderTarget& target) {
 	if (pickedPiece == nullptr) return;
 
 	for (auto move : *possibleMoves) {
@@ -491,26 +1187,28 @@ void Game::renderPossibleMoves() {
 		tile.setFillColor(
 			isTileKing(move)
 			? sf::Color(230, 100, 103, 200) 
+			: (losingCaptures >> squareOf(move)) & 1
+			? sf::Color(230, 170, 60, 150)
 			: sf::Color(103, 232, 230, 100)
 		);
 		tile.setPosition(sf::Vector2f(tileSizef * move.x, tileSizef * move.y));
-		window->draw(tile);
+		target.draw(tile);
 	}
 }
 
-void Game::renderChecks() {
+void Game::renderChecks(sf::RenderTarget& target) {
 	sf::RectangleShape tile = sf::RectangleShape();
 	tile.setSize(sf::Vector2f(tileSizef, tileSizef));
 	tile.setFillColor(sf::Color(230, 100, 103, 200));
 
 	if (!!whiteKing && isWhiteCheck) {
 		tile.setPosition(whiteKing->getPosition());
-		window->draw(tile);
+		target.draw(tile);
 	}
 	
 	if (!!blackKing && isBlackCheck) {
 		tile.setPosition(blackKing->getPosition());
-		window->draw(tile);
+		target.draw(tile);
 	}
 }
 
@@ -9,8 +9,34 @@
 #include <array>
 #include <iostream>
 #include <algorithm>
+#include <future>
 
 #include "Pieces.h"
+#include "History.h"
+#include "Profiler.h"
+#include "Engine.h"
+#include "ComputerPlayer.h"
+#include "Analysis.h"
+#include "Assets.h"
+#include "Explorer.h"
+#include "MateSolver.h"
+#include "Input.h"
+
+enum class GameMode {
+	WINDOW = 0,	// interactive game in its own window
+	OFFSCREEN,	// no window, assets are loaded so it can be rendered into any target
+	RULES		// no window and no assets, only the game logic
+};
+
+/*
+	Legal moves of every piece of the side to move, indexed by the square of the piece.
+*/
+
+struct LegalMoveCache
+{
+	std::array<std::vector<sf::Vector2i>, 64> moves;
+	int count = 0;
+};
 
 /*
 	Class that acts as a game engine.
@@ -19,6 +45,7 @@
 class Game
 {
 private:
+	GameMode mode;
 	sf::RenderWindow* window;
 	sf::VideoMode videoMode;
 	sf::Event ev;
@@ -28,14 +55,26 @@ private:
 
 	// Game logic
 	void initBoard();
+	Piece* createPiece(PieceType type, PieceColor color);
 	std::array<std::array<Piece*, 8>, 8> board;
 
 	Piece* pickedPiece;
 	std::vector<sf::Vector2i>* possibleMoves;
 	void setPossibleMoves();
+	std::uint64_t losingCaptures;	// bits of the possible moves that lose material in the exchange
 
 	PieceColor turn;
 	void handleTurnChange();
+
+	// Legal moves of the side to move, computed on a worker thread as soon as the turn changes.
+	// Only the move highlighting uses them, checkmate and stalemate come from Position::classify.
+	std::future<LegalMoveCache> legalMovesFuture;
+	std::vector<std::future<LegalMoveCache>> staleLegalMoves;	// outdated but still running, dropping them would wait
+	LegalMoveCache legalMoves;
+	bool legalMovesReady;
+	void startLegalMovesPrecompute();
+	const LegalMoveCache& getLegalMoves();
+	bool getCachedPossibleMoves(Piece* piece, std::vector<sf::Vector2i>* moves);
 	bool isTileKing(sf::Vector2i tile);
 
 	King* whiteKing;
@@ -49,13 +88,54 @@ private:
 	bool anyPossibleMoves(PieceColor color);
 	void getPiecePossibleMoves(Piece* piece, std::vector<sf::Vector2i>* moves);
 
-	void renderChecks();
+	void renderChecks(sf::RenderTarget& target);
 	bool isMoveInvalid(Piece* piece, sf::Vector2i move);
 
+	// Move history
+	MoveHistory history;
+	std::uint64_t hash;
+	void makeMove(Piece* piece, sf::Vector2i move);
+	void undoMove();
+	void redoMove();
+
+	bool isDraw;
+	void updateIsDraw();
+
+	// Computer opponent, toggled with C
+	ComputerPlayer* computer;
+	void toggleComputer();
+	void updateComputer();
+
+	// Live engine analysis, toggled with A
+	Analyzer* analyzer;
+	std::uint64_t analyzedHash;
+	AnalysisInfo analysis;
+	bool hasAnalysis;
+	sf::Text analysisText;
+	void toggleAnalysis();
+	void updateAnalysis();
+	void renderAnalysis(sf::RenderTarget& target);
+
+	// Forced mate hint, toggled with M, the solver restarts on a worker thread whenever the position changes
+	MateSolver* mateSolver;
+	std::future<MateResult> mateFuture;
+	std::uint64_t mateHash;	// position the solver was started on
+	MateResult mate;
+	sf::Text mateText;
+	void toggleMate();
+	void updateMate();
+	void cancelMate();
+	void renderMate(sf::RenderTarget& target);
+
 	// UI
 	void initUI();
-	std::map<std::string, sf::Texture*> textures;
+	// The pieces image is decoded on a loader thread, until it arrives pieces are drawn as placeholders
+	sf::Texture piecesTexture;
+	std::future<sf::Image> piecesImage;
+	bool texturesLoaded;
+	sf::CircleShape piecePlaceholder;
 	void initTextures();
+	void updateTextures();
 
 	sf::Font font;
 	sf::Text turnText;
@@ -63,7 +143,22 @@ private:
 	sf::Text winnerText;
 	sf::Text tooltipText;
 	sf::RectangleShape overlay;
-	void renderText();
+	void renderText(sf::RenderTarget& target);
+
+	// Profiler overlay, toggled with F3
+	bool showProfiler;
+	sf::Text profilerText;
+	sf::RectangleShape profilerBackground;
+	void renderProfiler(sf::RenderTarget& target);
+
+	// Opening explorer panel, toggled with E, the index is mapped on first use
+	OpeningExplorer explorer;
+	bool showExplorer;
+	std::uint64_t explorerHash;	// position the panel text was built for
+	sf::Text explorerText;
+	sf::RectangleShape explorerBackground;
+	void toggleExplorer();
+	void renderExplorer(sf::RenderTarget& target);
 
 	sf::View boardView;
 	int tileSize;
@@ -73,31 +168,54 @@ private:
 	sf::Vector2f margin;
 	sf::RectangleShape pickedPieceCursor;
 
+	// Input, read from the window by pollEvents or handed to update by a replay
+	InputFrame input;
+	void handleKeys(const InputFrame& frame);
+	void close();
+
+	// Recording of the input into input.rec, toggled with F9
+	InputRecorder recorder;
+	void toggleRecording();
+
 	// Mouse
-	sf::Vector2i mousePosWindow;
 	sf::Vector2f mousePosBoard;
 	sf::Vector2i mousePosTile;
 	sf::RectangleShape cursor;
-	void updateMousePos();
-	void updateInput();
+	void updateMousePos(const InputFrame& frame);
+	void updateInput(const InputFrame& frame);
 	bool mousePressed;
 
-	void renderPossibleMoves();
+	void renderPossibleMoves(sf::RenderTarget& target);
 
 	void cleanup();
+
+	friend class GameBenchmark;
 public:
 	Game();
+	// Without a window the game can only be driven (and rendered) programmatically
+	explicit Game(GameMode mode);
 	~Game();
 
 	// Getters
 	const bool getWindowIsOpen() const;
+	const std::array<std::array<Piece*, 8>, 8>& getBoard() const;
+	PieceColor getTurn() const;
+	bool getIsCheckmate() const;
+	bool getIsDraw() const;
+	const MoveHistory& getHistory() const;
+	Position getPosition() const;
 
 	// Methods
 	void run();
 	void restart();
+	void loadFen(const std::string& fen);
+	bool playMove(sf::Vector2i from, sf::Vector2i to);
 	void pollEvents();
 	void update();
+	// Runs a frame on the given input instead of the window's, it works without a window
+	void update(const InputFrame& frame);
 	void render();
+	void render(sf::RenderTarget& target);
 };
 
 // utils
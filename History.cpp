@@ -0,0 +1,135 @@
+#include "History.h"
+
+#include <algorithm>
+#include <array>
+
+/*
+	ZOBRIST
+*/
+
+static std::uint64_t splitmix64(std::uint64_t& state) {
+	std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+// 2 colors * 6 types * 64 tiles, followed by the turn key
+static std::array<std::uint64_t, 2 * 6 * 64 + 1> initZobristKeys() {
+	std::array<std::uint64_t, 2 * 6 * 64 + 1> keys{};
+
+	// fixed seed, so hashes are the same across runs
+	std::uint64_t state = 0x43686573735A6F62ull;
+	for (auto& key : keys)
+		key = splitmix64(state);
+
+	return keys;
+}
+
+static const std::array<std::uint64_t, 2 * 6 * 64 + 1> zobristKeys = initZobristKeys();
+
+std::uint64_t zobristPieceKey(PieceColor color, PieceType type, sf::Vector2i tile) {
+	return zobristKeys[(color * 6 + type) * 64 + tile.y * 8 + tile.x];
+}
+
+std::uint64_t zobristTurnKey() {
+	return zobristKeys[2 * 6 * 64];
+}
+
+std::uint64_t hashBoard(std::array<std::array<Piece*, 8>, 8>& board, PieceColor turn) {
+	std::uint64_t hash = turn == PieceColor::BLACK ? zobristTurnKey() : 0;
+
+	for (int i = 0; i < 8; ++i) {
+		for (int j = 0; j < 8; ++j) {
+			Piece* p = board[i][j];
+			if (!p) continue;
+
+			hash ^= zobristPieceKey(p->color, p->type, sf::Vector2i(j, i));
+		}
+	}
+
+	return hash;
+}
+
+/*
+	MOVE HISTORY
+*/
+
+MoveHistory::MoveHistory() : current{ 0 }, rootHash{ 0 } {}
+
+void MoveHistory::reset(std::uint64_t hash) {
+	records.clear();
+	current = 0;
+	rootHash = hash;
+}
+
+void MoveHistory::push(const MoveRecord& record) {
+	// playing a new move drops the moves that could be redone,
+	// their captured pieces are back on the board so nothing is leaked
+	records.resize(current);
+	records.push_back(record);
+	++current;
+}
+
+bool MoveHistory::canUndo() const {
+	return current > 0;
+}
+
+bool MoveHistory::canRedo() const {
+	return current < records.size();
+}
+
+const MoveRecord& MoveHistory::undo() {
+	return records[--current];
+}
+
+const MoveRecord& MoveHistory::redo() {
+	return records[current++];
+}
+
+const MoveRecord* MoveHistory::last() const {
+	return current > 0 ? &records[current - 1] : nullptr;
+}
+
+std::uint64_t MoveHistory::getHash() const {
+	return current > 0 ? records[current - 1].hash : rootHash;
+}
+
+int MoveHistory::getHalfmoveClock() const {
+	return current > 0 ? records[current - 1].halfmoveClock : 0;
+}
+
+std::size_t MoveHistory::getPly() const {
+	return current;
+}
+
+int MoveHistory::repetitionCount() const {
+	// A position can only repeat since the last pawn move or capture,
+	// and only with the same side to move, so only every second hash since then is compared.
+	std::uint64_t hash = getHash();
+	int count = 1;
+
+	std::size_t limit = std::min<std::size_t>(getHalfmoveClock(), current);
+	for (std::size_t back = 2; back <= limit; back += 2) {
+		std::size_t ply = current - back;
+		std::uint64_t h = ply > 0 ? records[ply - 1].hash : rootHash;
+		if (h == hash) ++count;
+	}
+
+	return count;
+}
+
+bool MoveHistory::isThreefoldRepetition() const {
+	return repetitionCount() >= 3;
+}
+
+bool MoveHistory::isFiftyMoveRule() const {
+	return getHalfmoveClock() >= 100;
+}
+
+void MoveHistory::deleteCapturedPieces() {
+	for (std::size_t i = 0; i < current; ++i) {
+		delete records[i].captured;
+		records[i].captured = nullptr;
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Pieces.h"
+
+/*
+	Zobrist hashing of positions.
+	The hash of a position is the xor of one key per (color, type, tile) of every piece on the board,
+	plus the turn key when it is blacks' turn, so it can be updated incrementally when a move is made.
+*/
+
+std::uint64_t zobristPieceKey(PieceColor color, PieceType type, sf::Vector2i tile);
+std::uint64_t zobristTurnKey();
+std::uint64_t hashBoard(std::array<std::array<Piece*, 8>, 8>& board, PieceColor turn);
+
+/*
+	Everything needed to take back a single move (ply) in O(1).
+*/
+
+struct MoveRecord
+{
+	Piece* piece;
+	Piece* captured;
+	sf::Vector2i from;
+	sf::Vector2i to;
+
+	// pawn state of the moved piece before the move
+	bool pawnHasMoved;
+	bool pawnInitialMove;
+
+	// state of the position after the move
+	std::uint64_t hash;
+	int halfmoveClock;
+	bool isWhiteCheck;
+	bool isBlackCheck;
+};
+
+class MoveHistory
+{
+private:
+	std::vector<MoveRecord> records;
+	std::size_t current;
+
+	std::uint64_t rootHash;
+public:
+	MoveHistory();
+
+	void reset(std::uint64_t hash);
+	void push(const MoveRecord& record);
+
+	bool canUndo() const;
+	bool canRedo() const;
+	const MoveRecord& undo();
+	const MoveRecord& redo();
+
+	// State of the position reached by the moves played so far
+	const MoveRecord* last() const;
+	std::uint64_t getHash() const;
+	int getHalfmoveClock() const;
+	std::size_t getPly() const;
+
+	int repetitionCount() const;
+	bool isThreefoldRepetition() const;
+	bool isFiftyMoveRule() const;
+
+	// Pieces captured by the moves played so far, the history owns them until they are put back on the board
+	void deleteCapturedPieces();
+};
@@ -0,0 +1,53 @@
+#include "Input.h"
+
+#include <iomanip>
+#include <sstream>
+
+static const char* RECORDING_VERSION = "chess-input 1";
+
+bool InputRecorder::open(const std::string& path, const std::string& fen) {
+	close();
+
+	file.open(path, std::ios::trunc);
+	if (!file) return false;
+
+	// enough digits for the coordinates to read back exactly
+	file << std::setprecision(9);
+	file << RECORDING_VERSION << "\n" << fen << "\n";
+	start = std::chrono::steady_clock::now();
+	return true;
+}
+
+void InputRecorder::write(InputFrame& frame) {
+	if (!file.is_open()) return;
+
+	frame.timeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	file << frame.timeUs << " " << frame.mouseBoard.x << " " << frame.mouseBoard.y << " " << frame.mouseLeft << " " << frame.closed;
+	for (sf::Keyboard::Key key : frame.keys)
+		file << " " << int(key);
+	file << "\n";
+}
+
+void InputRecorder::close() {
+	if (file.is_open()) file.close();
+}
+
+bool InputRecording::load(const std::string& path) {
+	fen.clear();
+	frames.clear();
+
+	std::ifstream file(path);
+	std::string line;
+	if (!std::getline(file, line) || line != RECORDING_VERSION || !std::getline(file, fen)) return false;
+
+	while (std::getline(file, line)) {
+		std::istringstream stream(line);
+		InputFrame frame;
+		// a recording cut short by a crash ends in a partial line
+		if (!(stream >> frame.timeUs >> frame.mouseBoard.x >> frame.mouseBoard.y >> frame.mouseLeft >> frame.closed)) break;
+		for (int key; stream >> key;)
+			frame.keys.push_back(sf::Keyboard::Key(key));
+		frames.push_back(frame);
+	}
+	return true;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Window.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/*
+	Everything Game::update reads from the user in one frame.
+	The mouse is kept in board coordinates, so a frame means the same whatever the size of the window it came from.
+*/
+
+struct InputFrame
+{
+	std::int64_t timeUs = 0;	// since the start of the recording
+	sf::Vector2f mouseBoard;
+	bool mouseLeft = false;
+	bool closed = false;		// the window was closed
+	std::vector<sf::Keyboard::Key> keys;	// pressed since the previous frame
+};
+
+/*
+	Recordings are text files: a version line, the FEN the recording starts from, then one line per frame
+		<timeUs> <mouse x> <mouse y> <mouse left> <closed> [<key code>...]
+	Replayed from the same position the frames take the game through the same states, except for the moves of the
+	computer opponent, which depend on how long it got to think.
+*/
+
+class InputRecorder
+{
+private:
+	std::ofstream file;
+	std::chrono::steady_clock::time_point start;
+public:
+	bool open(const std::string& path, const std::string& fen);
+	// Stamps the frame with the time since open
+	void write(InputFrame& frame);
+	void close();
+
+	// Getters
+	bool isOpen() const { return file.is_open(); }
+};
+
+class InputRecording
+{
+private:
+	std::string fen;
+	std::vector<InputFrame> frames;
+public:
+	bool load(const std::string& path);
+
+	// Getters
+	const std::string& getFen() const { return fen; }
+	const std::vector<InputFrame>& getFrames() const { return frames; }
+};
@@ -0,0 +1,167 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile() : data{ nullptr }, size{ 0 }, writable{ false }, file{ nullptr }, mapping{ nullptr } {}
+
+bool MappedFile::open(const std::string& path) {
+	close();
+
+	HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (handle == INVALID_HANDLE_VALUE) return false;
+	file = handle;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(handle, &fileSize) || fileSize.QuadPart == 0) {
+		close();
+		return false;
+	}
+
+	mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mapping) {
+		close();
+		return false;
+	}
+
+	data = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	if (!data) {
+		close();
+		return false;
+	}
+	size = std::size_t(fileSize.QuadPart);
+	return true;
+}
+
+bool MappedFile::openWritable(const std::string& path, std::size_t newSize) {
+	close();
+
+	HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (handle == INVALID_HANDLE_VALUE) return false;
+	file = handle;
+
+	LARGE_INTEGER fileSize;
+	if (newSize) {
+		fileSize.QuadPart = LONGLONG(newSize);
+		if (!SetFilePointerEx(handle, fileSize, nullptr, FILE_BEGIN) || !SetEndOfFile(handle)) {
+			close();
+			return false;
+		}
+	}
+	if (!GetFileSizeEx(handle, &fileSize) || fileSize.QuadPart == 0) {
+		close();
+		return false;
+	}
+
+	mapping = CreateFileMappingA(handle, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+	if (!mapping) {
+		close();
+		return false;
+	}
+
+	data = static_cast<char*>(MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0));
+	if (!data) {
+		close();
+		return false;
+	}
+	size = std::size_t(fileSize.QuadPart);
+	writable = true;
+	return true;
+}
+
+bool MappedFile::flush() {
+	if (!data || !writable) return false;
+	return FlushViewOfFile(data, 0) && FlushFileBuffers(file);
+}
+
+void MappedFile::close() {
+	if (data) UnmapViewOfFile(data);
+	if (mapping) CloseHandle(mapping);
+	if (file) CloseHandle(file);
+	data = nullptr;
+	size = 0;
+	writable = false;
+	mapping = nullptr;
+	file = nullptr;
+}
+
+#else
+
+MappedFile::MappedFile() : data{ nullptr }, size{ 0 }, writable{ false }, descriptor{ -1 } {}
+
+bool MappedFile::open(const std::string& path) {
+	close();
+
+	descriptor = ::open(path.c_str(), O_RDONLY);
+	if (descriptor < 0) return false;
+
+	struct stat status;
+	if (fstat(descriptor, &status) != 0 || status.st_size == 0) {
+		close();
+		return false;
+	}
+
+	void* address = mmap(nullptr, std::size_t(status.st_size), PROT_READ, MAP_SHARED, descriptor, 0);
+	if (address == MAP_FAILED) {
+		close();
+		return false;
+	}
+
+	data = static_cast<char*>(address);
+	size = std::size_t(status.st_size);
+	return true;
+}
+
+bool MappedFile::openWritable(const std::string& path, std::size_t newSize) {
+	close();
+
+	descriptor = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+	if (descriptor < 0) return false;
+
+	struct stat status;
+	if ((newSize && ftruncate(descriptor, off_t(newSize)) != 0) || fstat(descriptor, &status) != 0 || status.st_size == 0) {
+		close();
+		return false;
+	}
+
+	void* address = mmap(nullptr, std::size_t(status.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+	if (address == MAP_FAILED) {
+		close();
+		return false;
+	}
+
+	data = static_cast<char*>(address);
+	size = std::size_t(status.st_size);
+	writable = true;
+	return true;
+}
+
+bool MappedFile::flush() {
+	if (!data || !writable) return false;
+	return msync(data, size, MS_SYNC) == 0;
+}
+
+void MappedFile::close() {
+	if (data) munmap(data, size);
+	if (descriptor >= 0) ::close(descriptor);
+	data = nullptr;
+	size = 0;
+	writable = false;
+	descriptor = -1;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+	close();
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+/*
+	Memory mapping of a whole file, read-only unless opened writable.
+	Pages are loaded by the OS on first access, so opening a file of any size is instant. Writes go to the shared
+	page cache, so they survive a crash of the process; flush is only needed to survive a crash of the machine.
+*/
+
+class MappedFile
+{
+private:
+	char* data;
+	std::size_t size;
+	bool writable;
+#ifdef _WIN32
+	void* file;
+	void* mapping;
+#else
+	int descriptor;
+#endif
+public:
+	MappedFile();
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool open(const std::string& path);
+	// Creates the file when missing and resizes it first when size is not 0, new bytes read as zeros
+	bool openWritable(const std::string& path, std::size_t size = 0);
+	// Writes the changed pages back to the disk
+	bool flush();
+	void close();
+
+	// Getters
+	bool isOpen() const { return data != nullptr; }
+	const char* getData() const { return data; }
+	char* getWritableData() { return writable ? data : nullptr; }
+	std::size_t getSize() const { return size; }
+};
@@ -0,0 +1,286 @@
+#include "MateSolver.h"
+
+#include <algorithm>
+#include <array>
+#include <thread>
+
+// Proof and disproof numbers are capped here, a node at INFINITE_NUMBER is solved
+static const std::uint32_t INFINITE_NUMBER = 0x3FFFFFFF;
+// Bound of the searches that complete the mating line, positions that need more are left to the table
+static const std::uint32_t PV_THRESHOLD = 5000;
+
+// Keys of the plies left, so the same position at different depths gets different entries
+static std::uint64_t pliesKey(int plies) {
+	std::uint64_t z = 0x4D617465536F6C76ull + std::uint64_t(plies) * 0x9E3779B97F4A7C15ull;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return z ^ (z >> 31);
+}
+
+MateSolver::MateSolver(const MateSolverOptions& options) : options{ options }, stopFlag{ false }, solved{ false }, nodes{ 0 }, nodeLimit{ 0 } {
+	std::size_t entries = 1;
+	while (entries * 2 * sizeof(TableEntry) <= std::size_t(std::max(options.hashSizeMb, 1)) * 1024 * 1024)
+		entries *= 2;
+	table = std::vector<TableEntry>(entries);
+	clear();
+}
+
+void MateSolver::clear() {
+	for (TableEntry& entry : table) {
+		entry.key.store(0, std::memory_order_relaxed);
+		entry.data.store(0, std::memory_order_relaxed);
+	}
+}
+
+void MateSolver::stop() {
+	stopFlag = true;
+}
+
+bool MateSolver::lookup(std::uint64_t key, std::uint32_t& phi, std::uint32_t& delta) const {
+	const TableEntry& entry = table[key & (table.size() - 1)];
+	std::uint64_t data = entry.data.load(std::memory_order_relaxed);
+	if ((entry.key.load(std::memory_order_relaxed) ^ data) != key || !data) return false;
+
+	phi = std::uint32_t(data);
+	delta = std::uint32_t(data >> 32);
+	return true;
+}
+
+void MateSolver::store(std::uint64_t key, std::uint32_t phi, std::uint32_t delta) {
+	// another thread can have solved the node while this one still worked with older numbers of its children
+	std::uint32_t oldPhi, oldDelta;
+	if (lookup(key, oldPhi, oldDelta) && (oldPhi == 0 || oldDelta == 0)) return;
+
+	TableEntry& entry = table[key & (table.size() - 1)];
+	std::uint64_t data = std::uint64_t(phi) | (std::uint64_t(delta) << 32);
+	entry.key.store(key ^ data, std::memory_order_relaxed);
+	entry.data.store(data, std::memory_order_relaxed);
+}
+
+// Mate in one is answered on the spot instead of storing an entry for every reply
+static bool isMateInOne(Position& position) {
+	MoveList list;
+	position.generateMoves(list);
+
+	PieceColor mover = position.turn;
+	for (Move m : list) {
+		UndoInfo undo = position.makeMove(m);
+		bool mate = (position.kings[mover] < 0 || !position.isAttacked(position.kings[mover], position.turn))
+			&& position.inCheck() && !position.hasLegalMove();
+		position.unmakeMove(m, undo);
+		if (mate) return true;
+	}
+	return false;
+}
+
+/*
+	DF-PN
+
+	Every node is seen from its side to move: phi is the proof number when the attacker is to move and the
+	disproof number when the defender is, delta the other one. A node succeeds for its side to move (phi = 0)
+	as soon as one child fails for the opponent, so phi = min(delta of children) and delta = sum(phi of children).
+	Plies are odd when the attacker is to move.
+*/
+
+void MateSolver::mid(Position& position, int plies, std::uint32_t thresholdPhi, std::uint32_t thresholdDelta, int thread) {
+	if (stopFlag.load(std::memory_order_relaxed) || solved.load(std::memory_order_relaxed)) return;
+	if (nodeLimit && nodes.load(std::memory_order_relaxed) >= nodeLimit) {
+		stopFlag = true;
+		return;
+	}
+	++nodes;
+
+	const std::uint64_t key = position.hash ^ pliesKey(plies);
+	const bool attacker = plies % 2 == 1;
+	const bool inCheck = position.inCheck();
+
+	// the attacker has played its last move, only a mate on the board counts
+	if (plies == 0) {
+		if (inCheck && !position.hasLegalMove()) store(key, INFINITE_NUMBER, 0);
+		else store(key, 0, INFINITE_NUMBER);
+		return;
+	}
+	if (plies == 1) {
+		if (isMateInOne(position)) store(key, 0, INFINITE_NUMBER);
+		else store(key, INFINITE_NUMBER, 0);
+		return;
+	}
+
+	MoveList list;
+	position.generateMoves(list);
+
+	std::array<Move, 256> moves;
+	std::array<std::uint64_t, 256> keys;
+	std::array<std::uint32_t, 256> initialDelta;
+	int count = 0;
+
+	PieceColor mover = position.turn;
+	for (Move m : list) {
+		UndoInfo undo = position.makeMove(m);
+		if (position.kings[mover] < 0 || !position.isAttacked(position.kings[mover], position.turn)) {
+			moves[count] = m;
+			keys[count] = position.hash ^ pliesKey(plies - 1);
+			// checks leave the defender few replies, so they are expected to be cheaper to prove
+			initialDelta[count] = attacker && !position.inCheck() ? 3 : 1;
+			++count;
+		}
+		position.unmakeMove(m, undo);
+	}
+
+	// mated or stalemated, only a stalemated defender gets away with it
+	if (!count) {
+		if (!attacker && !inCheck) store(key, 0, INFINITE_NUMBER);
+		else store(key, INFINITE_NUMBER, 0);
+		return;
+	}
+
+	// threads start the tie breaks at different moves
+	const int offset = (thread * 7) % count;
+
+	while (true) {
+		std::uint32_t phi = INFINITE_NUMBER, delta = 0;
+		std::uint32_t bestPhi = 0, bestDelta = INFINITE_NUMBER, secondDelta = INFINITE_NUMBER;
+		int best = -1;
+
+		for (int j = 0; j < count; ++j) {
+			int i = (j + offset) % count;
+			std::uint32_t childPhi = 1, childDelta = initialDelta[i];
+			lookup(keys[i], childPhi, childDelta);
+
+			phi = std::min(phi, childDelta);
+			delta = std::uint32_t(std::min<std::uint64_t>(std::uint64_t(delta) + childPhi, INFINITE_NUMBER));
+
+			if (childDelta < bestDelta) {
+				secondDelta = bestDelta;
+				bestDelta = childDelta;
+				bestPhi = childPhi;
+				best = i;
+			}
+			else if (childDelta < secondDelta)
+				secondDelta = childDelta;
+		}
+
+		if (phi >= thresholdPhi || delta >= thresholdDelta) {
+			store(key, phi, delta);
+			return;
+		}
+		if (stopFlag.load(std::memory_order_relaxed) || solved.load(std::memory_order_relaxed)) return;
+
+		std::uint32_t childThresholdPhi = std::uint32_t(std::min<std::uint64_t>(std::uint64_t(thresholdDelta) - delta + bestPhi, INFINITE_NUMBER));
+		// 1 + epsilon: stay a little longer in the child before switching to the second best one
+		std::uint32_t childThresholdDelta = std::uint32_t(std::min<std::uint64_t>(thresholdPhi, std::uint64_t(secondDelta) + secondDelta / 4 + 1));
+
+		UndoInfo undo = position.makeMove(moves[best]);
+		mid(position, plies - 1, childThresholdPhi, childThresholdDelta, thread);
+		position.unmakeMove(moves[best], undo);
+	}
+}
+
+// Runs all threads on the root until one of them solves it, true when the root is a forced mate
+bool MateSolver::solveDepth(const Position& position, int plies) {
+	solved = false;
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < std::max(options.threads, 1); ++t) {
+		threads.emplace_back([this, &position, plies, t] {
+			Position root = position;
+			mid(root, plies, INFINITE_NUMBER, INFINITE_NUMBER, t);
+			// the root only returns once it is solved, or when the search is stopped
+			if (!stopFlag.load()) solved = true;
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+
+	std::uint32_t phi, delta;
+	return !stopFlag.load() && lookup(position.hash ^ pliesKey(plies), phi, delta) && phi == 0;
+}
+
+// True when the attacker is known to mate with plies left, with search = false only the table is asked
+bool MateSolver::isProven(Position& position, int plies, bool search) {
+	std::uint64_t key = position.hash ^ pliesKey(plies);
+	std::uint32_t phi = 1, delta = 1;
+	// entries can have been replaced since the proof, or never been solved for the probes of shorter mates
+	if (search && (!lookup(key, phi, delta) || (phi != 0 && delta != 0))) {
+		solved = false;
+		mid(position, plies, PV_THRESHOLD, PV_THRESHOLD, 0);
+	}
+	if (!lookup(key, phi, delta)) return false;
+	return plies % 2 == 1 ? phi == 0 : delta == 0;
+}
+
+// Follows the proof: a mating move for the attacker, the reply that delays the mate longest for the defender
+std::vector<Move> MateSolver::extractPv(Position position, int plies) {
+	std::vector<Move> pv;
+
+	while (plies > 0 && !stopFlag.load()) {
+		MoveList list;
+		position.generateLegalMoves(list);
+		if (!list.size) break;
+
+		Move chosen = nullMove;
+		int chosenPlies = -1;
+		if (plies % 2 == 1) {
+			// moves proven by the search first, searching the others can cost more than the proof did
+			for (int pass = 0; pass < 2 && chosen.isNull(); ++pass) {
+				for (Move m : list) {
+					UndoInfo undo = position.makeMove(m);
+					bool proven = isProven(position, plies - 1, pass == 1);
+					position.unmakeMove(m, undo);
+					if (proven) {
+						chosen = m;
+						break;
+					}
+				}
+			}
+			--plies;
+		}
+		else {
+			for (Move m : list) {
+				UndoInfo undo = position.makeMove(m);
+				// the shortest mate after this reply that is cheap to prove, every reply is mated within plies - 1
+				int mateIn = 1;
+				while (mateIn < plies - 1 && !isProven(position, mateIn, true))
+					mateIn += 2;
+				position.unmakeMove(m, undo);
+				if (mateIn > chosenPlies) {
+					chosen = m;
+					chosenPlies = mateIn;
+				}
+			}
+			plies = chosenPlies;
+		}
+
+		if (chosen.isNull()) break;
+		pv.push_back(chosen);
+		position.makeMove(chosen);
+	}
+	return pv;
+}
+
+MateResult MateSolver::solve(const Position& position, int maxMoves) {
+	MateResult result;
+	stopFlag = false;
+	nodes = 0;
+	nodeLimit = options.nodes;
+
+	// shortest mate first, small depths are cheap next to the last one
+	for (int moves = 1; moves <= maxMoves; ++moves) {
+		int plies = moves * 2 - 1;
+		bool mate = solveDepth(position, plies);
+
+		if (stopFlag.load()) break;
+		if (mate) {
+			result.status = MateResult::MATE;
+			result.moves = moves;
+			// the proof is complete, the line is found without the node limit
+			nodeLimit = 0;
+			result.pv = extractPv(position, plies);
+			break;
+		}
+		if (moves == maxMoves) result.status = MateResult::NO_MATE;
+	}
+
+	result.nodes = nodes.load();
+	return result;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "Engine.h"
+
+/*
+	Proves or disproves a forced mate within a number of moves with depth-first proof-number search (df-pn).
+	Nodes are keyed by position hash and plies left, so proofs of different depths never mix.
+	All threads search the same root and share the hash table, which is lock-free: entries are written with their
+	key xored with their data, so a torn read simply misses. Threads break ties between equally promising moves
+	differently, so they spread over the tree instead of repeating each other's work.
+*/
+
+struct MateResult
+{
+	enum Status {
+		MATE = 0,	// forced mate in moves, pv is the mating line
+		NO_MATE,	// no forced mate in maxMoves or less
+		UNKNOWN		// stopped or out of nodes before a proof was found
+	};
+
+	Status status = UNKNOWN;
+	int moves = 0;
+	std::vector<Move> pv;
+	std::int64_t nodes = 0;
+};
+
+struct MateSolverOptions
+{
+	int threads = 1;
+	int hashSizeMb = 64;
+	std::int64_t nodes = 0;	// 0 = unlimited
+};
+
+class MateSolver
+{
+private:
+	struct TableEntry
+	{
+		std::atomic<std::uint64_t> key;	// key ^ data
+		std::atomic<std::uint64_t> data;	// phi | delta << 32
+	};
+
+	MateSolverOptions options;
+	std::vector<TableEntry> table;
+
+	std::atomic<bool> stopFlag;
+	std::atomic<bool> solved;
+	std::atomic<std::int64_t> nodes;
+	std::int64_t nodeLimit;	// options.nodes, lifted once the proof is complete
+
+	bool lookup(std::uint64_t key, std::uint32_t& phi, std::uint32_t& delta) const;
+	void store(std::uint64_t key, std::uint32_t phi, std::uint32_t delta);
+
+	void mid(Position& position, int plies, std::uint32_t thresholdPhi, std::uint32_t thresholdDelta, int thread);
+	bool solveDepth(const Position& position, int plies);
+	bool isProven(Position& position, int plies, bool search);
+	std::vector<Move> extractPv(Position position, int plies);
+public:
+	explicit MateSolver(const MateSolverOptions& options = MateSolverOptions());
+
+	// Shortest forced mate of the side to move in at most maxMoves moves
+	MateResult solve(const Position& position, int maxMoves);
+	// Can be called from another thread, solve returns UNKNOWN unless a proof was already complete
+	void stop();
+	void clear();
+};
@@ -0,0 +1,124 @@
+#include "MultiBoard.h"
+
+#include <cmath>
+
+// layout of the sprite sheet, see Pieces.cpp
+static const float spriteSize = 426.f;
+
+static const sf::Color lightTile(231, 198, 165);
+static const sf::Color darkTile(88, 50, 11);
+
+// two triangles, the primitive that is left once quads are gone
+static inline void writeQuad(sf::Vertex* v, sf::FloatRect rect, sf::FloatRect texture, sf::Color color) {
+	sf::Vector2f p0(rect.left, rect.top), p1(rect.left + rect.width, rect.top + rect.height);
+	sf::Vector2f t0(texture.left, texture.top), t1(texture.left + texture.width, texture.top + texture.height);
+
+	v[0] = sf::Vertex(p0, color, t0);
+	v[1] = sf::Vertex(sf::Vector2f(p1.x, p0.y), color, sf::Vector2f(t1.x, t0.y));
+	v[2] = sf::Vertex(sf::Vector2f(p0.x, p1.y), color, sf::Vector2f(t0.x, t1.y));
+	v[3] = v[1];
+	v[4] = sf::Vertex(p1, color, t1);
+	v[5] = v[2];
+}
+
+MultiBoard::MultiBoard(int boardCount, int columns, const sf::Texture* texture)
+	: boardCount{ std::max(boardCount, 1) }, texture{ texture }, anyDirty{ false }, buffer{ sf::Triangles, sf::VertexBuffer::Dynamic }
+{
+	this->columns = columns > 0 ? columns : int(std::ceil(std::sqrt(double(this->boardCount))));
+
+	std::array<std::int8_t, 64> empty;
+	empty.fill(0);
+	squares.assign(this->boardCount, empty);
+	dirty.assign(this->boardCount, 0);
+
+	vertices.resize(std::size_t(this->boardCount) * VERTICES_PER_BOARD * 2);
+	for (int board = 0; board < this->boardCount; ++board) {
+		writeTiles(board);
+		writePieces(board);
+	}
+
+	// the tiles go up once here, they only change with the layout
+	useBuffer = sf::VertexBuffer::isAvailable() && buffer.create(vertices.size()) && buffer.update(vertices.data());
+}
+
+sf::Vector2f MultiBoard::boardOrigin(int board) const {
+	return sf::Vector2f((board % columns) * (8.f + BOARD_GAP), (board / columns) * (8.f + BOARD_GAP));
+}
+
+sf::Vector2f MultiBoard::getSize() const {
+	int rows = (boardCount + columns - 1) / columns;
+	return sf::Vector2f(columns * (8.f + BOARD_GAP) - BOARD_GAP, rows * (8.f + BOARD_GAP) - BOARD_GAP);
+}
+
+void MultiBoard::writeTiles(int board) {
+	sf::Vertex* v = &vertices[std::size_t(board) * VERTICES_PER_BOARD];
+	sf::Vector2f origin = boardOrigin(board);
+
+	for (int square = 0; square < 64; ++square, v += 6) {
+		int x = square % 8, y = square / 8;
+		writeQuad(v, sf::FloatRect(origin.x + x, origin.y + y, 1.f, 1.f), sf::FloatRect(), (x + y) % 2 ? darkTile : lightTile);
+	}
+}
+
+void MultiBoard::writePieces(int board) {
+	sf::Vertex* v = &vertices[std::size_t(boardCount + board) * VERTICES_PER_BOARD];
+	sf::Vector2f origin = boardOrigin(board);
+
+	for (int square = 0; square < 64; ++square, v += 6) {
+		int code = squares[board][square];
+		if (!code) {
+			// collapsed to a point, it draws nothing
+			for (int i = 0; i < 6; ++i) v[i] = sf::Vertex(origin);
+			continue;
+		}
+
+		float spriteX = codeType(code) * spriteSize;
+		float spriteY = codeColor(code) == PieceColor::WHITE ? 0.f : spriteSize;
+		writeQuad(v, sf::FloatRect(origin.x + square % 8, origin.y + square / 8, 1.f, 1.f),
+			sf::FloatRect(spriteX, spriteY, spriteSize, spriteSize), sf::Color::White);
+	}
+}
+
+void MultiBoard::setPosition(int board, const Position& position) {
+	if (board < 0 || board >= boardCount || squares[board] == position.squares) return;
+
+	squares[board] = position.squares;
+	writePieces(board);
+	dirty[board] = 1;
+	anyDirty = true;
+}
+
+void MultiBoard::upload() {
+	if (!anyDirty) return;
+	anyDirty = false;
+
+	// runs of changed boards go up in one call
+	std::size_t piecesStart = std::size_t(boardCount) * VERTICES_PER_BOARD;
+	for (int first = 0; first < boardCount;) {
+		if (!dirty[first]) {
+			++first;
+			continue;
+		}
+
+		int last = first;
+		while (last < boardCount && dirty[last]) dirty[last++] = 0;
+
+		std::size_t offset = piecesStart + std::size_t(first) * VERTICES_PER_BOARD;
+		if (useBuffer) buffer.update(&vertices[offset], std::size_t(last - first) * VERTICES_PER_BOARD, unsigned(offset));
+		first = last;
+	}
+}
+
+void MultiBoard::render(sf::RenderTarget& target) {
+	std::size_t count = std::size_t(boardCount) * VERTICES_PER_BOARD;
+	upload();
+
+	if (!useBuffer) {
+		target.draw(vertices.data(), count, sf::Triangles);
+		target.draw(vertices.data() + count, count, sf::Triangles, sf::RenderStates(texture));
+		return;
+	}
+
+	target.draw(buffer, 0, count);
+	target.draw(buffer, count, count, sf::RenderStates(texture));
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "Engine.h"
+
+/*
+	Grid of many small boards, for simuls and club events, drawn with two draw calls whatever the number of boards.
+
+	Every board has a fixed range of one vertex buffer: all tiles come first and never change, then a quad per
+	square for the pieces, empty squares being degenerate. setPosition only rewrites the quads of a board whose
+	pieces changed, and render only uploads the ranges of those boards. Pieces come from the sprite sheet of
+	Pieces.cpp, so all boards share its texture.
+	Board i is in row i / columns and column i % columns, a board is 8 by 8 units with BOARD_GAP units between boards.
+*/
+
+class MultiBoard
+{
+private:
+	int boardCount;
+	int columns;
+	const sf::Texture* texture;
+
+	std::vector<std::array<std::int8_t, 64>> squares;	// what the vertices of every board show
+	std::vector<char> dirty;							// boards changed since the last upload
+	bool anyDirty;
+
+	std::vector<sf::Vertex> vertices;	// tiles of every board, then pieces of every board
+	sf::VertexBuffer buffer;
+	bool useBuffer;						// without vertex buffer support the vertices are drawn from memory
+
+	sf::Vector2f boardOrigin(int board) const;
+	void writeTiles(int board);
+	void writePieces(int board);
+	void upload();
+public:
+	static const int VERTICES_PER_BOARD = 64 * 6;
+	static constexpr float BOARD_GAP = 0.5f;
+
+	// 0 columns lays the boards out in a square grid
+	MultiBoard(int boardCount, int columns, const sf::Texture* texture);
+
+	void setPosition(int board, const Position& position);
+	void render(sf::RenderTarget& target);
+
+	// Getters
+	int getBoardCount() const { return boardCount; }
+	int getColumns() const { return columns; }
+	sf::Vector2f getSize() const;
+};
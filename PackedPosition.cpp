@@ -0,0 +1,374 @@
+#include "PackedPosition.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define PACKED_SSSE3 1
+#else
+#define PACKED_SSSE3 0
+#endif
+
+/*
+	Shuffle controls for 8 squares, indexed by their occupancy byte. compress[m] gathers the codes of the occupied
+	squares to the front, expand[m] puts them back on their squares; unused lanes are 0x80, which pshufb zeroes.
+*/
+
+struct PackTables
+{
+	std::array<std::array<std::uint8_t, 8>, 256> compress;
+	std::array<std::array<std::uint8_t, 16>, 256> expand;
+	std::array<std::uint8_t, 256> counts;
+};
+
+static PackTables initPackTables() {
+	PackTables tables;
+
+	for (int m = 0; m < 256; ++m) {
+		tables.compress[m].fill(0x80);
+		tables.expand[m].fill(0x80);
+
+		int count = 0;
+		for (int bit = 0; bit < 8; ++bit) {
+			if (!(m >> bit & 1)) continue;
+			tables.compress[m][count] = std::uint8_t(bit);
+			tables.expand[m][bit] = std::uint8_t(count);
+			++count;
+		}
+		tables.counts[m] = std::uint8_t(count);
+	}
+	return tables;
+}
+
+static const PackTables packTables = initPackTables();
+
+static inline int lowestSquare(std::uint64_t bits) {
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward64(&index, bits);
+	return int(index);
+#else
+	return __builtin_ctzll(bits);
+#endif
+}
+
+static inline int countSquares(std::uint64_t bits) {
+	int count = 0;
+	for (; bits; bits &= bits - 1) ++count;
+	return count;
+}
+
+static inline bool hasKing(const Position& position, PieceColor color) {
+	int square = position.kings[color];
+	return square >= 0 && square < 64 && position.squares[square] == pieceCode(color, PieceType::KING);
+}
+
+// 32 codes fill the pieces, and an empty occupancy is the empty slot of sets
+static inline bool fits(const Position& position, std::uint64_t occupancy) {
+	return countSquares(occupancy) <= 32 && hasKing(position, PieceColor::WHITE) && hasKing(position, PieceColor::BLACK);
+}
+
+bool isPackable(const Position& position) {
+	std::uint64_t occupancy = 0;
+	for (int sq = 0; sq < 64; ++sq)
+		occupancy |= std::uint64_t(position.squares[sq] != 0) << sq;
+	return fits(position, occupancy);
+}
+
+PackedPosition packPosition(const Position& position) {
+	PackedPosition packed{};
+	const std::int8_t* squares = position.squares.data();
+
+#if PACKED_SSSE3
+	const __m128i zero = _mm_setzero_si128();
+	alignas(16) std::uint8_t codes[64];
+	for (int i = 0; i < 64; i += 16) {
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(squares + i));
+
+		std::uint64_t empty = std::uint16_t(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)));
+		packed.occupancy |= (~empty & 0xFFFF) << i;
+
+		// type | 8 for blacks, empty squares get garbage that compress drops
+		__m128i type = _mm_sub_epi8(_mm_abs_epi8(v), _mm_set1_epi8(1));
+		__m128i black = _mm_and_si128(_mm_cmplt_epi8(v, zero), _mm_set1_epi8(8));
+		_mm_store_si128(reinterpret_cast<__m128i*>(codes + i), _mm_or_si128(type, black));
+	}
+	if (!fits(position, packed.occupancy)) return PackedPosition{};
+
+	// 8 squares at a time, each store overlaps the unused tail of the previous one
+	alignas(16) std::uint8_t listed[48] = {};
+	int count = 0;
+	for (int i = 0; i < 8; ++i) {
+		int m = int(packed.occupancy >> (i * 8) & 0xFF);
+		__m128i chunk = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(codes + i * 8));
+		__m128i control = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(packTables.compress[m].data()));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(listed + count), _mm_shuffle_epi8(chunk, control));
+		count += packTables.counts[m];
+	}
+
+	// two codes to a byte: even * 1 + odd * 16
+	const __m128i weights = _mm_set1_epi16(0x1001);
+	__m128i low = _mm_maddubs_epi16(_mm_load_si128(reinterpret_cast<const __m128i*>(listed)), weights);
+	__m128i high = _mm_maddubs_epi16(_mm_load_si128(reinterpret_cast<const __m128i*>(listed + 16)), weights);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(packed.pieces), _mm_packus_epi16(low, high));
+#else
+	// 4-bit code of every piece code + 6
+	static const std::uint8_t nibbles[13] = { 13, 12, 11, 10, 9, 8, 0, 0, 1, 2, 3, 4, 5 };
+
+	// no branch on the squares, only a pass over the pieces
+	for (int sq = 0; sq < 64; ++sq)
+		packed.occupancy |= std::uint64_t(squares[sq] != 0) << sq;
+	if (!fits(position, packed.occupancy)) return PackedPosition{};
+
+	int piece = 0;
+	for (std::uint64_t bits = packed.occupancy; bits; bits &= bits - 1, ++piece)
+		packed.pieces[piece / 2] |= std::uint8_t(nibbles[squares[lowestSquare(bits)] + 6] << (piece % 2 * 4));
+#endif
+
+	packed.flags = position.turn == PieceColor::BLACK ? 1 : 0;
+	packed.halfmoveClock = std::uint8_t(std::min(position.halfmoveClock, 255));
+	return packed;
+}
+
+void unpackSquares(const PackedPosition& packed, std::array<std::int8_t, 64>& squares) {
+#if PACKED_SSSE3
+	// codes one per byte, with bit 4 set to tell a listed king from an empty lane; zeros past the 32 codes
+	alignas(16) std::uint8_t codes[80] = {};
+	const __m128i low4 = _mm_set1_epi8(0x0F), listed = _mm_set1_epi8(0x10);
+	__m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed.pieces));
+	__m128i low = _mm_or_si128(_mm_and_si128(p, low4), listed);
+	__m128i high = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(p, 4), low4), listed);
+	_mm_store_si128(reinterpret_cast<__m128i*>(codes), _mm_unpacklo_epi8(low, high));
+	_mm_store_si128(reinterpret_cast<__m128i*>(codes + 16), _mm_unpackhi_epi8(low, high));
+
+	alignas(16) std::uint8_t spread[64];
+	int count = 0;
+	for (int i = 0; i < 8; ++i) {
+		int m = int(packed.occupancy >> (i * 8) & 0xFF);
+		__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + count));
+		__m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(packTables.expand[m].data()));
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(spread + i * 8), _mm_shuffle_epi8(chunk, control));
+		count += packTables.counts[m];
+	}
+
+	// code = type + 1, negated for blacks, 0 where nothing was listed
+	const __m128i seven = _mm_set1_epi8(7), eight = _mm_set1_epi8(8), one = _mm_set1_epi8(1);
+	for (int i = 0; i < 64; i += 16) {
+		__m128i n = _mm_load_si128(reinterpret_cast<const __m128i*>(spread + i));
+		__m128i code = _mm_add_epi8(_mm_and_si128(n, seven), one);
+		__m128i black = _mm_cmpeq_epi8(_mm_and_si128(n, eight), eight);
+		code = _mm_sub_epi8(_mm_xor_si128(code, black), black);
+		code = _mm_and_si128(code, _mm_cmpeq_epi8(_mm_and_si128(n, listed), listed));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(squares.data() + i), code);
+	}
+#else
+	squares.fill(0);
+
+	int piece = 0;
+	for (std::uint64_t bits = packed.occupancy; bits && piece < 32; bits &= bits - 1, ++piece) {
+		int nibble = packed.pieces[piece / 2] >> (piece % 2 * 4) & 15;
+		squares[lowestSquare(bits)] = std::int8_t(pieceCode(nibble & 8 ? PieceColor::BLACK : PieceColor::WHITE, PieceType(nibble & 7)));
+	}
+#endif
+}
+
+// Zobrist keys by piece code + 6 and square, copied out of History.cpp so the hash needs no call per piece
+struct CodeKeys
+{
+	std::array<std::array<std::uint64_t, 64>, 13> keys;
+};
+
+static CodeKeys initCodeKeys() {
+	CodeKeys table{};
+	for (int code = -6; code <= 6; ++code) {
+		if (!code) continue;
+		for (int sq = 0; sq < 64; ++sq)
+			table.keys[code + 6][sq] = zobristPieceKey(codeColor(code), codeType(code), tileOf(sq));
+	}
+	return table;
+}
+
+Position unpackPosition(const PackedPosition& packed) {
+	// built on first use, the keys of History.cpp are only known to be ready by then
+	static const CodeKeys codeKeys = initCodeKeys();
+
+	Position position;
+	unpackSquares(packed, position.squares);
+	position.turn = packed.flags & 1 ? PieceColor::BLACK : PieceColor::WHITE;
+	position.halfmoveClock = packed.halfmoveClock;
+
+	// only the occupied squares need a key
+	position.hash = position.turn == PieceColor::BLACK ? zobristTurnKey() : 0;
+	for (std::uint64_t bits = packed.occupancy; bits; bits &= bits - 1) {
+		int sq = lowestSquare(bits);
+		int code = position.squares[sq];
+		position.hash ^= codeKeys.keys[code + 6][sq];
+		if (code == pieceCode(PieceColor::WHITE, PieceType::KING)) position.kings[PieceColor::WHITE] = sq;
+		else if (code == pieceCode(PieceColor::BLACK, PieceType::KING)) position.kings[PieceColor::BLACK] = sq;
+	}
+	return position;
+}
+
+void packPositions(const Position* positions, PackedPosition* packed, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i)
+		packed[i] = packPosition(positions[i]);
+}
+
+void unpackPositions(const PackedPosition* packed, Position* positions, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i)
+		positions[i] = unpackPosition(packed[i]);
+}
+
+std::uint64_t packedHash(const PackedPosition& packed) {
+	std::uint64_t words[4];
+	std::memcpy(words, &packed, sizeof(words));
+	// the halfmove clock is the second byte of the last word
+	words[3] &= ~(std::uint64_t(0xFF) << 8);
+
+	std::uint64_t h = words[0] * 0x9E3779B97F4A7C15ull;
+	for (int i = 1; i < 4; ++i)
+		h = (h ^ (h >> 32) ^ words[i]) * 0xD6E8FEB86659FD93ull;
+	return h ^ (h >> 32);
+}
+
+/*
+	POSITION SET
+*/
+
+PositionSet::PositionSet() : header{ nullptr }, slots{ nullptr }, failed{ false } {}
+
+bool PositionSet::create(const std::string& target, std::uint64_t slotCount) {
+	// truncated first so the slots start out empty, without writing them
+	if (!std::ofstream(target, std::ios::binary | std::ios::trunc)) return false;
+	if (!file.openWritable(target, sizeof(PositionSetHeader) + slotCount * sizeof(PackedPosition))) return false;
+
+	header = reinterpret_cast<PositionSetHeader*>(file.getWritableData());
+	std::memcpy(header->magic, "CHPS", 4);
+	header->version = POSITION_SET_VERSION;
+	header->slotCount = slotCount;
+	header->count = 0;
+	slots = reinterpret_cast<PackedPosition*>(file.getWritableData() + sizeof(PositionSetHeader));
+	return true;
+}
+
+bool PositionSet::open(const std::string& path, std::uint64_t capacity) {
+	close();
+	this->path = path;
+	failed = false;
+
+	// only a missing or empty file is created, anything else has to be a set already
+	std::ifstream existing(path, std::ios::binary | std::ios::ate);
+	if (existing && existing.tellg() > 0) {
+		existing.close();
+		if (!file.openWritable(path) || file.getSize() < sizeof(PositionSetHeader)) {
+			close();
+			return false;
+		}
+
+		header = reinterpret_cast<PositionSetHeader*>(file.getWritableData());
+		std::uint64_t slotCount = header->slotCount;
+		if (std::memcmp(header->magic, "CHPS", 4) == 0 && header->version == POSITION_SET_VERSION
+			&& slotCount && (slotCount & (slotCount - 1)) == 0 && header->count <= slotCount / 4 * 3
+			&& file.getSize() == sizeof(PositionSetHeader) + slotCount * sizeof(PackedPosition)) {
+			slots = reinterpret_cast<PackedPosition*>(file.getWritableData() + sizeof(PositionSetHeader));
+			return true;
+		}
+		// not a set, it is not ours to overwrite
+		close();
+		return false;
+	}
+
+	existing.close();
+	std::uint64_t slotCount = 16;
+	while (slotCount / 4 * 3 < capacity) slotCount *= 2;
+	return create(path, slotCount);
+}
+
+void PositionSet::close() {
+	file.close();
+	header = nullptr;
+	slots = nullptr;
+}
+
+PackedPosition* PositionSet::find(const PackedPosition& key) const {
+	std::uint64_t mask = header->slotCount - 1;
+	for (std::uint64_t i = packedHash(key) & mask;; i = (i + 1) & mask) {
+		PackedPosition* slot = &slots[i];
+		if (!slot->occupancy || *slot == key) return slot;
+	}
+}
+
+bool PositionSet::insert(const PackedPosition& position) {
+	if (!header || failed || !position.occupancy) return false;
+
+	PackedPosition key = position;
+	key.halfmoveClock = 0;
+	PackedPosition* slot = find(key);
+	if (slot->occupancy) return false;
+
+	// grown before the table gets fuller than 3/4, so probing always reaches an empty slot
+	if (header->count + 1 > header->slotCount / 4 * 3) {
+		if (!grow()) {
+			std::fprintf(stderr, "PositionSet: failed to grow %s\n", path.c_str());
+			failed = true;
+			return false;
+		}
+		slot = find(key);
+	}
+
+	std::memcpy(reinterpret_cast<char*>(slot) + sizeof(key.occupancy), reinterpret_cast<const char*>(&key) + sizeof(key.occupancy),
+		sizeof(PackedPosition) - sizeof(key.occupancy));
+	slot->occupancy = key.occupancy;
+	++header->count;
+	return true;
+}
+
+bool PositionSet::contains(const PackedPosition& position) const {
+	if (!header) return false;
+
+	PackedPosition key = position;
+	key.halfmoveClock = 0;
+	return find(key)->occupancy != 0;
+}
+
+// The entries move to a new file twice the size, which then replaces the old one
+bool PositionSet::grow() {
+	std::string target = path + ".grow";
+	std::uint64_t oldSlotCount = header->slotCount;
+
+	MappedFile old;
+	if (!old.open(path)) return false;
+	const PackedPosition* oldSlots = reinterpret_cast<const PackedPosition*>(old.getData() + sizeof(PositionSetHeader));
+
+	close();
+	if (!create(target, oldSlotCount * 2)) {
+		// still the old table, full, so the caller has to stop inserting
+		old.close();
+		open(path);
+		return false;
+	}
+
+	for (std::uint64_t i = 0; i < oldSlotCount; ++i) {
+		if (!oldSlots[i].occupancy) continue;
+		*find(oldSlots[i]) = oldSlots[i];
+		++header->count;
+	}
+
+	old.close();
+	close();
+#ifdef _WIN32
+	// rename does not replace an existing file there
+	std::remove(path.c_str());
+#endif
+	if (std::rename(target.c_str(), path.c_str()) != 0) {
+		open(path);
+		return false;
+	}
+	return open(path);
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "Engine.h"
+#include "MappedFile.h"
+
+/*
+	Canonical 32-byte encoding of a Position, for keeping positions by the hundreds of millions.
+
+	Pieces are listed in square order as 4-bit codes, two per byte, low nibble first: the piece type, +8 for
+	blacks. Pawns never promote, so there are never more than the 32 pieces the codes have room for. Unused
+	nibbles and the reserved bytes are zero, so two encodings are equal exactly when the positions are. Unpacking
+	gives back the same Position, hash included; the halfmove clock is kept up to 255.
+	Multi-byte fields are stored little-endian, like the machines that write them.
+*/
+
+struct PackedPosition
+{
+	std::uint64_t occupancy;	// bit y * 8 + x is set for every piece
+	std::uint8_t pieces[16];
+	std::uint8_t flags;			// bit 0 is set when blacks are to move
+	std::uint8_t halfmoveClock;
+	std::uint8_t reserved[6];
+};
+
+static_assert(sizeof(PackedPosition) == 32, "the packed layout is part of the file formats");
+
+inline bool operator==(const PackedPosition& a, const PackedPosition& b) { return std::memcmp(&a, &b, sizeof(PackedPosition)) == 0; }
+inline bool operator!=(const PackedPosition& a, const PackedPosition& b) { return !(a == b); }
+
+// Both kings and at most 32 pieces, which every game from the start position keeps to
+bool isPackable(const Position& position);
+
+// The SSSE3 shuffles move the 4-bit codes 8 squares at a time, other targets use the same layout square by square.
+// A position that is not packable gives an empty encoding, with no occupancy, that sets refuse.
+PackedPosition packPosition(const Position& position);
+Position unpackPosition(const PackedPosition& packed);
+// Only the squares, for callers that don't need the hash
+void unpackSquares(const PackedPosition& packed, std::array<std::int8_t, 64>& squares);
+
+void packPositions(const Position* positions, PackedPosition* packed, std::size_t count);
+void unpackPositions(const PackedPosition* packed, Position* positions, std::size_t count);
+
+// Hash of the encoding without the halfmove clock, positions that only differ in it are the same for sets
+std::uint64_t packedHash(const PackedPosition& packed);
+
+/*
+	Set of positions in a memory mapped file, for deduplicating more positions than fit in memory.
+
+	The file is a header followed by an open addressing table of PackedPosition slots with linear probing, an empty
+	slot has no occupancy (a position always has its kings). The halfmove clock is not stored: positions that only
+	differ in it count as one. The table doubles into a new file before it gets more than 3/4 full.
+	A slot is written pieces first and occupancy last, so a crash can at worst leave one incomplete position behind.
+*/
+
+struct PositionSetHeader
+{
+	char magic[4];			// "CHPS"
+	std::uint32_t version;
+	std::uint64_t slotCount;
+	std::uint64_t count;
+	std::uint64_t reserved;
+};
+
+static_assert(sizeof(PositionSetHeader) == 32, "the set layout is part of the file format");
+
+const std::uint32_t POSITION_SET_VERSION = 1;
+
+class PositionSet
+{
+private:
+	std::string path;
+	MappedFile file;
+	PositionSetHeader* header;
+	PackedPosition* slots;
+	bool failed;
+
+	bool create(const std::string& target, std::uint64_t slotCount);
+	bool grow();
+	PackedPosition* find(const PackedPosition& key) const;
+public:
+	PositionSet();
+	PositionSet(const PositionSet&) = delete;
+	PositionSet& operator=(const PositionSet&) = delete;
+
+	// Maps the set, creating it with room for capacity positions when missing
+	bool open(const std::string& path, std::uint64_t capacity = 1 << 20);
+	void close();
+
+	// True when the position was not in the set yet, an empty encoding is never inserted. False as well when the
+	// table could not grow, hasFailed() tells that apart and nothing more gets inserted.
+	bool insert(const PackedPosition& position);
+	bool contains(const PackedPosition& position) const;
+
+	// Getters
+	bool isOpen() const { return header != nullptr; }
+	std::uint64_t getCount() const { return header ? header->count : 0; }
+	std::uint64_t getSlotCount() const { return header ? header->slotCount : 0; }
+	bool hasFailed() const { return failed || !header; }
+};
@@ -327,4 +327,17 @@ void Pawn::moveToTile(sf::Vector2i move) {
 
 	if (initialMove) initialMove = false;
 	else if (!hasMoved) hasMoved = true;
+}
+
+bool Pawn::getHasMoved() {
+	return this->hasMoved;
+}
+
+bool Pawn::getInitialMove() {
+	return this->initialMove;
+}
+
+void Pawn::setMoveState(bool hasMoved, bool initialMove) {
+	this->hasMoved = hasMoved;
+	this->initialMove = initialMove;
 }
\ No newline at end of file
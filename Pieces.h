@@ -110,6 +110,11 @@ public:
 	Pawn(PieceColor color, sf::Texture* texture, float size);
 	void getMoves(std::array<std::array<Piece*, 8>, 8>&, std::vector<sf::Vector2i>*);
 	void moveToTile(sf::Vector2i);
+
+	// For undo and positions loaded from a FEN, moveToTile keeps them up to date otherwise
+	bool getHasMoved();
+	bool getInitialMove();
+	void setMoveState(bool hasMoved, bool initialMove);
 };
 
 PieceColor oppositeColor(PieceColor color);
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "Profiler.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// Events kept per thread, older events are overwritten
+static const std::size_t traceBufferSize = 1 << 16;
+
+/*
+	COUNTER
+*/
+
+ProfileCounter::ProfileCounter(const char* name) : name{ name }, calls{ 0 }, totalNs{ 0 }, maxNs{ 0 } {}
+
+void ProfileCounter::add(std::uint64_t ns) {
+	calls.fetch_add(1, std::memory_order_relaxed);
+	totalNs.fetch_add(ns, std::memory_order_relaxed);
+
+	std::uint64_t prevMax = maxNs.load(std::memory_order_relaxed);
+	while (ns > prevMax && !maxNs.compare_exchange_weak(prevMax, ns, std::memory_order_relaxed));
+}
+
+/*
+	SCOPE
+*/
+
+ProfileScope::ProfileScope(ProfileCounter& counter) : counter{ counter }, start{ Profiler::get().now() } {}
+
+ProfileScope::~ProfileScope() {
+	Profiler& profiler = Profiler::get();
+	profiler.record(counter, start, profiler.now());
+}
+
+/*
+	PROFILER
+*/
+
+constexpr std::array<int, 10> Profiler::frameBuckets;
+
+Profiler::Profiler() : startTime{ std::chrono::steady_clock::now() }, tracing{ false }, lastFrame{ -1 }, maxFrameNs{ 0 } {
+	for (auto& bucket : frameHistogram)
+		bucket = 0;
+}
+
+Profiler& Profiler::get() {
+	static Profiler profiler;
+	return profiler;
+}
+
+ProfileCounter& Profiler::counter(const char* name) {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	for (auto& c : counters) {
+		if (std::strcmp(c->name, name) == 0) return *c;
+	}
+
+	counters.push_back(std::make_unique<ProfileCounter>(name));
+	return *counters.back();
+}
+
+void Profiler::setTracing(bool enabled) {
+	tracing = enabled;
+}
+
+std::int64_t Profiler::now() const {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+Profiler::ThreadBuffer* Profiler::getThreadBuffer() {
+	// Each thread writes only to its own buffer, the buffers are owned by the profiler so they can still be dumped
+	// after the thread has finished. The lease gives the buffer back when the thread exits, short-lived threads
+	// like the async searches then reuse the same few buffers instead of adding one each.
+	struct Lease
+	{
+		ThreadBuffer* buffer = nullptr;
+		~Lease() { if (buffer) Profiler::get().releaseThreadBuffer(buffer); }
+	};
+	thread_local Lease lease;
+	if (lease.buffer) return lease.buffer;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	for (auto& buffer : threadBuffers) {
+		if (buffer->inUse) continue;
+		buffer->inUse = true;
+		return lease.buffer = buffer.get();
+	}
+
+	threadBuffers.push_back(std::make_unique<ThreadBuffer>());
+	ThreadBuffer* buffer = threadBuffers.back().get();
+	buffer->tid = int(threadBuffers.size());
+	buffer->inUse = true;
+	buffer->events.resize(traceBufferSize);
+	buffer->next = 0;
+	buffer->wrapped = false;
+
+	return lease.buffer = buffer;
+}
+
+void Profiler::releaseThreadBuffer(ThreadBuffer* buffer) {
+	std::lock_guard<std::mutex> lock(mutex);
+	buffer->inUse = false;
+}
+
+void Profiler::record(ProfileCounter& counter, std::int64_t start, std::int64_t end) {
+	counter.add(std::uint64_t(end - start));
+
+	if (!tracing.load(std::memory_order_relaxed)) return;
+
+	ThreadBuffer* buffer = getThreadBuffer();
+	std::lock_guard<std::mutex> lock(buffer->mutex);
+	buffer->events[buffer->next] = TraceEvent{ counter.name, start, end - start };
+	if (++buffer->next == traceBufferSize) {
+		buffer->next = 0;
+		buffer->wrapped = true;
+	}
+}
+
+void Profiler::frame() {
+	// called from the render loop only
+	std::int64_t t = now();
+	if (lastFrame >= 0) {
+		std::uint64_t ns = std::uint64_t(t - lastFrame);
+		if (ns > maxFrameNs) maxFrameNs = ns;
+
+		std::size_t bucket = 0;
+		while (bucket < frameBuckets.size() && ns > std::uint64_t(frameBuckets[bucket]) * 1000000) ++bucket;
+		frameHistogram[bucket].fetch_add(1, std::memory_order_relaxed);
+	}
+	lastFrame = t;
+}
+
+std::string Profiler::summary() {
+	std::ostringstream out;
+	out << std::fixed << std::setprecision(3);
+
+	out << std::left << std::setw(24) << "scope" << std::right
+		<< std::setw(10) << "calls"
+		<< std::setw(12) << "avg ms"
+		<< std::setw(12) << "max ms"
+		<< std::setw(12) << "total ms" << "\n";
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		for (auto& c : counters) {
+			std::uint64_t calls = c->calls.load(std::memory_order_relaxed);
+			double total = double(c->totalNs.load(std::memory_order_relaxed)) / 1e6;
+
+			out << std::left << std::setw(24) << c->name << std::right
+				<< std::setw(10) << calls
+				<< std::setw(12) << (calls ? total / double(calls) : 0.0)
+				<< std::setw(12) << double(c->maxNs.load(std::memory_order_relaxed)) / 1e6
+				<< std::setw(12) << total << "\n";
+		}
+	}
+
+	out << "\nframe time (max " << double(maxFrameNs) / 1e6 << " ms)\n";
+	for (std::size_t i = 0; i < frameHistogram.size(); ++i) {
+		if (i < frameBuckets.size())
+			out << "<= " << std::setw(5) << frameBuckets[i] << " ms";
+		else
+			out << " > " << std::setw(5) << frameBuckets.back() << " ms";
+		out << std::setw(10) << frameHistogram[i].load(std::memory_order_relaxed) << "\n";
+	}
+
+	return out.str();
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) {
+	std::ofstream out(path);
+	if (!out) return false;
+
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// "X" events are complete events with a duration, timestamps are in microseconds
+	out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	bool first = true;
+	out << std::fixed << std::setprecision(3);
+	std::vector<TraceEvent> events;
+	for (auto& buffer : threadBuffers) {
+		// copied under the lock of the buffer, its thread may still be recording, then written without holding it
+		{
+			std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+			std::size_t begin = buffer->wrapped ? buffer->next : 0;
+			std::size_t count = buffer->wrapped ? traceBufferSize : buffer->next;
+			events.assign(buffer->events.begin() + begin, buffer->events.begin() + std::min(begin + count, traceBufferSize));
+			if (begin + count > traceBufferSize)
+				events.insert(events.end(), buffer->events.begin(), buffer->events.begin() + (begin + count - traceBufferSize));
+		}
+
+		for (const TraceEvent& e : events) {
+			out << (first ? "" : ",\n")
+				<< "{\"name\":\"" << e.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->tid
+				<< ",\"ts\":" << double(e.start) / 1e3 << ",\"dur\":" << double(e.duration) / 1e3 << "}";
+			first = false;
+		}
+	}
+
+	out << "\n],\n";
+
+	// counter totals and the frame time histogram go to the trace metadata
+	out << "\"otherData\":{";
+	for (auto& c : counters) {
+		out << "\"" << c->name << "\":\"calls=" << c->calls.load()
+			<< " total_ns=" << c->totalNs.load() << " max_ns=" << c->maxNs.load() << "\",";
+	}
+	out << "\"frame_histogram_ms\":\"";
+	for (std::size_t i = 0; i < frameHistogram.size(); ++i) {
+		if (i < frameBuckets.size()) out << "<=" << frameBuckets[i];
+		else out << ">" << frameBuckets.back();
+		out << ":" << frameHistogram[i].load() << (i + 1 < frameHistogram.size() ? " " : "");
+	}
+	out << "\"}}\n";
+
+	return bool(out);
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Set CHESS_PROFILE to 0 to compile all instrumentation out
+#ifndef CHESS_PROFILE
+#define CHESS_PROFILE 1
+#endif
+
+/*
+	Low overhead instrumentation of the hot paths.
+	Every PROFILE_SCOPE adds to a named counter (calls, total and max time) and, while tracing is enabled,
+	records the scope in a ring buffer of the calling thread, so the last events can be dumped as a Chrome trace.
+	PROFILE_FRAME marks the start of a frame and feeds the frame time histogram.
+*/
+
+struct ProfileCounter
+{
+	const char* name;
+	std::atomic<std::uint64_t> calls;
+	std::atomic<std::uint64_t> totalNs;
+	std::atomic<std::uint64_t> maxNs;
+
+	explicit ProfileCounter(const char* name);
+	void add(std::uint64_t ns);
+};
+
+struct TraceEvent
+{
+	const char* name;
+	std::int64_t start;	// ns since the profiler was created
+	std::int64_t duration;
+};
+
+class Profiler
+{
+public:
+	// Upper bounds of the frame time histogram buckets in ms, the last bucket takes everything above
+	static constexpr std::array<int, 10> frameBuckets = { 8, 16, 33, 50, 100, 150, 250, 500, 1000, 2000 };
+private:
+	// One per running thread at most, a finished thread hands its buffer on to the next new one
+	struct ThreadBuffer
+	{
+		int tid;
+		bool inUse;			// guarded by the profiler mutex
+		std::mutex mutex;	// the owner only contends with writeChromeTrace on it
+		std::vector<TraceEvent> events;
+		std::size_t next;
+		bool wrapped;
+	};
+
+	std::chrono::steady_clock::time_point startTime;
+	std::atomic<bool> tracing;
+
+	std::mutex mutex;
+	std::vector<std::unique_ptr<ProfileCounter>> counters;
+	std::vector<std::unique_ptr<ThreadBuffer>> threadBuffers;
+	ThreadBuffer* getThreadBuffer();
+	void releaseThreadBuffer(ThreadBuffer* buffer);
+
+	std::array<std::atomic<std::uint64_t>, frameBuckets.size() + 1> frameHistogram;
+	std::int64_t lastFrame;
+	std::uint64_t maxFrameNs;
+
+	Profiler();
+public:
+	static Profiler& get();
+
+	// Counters are never removed, so the returned reference can be cached by the call site
+	ProfileCounter& counter(const char* name);
+
+	void setTracing(bool enabled);
+
+	std::int64_t now() const;
+	void record(ProfileCounter& counter, std::int64_t start, std::int64_t end);
+	void frame();
+
+	// Human readable table of all counters and the frame time histogram
+	std::string summary();
+	bool writeChromeTrace(const std::string& path);
+};
+
+class ProfileScope
+{
+private:
+	ProfileCounter& counter;
+	std::int64_t start;
+public:
+	explicit ProfileScope(ProfileCounter& counter);
+	~ProfileScope();
+};
+
+#if CHESS_PROFILE
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(name) \
+	static ProfileCounter& PROFILE_CONCAT(profileCounter, __LINE__) = Profiler::get().counter(name); \
+	ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(PROFILE_CONCAT(profileCounter, __LINE__))
+#define PROFILE_FRAME() Profiler::get().frame()
+#else
+#define PROFILE_SCOPE(name)
+#define PROFILE_FRAME()
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/*
+	Lock-free bounded queue for exactly one producer thread and one consumer thread.
+	Neither side ever blocks, push fails when the queue is full and pop fails when it is empty.
+	T should be trivially copyable, items are copied in and out of a fixed ring buffer.
+*/
+
+template<typename T, std::size_t Capacity>
+class SpscQueue
+{
+	static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+private:
+	std::array<T, Capacity> buffer;
+
+	// on separate cache lines, so the producer and the consumer don't invalidate each other's line
+	alignas(64) std::atomic<std::size_t> head;	// next item to pop, written by the consumer
+	alignas(64) std::atomic<std::size_t> tail;	// next free slot, written by the producer
+public:
+	SpscQueue() : head{ 0 }, tail{ 0 } {}
+
+	bool push(const T& item) {
+		std::size_t t = tail.load(std::memory_order_relaxed);
+		if (t - head.load(std::memory_order_acquire) == Capacity) return false;
+
+		buffer[t & (Capacity - 1)] = item;
+		tail.store(t + 1, std::memory_order_release);
+		return true;
+	}
+
+	bool pop(T& item) {
+		std::size_t h = head.load(std::memory_order_relaxed);
+		if (h == tail.load(std::memory_order_acquire)) return false;
+
+		item = buffer[h & (Capacity - 1)];
+		head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+};
+
+/*
+	Lock-free slot for one producer thread and one consumer thread that only care about the latest value.
+	Three buffers take turns: the producer writes its own and swaps it with the shared one, the consumer swaps its
+	own with the shared one when a fresh value is there. Nothing is ever refused, an unread value is overwritten.
+*/
+
+template<typename T>
+class LatestValue
+{
+private:
+	static const unsigned FRESH = 4;
+
+	std::array<T, 3> buffers;
+	alignas(64) std::atomic<unsigned> shared;	// index of the shared buffer, | FRESH when it holds an unread value
+	alignas(64) unsigned back;					// producer only
+	alignas(64) unsigned front;					// consumer only
+public:
+	LatestValue() : buffers{}, shared{ 0 }, back{ 1 }, front{ 2 } {}
+
+	void publish(const T& value) {
+		buffers[back] = value;
+		back = shared.exchange(back | FRESH, std::memory_order_acq_rel) & ~FRESH;
+	}
+
+	// False when nothing was published since the last take
+	bool take(T& value) {
+		if (!(shared.load(std::memory_order_relaxed) & FRESH)) return false;
+
+		front = shared.exchange(front, std::memory_order_acq_rel) & ~FRESH;
+		value = buffers[front];
+		return true;
+	}
+};
@@ -0,0 +1,247 @@
+/*
+	Microbenchmarks for the rules, check detection and rendering hot paths.
+
+	Every benchmark runs on the same fixed set of middlegame and endgame positions.
+	Results are written as JSON in the same layout as Google Benchmark's --benchmark_format=json,
+	so the usual comparison tools can be used to track regressions between builds.
+
+	usage: Benchmark [--filter=<substring>] [--min_time=<seconds>] [--out=<file>]
+*/
+
+#include "../Game.h"
+#include "../PackedPosition.h"
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct BenchmarkPosition
+{
+	const char* name;
+	const char* fen;
+};
+
+static const BenchmarkPosition positions[] = {
+	{ "middlegame/open",		"r2q1rk1/pp2bppp/2n1bn2/3p4/3P4/2NBBN2/PP3PPP/R2Q1RK1 w - - 0 1" },
+	{ "middlegame/closed",		"r1bq1rk1/pp1nbppp/2p1p3/3pP3/3P1P2/2NB1N2/PPP3PP/R1BQ1RK1 b - - 0 1" },
+	{ "middlegame/check",		"r1bqk2r/pppp1Bpp/2n2n2/2b1p3/4P3/5N2/PPPP1PPP/RNBQK2R b - - 0 1" },
+	{ "endgame/rook",			"8/5pk1/6p1/8/3R4/6P1/r4PK1/8 w - - 0 1" },
+	{ "endgame/rook_check",		"8/8/8/4k3/8/8/3K4/4R3 b - - 0 1" },
+	{ "endgame/back_rank_mate",	"6k1/5ppp/8/8/8/8/5PPP/q5K1 w - - 0 1" },
+	{ "endgame/pawns",			"8/2k5/2p1p3/1pP1P1p1/1P4P1/3K4/8/8 w - - 0 1" },
+};
+
+struct BenchmarkResult
+{
+	std::string name;
+	long long iterations;
+	double realTime;	// ns per iteration
+};
+
+// Keeps the compiler from optimizing benchmarked calls away
+static volatile std::size_t sink;
+
+/*
+	Has access to the private hot paths of Game.
+*/
+
+class GameBenchmark
+{
+private:
+	std::string filter;
+	double minTime;
+	std::vector<BenchmarkResult> results;
+
+	sf::RenderTexture renderTexture;
+
+	template<typename F>
+	void run(const std::string& name, F&& f);
+
+	std::vector<Piece*> getPieces(Game& game, PieceColor color, int type);
+public:
+	GameBenchmark(const std::string& filter, double minTime);
+
+	void runAll();
+	void writeJson(std::ostream& out) const;
+};
+
+GameBenchmark::GameBenchmark(const std::string& filter, double minTime) : filter{ filter }, minTime{ minTime } {}
+
+template<typename F>
+void GameBenchmark::run(const std::string& name, F&& f) {
+	if (!filter.empty() && name.find(filter) == std::string::npos) return;
+
+	using clock = std::chrono::steady_clock;
+
+	// warm up, then double the batch size until one batch takes at least minTime
+	f();
+
+	long long iterations = 1;
+	double elapsed = 0.0;
+	while (true) {
+		auto start = clock::now();
+		for (long long i = 0; i < iterations; ++i)
+			f();
+		elapsed = std::chrono::duration<double>(clock::now() - start).count();
+
+		if (elapsed >= minTime || iterations >= (1ll << 40)) break;
+		iterations *= 2;
+	}
+
+	BenchmarkResult result{ name, iterations, elapsed * 1e9 / double(iterations) };
+	std::cerr << result.name << "\t" << result.realTime << " ns\t" << result.iterations << "\n";
+	results.push_back(result);
+}
+
+std::vector<Piece*> GameBenchmark::getPieces(Game& game, PieceColor color, int type) {
+	std::vector<Piece*> pieces;
+	for (auto& row : game.board) {
+		for (auto p : row) {
+			if (!p || p->color != color) continue;
+			if (type >= 0 && p->type != type) continue;
+			pieces.push_back(p);
+		}
+	}
+	return pieces;
+}
+
+void GameBenchmark::runAll() {
+	const char* typeNames[] = { "king", "queen", "bishop", "knight", "rook", "pawn" };
+
+	Game game(GameMode::OFFSCREEN);
+	std::vector<sf::Vector2i> moves;
+
+	// tiles are 150px, the board plus margins is 1300px
+	if (!renderTexture.create(1300, 1300))
+		std::cout << "Failed to create render texture\n";
+
+	for (auto& position : positions) {
+		game.loadFen(position.fen);
+		std::string suffix = std::string("/") + position.name;
+
+		for (int type = PieceType::KING; type <= PieceType::PAWN; ++type) {
+			auto pieces = getPieces(game, game.turn, type);
+			if (pieces.empty()) continue;
+
+			run(std::string("Piece::getMoves/") + typeNames[type] + suffix, [&]() {
+				for (auto p : pieces) {
+					p->getMoves(game.board, &moves);
+					sink = moves.size();
+				}
+			});
+		}
+
+		auto pieces = getPieces(game, game.turn, -1);
+		run("Game::getPiecePossibleMoves" + suffix, [&]() {
+			for (auto p : pieces) {
+				game.getPiecePossibleMoves(p, &moves);
+				sink = moves.size();
+			}
+		});
+
+		run("Game::updateIsCheck" + suffix, [&]() {
+			game.updateIsCheck();
+			sink = game.isWhiteCheck + game.isBlackCheck;
+		});
+
+		run("Game::anyPossibleMoves" + suffix, [&]() {
+			sink = game.anyPossibleMoves(game.turn);
+		});
+
+		// the positions above include checked and mated ones
+		run("Game::updateIsCheckmate" + suffix, [&]() {
+			game.isCheckmate = false;
+			game.isDraw = false;
+			game.updateIsCheckmate();
+			sink = game.isCheckmate;
+		});
+
+		Position enginePosition = game.getPosition();
+		run("Position::classify" + suffix, [&]() {
+			sink = int(enginePosition.classify());
+		});
+
+		// every capture of the side to move in one iteration
+		MoveList captures;
+		enginePosition.generateCaptures(captures);
+		if (captures.size) {
+			run("Position::see" + suffix, [&]() {
+				for (Move m : captures)
+					sink = enginePosition.see(m);
+			});
+		}
+
+		PackedPosition packed = packPosition(enginePosition);
+		run("packPosition" + suffix, [&]() {
+			sink = packPosition(enginePosition).pieces[0];
+		});
+		run("unpackPosition" + suffix, [&]() {
+			sink = std::size_t(unpackPosition(packed).hash);
+		});
+
+		run("Game::render" + suffix, [&]() {
+			game.render(renderTexture);
+			renderTexture.display();
+		});
+	}
+}
+
+static void writeJsonString(std::ostream& out, const std::string& s) {
+	out << '"';
+	for (char c : s) {
+		if (c == '"' || c == '\\') out << '\\';
+		out << c;
+	}
+	out << '"';
+}
+
+void GameBenchmark::writeJson(std::ostream& out) const {
+	auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+
+	out << "{\n";
+	out << "  \"context\": {\n";
+	out << "    \"date\": " << now << ",\n";
+	out << "    \"executable\": \"Benchmark\",\n";
+	out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << "\n";
+	out << "  },\n";
+	out << "  \"benchmarks\": [\n";
+	for (std::size_t i = 0; i < results.size(); ++i) {
+		auto& r = results[i];
+		out << "    {\"name\": ";
+		writeJsonString(out, r.name);
+		out << ", \"run_type\": \"iteration\", \"iterations\": " << r.iterations
+			<< ", \"real_time\": " << r.realTime
+			<< ", \"cpu_time\": " << r.realTime
+			<< ", \"time_unit\": \"ns\"}" << (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	out << "  ]\n";
+	out << "}\n";
+}
+
+int main(int argc, char** argv)
+{
+	std::string filter;
+	std::string outPath;
+	double minTime = 0.5;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg.rfind("--filter=", 0) == 0) filter = arg.substr(9);
+		else if (arg.rfind("--min_time=", 0) == 0) minTime = std::stod(arg.substr(11));
+		else if (arg.rfind("--out=", 0) == 0) outPath = arg.substr(6);
+	}
+
+	GameBenchmark benchmark(filter, minTime);
+	benchmark.runAll();
+
+	if (outPath.empty())
+		benchmark.writeJson(std::cout);
+	else {
+		std::ofstream out(outPath);
+		benchmark.writeJson(out);
+	}
+
+	return 0;
+}
@@ -0,0 +1,177 @@
+/*
+	Removes duplicate positions from FEN or EPD lines, against an on-disk PositionSet that persists between runs.
+
+	Lines are read from the standard input and the ones whose position (placement and side to move) was not seen
+	before, in this run or any earlier run on the same set, are written to the standard output unchanged. The set
+	grows on its own, --capacity only saves the first doublings. Counts go to the standard error. Positions that
+	cannot be packed, without both kings or with more than 32 pieces, are counted as invalid and left out.
+	--check packs a few fixed positions, malformed ones included, grows a set through a few doublings and exits
+	non-zero if anything comes out wrong.
+
+	usage: Dedup --set=<file> [--capacity=<positions>] < positions.epd > unique.epd
+	       Dedup --check
+*/
+
+#include "../PackedPosition.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+struct CheckCase
+{
+	const char* fen;
+	bool packable;
+};
+
+static const CheckCase checkCases[] = {
+	{ "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w - - 0 1", true },
+	{ "r1bqk2r/pppp1Bpp/2n2n2/2b1p3/4P3/5N2/PPPP1PPP/RNBQK2R b - - 7 4", true },
+	{ "8/8/8/4k3/8/8/3K4/4R3 b - - 0 1", true },
+	// 33 pieces, then 64: they used to be packed past the pieces
+	{ "rnbqkbnr/pppppppp/8/8/8/7P/PPPPPPPP/RNBQKBNR w - - 0 1", false },
+	{ "qqqqkqqq/qqqqqqqq/qqqqqqqq/qqqqqqqq/QQQQQQQQ/QQQQQQQQ/QQQQQQQQ/QQQQKQQQ w - - 0 1", false },
+	// no occupancy is the empty slot of the set, and no king is no position
+	{ "8/8/8/8/8/8/8/8 w - - 0 1", false },
+	{ "8/8/8/4k3/8/8/8/8 w - - 0 1", false },
+};
+
+static bool runChecks() {
+	PositionSet set;
+	std::string setPath = "dedup-check.set";
+	std::remove(setPath.c_str());
+	if (!set.open(setPath, 16)) {
+		std::cout << "Failed to open " << setPath << "\n";
+		return false;
+	}
+
+	int failed = 0;
+	for (const CheckCase& test : checkCases) {
+		Position position;
+		if (!position.loadFen(test.fen)) {
+			std::cout << "FAIL " << test.fen << ": not loaded\n";
+			++failed;
+			continue;
+		}
+
+		PackedPosition packed = packPosition(position);
+		bool ok = isPackable(position) == test.packable;
+		if (test.packable) {
+			Position unpacked = unpackPosition(packed);
+			ok = ok && unpacked.squares == position.squares && unpacked.hash == position.hash && unpacked.turn == position.turn
+				&& unpacked.kings == position.kings && set.insert(packed) && !set.insert(packed) && set.contains(packed);
+		}
+		else {
+			ok = ok && packed == PackedPosition{} && !set.insert(packed);
+		}
+
+		if (!ok) ++failed;
+		std::cout << (ok ? "ok   " : "FAIL ") << test.fen << "\n";
+	}
+
+	// enough random positions for a few doublings, all still there after a reopen
+	std::mt19937 rng(1);
+	std::vector<PackedPosition> inserted;
+	Position position;
+	position.loadFen(checkCases[0].fen);
+	while (inserted.size() < 500) {
+		MoveList list;
+		position.generateLegalMoves(list);
+		if (!list.size || position.halfmoveClock >= 100) position.loadFen(checkCases[0].fen);
+		else position.makeMove(list.moves[rng() % list.size]);
+		if (set.insert(packPosition(position))) inserted.push_back(packPosition(position));
+	}
+	std::uint64_t slotCount = set.getSlotCount();
+
+	set.close();
+	bool grown = set.open(setPath) && slotCount > 32 && set.getSlotCount() == slotCount && set.getCount() == inserted.size() + 3;
+	for (const PackedPosition& packed : inserted)
+		grown = grown && set.contains(packed);
+	if (!grown) ++failed;
+	std::cout << (grown ? "ok   " : "FAIL ") << inserted.size() << " positions inserted through " << slotCount << " slots and reopened\n";
+
+	// anything that is not a set is left alone, even when too short for a header
+	std::string otherPath = "dedup-check.txt";
+	std::ofstream(otherPath) << "not a set\n";
+	bool refused = !PositionSet().open(otherPath);
+	std::ifstream other(otherPath);
+	std::string line;
+	refused = refused && std::getline(other, line) && line == "not a set";
+	other.close();
+	std::remove(otherPath.c_str());
+	if (!refused) ++failed;
+	std::cout << (refused ? "ok   " : "FAIL ") << "a short file that is not a set is refused\n";
+
+	set.close();
+	std::remove(setPath.c_str());
+	return failed == 0;
+}
+
+int main(int argc, char** argv)
+{
+	std::string setPath;
+	std::uint64_t capacity = 1 << 20;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		std::size_t eq = arg.find('=');
+		std::string key = arg.substr(0, eq);
+		std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+		bool ok = true;
+		if (key == "--check") return runChecks() ? 0 : 1;
+		else if (key == "--set") setPath = value;
+		else if (key == "--capacity") ok = (capacity = std::stoull(value)) > 0;
+		else ok = false;
+
+		if (!ok) {
+			std::cout << "Invalid argument " << arg << "\n";
+			return 1;
+		}
+	}
+
+	if (setPath.empty()) {
+		std::cout << "usage: Dedup --set=<file> [--capacity=<positions>] < positions.epd > unique.epd\n"
+			"       Dedup --check\n";
+		return 1;
+	}
+
+	PositionSet set;
+	if (!set.open(setPath, capacity)) {
+		std::cerr << "Failed to open " << setPath << "\n";
+		return 1;
+	}
+
+	std::ios::sync_with_stdio(false);
+	auto start = std::chrono::steady_clock::now();
+	std::uint64_t read = 0, unique = 0, invalid = 0;
+	Position position;
+
+	for (std::string line; std::getline(std::cin, line);) {
+		if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+		++read;
+
+		if (!position.loadFen(line) || !isPackable(position)) {
+			++invalid;
+			continue;
+		}
+		if (!set.insert(packPosition(position))) {
+			if (!set.hasFailed()) continue;
+			// the rest would all look like duplicates
+			std::cerr << "Failed to grow " << setPath << " after " << read << " positions\n";
+			return 1;
+		}
+
+		++unique;
+		std::cout << line << "\n";
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cerr << read << " positions, " << unique << " new, " << invalid << " invalid, " << set.getCount() << " in the set, "
+		<< std::int64_t(read / std::max(seconds, 1e-9)) << " positions/s\n";
+	return 0;
+}
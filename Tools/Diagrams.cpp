@@ -0,0 +1,265 @@
+/*
+	Headless board diagram renderer.
+
+	Reads one FEN per line from stdin and writes a PNG diagram of every position, on all cores.
+	Diagrams are composited on the CPU straight into an RGBA buffer, so no window or GL context is needed:
+	the pieces sprite sheet is scaled to the tile size once, then every piece is alpha blended over its tile.
+
+	usage: Diagrams [--out=<directory>] [--size=<tile pixels>] [--concurrency=<n>] < positions.fen
+	diagrams are named after the line of the position, <directory>/000001.png for the first line
+*/
+
+#include "../Engine.h"
+#include "../Assets.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DIAGRAMS_SSE2 1
+#else
+#define DIAGRAMS_SSE2 0
+#endif
+
+struct DiagramOptions
+{
+	std::string outDirectory = ".";
+	int tileSize = 48;
+	int concurrency = 0;
+};
+
+// Same colors as the tiles of Game::initUI
+static const std::uint8_t lightTile[4] = { 231, 198, 165, 255 };
+static const std::uint8_t darkTile[4] = { 88, 50, 11, 255 };
+
+/*
+	BLENDING
+*/
+
+// x / 255 rounded, exact for x <= 255 * 255
+static inline unsigned divide255(unsigned x) {
+	x += 128;
+	return (x + (x >> 8)) >> 8;
+}
+
+// dst = src + dst * (1 - src alpha), src is premultiplied and dst is opaque
+static void blendRow(std::uint8_t* dst, const std::uint8_t* src, int pixels) {
+	int i = 0;
+#if DIAGRAMS_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i full = _mm_set1_epi16(255);
+	const __m128i half = _mm_set1_epi16(128);
+
+	// 4 pixels at a time, each half of the register widened to 16 bit channels
+	for (; i + 4 <= pixels; i += 4) {
+		__m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+		__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i * 4));
+
+		__m128i sLo = _mm_unpacklo_epi8(s, zero), sHi = _mm_unpackhi_epi8(s, zero);
+		__m128i dLo = _mm_unpacklo_epi8(d, zero), dHi = _mm_unpackhi_epi8(d, zero);
+
+		// broadcast the alpha of every pixel to its four channels
+		__m128i aLo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sLo, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+		__m128i aHi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(sHi, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+
+		__m128i pLo = _mm_add_epi16(_mm_mullo_epi16(dLo, _mm_sub_epi16(full, aLo)), half);
+		__m128i pHi = _mm_add_epi16(_mm_mullo_epi16(dHi, _mm_sub_epi16(full, aHi)), half);
+		pLo = _mm_srli_epi16(_mm_add_epi16(pLo, _mm_srli_epi16(pLo, 8)), 8);
+		pHi = _mm_srli_epi16(_mm_add_epi16(pHi, _mm_srli_epi16(pHi, 8)), 8);
+
+		__m128i out = _mm_packus_epi16(_mm_add_epi16(sLo, pLo), _mm_add_epi16(sHi, pHi));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), out);
+	}
+#endif
+	for (; i < pixels; ++i) {
+		unsigned inverse = 255 - src[i * 4 + 3];
+		for (int c = 0; c < 4; ++c)
+			dst[i * 4 + c] = std::uint8_t(src[i * 4 + c] + divide255(dst[i * 4 + c] * inverse));
+	}
+}
+
+/*
+	RENDERER
+*/
+
+class DiagramRenderer
+{
+private:
+	int tileSize;
+	// premultiplied RGBA sprites of every piece code, indexed by code + 6
+	std::array<std::vector<std::uint8_t>, 13> sprites;
+	// one pixel row of the empty board starting with a light and with a dark tile
+	std::array<std::vector<std::uint8_t>, 2> tileRows;
+public:
+	explicit DiagramRenderer(int tileSize);
+
+	bool loadSprites(const sf::Image& sheet);
+	int getImageSize() const { return tileSize * 8; }
+	void render(const Position& position, std::vector<std::uint8_t>& pixels) const;
+};
+
+DiagramRenderer::DiagramRenderer(int tileSize) : tileSize{ tileSize } {
+	for (int parity = 0; parity < 2; ++parity) {
+		tileRows[parity].resize(std::size_t(getImageSize()) * 4);
+		for (int x = 0; x < getImageSize(); ++x) {
+			const std::uint8_t* color = ((x / tileSize + parity) % 2 == 0) ? lightTile : darkTile;
+			std::copy(color, color + 4, &tileRows[parity][std::size_t(x) * 4]);
+		}
+	}
+}
+
+// Box filters the 426 pixels sprites of the sheet (the layout of Pieces.cpp) down to the tile size
+bool DiagramRenderer::loadSprites(const sf::Image& sheet) {
+	const int spriteSize = 426;
+	if (sheet.getSize().x < unsigned(spriteSize * 6) || sheet.getSize().y < unsigned(spriteSize * 2)) return false;
+
+	const std::uint8_t* source = sheet.getPixelsPtr();
+	const int stride = sheet.getSize().x * 4;
+
+	for (int color = 0; color < 2; ++color) {
+		for (int type = KING; type <= PAWN; ++type) {
+			std::vector<std::uint8_t>& sprite = sprites[pieceCode(PieceColor(color), PieceType(type)) + 6];
+			sprite.assign(std::size_t(tileSize) * tileSize * 4, 0);
+
+			for (int y = 0; y < tileSize; ++y) {
+				int y0 = y * spriteSize / tileSize, y1 = std::max((y + 1) * spriteSize / tileSize, y0 + 1);
+				for (int x = 0; x < tileSize; ++x) {
+					int x0 = x * spriteSize / tileSize, x1 = std::max((x + 1) * spriteSize / tileSize, x0 + 1);
+
+					double sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+					for (int sy = y0; sy < y1; ++sy) {
+						const std::uint8_t* p = source + (color * spriteSize + sy) * stride + (type * spriteSize + x0) * 4;
+						for (int sx = x0; sx < x1; ++sx, p += 4) {
+							double alpha = p[3] / 255.0;
+							sum[0] += p[0] * alpha;
+							sum[1] += p[1] * alpha;
+							sum[2] += p[2] * alpha;
+							sum[3] += p[3];
+						}
+					}
+
+					double count = double(y1 - y0) * (x1 - x0);
+					std::uint8_t* out = &sprite[(std::size_t(y) * tileSize + x) * 4];
+					for (int c = 0; c < 4; ++c)
+						out[c] = std::uint8_t(std::min(sum[c] / count + 0.5, 255.0));
+				}
+			}
+		}
+	}
+	return true;
+}
+
+void DiagramRenderer::render(const Position& position, std::vector<std::uint8_t>& pixels) const {
+	const int size = getImageSize();
+	const std::size_t stride = std::size_t(size) * 4;
+	pixels.resize(stride * size);
+
+	for (int y = 0; y < size; ++y) {
+		const std::vector<std::uint8_t>& row = tileRows[(y / tileSize) % 2];
+		std::copy(row.begin(), row.end(), pixels.begin() + y * stride);
+	}
+
+	for (int square = 0; square < 64; ++square) {
+		int code = position.squares[square];
+		if (!code) continue;
+
+		const std::uint8_t* sprite = sprites[code + 6].data();
+		std::uint8_t* dst = &pixels[(square / 8) * tileSize * stride + std::size_t(square % 8) * tileSize * 4];
+		for (int y = 0; y < tileSize; ++y)
+			blendRow(dst + y * stride, sprite + std::size_t(y) * tileSize * 4, tileSize);
+	}
+}
+
+/*
+	BATCH
+*/
+
+int main(int argc, char** argv)
+{
+	DiagramOptions options;
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		std::size_t eq = arg.find('=');
+		std::string key = arg.substr(0, eq);
+		std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+		bool ok = true;
+		if (key == "--out") options.outDirectory = value;
+		else if (key == "--size") ok = (options.tileSize = std::stoi(value)) > 0;
+		else if (key == "--concurrency") options.concurrency = std::stoi(value);
+		else ok = false;
+
+		if (!ok) {
+			std::cout << "Invalid argument " << arg << "\n";
+			std::cout << "usage: Diagrams [--out=<directory>] [--size=<tile pixels>] [--concurrency=<n>] < positions.fen\n";
+			return 1;
+		}
+	}
+
+	sf::Image sheet;
+	DiagramRenderer renderer(options.tileSize);
+	if (!sheet.loadFromMemory(piecesTextureAsset.data, piecesTextureAsset.size) || !renderer.loadSprites(sheet)) {
+		std::cout << "Failed to load pieces texture\n";
+		return 1;
+	}
+
+	std::vector<std::string> fens;
+	for (std::string line; std::getline(std::cin, line);)
+		fens.push_back(line);
+
+	auto start = std::chrono::steady_clock::now();
+
+	std::atomic<std::size_t> next(0);
+	std::atomic<int> written(0), failed(0);
+	auto worker = [&] {
+		// buffers are reused for every diagram of the thread
+		std::vector<std::uint8_t> pixels;
+		sf::Image image;
+		Position position;
+		char name[32];
+
+		for (std::size_t i = next++; i < fens.size(); i = next++) {
+			if (fens[i].find_first_not_of(" \t\r") == std::string::npos) continue;
+
+			if (!position.loadFen(fens[i])) {
+				std::fprintf(stderr, "line %zu: invalid FEN\n", i + 1);
+				++failed;
+				continue;
+			}
+
+			renderer.render(position, pixels);
+			image.create(renderer.getImageSize(), renderer.getImageSize(), pixels.data());
+
+			std::snprintf(name, sizeof(name), "/%06zu.png", i + 1);
+			if (!image.saveToFile(options.outDirectory + name)) {
+				std::fprintf(stderr, "line %zu: failed to write %s%s\n", i + 1, options.outDirectory.c_str(), name);
+				++failed;
+				continue;
+			}
+			++written;
+		}
+	};
+
+	int concurrency = options.concurrency > 0 ? options.concurrency : int(std::thread::hardware_concurrency());
+	std::vector<std::thread> threads;
+	for (int i = 0; i < std::max(concurrency, 1); ++i)
+		threads.emplace_back(worker);
+	for (auto& thread : threads)
+		thread.join();
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << written << " diagrams in " << seconds << " s (" << (seconds > 0.0 ? written / seconds : 0.0) << " per second)";
+	if (failed) std::cout << ", " << failed << " failed";
+	std::cout << "\n";
+
+	return failed ? 1 : 0;
+}
@@ -0,0 +1,490 @@
+/*
+	Distributed analysis over TCP.
+
+	A coordinator splits a job into shards and hands them out to the worker processes that connect to it, one shard
+	per worker at a time, so faster workers simply get more of them. Workers can join at any time. The shard of a
+	worker that disconnects, or that takes longer than --timeout, goes back to the queue and the first result that
+	comes back for a shard wins. Results are merged in the order of the input.
+
+	Jobs:
+	- analysis of every position of an EPD file, written to --out (or stdout) as the FEN followed by the best move,
+	  score, depth and nodes, --shard positions per shard, searched to --depth (8 without --depth and --nodes)
+	- perft of a FEN, split into the subtrees --split plies below the root, --shard subtrees per shard; subtrees
+	  that are the same position are only counted once and multiplied
+
+	usage: Distributed --coordinator [--port=<n>] [--timeout=<seconds>] [--shard=<n>]
+			(--epd=<file> [--depth=<n>] [--nodes=<n>] [--out=<file>] | --perft=<fen> --depth=<n> [--split=<n>])
+		Distributed --worker [--host=<address>] [--port=<n>] [--hash=<MB>]
+	e.g. on localhost: Distributed --coordinator --perft="<fen>" --depth=6 & then start Distributed --worker N times
+*/
+
+#include "../Engine.h"
+
+#include <SFML/Network.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum MessageType {
+	MESSAGE_JOB = 0,	// coordinator -> worker: a shard to work on
+	MESSAGE_RESULT,		// worker -> coordinator: the results of its shard
+	MESSAGE_QUIT		// coordinator -> worker: everything is done
+};
+
+enum JobType {
+	JOB_ANALYSIS = 0,
+	JOB_PERFT
+};
+
+struct Shard
+{
+	std::vector<std::string> fens;
+	std::vector<std::uint64_t> multiplicities;	// perft only, how many subtrees lead to the position
+};
+
+// Result of one position of a shard, perft only uses nodes
+struct ItemResult
+{
+	std::string bestMove;
+	std::int32_t score = 0;
+	std::int32_t depth = 0;
+	std::uint64_t nodes = 0;
+};
+
+struct DistributedOptions
+{
+	bool coordinator = false;
+	bool worker = false;
+	std::string host = "127.0.0.1";
+	unsigned short port = 5555;
+	int timeoutSeconds = 600;
+	int shardSize = 8;
+
+	std::string epdPath;
+	std::string outPath;
+	std::string perftFen;
+	int depth = 0;
+	std::int64_t nodes = 0;
+	int split = 2;
+	int hashSizeMb = 16;
+};
+
+/*
+	WORKER
+*/
+
+static std::vector<ItemResult> runShard(JobType type, int depth, std::int64_t nodes, const std::vector<std::string>& fens, Engine& engine) {
+	std::vector<ItemResult> results(fens.size());
+
+	for (std::size_t i = 0; i < fens.size(); ++i) {
+		Position position;
+		if (!position.loadFen(fens[i])) continue;
+
+		if (type == JOB_PERFT) {
+			results[i].nodes = position.perft(depth);
+			continue;
+		}
+
+		// every position on its own, so results do not depend on which worker got which shard
+		engine.clear();
+		SearchLimits limits;
+		limits.depth = depth;
+		limits.nodes = nodes;
+		SearchResult result = engine.search(position, limits);
+
+		results[i].bestMove = result.bestMove.isNull() ? "none" : result.bestMove.toString();
+		results[i].score = result.score;
+		results[i].depth = result.depth;
+		results[i].nodes = std::uint64_t(result.nodes);
+	}
+
+	return results;
+}
+
+static int runWorker(const DistributedOptions& options) {
+	EngineOptions engineOptions;
+	engineOptions.hashSizeMb = options.hashSizeMb;
+	Engine engine(engineOptions);
+
+	// the coordinator may not be listening yet
+	sf::TcpSocket socket;
+	int attempts = 0;
+	while (socket.connect(sf::IpAddress(options.host), options.port, sf::seconds(5)) != sf::Socket::Done) {
+		if (++attempts == 30) {
+			std::cout << "Failed to connect to " << options.host << ":" << options.port << "\n";
+			return 1;
+		}
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+	}
+
+	int shards = 0;
+	while (true) {
+		sf::Packet packet;
+		if (socket.receive(packet) != sf::Socket::Done) break;
+
+		sf::Uint8 message;
+		packet >> message;
+		if (message != MESSAGE_JOB) break;
+
+		sf::Uint8 type;
+		sf::Uint32 shard, count;
+		sf::Int32 depth;
+		sf::Int64 nodes;
+		packet >> type >> shard >> depth >> nodes >> count;
+
+		std::vector<std::string> fens(count);
+		for (auto& fen : fens)
+			packet >> fen;
+		if (!packet) break;
+
+		std::vector<ItemResult> results = runShard(JobType(type), depth, nodes, fens, engine);
+
+		sf::Packet reply;
+		reply << sf::Uint8(MESSAGE_RESULT) << shard << sf::Uint32(results.size());
+		for (const ItemResult& result : results)
+			reply << result.bestMove << result.score << result.depth << sf::Uint64(result.nodes);
+		if (socket.send(reply) != sf::Socket::Done) break;
+		++shards;
+	}
+
+	std::cout << "Worker done, " << shards << " shards\n";
+	return 0;
+}
+
+/*
+	COORDINATOR
+*/
+
+class Coordinator
+{
+private:
+	struct Connection
+	{
+		std::unique_ptr<sf::TcpSocket> socket;
+		int shard = -1;	// -1 = idle
+		std::chrono::steady_clock::time_point start;
+		bool requeued = false;	// the shard already went back to pending, after a timeout
+	};
+
+	const DistributedOptions& options;
+	JobType type;
+	int depth;
+	std::vector<Shard> shards;
+
+	std::deque<int> pending;
+	std::vector<bool> done;
+	std::vector<std::vector<ItemResult>> results;
+	int remaining;
+	int retried;
+
+	sf::TcpListener listener;
+	sf::SocketSelector selector;
+	std::vector<Connection> connections;
+
+	void assign(Connection& connection);
+	bool receive(Connection& connection);
+	void requeue(int shard);
+	// Once per assignment, a slow worker that keeps running its shard is not counted again and again
+	void requeue(Connection& connection);
+public:
+	Coordinator(const DistributedOptions& options, JobType type, int depth, std::vector<Shard> shards);
+
+	bool run();
+	const std::vector<Shard>& getShards() const { return shards; }
+	const std::vector<std::vector<ItemResult>>& getResults() const { return results; }
+};
+
+Coordinator::Coordinator(const DistributedOptions& options, JobType type, int depth, std::vector<Shard> shards)
+	: options{ options }, type{ type }, depth{ depth }, shards{ std::move(shards) } {
+	for (int i = 0; i < int(this->shards.size()); ++i)
+		pending.push_back(i);
+	done.assign(this->shards.size(), false);
+	results.resize(this->shards.size());
+	remaining = int(this->shards.size());
+	retried = 0;
+}
+
+void Coordinator::assign(Connection& connection) {
+	// requeued shards can have been finished by their first worker in the meantime
+	while (!pending.empty() && done[pending.front()])
+		pending.pop_front();
+	if (pending.empty()) return;
+
+	int shard = pending.front();
+	pending.pop_front();
+
+	sf::Packet packet;
+	packet << sf::Uint8(MESSAGE_JOB) << sf::Uint8(type) << sf::Uint32(shard) << sf::Int32(depth)
+		<< sf::Int64(options.nodes) << sf::Uint32(shards[shard].fens.size());
+	for (const std::string& fen : shards[shard].fens)
+		packet << fen;
+
+	connection.shard = shard;
+	connection.start = std::chrono::steady_clock::now();
+	connection.requeued = false;
+	// the worker is gone, the selector reports the disconnect on the next wait
+	if (connection.socket->send(packet) != sf::Socket::Done) {
+		requeue(shard);
+		connection.shard = -1;
+	}
+}
+
+void Coordinator::requeue(int shard) {
+	if (shard < 0 || done[shard]) return;
+	// retries go first, the end of the job waits for them
+	pending.push_front(shard);
+	++retried;
+}
+
+void Coordinator::requeue(Connection& connection) {
+	if (connection.requeued) return;
+	requeue(connection.shard);
+	connection.requeued = true;
+}
+
+// False when the worker is gone
+bool Coordinator::receive(Connection& connection) {
+	sf::Packet packet;
+	if (connection.socket->receive(packet) != sf::Socket::Done) {
+		requeue(connection);
+		return false;
+	}
+
+	sf::Uint8 message;
+	sf::Uint32 shard, count;
+	packet >> message >> shard >> count;
+	if (!packet || message != MESSAGE_RESULT || shard >= shards.size() || count != shards[shard].fens.size()) {
+		std::cout << "Invalid message from " << connection.socket->getRemoteAddress().toString() << "\n";
+		requeue(connection);
+		return false;
+	}
+
+	std::vector<ItemResult> items(count);
+	for (ItemResult& item : items) {
+		sf::Uint64 nodes;
+		packet >> item.bestMove >> item.score >> item.depth >> nodes;
+		item.nodes = nodes;
+	}
+	if (!packet) {
+		requeue(connection);
+		return false;
+	}
+
+	if (!done[shard]) {
+		done[shard] = true;
+		results[shard] = std::move(items);
+		--remaining;
+
+		int finished = int(shards.size()) - remaining;
+		if (finished % 10 == 0 || !remaining)
+			std::cerr << finished << "/" << shards.size() << " shards, " << connections.size() << " workers, " << retried << " retried\n";
+	}
+
+	connection.shard = -1;
+	return true;
+}
+
+bool Coordinator::run() {
+	if (listener.listen(options.port) != sf::Socket::Done) {
+		std::cout << "Failed to listen on port " << options.port << "\n";
+		return false;
+	}
+	selector.add(listener);
+	std::cerr << "Listening on port " << options.port << ", " << shards.size() << " shards\n";
+
+	while (remaining > 0) {
+		if (selector.wait(sf::milliseconds(200))) {
+			if (selector.isReady(listener)) {
+				Connection connection;
+				connection.socket = std::make_unique<sf::TcpSocket>();
+				if (listener.accept(*connection.socket) == sf::Socket::Done) {
+					selector.add(*connection.socket);
+					connections.push_back(std::move(connection));
+				}
+			}
+
+			for (std::size_t i = 0; i < connections.size();) {
+				if (selector.isReady(*connections[i].socket) && !receive(connections[i])) {
+					selector.remove(*connections[i].socket);
+					connections.erase(connections.begin() + i);
+					continue;
+				}
+				++i;
+			}
+		}
+
+		// a hung worker keeps its connection, its shard is handed to the next idle one
+		auto now = std::chrono::steady_clock::now();
+		for (Connection& connection : connections) {
+			if (connection.shard < 0 || now - connection.start <= std::chrono::seconds(options.timeoutSeconds)) continue;
+			// a shard that was already handed on is just long, not hung on every worker
+			bool handedOn = std::any_of(connections.begin(), connections.end(), [&connection](const Connection& other) {
+				return &other != &connection && other.shard == connection.shard;
+			});
+			if (!handedOn) requeue(connection);
+		}
+
+		for (Connection& connection : connections) {
+			if (connection.shard < 0) assign(connection);
+		}
+	}
+
+	for (Connection& connection : connections) {
+		sf::Packet packet;
+		packet << sf::Uint8(MESSAGE_QUIT);
+		connection.socket->send(packet);
+	}
+	return true;
+}
+
+static std::vector<std::string> readEpd(const std::string& path) {
+	std::vector<std::string> fens;
+	std::ifstream in(path);
+	for (std::string line; std::getline(in, line);) {
+		Position position;
+		if (line.find_first_not_of(" \t\r") != std::string::npos && position.loadFen(line))
+			fens.push_back(position.toFen());
+	}
+	return fens;
+}
+
+// Positions split plies below the root, with the number of move sequences that lead to each of them
+static void splitPerft(Position& position, int split, std::map<std::string, std::uint64_t>& subtrees, std::vector<std::string>& order) {
+	if (split == 0) {
+		std::string fen = position.toFen();
+		if (subtrees[fen]++ == 0) order.push_back(fen);
+		return;
+	}
+
+	MoveList list;
+	position.generateLegalMoves(list);
+	for (Move m : list) {
+		UndoInfo undo = position.makeMove(m);
+		splitPerft(position, split - 1, subtrees, order);
+		position.unmakeMove(m, undo);
+	}
+}
+
+static int runCoordinator(const DistributedOptions& options) {
+	JobType type = options.perftFen.empty() ? JOB_ANALYSIS : JOB_PERFT;
+	std::vector<std::string> fens;
+	std::vector<std::uint64_t> multiplicities;
+	int depth = options.depth;
+
+	if (type == JOB_PERFT) {
+		Position root;
+		if (!root.loadFen(options.perftFen) || options.depth < 1) {
+			std::cout << "Invalid perft position or depth\n";
+			return 1;
+		}
+
+		int split = std::min(options.split, options.depth - 1);
+		std::map<std::string, std::uint64_t> subtrees;
+		splitPerft(root, split, subtrees, fens);
+		for (const std::string& fen : fens)
+			multiplicities.push_back(subtrees[fen]);
+		depth = options.depth - split;
+	}
+	else {
+		if (!depth && !options.nodes) depth = 8;
+		fens = readEpd(options.epdPath);
+		if (fens.empty()) {
+			std::cout << "No positions in " << options.epdPath << "\n";
+			return 1;
+		}
+	}
+
+	std::vector<Shard> shards;
+	for (std::size_t i = 0; i < fens.size(); i += options.shardSize) {
+		Shard shard;
+		std::size_t end = std::min(fens.size(), i + options.shardSize);
+		shard.fens.assign(fens.begin() + i, fens.begin() + end);
+		if (type == JOB_PERFT) shard.multiplicities.assign(multiplicities.begin() + i, multiplicities.begin() + end);
+		shards.push_back(std::move(shard));
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	Coordinator coordinator(options, type, depth, std::move(shards));
+	if (!coordinator.run()) return 1;
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	std::uint64_t totalNodes = 0;
+	const auto& results = coordinator.getResults();
+
+	if (type == JOB_PERFT) {
+		for (std::size_t s = 0; s < results.size(); ++s) {
+			for (std::size_t i = 0; i < results[s].size(); ++i)
+				totalNodes += results[s][i].nodes * coordinator.getShards()[s].multiplicities[i];
+		}
+		std::cout << "perft " << options.depth << ": " << totalNodes << "\n";
+	}
+	else {
+		std::ofstream file;
+		if (!options.outPath.empty()) file.open(options.outPath);
+		std::ostream& out = options.outPath.empty() ? std::cout : file;
+
+		for (std::size_t s = 0; s < results.size(); ++s) {
+			for (std::size_t i = 0; i < results[s].size(); ++i) {
+				const ItemResult& item = results[s][i];
+				out << coordinator.getShards()[s].fens[i] << " bm " << item.bestMove << "; ce " << item.score
+					<< "; acd " << item.depth << "; acn " << item.nodes << ";\n";
+				totalNodes += item.nodes;
+			}
+		}
+	}
+
+	std::cerr << totalNodes << " nodes in " << seconds << " s, " << std::uint64_t(totalNodes / std::max(seconds, 1e-9)) << " nodes/s\n";
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	DistributedOptions options;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		std::size_t eq = arg.find('=');
+		std::string key = arg.substr(0, eq);
+		std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+		bool ok = true;
+		if (key == "--coordinator") options.coordinator = true;
+		else if (key == "--worker") options.worker = true;
+		else if (key == "--host") options.host = value;
+		else if (key == "--port") options.port = (unsigned short)std::stoi(value);
+		else if (key == "--timeout") ok = (options.timeoutSeconds = std::stoi(value)) > 0;
+		else if (key == "--shard") ok = (options.shardSize = std::stoi(value)) > 0;
+		else if (key == "--epd") options.epdPath = value;
+		else if (key == "--out") options.outPath = value;
+		else if (key == "--perft") options.perftFen = value;
+		else if (key == "--depth") options.depth = std::stoi(value);
+		else if (key == "--nodes") options.nodes = std::stoll(value);
+		else if (key == "--split") ok = (options.split = std::stoi(value)) >= 0;
+		else if (key == "--hash") options.hashSizeMb = std::stoi(value);
+		else ok = false;
+
+		if (!ok) {
+			std::cout << "Invalid argument " << arg << "\n";
+			return 1;
+		}
+	}
+
+	if (options.worker)
+		return runWorker(options);
+	if (options.coordinator && (!options.epdPath.empty() || !options.perftFen.empty()))
+		return runCoordinator(options);
+
+	std::cout << "usage: Distributed --coordinator [--port=<n>] [--timeout=<seconds>] [--shard=<n>]\n"
+		"\t\t(--epd=<file> [--depth=<n>] [--nodes=<n>] [--out=<file>] | --perft=<fen> --depth=<n> [--split=<n>])\n"
+		"\tDistributed --worker [--host=<address>] [--port=<n>] [--hash=<MB>]\n";
+	return 1;
+}
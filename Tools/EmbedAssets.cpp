@@ -0,0 +1,69 @@
+/*
+	Generates Assets.cpp, which compiles the game assets into the executable so startup does not touch the disk.
+	Run it from the repository root whenever a file of Textures/ or Fonts/ changes, the output is committed.
+
+	usage: EmbedAssets [--out=<file>]
+*/
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+struct AssetFile
+{
+	const char* name;	// name of the EmbeddedAsset in Assets.h
+	const char* path;
+};
+
+static const AssetFile assetFiles[] = {
+	{ "piecesTextureAsset", "Textures/pieces.png" },
+	{ "fontAsset", "Fonts/Pixel NES.otf" },
+};
+
+int main(int argc, char** argv)
+{
+	std::string outPath = "Assets.cpp";
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		if (arg.rfind("--out=", 0) == 0)
+			outPath = arg.substr(6);
+		else {
+			std::cout << "usage: EmbedAssets [--out=<file>]\n";
+			return 1;
+		}
+	}
+
+	std::ofstream out(outPath, std::ios::binary);
+	if (!out) {
+		std::cout << "Failed to open " << outPath << "\n";
+		return 1;
+	}
+
+	out << "// Generated by Tools/EmbedAssets.cpp, do not edit\n\n";
+	out << "#include \"Assets.h\"\n";
+
+	for (const AssetFile& asset : assetFiles) {
+		std::ifstream in(asset.path, std::ios::binary);
+		if (!in) {
+			std::cout << "Failed to open " << asset.path << "\n";
+			return 1;
+		}
+		std::vector<unsigned char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+		// arrays rather than string literals, MSVC limits the length of a literal
+		out << "\n// " << asset.path << "\n";
+		out << "static const unsigned char " << asset.name << "Data[] = {";
+		for (std::size_t i = 0; i < bytes.size(); ++i) {
+			if (i % 24 == 0) out << "\n\t";
+			out << int(bytes[i]) << ",";
+		}
+		out << "\n};\n";
+		out << "const EmbeddedAsset " << asset.name << " = { " << asset.name << "Data, sizeof(" << asset.name << "Data) };\n";
+
+		std::cout << asset.path << ": " << bytes.size() << " bytes\n";
+	}
+
+	return 0;
+}
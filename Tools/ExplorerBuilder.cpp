@@ -0,0 +1,420 @@
+/*
+	Builds the opening explorer index (Explorer.h) from PGN archives.
+
+	Every game is replayed through the rules from its first move (or its FEN tag) and each position of its
+	opening is keyed by hash together with the move played and the game result. Games are parsed on all cores,
+	every thread sorts and sums its own positions, and the sorted runs are merged into the index file.
+	Games leave the rules at the first castling, promotion or en passant, their moves up to there still count.
+
+	usage: ExplorerBuilder [--out=<file>] [--plies=<n>] [--concurrency=<n>] <games.pgn>...
+*/
+
+#include "../Explorer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct BuilderOptions
+{
+	std::string outPath = "explorer.idx";
+	int maxPlies = 40;
+	int concurrency = 0;
+	std::vector<std::string> pgnPaths;
+};
+
+// Result of a game as stored in the index
+enum GameOutcome {
+	WHITE_WINS = 0,
+	DRAWN,
+	BLACK_WINS,
+	UNKNOWN
+};
+
+struct GameText
+{
+	const char* begin;
+	const char* end;
+};
+
+struct PositionRecord
+{
+	std::uint64_t hash;
+	std::int8_t from;
+	std::int8_t to;
+	std::uint8_t outcome;
+};
+
+static bool recordLess(const PositionRecord& a, const PositionRecord& b) {
+	if (a.hash != b.hash) return a.hash < b.hash;
+	if (a.from != b.from) return a.from < b.from;
+	return a.to < b.to;
+}
+
+static bool entryLess(const ExplorerEntry& a, const ExplorerEntry& b) {
+	if (a.hash != b.hash) return a.hash < b.hash;
+	if (a.from != b.from) return a.from < b.from;
+	return a.to < b.to;
+}
+
+static bool sameKey(const ExplorerEntry& a, const ExplorerEntry& b) {
+	return a.hash == b.hash && a.from == b.from && a.to == b.to;
+}
+
+/*
+	PGN
+*/
+
+// Splits an archive into games, a game starts at the first tag line that follows movetext
+static void splitGames(const char* data, std::size_t size, std::vector<GameText>& games) {
+	const char* end = data + size;
+	const char* gameStart = data;
+	bool movetext = false;
+
+	for (const char* line = data; line < end;) {
+		const char* next = static_cast<const char*>(std::memchr(line, '\n', end - line));
+		next = next ? next + 1 : end;
+
+		const char* first = line;
+		while (first < next && (*first == ' ' || *first == '\t' || *first == '\r' || *first == '\n')) ++first;
+
+		if (first < next) {
+			if (*first == '[' && movetext) {
+				games.push_back(GameText{ gameStart, line });
+				gameStart = line;
+				movetext = false;
+			}
+			else if (*first != '[')
+				movetext = true;
+		}
+		line = next;
+	}
+
+	if (movetext) games.push_back(GameText{ gameStart, end });
+}
+
+static GameOutcome parseOutcome(const std::string& token) {
+	if (token == "1-0") return WHITE_WINS;
+	if (token == "0-1") return BLACK_WINS;
+	if (token == "1/2-1/2") return DRAWN;
+	return UNKNOWN;
+}
+
+// Legal move of a SAN token, a null move when it is not one under the rules of the game
+static Move parseSan(Position& position, std::string san) {
+	while (!san.empty() && std::strchr("+#!?", san.back())) san.pop_back();
+	if (san.size() < 2 || san[0] == 'O' || san[0] == '0' || san.find('=') != std::string::npos) return nullMove;
+
+	PieceType type = PieceType::PAWN;
+	const char* pieceLetters = "KQBNR";
+	if (const char* letter = std::strchr(pieceLetters, san[0])) {
+		type = PieceType(letter - pieceLetters);
+		san.erase(0, 1);
+	}
+	san.erase(std::remove(san.begin(), san.end(), 'x'), san.end());
+	if (san.size() < 2) return nullMove;
+
+	char toFile = san[san.size() - 2], toRank = san[san.size() - 1];
+	if (toFile < 'a' || toFile > 'h' || toRank < '1' || toRank > '8') return nullMove;
+	int to = ('8' - toRank) * 8 + (toFile - 'a');
+
+	// disambiguation by file, rank or both
+	int fromFile = -1, fromRank = -1;
+	for (std::size_t i = 0; i + 2 < san.size(); ++i) {
+		if (san[i] >= 'a' && san[i] <= 'h') fromFile = san[i] - 'a';
+		else if (san[i] >= '1' && san[i] <= '8') fromRank = '8' - san[i];
+		else return nullMove;
+	}
+
+	MoveList list;
+	position.generateLegalMoves(list);
+
+	Move found = nullMove;
+	for (Move m : list) {
+		if (m.to != to || codeType(position.squares[m.from]) != type) continue;
+		if ((fromFile >= 0 && m.from % 8 != fromFile) || (fromRank >= 0 && m.from / 8 != fromRank)) continue;
+		// ambiguous
+		if (!found.isNull()) return nullMove;
+		found = m;
+	}
+	return found;
+}
+
+// Value of a tag line such as [Result "1-0"], empty when the line is another tag
+static std::string tagValue(const char* begin, const char* end, const char* name) {
+	std::size_t length = std::strlen(name);
+	if (end - begin < std::ptrdiff_t(length + 2) || std::strncmp(begin + 1, name, length) != 0 || begin[length + 1] != ' ') return "";
+
+	const char* open = static_cast<const char*>(std::memchr(begin, '"', end - begin));
+	if (!open) return "";
+	const char* close = static_cast<const char*>(std::memchr(open + 1, '"', end - open - 1));
+	return close ? std::string(open + 1, close) : "";
+}
+
+class GameReplay
+{
+private:
+	const BuilderOptions& options;
+public:
+	std::vector<PositionRecord> records;
+	std::size_t gamesReplayed = 0;
+	std::size_t gamesSkipped = 0;
+
+	explicit GameReplay(const BuilderOptions& options) : options{ options } {}
+
+	void replay(const GameText& game);
+};
+
+void GameReplay::replay(const GameText& game) {
+	Position position;
+	position.loadFen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w");
+	GameOutcome outcome = UNKNOWN;
+
+	std::vector<Move> moves;
+	bool playing = true;
+	int depth = 0;	// variation nesting
+
+	const char* p = game.begin;
+	while (p < game.end) {
+		char c = *p;
+
+		if (depth == 0 && c == '[') {
+			const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', game.end - p));
+			if (!lineEnd) lineEnd = game.end;
+
+			std::string value = tagValue(p, lineEnd, "Result");
+			if (!value.empty()) outcome = parseOutcome(value);
+			value = tagValue(p, lineEnd, "FEN");
+			if (!value.empty() && !position.loadFen(value)) playing = false;
+
+			p = lineEnd;
+			continue;
+		}
+
+		// comments don't nest, variations do
+		if (c == '{') {
+			const char* close = static_cast<const char*>(std::memchr(p, '}', game.end - p));
+			p = close ? close + 1 : game.end;
+			continue;
+		}
+		if (c == '(') ++depth;
+		else if (c == ')' && depth > 0) --depth;
+		if (depth > 0 || c == ')' || std::isspace(static_cast<unsigned char>(c))) {
+			++p;
+			continue;
+		}
+		if (c == ';') {
+			const char* lineEnd = static_cast<const char*>(std::memchr(p, '\n', game.end - p));
+			p = lineEnd ? lineEnd : game.end;
+			continue;
+		}
+
+		const char* tokenEnd = p;
+		while (tokenEnd < game.end && !std::isspace(static_cast<unsigned char>(*tokenEnd)) && !std::strchr("{}();", *tokenEnd))
+			++tokenEnd;
+		// a stray } of a broken game, skipped or it would be found again and again
+		if (tokenEnd == p) {
+			++p;
+			continue;
+		}
+		std::string token(p, tokenEnd);
+		p = tokenEnd;
+
+		// move numbers, possibly glued to the move as in 1.e4
+		std::size_t skip = 0;
+		while (skip < token.size() && (std::isdigit(static_cast<unsigned char>(token[skip])) || token[skip] == '.')) ++skip;
+		if (token[0] == '$' || token == "*" || parseOutcome(token) != UNKNOWN) {
+			if (parseOutcome(token) != UNKNOWN && outcome == UNKNOWN) outcome = parseOutcome(token);
+			continue;
+		}
+		token.erase(0, skip);
+		if (token.empty() || !playing || int(moves.size()) >= options.maxPlies) continue;
+
+		Move m = parseSan(position, token);
+		if (m.isNull()) {
+			playing = false;
+			continue;
+		}
+
+		records.push_back(PositionRecord{ position.hash, m.from, m.to, std::uint8_t(UNKNOWN) });
+		moves.push_back(m);
+		position.makeMove(m);
+	}
+
+	// results are only known at the end of the game, games without one don't count
+	if (outcome == UNKNOWN) {
+		records.resize(records.size() - moves.size());
+		++gamesSkipped;
+		return;
+	}
+	for (std::size_t i = records.size() - moves.size(); i < records.size(); ++i)
+		records[i].outcome = std::uint8_t(outcome);
+	++gamesReplayed;
+}
+
+/*
+	INDEX
+*/
+
+// Sorts the records of one thread and sums the results of every position and move
+static std::vector<ExplorerEntry> aggregate(std::vector<PositionRecord>& records) {
+	std::sort(records.begin(), records.end(), recordLess);
+
+	std::vector<ExplorerEntry> entries;
+	for (const PositionRecord& r : records) {
+		if (entries.empty() || entries.back().hash != r.hash || entries.back().from != r.from || entries.back().to != r.to)
+			entries.push_back(ExplorerEntry{ r.hash, r.from, r.to, 0, 0, 0, 0 });
+
+		ExplorerEntry& e = entries.back();
+		if (r.outcome == WHITE_WINS) ++e.whiteWins;
+		else if (r.outcome == DRAWN) ++e.draws;
+		else ++e.blackWins;
+	}
+
+	std::vector<PositionRecord>().swap(records);
+	return entries;
+}
+
+// Merges the sorted runs of all threads into the index file
+static bool writeIndex(const std::string& path, const std::vector<std::vector<ExplorerEntry>>& runs, std::uint64_t& entryCount) {
+	std::ofstream out(path, std::ios::binary);
+	if (!out) return false;
+
+	ExplorerHeader header = { { 'C', 'H', 'X', 'I' }, EXPLORER_VERSION, 0 };
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+	// (run, position in run), smallest entry on top
+	using Cursor = std::pair<std::size_t, std::size_t>;
+	auto greater = [&](const Cursor& a, const Cursor& b) {
+		return entryLess(runs[b.first][b.second], runs[a.first][a.second]);
+	};
+	std::priority_queue<Cursor, std::vector<Cursor>, decltype(greater)> heap(greater);
+	for (std::size_t i = 0; i < runs.size(); ++i) {
+		if (!runs[i].empty()) heap.push(Cursor(i, 0));
+	}
+
+	std::vector<ExplorerEntry> buffer;
+	buffer.reserve(1 << 16);
+	entryCount = 0;
+
+	while (!heap.empty()) {
+		Cursor cursor = heap.top();
+		heap.pop();
+
+		const ExplorerEntry& e = runs[cursor.first][cursor.second];
+		if (!buffer.empty() && sameKey(buffer.back(), e)) {
+			buffer.back().whiteWins += e.whiteWins;
+			buffer.back().draws += e.draws;
+			buffer.back().blackWins += e.blackWins;
+		}
+		else {
+			// the last entry may still grow, everything before it is final
+			if (buffer.size() == buffer.capacity()) {
+				out.write(reinterpret_cast<const char*>(buffer.data()), (buffer.size() - 1) * sizeof(ExplorerEntry));
+				entryCount += buffer.size() - 1;
+				buffer.erase(buffer.begin(), buffer.end() - 1);
+			}
+			buffer.push_back(e);
+		}
+
+		if (cursor.second + 1 < runs[cursor.first].size())
+			heap.push(Cursor(cursor.first, cursor.second + 1));
+	}
+
+	out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size() * sizeof(ExplorerEntry));
+	entryCount += buffer.size();
+
+	header.entryCount = entryCount;
+	out.seekp(0);
+	out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	return bool(out);
+}
+
+int main(int argc, char** argv)
+{
+	BuilderOptions options;
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		std::size_t eq = arg.find('=');
+		std::string key = arg.substr(0, eq);
+		std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+		bool ok = true;
+		if (arg.rfind("--", 0) != 0) options.pgnPaths.push_back(arg);
+		else if (key == "--out") options.outPath = value;
+		else if (key == "--plies") ok = (options.maxPlies = std::stoi(value)) > 0;
+		else if (key == "--concurrency") options.concurrency = std::stoi(value);
+		else ok = false;
+
+		if (!ok) {
+			std::cout << "Invalid argument " << arg << "\n";
+			return 1;
+		}
+	}
+
+	if (options.pgnPaths.empty()) {
+		std::cout << "usage: ExplorerBuilder [--out=<file>] [--plies=<n>] [--concurrency=<n>] <games.pgn>...\n";
+		return 1;
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	// archives stay mapped while they are parsed, games point into them
+	std::vector<MappedFile> archives(options.pgnPaths.size());
+	std::vector<GameText> games;
+	for (std::size_t i = 0; i < archives.size(); ++i) {
+		if (!archives[i].open(options.pgnPaths[i])) {
+			std::cout << "Failed to open " << options.pgnPaths[i] << "\n";
+			return 1;
+		}
+		splitGames(archives[i].getData(), archives[i].getSize(), games);
+	}
+
+	int concurrency = std::max(options.concurrency > 0 ? options.concurrency : int(std::thread::hardware_concurrency()), 1);
+	std::vector<GameReplay> replays(concurrency, GameReplay(options));
+	std::vector<std::vector<ExplorerEntry>> runs(concurrency);
+
+	// games are handed out in batches, every thread keeps its own records until the merge
+	const std::size_t batchSize = 256;
+	std::atomic<std::size_t> nextBatch(0);
+	std::vector<std::thread> threads;
+	for (int t = 0; t < concurrency; ++t) {
+		threads.emplace_back([&, t] {
+			for (std::size_t b = nextBatch++; b * batchSize < games.size(); b = nextBatch++) {
+				std::size_t end = std::min(games.size(), (b + 1) * batchSize);
+				for (std::size_t g = b * batchSize; g < end; ++g)
+					replays[t].replay(games[g]);
+			}
+			runs[t] = aggregate(replays[t].records);
+		});
+	}
+	for (auto& thread : threads)
+		thread.join();
+
+	std::size_t replayed = 0, skipped = 0;
+	for (const GameReplay& replay : replays) {
+		replayed += replay.gamesReplayed;
+		skipped += replay.gamesSkipped;
+	}
+
+	std::uint64_t entryCount = 0;
+	if (!writeIndex(options.outPath, runs, entryCount)) {
+		std::cout << "Failed to write " << options.outPath << "\n";
+		return 1;
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << replayed << " games indexed, " << skipped << " without a result skipped, "
+		<< entryCount << " positions and moves in " << options.outPath << " (" << seconds << " s, "
+		<< (seconds > 0.0 ? replayed / seconds : 0.0) << " games per second)\n";
+
+	return 0;
+}
@@ -0,0 +1,120 @@
+/*
+	Mate puzzle solver for batches of positions.
+
+	Reads EPD lines (a FEN, optionally followed by "dm <n>;" with the expected mate length) and proves the
+	shortest forced mate of the side to move with MateSolver. Positions with a dm opcode are checked against it.
+
+	usage: Puzzles --puzzles=<file.epd> [--moves=<n>] [--threads=<n>] [--hash=<MB>] [--nodes=<n>]
+	--moves defaults to the dm of each position, or 5 when it has none
+*/
+
+#include "../MateSolver.h"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+struct PuzzleOptions
+{
+	std::string puzzlesPath;
+	int maxMoves = 0;	// 0 = dm of the position
+	MateSolverOptions solver;
+};
+
+// Expected mate length of an EPD line, 0 when there is no dm opcode
+static int parseDirectMate(const std::string& line) {
+	std::size_t dm = line.find("dm ");
+	if (dm == std::string::npos) return 0;
+	return std::atoi(line.c_str() + dm + 3);
+}
+
+static std::string pvToString(const std::vector<Move>& pv) {
+	std::string s;
+	for (Move m : pv)
+		s += (s.empty() ? "" : " ") + m.toString();
+	return s;
+}
+
+int main(int argc, char** argv)
+{
+	PuzzleOptions options;
+	options.solver.threads = int(std::thread::hardware_concurrency());
+
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		std::size_t eq = arg.find('=');
+		std::string key = arg.substr(0, eq);
+		std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+		bool ok = true;
+		if (key == "--puzzles") options.puzzlesPath = value;
+		else if (key == "--moves") ok = (options.maxMoves = std::stoi(value)) > 0;
+		else if (key == "--threads") options.solver.threads = std::stoi(value);
+		else if (key == "--hash") options.solver.hashSizeMb = std::stoi(value);
+		else if (key == "--nodes") options.solver.nodes = std::stoll(value);
+		else ok = false;
+
+		if (!ok) {
+			std::cout << "Invalid argument " << arg << "\n";
+			return 1;
+		}
+	}
+
+	if (options.puzzlesPath.empty()) {
+		std::cout << "usage: Puzzles --puzzles=<file.epd> [--moves=<n>] [--threads=<n>] [--hash=<MB>] [--nodes=<n>]\n";
+		return 1;
+	}
+
+	std::ifstream in(options.puzzlesPath);
+	if (!in) {
+		std::cout << "Failed to open " << options.puzzlesPath << "\n";
+		return 1;
+	}
+
+	MateSolver solver(options.solver);
+	int puzzles = 0, solved = 0, wrong = 0;
+	std::int64_t totalNodes = 0;
+	auto start = std::chrono::steady_clock::now();
+
+	for (std::string line; std::getline(in, line);) {
+		Position position;
+		if (line.find_first_not_of(" \t\r") == std::string::npos || !position.loadFen(line)) continue;
+		++puzzles;
+
+		int expected = parseDirectMate(line);
+		int maxMoves = options.maxMoves ? options.maxMoves : expected ? expected : 5;
+
+		auto puzzleStart = std::chrono::steady_clock::now();
+		solver.clear();
+		MateResult result = solver.solve(position, maxMoves);
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - puzzleStart).count();
+		totalNodes += result.nodes;
+
+		std::ostringstream out;
+		out << puzzles << ": ";
+		if (result.status == MateResult::MATE) {
+			++solved;
+			out << "mate in " << result.moves << " " << pvToString(result.pv);
+		}
+		else if (result.status == MateResult::NO_MATE)
+			out << "no mate in " << maxMoves;
+		else
+			out << "unknown";
+
+		if (expected && (result.status != MateResult::MATE || result.moves != expected)) {
+			++wrong;
+			out << " (expected mate in " << expected << ")";
+		}
+		out << " [" << result.nodes << " nodes, " << ms << " ms]";
+		std::cout << out.str() << std::endl;
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << solved << "/" << puzzles << " mates found, " << wrong << " not as expected, "
+		<< totalNodes << " nodes in " << seconds << " s\n";
+
+	return wrong ? 1 : 0;
+}
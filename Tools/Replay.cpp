@@ -0,0 +1,135 @@
+/*
+	Replays an input recording (F9 in the game writes input.rec) into an offscreen game and times every frame.
+
+	Each frame runs Game::update on the recorded input, then renders into a render texture, as fast as possible or,
+	with --realtime, at the pace it was recorded. The update and render times of every frame can be written as CSV,
+	the summary with their percentiles goes to the standard output. The final position is printed as well, two runs
+	of the same recording end in the same position unless the computer opponent played.
+
+	usage: Replay --input=<file> [--realtime] [--repeat=<n>] [--csv=<file>]
+*/
+
+#include "../Game.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct FrameTime
+{
+	double updateUs;
+	double renderUs;
+};
+
+static double percentile(std::vector<double> values, double p) {
+	if (values.empty()) return 0.0;
+	std::size_t index = std::min(values.size() - 1, std::size_t(p / 100.0 * double(values.size())));
+	std::nth_element(values.begin(), values.begin() + index, values.end());
+	return values[index];
+}
+
+static void printSummary(const std::string& name, const std::vector<double>& values) {
+	double total = 0.0;
+	for (double v : values) total += v;
+
+	std::cout << std::left << std::setw(8) << name << std::right << std::fixed << std::setprecision(1)
+		<< " mean " << std::setw(9) << (values.empty() ? 0.0 : total / double(values.size()))
+		<< "  p50 " << std::setw(9) << percentile(values, 50.0)
+		<< "  p90 " << std::setw(9) << percentile(values, 90.0)
+		<< "  p99 " << std::setw(9) << percentile(values, 99.0)
+		<< "  max " << std::setw(9) << percentile(values, 100.0) << " us\n";
+}
+
+int main(int argc, char** argv)
+{
+	std::string inputPath;
+	std::string csvPath;
+	bool realtime = false;
+	int repeat = 1;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		bool ok = true;
+		if (arg.rfind("--input=", 0) == 0) inputPath = arg.substr(8);
+		else if (arg.rfind("--csv=", 0) == 0) csvPath = arg.substr(6);
+		else if (arg == "--realtime") realtime = true;
+		else if (arg.rfind("--repeat=", 0) == 0) ok = (repeat = std::stoi(arg.substr(9))) > 0;
+		else ok = false;
+
+		if (!ok) {
+			std::cout << "Invalid argument " << arg << "\n";
+			return 1;
+		}
+	}
+
+	if (inputPath.empty()) {
+		std::cout << "usage: Replay --input=<file> [--realtime] [--repeat=<n>] [--csv=<file>]\n";
+		return 1;
+	}
+
+	InputRecording recording;
+	if (!recording.load(inputPath)) {
+		std::cout << "Failed to load " << inputPath << "\n";
+		return 1;
+	}
+
+	// tiles are 150px, the board plus margins is 1300px
+	sf::RenderTexture target;
+	if (!target.create(1300, 1300)) {
+		std::cout << "Failed to create render texture\n";
+		return 1;
+	}
+
+	using clock = std::chrono::steady_clock;
+	std::vector<FrameTime> times;
+	times.reserve(recording.getFrames().size() * std::size_t(repeat));
+	std::string finalFen;
+
+	for (int run = 0; run < repeat; ++run) {
+		Game game(GameMode::OFFSCREEN);
+		game.loadFen(recording.getFen());
+
+		auto start = clock::now();
+		for (const InputFrame& frame : recording.getFrames()) {
+			if (realtime)
+				std::this_thread::sleep_until(start + std::chrono::microseconds(frame.timeUs));
+
+			auto t0 = clock::now();
+			game.update(frame);
+			auto t1 = clock::now();
+			game.render(target);
+			target.display();
+			auto t2 = clock::now();
+
+			times.push_back(FrameTime{
+				std::chrono::duration<double, std::micro>(t1 - t0).count(),
+				std::chrono::duration<double, std::micro>(t2 - t1).count() });
+		}
+		finalFen = game.getPosition().toFen();
+	}
+
+	if (!csvPath.empty()) {
+		std::ofstream csv(csvPath);
+		csv << "frame,update_us,render_us\n";
+		for (std::size_t i = 0; i < times.size(); ++i)
+			csv << i << "," << times[i].updateUs << "," << times[i].renderUs << "\n";
+	}
+
+	std::vector<double> update, render, total;
+	for (const FrameTime& time : times) {
+		update.push_back(time.updateUs);
+		render.push_back(time.renderUs);
+		total.push_back(time.updateUs + time.renderUs);
+	}
+
+	std::cout << times.size() << " frames\n";
+	printSummary("update", update);
+	printSummary("render", render);
+	printSummary("frame", total);
+	std::cout << "final position " << finalFen << "\n";
+	return 0;
+}
@@ -0,0 +1,245 @@
+/*
+	Self-play training data generator.
+
+	Plays engine-vs-engine games on all cores, each from a random opening of --random plies, with a fixed depth or
+	node budget per move. Every position out of check that the engine scored is recorded with its score and, once
+	the game is over, its result. Games end in checkmate, stalemate, insufficient material, threefold repetition,
+	the 50-move rule, a found mate or --maxplies. Every thread writes its own file <out>.<thread>.bin through a
+	buffered TrainingDataWriter, see TrainingData.h for the format.
+
+	With --dump the given files are read back in shuffled order instead and printed as FEN, score and result.
+
+	usage: SelfPlay --out=<prefix> [--positions=<n>] [--depth=<n>] [--nodes=<n>] [--random=<plies>] [--maxplies=<n>]
+			[--concurrency=<n>] [--hash=<MB>] [--seed=<n>]
+		SelfPlay --dump=<file>[,<file>...] [--count=<n>] [--seed=<n>]
+	--nodes defaults to 5000 when neither --depth nor --nodes is given
+*/
+
+#include "../Engine.h"
+#include "../TrainingData.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct SelfPlayOptions
+{
+	std::string outPrefix;
+	std::int64_t positions = 1000000;
+	int depth = 0;
+	std::int64_t nodes = 0;
+	int randomPlies = 8;
+	int maxPlies = 400;
+	int concurrency = 0;
+	int hashSizeMb = 4;
+	std::uint64_t seed = 1;
+
+	std::vector<std::string> dumpPaths;
+	std::int64_t count = 20;
+};
+
+class SelfPlay
+{
+private:
+	const SelfPlayOptions& options;
+	std::atomic<std::int64_t> positions;
+	std::atomic<std::int64_t> games;
+	std::atomic<int> liveWorkers;
+	std::atomic<bool> failed;
+
+	void worker(int thread);
+	// False when the game gave no samples
+	bool playGame(Engine& engine, std::mt19937_64& rng, TrainingDataWriter& writer);
+public:
+	explicit SelfPlay(const SelfPlayOptions& options) : options{ options }, positions{ 0 }, games{ 0 }, liveWorkers{ 0 }, failed{ false } {}
+
+	// False when a worker could not write its samples
+	bool run();
+};
+
+bool SelfPlay::playGame(Engine& engine, std::mt19937_64& rng, TrainingDataWriter& writer) {
+	Position position;
+	position.loadFen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w");
+
+	// random opening, started over when it runs into the end of a game
+	for (int ply = 0; ply < options.randomPlies; ++ply) {
+		MoveList list;
+		position.generateLegalMoves(list);
+		if (!list.size) return false;
+		position.makeMove(list.moves[rng() % list.size]);
+	}
+	if (position.classify() != GameState::ONGOING) return false;
+
+	engine.clear();
+	std::vector<PackedSample> samples;
+	std::vector<std::uint64_t> hashes{ position.hash };
+	// result for whites, 1 win, 0 draw, -1 loss
+	int result = 0;
+
+	SearchLimits limits;
+	limits.depth = options.depth;
+	limits.nodes = options.nodes;
+
+	for (int ply = options.randomPlies; ply < options.maxPlies; ++ply) {
+		GameState state = position.classify();
+		if (state == GameState::CHECKMATE) {
+			result = position.turn == PieceColor::WHITE ? -1 : 1;
+			break;
+		}
+		if (state != GameState::ONGOING || position.halfmoveClock >= 100) break;
+		if (std::count(hashes.begin(), hashes.end(), position.hash) >= 3) break;
+
+		SearchResult search = engine.search(position, limits);
+		if (search.bestMove.isNull()) break;
+
+		// positions in check have no quiet score to learn from
+		if (!position.inCheck()) samples.push_back(packSample(position, search.score, 0, ply));
+
+		// the mate will be played out as scored, no need to spend the nodes on it
+		if (isMateScore(search.score)) {
+			bool whiteWins = (search.score > 0) == (position.turn == PieceColor::WHITE);
+			result = whiteWins ? 1 : -1;
+			break;
+		}
+
+		position.makeMove(search.bestMove);
+		hashes.push_back(position.hash);
+	}
+
+	for (PackedSample& sample : samples) {
+		sample.result = std::int8_t(sample.flags & 1 ? -result : result);
+		writer.add(sample);
+	}
+	positions += std::int64_t(samples.size());
+	++games;
+	return !samples.empty();
+}
+
+void SelfPlay::worker(int thread) {
+	EngineOptions engineOptions;
+	engineOptions.hashSizeMb = options.hashSizeMb;
+	Engine engine(engineOptions);
+
+	std::mt19937_64 rng(options.seed * 0x9E3779B97F4A7C15ull + std::uint64_t(thread));
+
+	TrainingDataWriter writer;
+	std::string path = options.outPrefix + "." + std::to_string(thread) + ".bin";
+	if (writer.open(path)) {
+		// with the options given, a game may never get past its opening, the target would never be reached
+		int fruitless = 0;
+		while (positions.load() < options.positions) {
+			if (playGame(engine, rng, writer)) fruitless = 0;
+			else if (++fruitless == 1000) {
+				std::cout << "No samples in the last " << fruitless << " games, giving up\n";
+				failed = true;
+				break;
+			}
+		}
+	}
+	else {
+		std::cout << "Failed to open " << path << "\n";
+		failed = true;
+	}
+
+	--liveWorkers;
+}
+
+bool SelfPlay::run() {
+	int concurrency = options.concurrency > 0 ? options.concurrency : std::max(1, int(std::thread::hardware_concurrency()));
+	auto start = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	liveWorkers = concurrency;
+	for (int t = 0; t < concurrency; ++t)
+		threads.emplace_back(&SelfPlay::worker, this, t);
+
+	auto report = [&]() {
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::int64_t n = positions.load();
+		std::cout << n << " positions, " << games.load() << " games, "
+			<< std::int64_t(n / std::max(seconds, 1e-9) * 3600.0) << " positions/hour" << std::endl;
+	};
+
+	// the workers left early when they could not write, the target would never be reached then
+	for (int second = 1; positions.load() < options.positions && liveWorkers.load() > 0; ++second) {
+		std::this_thread::sleep_for(std::chrono::seconds(1));
+		if (second % 10 == 0) report();
+	}
+	for (auto& thread : threads)
+		thread.join();
+	report();
+	return !failed;
+}
+
+static int dump(const SelfPlayOptions& options) {
+	TrainingDataReader reader(1 << 20, options.seed);
+	if (!reader.open(options.dumpPaths)) {
+		std::cout << "Failed to open the samples\n";
+		return 1;
+	}
+
+	std::cout << reader.getSampleCount() << " samples\n";
+	TrainingSample sample;
+	for (std::int64_t i = 0; i < options.count && reader.next(sample); ++i)
+		std::cout << sample.position.toFen() << " | score " << sample.score << " | result " << sample.result << " | ply " << sample.ply << "\n";
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	SelfPlayOptions options;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		std::size_t eq = arg.find('=');
+		std::string key = arg.substr(0, eq);
+		std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+		bool ok = true;
+		if (key == "--out") options.outPrefix = value;
+		else if (key == "--positions") ok = (options.positions = std::stoll(value)) > 0;
+		else if (key == "--depth") options.depth = std::stoi(value);
+		else if (key == "--nodes") options.nodes = std::stoll(value);
+		else if (key == "--random") ok = (options.randomPlies = std::stoi(value)) >= 0;
+		else if (key == "--maxplies") options.maxPlies = std::stoi(value);
+		else if (key == "--concurrency") options.concurrency = std::stoi(value);
+		else if (key == "--hash") options.hashSizeMb = std::stoi(value);
+		else if (key == "--seed") options.seed = std::stoull(value);
+		else if (key == "--count") options.count = std::stoll(value);
+		else if (key == "--dump") {
+			std::stringstream paths(value);
+			for (std::string path; std::getline(paths, path, ',');)
+				options.dumpPaths.push_back(path);
+		}
+		else ok = false;
+
+		if (!ok) {
+			std::cout << "Invalid argument " << arg << "\n";
+			return 1;
+		}
+	}
+
+	if (!options.dumpPaths.empty())
+		return dump(options);
+
+	if (options.outPrefix.empty()) {
+		std::cout << "usage: SelfPlay --out=<prefix> [--positions=<n>] [--depth=<n>] [--nodes=<n>] [--random=<plies>] [--maxplies=<n>]\n"
+			"\t\t[--concurrency=<n>] [--hash=<MB>] [--seed=<n>]\n"
+			"\tSelfPlay --dump=<file>[,<file>...] [--count=<n>] [--seed=<n>]\n";
+		return 1;
+	}
+	if (options.maxPlies <= options.randomPlies) {
+		std::cout << "--maxplies has to be above --random, the searched plies come after the random ones\n";
+		return 1;
+	}
+	if (!options.depth && !options.nodes) options.nodes = 5000;
+
+	SelfPlay selfPlay(options);
+	return selfPlay.run() ? 0 : 1;
+}
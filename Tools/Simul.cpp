@@ -0,0 +1,180 @@
+/*
+	Simul view: one window showing many live games at once, see MultiBoard.h.
+
+	Positions are read from the standard input, one "<board> <FEN>" line per update, boards counted from 0, so any
+	relay or script can feed it, e.g. a pipe from a broadcast. With --demo the boards play random games instead,
+	a move every --interval milliseconds each, which is also the way to check the frame rate with a full screen.
+	Frame times are printed every 5 seconds.
+
+	usage: Simul [--boards=<n>] [--columns=<n>] [--demo] [--interval=<ms>] [--fps=<limit, 0 = none>]
+*/
+
+#include "../Assets.h"
+#include "../MultiBoard.h"
+#include "../SpscQueue.h"
+
+#include <SFML/Window.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct BoardUpdate
+{
+	int board;
+	Position position;
+};
+
+// View of the whole grid, letterboxed like the board of the game
+static sf::View gridView(const MultiBoard& boards, sf::Vector2u windowSize) {
+	sf::Vector2f size = boards.getSize() + sf::Vector2f(2.f * MultiBoard::BOARD_GAP, 2.f * MultiBoard::BOARD_GAP);
+	sf::View view(sf::FloatRect(-MultiBoard::BOARD_GAP, -MultiBoard::BOARD_GAP, size.x, size.y));
+
+	float windowRatio = windowSize.x / float(windowSize.y);
+	float viewRatio = size.x / size.y;
+	if (windowRatio > viewRatio)
+		view.setViewport(sf::FloatRect((1.f - viewRatio / windowRatio) / 2.f, 0.f, viewRatio / windowRatio, 1.f));
+	else
+		view.setViewport(sf::FloatRect(0.f, (1.f - windowRatio / viewRatio) / 2.f, 1.f, windowRatio / viewRatio));
+	return view;
+}
+
+int main(int argc, char** argv)
+{
+	int boardCount = 100;
+	int columns = 0;
+	bool demo = false;
+	int intervalMs = 1000;
+	int fps = 60;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		std::size_t eq = arg.find('=');
+		std::string key = arg.substr(0, eq);
+		std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+		bool ok = true;
+		if (key == "--boards") ok = (boardCount = std::stoi(value)) > 0;
+		else if (key == "--columns") columns = std::stoi(value);
+		else if (key == "--demo") demo = true;
+		else if (key == "--interval") ok = (intervalMs = std::stoi(value)) > 0;
+		else if (key == "--fps") fps = std::stoi(value);
+		else ok = false;
+
+		if (!ok) {
+			std::cout << "Invalid argument " << arg << "\n";
+			std::cout << "usage: Simul [--boards=<n>] [--columns=<n>] [--demo] [--interval=<ms>] [--fps=<limit, 0 = none>]\n";
+			return 1;
+		}
+	}
+
+	sf::Image sheet;
+	sf::Texture texture;
+	if (!sheet.loadFromMemory(piecesTextureAsset.data, piecesTextureAsset.size) || !texture.loadFromImage(sheet)) {
+		std::cout << "Failed to load pieces texture\n";
+		return 1;
+	}
+	// the sprites are drawn at a fraction of their size, mipmaps keep them from shimmering
+	texture.setSmooth(true);
+	texture.generateMipmap();
+
+	MultiBoard boards(boardCount, columns, &texture);
+
+	Position start;
+	start.loadFen("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w");
+	std::vector<Position> positions(boardCount, start);
+	for (int board = 0; board < boardCount; ++board)
+		boards.setPosition(board, positions[board]);
+
+	// the reader thread only parses, the boards are only touched by the render thread.
+	// Never deleted: the reader can still be blocked in getline when main returns, so the queue has to outlive it.
+	SpscQueue<BoardUpdate, 1024>& updates = *new SpscQueue<BoardUpdate, 1024>();
+	if (!demo) {
+		std::thread([&updates] {
+			for (std::string line; std::getline(std::cin, line);) {
+				std::istringstream stream(line);
+				BoardUpdate update;
+				std::string fen;
+				if (!(stream >> update.board) || !std::getline(stream >> std::ws, fen) || !update.position.loadFen(fen)) {
+					std::cerr << "Invalid line " << line << "\n";
+					continue;
+				}
+				while (!updates.push(update))
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		}).detach();
+	}
+
+	sf::RenderWindow window(sf::VideoMode(1600, 1000), "Simul");
+	window.setVerticalSyncEnabled(false);
+	window.setFramerateLimit(unsigned(std::max(fps, 0)));
+	sf::View view = gridView(boards, window.getSize());
+
+	std::mt19937 rng(1);
+	using clock = std::chrono::steady_clock;
+	auto demoStart = clock::now();
+	std::vector<std::int64_t> movesPlayed(boardCount, 0);
+
+	std::vector<double> frameTimes;
+	auto lastReport = clock::now();
+	auto lastFrame = clock::now();
+
+	while (window.isOpen()) {
+		sf::Event event;
+		while (window.pollEvent(event)) {
+			if (event.type == sf::Event::Closed || (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape))
+				window.close();
+			else if (event.type == sf::Event::Resized)
+				view = gridView(boards, sf::Vector2u(event.size.width, event.size.height));
+		}
+
+		BoardUpdate update;
+		while (updates.pop(update))
+			boards.setPosition(update.board, update.position);
+
+		if (demo) {
+			// staggered, so a few boards change every frame like in a real event
+			std::int64_t elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now() - demoStart).count();
+			for (int board = 0; board < boardCount; ++board) {
+				std::int64_t due = (elapsedMs + std::int64_t(board) * intervalMs / boardCount) / intervalMs;
+				if (movesPlayed[board] >= due) continue;
+				movesPlayed[board] = due;
+
+				MoveList list;
+				positions[board].generateLegalMoves(list);
+				if (!list.size || positions[board].halfmoveClock >= 100 || positions[board].isInsufficientMaterial())
+					positions[board] = start;
+				else
+					positions[board].makeMove(list.moves[rng() % list.size]);
+				boards.setPosition(board, positions[board]);
+			}
+		}
+
+		window.clear(sf::Color(25, 25, 25));
+		window.setView(view);
+		boards.render(window);
+		window.display();
+
+		auto now = clock::now();
+		frameTimes.push_back(std::chrono::duration<double, std::milli>(now - lastFrame).count());
+		lastFrame = now;
+
+		if (now - lastReport >= std::chrono::seconds(5)) {
+			std::sort(frameTimes.begin(), frameTimes.end());
+			double total = 0.0;
+			for (double t : frameTimes) total += t;
+			std::cout << frameTimes.size() / std::chrono::duration<double>(now - lastReport).count() << " fps, "
+				<< "mean " << total / frameTimes.size() << " ms, "
+				<< "p99 " << frameTimes[std::min(frameTimes.size() - 1, frameTimes.size() * 99 / 100)] << " ms" << std::endl;
+			frameTimes.clear();
+			lastReport = now;
+		}
+	}
+
+	return 0;
+}
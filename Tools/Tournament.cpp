@@ -0,0 +1,360 @@
+/*
+	Headless engine-vs-engine match runner.
+
+	Plays engine A (the candidate) against engine B (the baseline) on all cores.
+	Every opening of the EPD file is played twice with colors swapped, games are adjudicated by Game itself
+	(checkmate, stalemate, insufficient material, threefold repetition and the 50-move rule) plus time forfeits
+	and a ply limit.
+	The match stops early once a sequential probability ratio test accepts either H0 (elo0) or H1 (elo1).
+
+	usage: Tournament --openings=<file.epd> [--games=<n>] [--concurrency=<n>] [--tc=<seconds>+<increment>]
+		[--a=<engine options>] [--b=<engine options>] [--elo0=<elo>] [--elo1=<elo>] [--alpha=<p>] [--beta=<p>]
+		[--maxplies=<n>]
+	engine options: comma separated depth=<n>, nodes=<n>, hash=<MB>, quiescence=<0|1>
+*/
+
+#include "../Game.h"
+#include "../Engine.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct EngineConfig
+{
+	EngineOptions options;
+	std::int64_t nodes = 0;
+};
+
+struct TimeControl
+{
+	std::int64_t baseMs = 10000;
+	std::int64_t incrementMs = 100;
+};
+
+struct MatchOptions
+{
+	std::string openingsPath;
+	int games = 1000;
+	int concurrency = 0;
+	TimeControl timeControl;
+	EngineConfig engines[2];
+	double elo0 = 0.0;
+	double elo1 = 5.0;
+	double alpha = 0.05;
+	double beta = 0.05;
+	int maxPlies = 400;
+};
+
+// Score of engine A in a single game
+enum GameResult {
+	A_LOSES = 0,
+	DRAW,
+	A_WINS
+};
+
+/*
+	SPRT
+*/
+
+static double eloToScore(double elo) {
+	return 1.0 / (1.0 + std::pow(10.0, -elo / 400.0));
+}
+
+static double scoreToElo(double score) {
+	score = std::min(std::max(score, 1e-6), 1.0 - 1e-6);
+	return -400.0 * std::log10(1.0 / score - 1.0);
+}
+
+class MatchStatistics
+{
+private:
+	int wins = 0, draws = 0, losses = 0;
+public:
+	void add(GameResult result) {
+		if (result == A_WINS) ++wins;
+		else if (result == DRAW) ++draws;
+		else ++losses;
+	}
+
+	int getGames() const { return wins + draws + losses; }
+
+	double getScore() const {
+		return getGames() ? (wins + 0.5 * draws) / getGames() : 0.5;
+	}
+
+	// Variance of the score of a single game, from the observed win/draw/loss frequencies
+	double getVariance() const {
+		int n = getGames();
+		if (!n) return 0.0;
+
+		double w = double(wins) / n, d = double(draws) / n;
+		double s = getScore();
+		return w + d / 4.0 - s * s;
+	}
+
+	// Elo difference and the half width of its 95% confidence interval
+	void getElo(double& elo, double& error) const {
+		double s = getScore();
+		double margin = 1.96 * std::sqrt(getVariance() / std::max(getGames(), 1));
+		elo = scoreToElo(s);
+		error = (scoreToElo(s + margin) - scoreToElo(s - margin)) / 2.0;
+	}
+
+	// Log likelihood ratio of H1 (elo1) against H0 (elo0), normal approximation of the trinomial model
+	double getLLR(double elo0, double elo1) const {
+		double variance = getVariance();
+		if (getGames() < 2 || variance <= 0.0) return 0.0;
+
+		double s0 = eloToScore(elo0), s1 = eloToScore(elo1);
+		return (s1 - s0) * (2.0 * getScore() - s0 - s1) / (2.0 * variance / getGames());
+	}
+
+	std::string toString() const {
+		std::ostringstream out;
+		out << "+" << wins << " =" << draws << " -" << losses;
+		return out.str();
+	}
+};
+
+/*
+	MATCH
+*/
+
+class Match
+{
+private:
+	MatchOptions options;
+	std::vector<std::string> openings;
+
+	std::atomic<int> nextGame;
+	std::atomic<bool> stopped;
+
+	std::mutex mutex;
+	MatchStatistics statistics;
+	std::string verdict;
+	std::chrono::steady_clock::time_point startTime;
+
+	void worker();
+	GameResult playGame(Game& game, Engine engines[2], const std::string& fen, bool aIsWhite);
+	void report(bool final);
+public:
+	explicit Match(const MatchOptions& options);
+
+	bool loadOpenings();
+	void run();
+};
+
+Match::Match(const MatchOptions& options) : options{ options }, nextGame{ 0 }, stopped{ false } {}
+
+bool Match::loadOpenings() {
+	std::ifstream in(options.openingsPath);
+	if (!in) {
+		std::cout << "Failed to open " << options.openingsPath << "\n";
+		return false;
+	}
+
+	// EPD has the first four FEN fields followed by operations, only the position is used
+	std::string line;
+	while (std::getline(in, line)) {
+		std::istringstream fields(line);
+		std::string placement, side, castling, enPassant;
+		if (!(fields >> placement >> side >> castling >> enPassant)) continue;
+
+		openings.push_back(placement + " " + side + " " + castling + " " + enPassant + " 0 1");
+	}
+
+	if (openings.empty()) std::cout << "No openings in " << options.openingsPath << "\n";
+	return !openings.empty();
+}
+
+GameResult Match::playGame(Game& game, Engine engines[2], const std::string& fen, bool aIsWhite) {
+	game.loadFen(fen);
+	engines[0].clear();
+	engines[1].clear();
+
+	std::int64_t clocks[2] = { options.timeControl.baseMs, options.timeControl.baseMs };
+
+	// result from the point of view of the given color
+	auto resultFor = [aIsWhite](PieceColor winner) {
+		return (winner == PieceColor::WHITE) == aIsWhite ? A_WINS : A_LOSES;
+	};
+
+	for (int ply = 0; ply < options.maxPlies; ++ply) {
+		if (game.getIsCheckmate()) return resultFor(oppositeColor(game.getTurn()));
+		if (game.getIsDraw()) return DRAW;
+
+		PieceColor side = game.getTurn();
+		int engineIndex = (side == PieceColor::WHITE) == aIsWhite ? 0 : 1;
+
+		Position position = Position::fromBoard(game.getBoard(), side);
+		position.halfmoveClock = game.getHistory().getHalfmoveClock();
+
+		SearchLimits limits;
+		limits.nodes = options.engines[engineIndex].nodes;
+		limits.timeLeftMs = std::max<std::int64_t>(1, clocks[side]);
+		limits.incrementMs = options.timeControl.incrementMs;
+
+		auto start = std::chrono::steady_clock::now();
+		SearchResult result = engines[engineIndex].search(position, limits);
+		auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+		clocks[side] -= elapsed;
+		if (clocks[side] < 0) return resultFor(oppositeColor(side));
+		clocks[side] += options.timeControl.incrementMs;
+
+		// Game ends mates and stalemates itself, a null move only comes from a search stopped before its first iteration
+		if (result.bestMove.isNull()) return DRAW;
+
+		if (!game.playMove(tileOf(result.bestMove.from), tileOf(result.bestMove.to))) {
+			std::cout << "Illegal move " << result.bestMove.toString() << " in " << position.toFen() << "\n";
+			return resultFor(oppositeColor(side));
+		}
+	}
+
+	return DRAW;
+}
+
+void Match::worker() {
+	Game game(GameMode::RULES);
+	Engine engines[2] = { Engine(options.engines[0].options), Engine(options.engines[1].options) };
+
+	while (!stopped) {
+		int index = nextGame++;
+		if (index >= options.games) break;
+
+		// game pairs: the same opening with colors swapped
+		const std::string& fen = openings[(index / 2) % openings.size()];
+		GameResult result = playGame(game, engines, fen, index % 2 == 0);
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (stopped) break;
+
+		statistics.add(result);
+
+		double llr = statistics.getLLR(options.elo0, options.elo1);
+		double lower = std::log(options.beta / (1.0 - options.alpha));
+		double upper = std::log((1.0 - options.beta) / options.alpha);
+		if (llr >= upper) verdict = "H1 accepted (elo >= " + std::to_string(options.elo1) + ")";
+		else if (llr <= lower) verdict = "H0 accepted (elo <= " + std::to_string(options.elo0) + ")";
+		if (!verdict.empty()) stopped = true;
+
+		if (statistics.getGames() % 10 == 0 || stopped) report(false);
+	}
+}
+
+void Match::report(bool final) {
+	double elo, error;
+	statistics.getElo(elo, error);
+
+	double hours = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count() / 3600.0;
+	double llr = statistics.getLLR(options.elo0, options.elo1);
+
+	std::cout << std::fixed << std::setprecision(2)
+		<< (final ? "Finished: " : "") << statistics.getGames() << " games " << statistics.toString()
+		<< "  score " << statistics.getScore() * 100.0 << "%"
+		<< "  elo " << elo << " +- " << error
+		<< "  llr " << llr << " (" << std::log(options.beta / (1.0 - options.alpha)) << ", " << std::log((1.0 - options.beta) / options.alpha) << ")"
+		<< "  " << std::setprecision(0) << (hours > 0.0 ? statistics.getGames() / hours : 0.0) << " games/h\n";
+
+	if (final) std::cout << (verdict.empty() ? "SPRT inconclusive" : verdict) << "\n";
+}
+
+void Match::run() {
+	int concurrency = options.concurrency > 0 ? options.concurrency : int(std::thread::hardware_concurrency());
+	if (concurrency <= 0) concurrency = 1;
+
+	std::cout << "Playing up to " << options.games << " games on " << concurrency << " threads, "
+		<< openings.size() << " openings\n";
+
+	startTime = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < concurrency; ++i)
+		threads.emplace_back(&Match::worker, this);
+	for (auto& t : threads)
+		t.join();
+
+	report(true);
+}
+
+/*
+	COMMAND LINE
+*/
+
+static bool parseEngineConfig(const std::string& s, EngineConfig& config) {
+	std::istringstream in(s);
+	std::string option;
+	while (std::getline(in, option, ',')) {
+		std::size_t eq = option.find('=');
+		if (eq == std::string::npos) return false;
+
+		std::string key = option.substr(0, eq);
+		long long value = std::stoll(option.substr(eq + 1));
+		if (key == "depth") config.options.maxDepth = int(value);
+		else if (key == "nodes") config.nodes = value;
+		else if (key == "hash") config.options.hashSizeMb = int(value);
+		else if (key == "quiescence") config.options.quiescence = value != 0;
+		else return false;
+	}
+	return true;
+}
+
+static bool parseTimeControl(const std::string& s, TimeControl& tc) {
+	std::size_t plus = s.find('+');
+	tc.baseMs = std::int64_t(std::stod(s.substr(0, plus)) * 1000.0);
+	tc.incrementMs = plus == std::string::npos ? 0 : std::int64_t(std::stod(s.substr(plus + 1)) * 1000.0);
+	return tc.baseMs > 0;
+}
+
+int main(int argc, char** argv)
+{
+	MatchOptions options;
+	for (auto& engine : options.engines)
+		engine.options.hashSizeMb = 8;
+
+	for (int i = 1; i < argc; ++i) {
+		std::string arg = argv[i];
+		std::size_t eq = arg.find('=');
+		std::string key = arg.substr(0, eq);
+		std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+		bool ok = true;
+		if (key == "--openings") options.openingsPath = value;
+		else if (key == "--games") options.games = std::stoi(value);
+		else if (key == "--concurrency") options.concurrency = std::stoi(value);
+		else if (key == "--tc") ok = parseTimeControl(value, options.timeControl);
+		else if (key == "--a") ok = parseEngineConfig(value, options.engines[0]);
+		else if (key == "--b") ok = parseEngineConfig(value, options.engines[1]);
+		else if (key == "--elo0") options.elo0 = std::stod(value);
+		else if (key == "--elo1") options.elo1 = std::stod(value);
+		else if (key == "--alpha") options.alpha = std::stod(value);
+		else if (key == "--beta") options.beta = std::stod(value);
+		else if (key == "--maxplies") options.maxPlies = std::stoi(value);
+		else ok = false;
+
+		if (!ok) {
+			std::cout << "Invalid argument " << arg << "\n";
+			return 1;
+		}
+	}
+
+	if (options.openingsPath.empty()) {
+		std::cout << "usage: Tournament --openings=<file.epd> [--games=<n>] [--concurrency=<n>] [--tc=<s>+<inc>] "
+			"[--a=<options>] [--b=<options>] [--elo0=<elo>] [--elo1=<elo>] [--alpha=<p>] [--beta=<p>] [--maxplies=<n>]\n";
+		return 1;
+	}
+
+	Match match(options);
+	if (!match.loadOpenings()) return 1;
+	match.run();
+
+	return 0;
+}
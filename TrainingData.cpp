@@ -0,0 +1,129 @@
+#include "TrainingData.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Samples per block of the reader, big enough for sequential reads, small enough to mix files well
+static const std::size_t BLOCK_SAMPLES = 4096;
+
+PackedSample packSample(const Position& position, int score, int result, int ply) {
+	PackedPosition packed = packPosition(position);
+
+	PackedSample sample{};
+	sample.occupancy = packed.occupancy;
+	std::memcpy(sample.pieces, packed.pieces, sizeof(sample.pieces));
+	sample.score = std::int16_t(std::max(-32767, std::min(score, 32767)));
+	sample.result = std::int8_t(result);
+	sample.flags = packed.flags;
+	sample.ply = std::uint16_t(std::min(ply, 65535));
+	sample.halfmoveClock = packed.halfmoveClock;
+	return sample;
+}
+
+TrainingSample unpackSample(const PackedSample& sample) {
+	PackedPosition packed{};
+	packed.occupancy = sample.occupancy;
+	std::memcpy(packed.pieces, sample.pieces, sizeof(packed.pieces));
+	packed.flags = sample.flags & 1;
+	packed.halfmoveClock = sample.halfmoveClock;
+
+	return TrainingSample{ unpackPosition(packed), sample.score, sample.result, sample.ply };
+}
+
+/*
+	WRITER
+*/
+
+TrainingDataWriter::TrainingDataWriter(std::size_t bufferSamples) : bufferSamples{ std::max<std::size_t>(bufferSamples, 1) }, written{ 0 } {
+	buffer.reserve(this->bufferSamples);
+}
+
+TrainingDataWriter::~TrainingDataWriter() {
+	flush();
+}
+
+bool TrainingDataWriter::open(const std::string& path) {
+	file.open(path, std::ios::binary | std::ios::app);
+	return bool(file);
+}
+
+void TrainingDataWriter::add(const PackedSample& sample) {
+	buffer.push_back(sample);
+	if (buffer.size() >= bufferSamples) flush();
+}
+
+bool TrainingDataWriter::flush() {
+	if (buffer.empty() || !file) return bool(file);
+
+	file.write(reinterpret_cast<const char*>(buffer.data()), std::streamsize(buffer.size() * sizeof(PackedSample)));
+	file.flush();
+	written += buffer.size();
+	buffer.clear();
+	return bool(file);
+}
+
+/*
+	READER
+*/
+
+TrainingDataReader::TrainingDataReader(std::size_t bufferSamples, std::uint64_t seed)
+	: nextBlock{ 0 }, sampleCount{ 0 }, bufferPosition{ 0 }, bufferSamples{ std::max(bufferSamples, BLOCK_SAMPLES) }, rng{ seed } {}
+
+bool TrainingDataReader::open(const std::vector<std::string>& paths) {
+	files.clear();
+	blocks.clear();
+	sampleCount = 0;
+
+	for (const std::string& path : paths) {
+		files.emplace_back();
+		if (!files.back().open(path)) return false;
+
+		// a partial sample at the end is what a crash while writing leaves behind
+		std::size_t samples = files.back().getSize() / sizeof(PackedSample);
+		for (std::size_t first = 0; first < samples; first += BLOCK_SAMPLES)
+			blocks.push_back(Block{ int(files.size() - 1), first, std::min(BLOCK_SAMPLES, samples - first) });
+		sampleCount += samples;
+	}
+
+	rewind();
+	return true;
+}
+
+void TrainingDataReader::rewind() {
+	std::shuffle(blocks.begin(), blocks.end(), rng);
+	nextBlock = 0;
+	buffer.clear();
+	bufferPosition = 0;
+}
+
+bool TrainingDataReader::fill() {
+	buffer.clear();
+	bufferPosition = 0;
+
+	while (nextBlock < blocks.size() && buffer.size() + blocks[nextBlock].count <= bufferSamples) {
+		const Block& block = blocks[nextBlock++];
+		const char* data = files[block.file].getData() + block.first * sizeof(PackedSample);
+
+		std::size_t size = buffer.size();
+		buffer.resize(size + block.count);
+		std::memcpy(buffer.data() + size, data, block.count * sizeof(PackedSample));
+	}
+
+	std::shuffle(buffer.begin(), buffer.end(), rng);
+	return !buffer.empty();
+}
+
+bool TrainingDataReader::next(PackedSample& sample) {
+	if (bufferPosition == buffer.size() && !fill()) return false;
+
+	sample = buffer[bufferPosition++];
+	return true;
+}
+
+bool TrainingDataReader::next(TrainingSample& sample) {
+	PackedSample packed;
+	if (!next(packed)) return false;
+
+	sample = unpackSample(packed);
+	return true;
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Engine.h"
+#include "MappedFile.h"
+#include "PackedPosition.h"
+
+/*
+	Training samples for evaluation networks, written by Tools/SelfPlay.cpp.
+
+	A file is nothing but PackedSample records, so files can be concatenated and split freely. A sample only ends
+	up in a file as a whole record, a crash while writing can at most leave a partial one at the end, which readers
+	ignore. Multi-byte fields are stored little-endian, like the machines that write them.
+*/
+
+struct PackedSample
+{
+	std::uint64_t occupancy;	// as in PackedPosition
+	std::uint8_t pieces[16];	// as in PackedPosition
+	std::int16_t score;			// search score in centipawns from the side to move
+	std::int8_t result;			// game result from the side to move: 1 win, 0 draw, -1 loss
+	std::uint8_t flags;			// bit 0 is set when blacks are to move
+	std::uint16_t ply;			// plies since the start of the game
+	std::uint8_t halfmoveClock;
+	std::uint8_t reserved;
+};
+
+static_assert(sizeof(PackedSample) == 32, "the sample layout is part of the file format");
+
+struct TrainingSample
+{
+	Position position;
+	int score;
+	int result;
+	int ply;
+};
+
+PackedSample packSample(const Position& position, int score, int result, int ply);
+TrainingSample unpackSample(const PackedSample& sample);
+
+/*
+	Buffered writer of one thread. Every thread writes its own file, so writers never wait for each other.
+*/
+
+class TrainingDataWriter
+{
+private:
+	std::ofstream file;
+	std::vector<PackedSample> buffer;
+	std::size_t bufferSamples;
+	std::uint64_t written;
+public:
+	explicit TrainingDataWriter(std::size_t bufferSamples = 4096);
+	~TrainingDataWriter();
+	TrainingDataWriter(const TrainingDataWriter&) = delete;
+	TrainingDataWriter& operator=(const TrainingDataWriter&) = delete;
+
+	// Samples are appended to what the file already holds
+	bool open(const std::string& path);
+	void add(const PackedSample& sample);
+	bool flush();
+
+	// Getters
+	std::uint64_t getWritten() const { return written; }
+};
+
+/*
+	Streams the samples of a set of files in shuffled order. The files are mapped and cut into blocks; blocks are
+	read in a random order into a buffer that is shuffled before it is handed out, so a pass touches every sample
+	once without ever holding more than the buffer in memory.
+*/
+
+class TrainingDataReader
+{
+private:
+	struct Block
+	{
+		int file;
+		std::size_t first;
+		std::size_t count;
+	};
+
+	std::deque<MappedFile> files;
+	std::vector<Block> blocks;
+	std::size_t nextBlock;
+	std::uint64_t sampleCount;
+
+	std::vector<PackedSample> buffer;
+	std::size_t bufferPosition;
+	std::size_t bufferSamples;
+	std::mt19937_64 rng;
+
+	bool fill();
+public:
+	explicit TrainingDataReader(std::size_t bufferSamples = 1 << 20, std::uint64_t seed = 0);
+
+	bool open(const std::vector<std::string>& paths);
+	// Starts the next pass, in a new order
+	void rewind();
+	// False once every sample of the pass was returned
+	bool next(PackedSample& sample);
+	bool next(TrainingSample& sample);
+
+	// Getters
+	std::uint64_t getSampleCount() const { return sampleCount; }
+};